@@ -13,6 +13,11 @@ macro(SetGlobalCompilerAndLinkerSettings)
         message(STATUS "Platform is 32-bit")
     endif(CMAKE_SIZEOF_VOID_P EQUAL 8)
 
+    # mesh kernel with 32-bit indices, must be the same for all modules using the mesh kernel
+    if(FREECAD_USE_MESH_COMPACT_INDICES)
+        add_definitions(-DMESH_COMPACT_INDICES)
+    endif(FREECAD_USE_MESH_COMPACT_INDICES)
+
     # check for mips64 platform
     if("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "mips64")
         message(STATUS "Architecture: mips64")
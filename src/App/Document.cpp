@@ -90,6 +90,12 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 
 #include <QCoreApplication>
 #include <QCryptographicHash>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 #include "AutoTransaction.h"
 #include "Document.h"
@@ -191,6 +197,10 @@ struct DocumentP
 #endif //USE_OLD_DAG
     std::multimap<const App::DocumentObject*,
         std::unique_ptr<App::DocumentObjectExecReturn> > _RecomputeLog;
+    // guards the recompute log and the undo transaction while objects are
+    // recomputed by worker threads
+    std::recursive_mutex recomputeMutex;
+    bool concurrentRecompute;
 
     DocumentP() {
         static std::random_device _RD;
@@ -213,6 +223,7 @@ struct DocumentP
         iUndoMode = 0;
         UndoMemSize = 0;
         UndoMaxStackSize = 20;
+        concurrentRecompute = false;
     }
 
     void addRecomputeLog(const char *why, App::DocumentObject *obj) {
@@ -228,11 +239,13 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which, std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error,true);
     }
 
     void clearRecomputeLog(const App::DocumentObject *obj=0) {
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         if(!obj)
             _RecomputeLog.clear();
         else
@@ -240,6 +253,7 @@ struct DocumentP
     }
 
     const char *findRecomputeLog(const App::DocumentObject *obj) {
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         auto range = _RecomputeLog.equal_range(obj);
         if(range.first == range.second)
             return 0;
@@ -255,8 +269,47 @@ struct DocumentP
     static partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
 };
 
+// Context of a thread recomputing an object on behalf of
+// Document::_recomputeConcurrently(). Any signal emitted by the object while
+// being recomputed is queued here and emitted later on the main thread.
+struct RecomputeWorkerContext
+{
+    std::vector<std::function<void()> > signals;
+};
+
+static thread_local RecomputeWorkerContext *_RecomputeWorker;
+
 } // namespace App
 
+namespace {
+class RecomputeRunnable : public QRunnable
+{
+public:
+    RecomputeRunnable(std::function<void()> &&func)
+        : func(std::move(func))
+    {
+    }
+    void run() override
+    {
+        func();
+    }
+
+private:
+    std::function<void()> func;
+};
+
+// A Python extension may run arbitrary Python code on execution
+bool hasPythonExtension(const App::DocumentObject *obj)
+{
+    auto vector = obj->getExtensionsDerivedFromType<App::DocumentObjectExtension>();
+    for(auto ext : vector) {
+        if (ext->isPythonExtension())
+            return true;
+    }
+    return false;
+}
+}
+
 PROPERTY_SOURCE(App::Document, App::PropertyContainer)
 
 bool Document::testStatus(Status pos) const
@@ -1507,9 +1560,15 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject *Who, const Property *What)
 {
-    if(Who->isDerivedFrom(App::DocumentObject::getClassTypeId()))
-        signalBeforeChangeObject(*static_cast<const App::DocumentObject*>(Who), *What);
+    if(Who->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
+        auto obj = static_cast<const App::DocumentObject*>(Who);
+        if(!_deferSignal([this,obj,What](){signalBeforeChangeObject(*obj, *What);}))
+            signalBeforeChangeObject(*obj, *What);
+    }
     if(!d->rollback && !_IsRelabeling) {
+        std::unique_lock<std::recursive_mutex> lock(d->recomputeMutex, std::defer_lock);
+        if(d->concurrentRecompute)
+            lock.lock();
         _checkTransaction(0,What,__LINE__);
         if (d->activeUndoTransaction)
             d->activeUndoTransaction->addObjectChange(Who,What);
@@ -1521,6 +1580,14 @@ void Document::onChangedProperty(const DocumentObject *Who, const Property *What
     signalChangedObject(*Who, *What);
 }
 
+bool Document::_deferSignal(std::function<void()> &&func)
+{
+    if(!_RecomputeWorker)
+        return false;
+    _RecomputeWorker->signals.push_back(std::move(func));
+    return true;
+}
+
 void Document::setTransactionMode(int iMode)
 {
     d->iTransactionMode = iMode;
@@ -3471,6 +3538,7 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
     ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
             "User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute",true);
+    bool concurrent = hGrp->GetBool("ConcurrentRecompute",false);
 
     std::set<App::DocumentObject *> filter;
     size_t idx = 0;
@@ -3484,6 +3552,11 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
             if(canAbort)
                 seq.reset(new Base::SequencerLauncher("Recompute...", topoSortedObjects.size()));
             FC_LOG("Recompute pass " << passes);
+            if(concurrent && passes==0) {
+                if(_recomputeConcurrently(topoSortedObjects,filter,seq.get(),hasError,objectCount) < 0)
+                    passes = 2;
+                idx = topoSortedObjects.size();
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if(!obj->getNameInDocument() || filter.find(obj)!=filter.end())
@@ -3563,6 +3636,250 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
 
 #endif // USE_OLD_DAG
 
+/*!
+  Recomputes the sorted objects \a objs like the first pass of recompute() but
+  dispatches the objects that have no pending dependencies to a thread pool.
+  Objects that cannot be recomputed concurrently (e.g. Python features) are
+  recomputed on the main thread while no worker is busy. The signals of the
+  objects are emitted on the main thread in the order of \a objs, and the
+  recomputed objects are purged only while no worker is busy.
+ */
+int Document::_recomputeConcurrently(const std::vector<App::DocumentObject*> &objs,
+        std::set<App::DocumentObject*> &filter, Base::SequencerLauncher *seq,
+        bool *hasError, int &objectCount)
+{
+    ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+    int threads = hGrp->GetInt("RecomputeThreads",0);
+    if(threads <= 0)
+        threads = QThread::idealThreadCount();
+
+    // build the dependency counts of the objects from their OutList
+    std::unordered_map<App::DocumentObject*, size_t> index;
+    for(size_t i=0; i<objs.size(); ++i)
+        index[objs[i]] = i;
+
+    std::vector<int> pending(objs.size(), 0);
+    std::vector<std::vector<size_t> > dependents(objs.size());
+    for(size_t i=0; i<objs.size(); ++i) {
+        auto outList = objs[i]->getOutList();
+        std::sort(outList.begin(), outList.end());
+        outList.erase(std::unique(outList.begin(), outList.end()), outList.end());
+        for(auto dep : outList) {
+            auto it = index.find(dep);
+            if(it == index.end() || it->second == i)
+                continue;
+            ++pending[i];
+            dependents[it->second].push_back(i);
+        }
+    }
+
+    enum State {Waiting, Running, Finished};
+    std::vector<State> states(objs.size(), Waiting);
+    std::vector<bool> recomputed(objs.size(), false);
+    std::vector<std::vector<std::function<void()> > > signals(objs.size());
+    std::deque<size_t> ready;
+    std::deque<size_t> serial;
+    std::vector<size_t> purge;
+    size_t numFinished = 0;
+    size_t numSignaled = 0;
+    int running = 0;
+    bool aborted = false;
+
+    // results posted by the worker threads
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<std::pair<size_t, int> > results;
+
+    for(size_t i=0; i<objs.size(); ++i) {
+        if(!pending[i])
+            ready.push_back(i);
+    }
+
+    // handle the result of a recomputed or skipped object on the main thread
+    auto finish = [&](size_t i, int res) {
+        auto obj = objs[i];
+        states[i] = Finished;
+        ++numFinished;
+        if(res) {
+            recomputed[i] = false;
+            if(hasError)
+                *hasError = true;
+            if(res < 0)
+                aborted = true;
+            // if something happened filter all object in its inListRecursive
+            obj->getInListEx(filter,true);
+            filter.insert(obj);
+        }
+        else if(obj->getNameInDocument() && !filter.count(obj)
+                && (obj->isTouched() || recomputed[i])) {
+            recomputed[i] = true;
+            // set all dependent object touched to force recompute, the
+            // object itself is purged after its signal in emitSignals()
+            for (auto inObjIt : obj->getInList())
+                inObjIt->enforceRecompute();
+        }
+        else {
+            recomputed[i] = false;
+        }
+
+        for(auto dep : dependents[i]) {
+            if(--pending[dep] == 0 && states[dep] == Waiting)
+                ready.push_back(dep);
+        }
+    };
+
+    // Emit the queued signals in the order of the sorted objects up to the
+    // first unfinished object. If 'all' is true the queues of all objects are
+    // emitted, which is done once the recompute is over, whatever the outcome.
+    auto emitSignals = [&](bool all) {
+        while(numSignaled<objs.size()) {
+            size_t i = numSignaled;
+            bool finished = states[i] == Finished;
+            if(!finished && !all)
+                break;
+            ++numSignaled;
+            auto queue = std::move(signals[i]);
+            for(auto &func : queue)
+                func();
+            if(finished && recomputed[i] && objs[i]->getNameInDocument()) {
+                signalRecomputedObject(*objs[i]);
+                // a dependent may still be running and read the status of
+                // the object, so it's purged once no worker is busy
+                purge.push_back(i);
+            }
+            if (seq && !all)
+                seq->next(true);
+        }
+    };
+
+    auto purgeTouched = [&]() {
+        for(auto i : purge) {
+            if(objs[i]->getNameInDocument())
+                objs[i]->purgeTouched();
+        }
+        purge.clear();
+    };
+
+    // wait for the busy workers to post their results, the workers may need
+    // the GIL to evaluate expressions
+    auto wait = [&](bool all) {
+        std::unique_ptr<Base::PyGILStateRelease> release;
+        if(PyGILState_Check())
+            release.reset(new Base::PyGILStateRelease);
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]() {
+            return all ? (int)results.size() == running : !results.empty();
+        });
+        std::vector<std::pair<size_t, int> > done(results.begin(), results.end());
+        results.clear();
+        running -= (int)done.size();
+        return done;
+    };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    d->concurrentRecompute = true;
+
+    try {
+        while(numFinished < objs.size()) {
+            if(!running)
+                purgeTouched();
+            while(!aborted && !ready.empty()) {
+                size_t i = ready.front();
+                ready.pop_front();
+                auto obj = objs[i];
+                if(!obj->getNameInDocument() || filter.count(obj)) {
+                    finish(i, 0);
+                    continue;
+                }
+                // ask the object if it should be recomputed
+                if(!obj->mustRecompute()) {
+                    finish(i, 0);
+                    continue;
+                }
+                ++objectCount;
+                recomputed[i] = true;
+                states[i] = Running;
+                if(!obj->canRecomputeConcurrently() || hasPythonExtension(obj)) {
+                    serial.push_back(i);
+                    continue;
+                }
+                ++running;
+                pool.start(new RecomputeRunnable([&, i]() {
+                    RecomputeWorkerContext context;
+                    _RecomputeWorker = &context;
+                    int res;
+                    try {
+                        res = _recomputeFeature(objs[i]);
+                    }
+                    catch (...) {
+                        // the result must be posted in any case, otherwise
+                        // the main thread waits forever
+                        FC_ERR("Unknown exception in " << objs[i]->getFullName() << " thrown");
+                        d->addRecomputeLog("Unknown exception!",objs[i]);
+                        res = 1;
+                    }
+                    _RecomputeWorker = nullptr;
+                    std::lock_guard<std::mutex> lock(mutex);
+                    signals[i] = std::move(context.signals);
+                    results.emplace_back(i, res);
+                    cond.notify_one();
+                }));
+            }
+
+            if(running) {
+                for(auto &v : wait(aborted))
+                    finish(v.first, v.second);
+                emitSignals(false);
+                continue;
+            }
+            if(aborted)
+                break;
+
+            if(!serial.empty()) {
+                size_t i = serial.front();
+                serial.pop_front();
+                finish(i, _recomputeFeature(objs[i]));
+                emitSignals(false);
+                continue;
+            }
+
+            if(ready.empty() && numFinished < objs.size()) {
+                // Nothing is ready because of a cyclic dependency. Continue
+                // with the next waiting object in the sorted order.
+                for(size_t i=0; i<objs.size(); ++i) {
+                    if(states[i] == Waiting) {
+                        FC_LOG("Cyclic dependency of " << objs[i]->getFullName());
+                        ready.push_back(i);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    catch (...) {
+        if(running) {
+            for(auto &v : wait(true)) {
+                states[v.first] = Finished;
+                if(v.second)
+                    recomputed[v.first] = false;
+            }
+        }
+        pool.waitForDone();
+        d->concurrentRecompute = false;
+        emitSignals(true);
+        purgeTouched();
+        throw;
+    }
+
+    pool.waitForDone();
+    d->concurrentRecompute = false;
+    emitSignals(true);
+    purgeTouched();
+    return aborted ? -1 : 0;
+}
+
 /*!
   Does almost the same as topologicalSort() until no object with an input degree of zero
   can be found. It then searches for objects with an output degree of zero until neither
@@ -33,6 +33,7 @@
 #include "PropertyLinks.h"
 
 #include <map>
+#include <set>
 #include <vector>
 #include <stack>
 #include <functional>
@@ -41,6 +42,7 @@
 
 namespace Base {
     class Writer;
+    class SequencerLauncher;
 }
 
 namespace App
@@ -511,6 +513,7 @@ public:
     friend class DocumentObject;
     friend class Transaction;
     friend class TransactionDocumentObject;
+    friend class DynamicProperty;
 
     /// Destruction
     virtual ~Document();
@@ -537,6 +540,14 @@ protected:
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /// helper which recomputes the objects on a thread pool where possible
+    /// @return 0 if succeeded, -1 if aborted by user.
+    int _recomputeConcurrently(const std::vector<DocumentObject*> &objs,
+            std::set<App::DocumentObject*> &filter, Base::SequencerLauncher *seq,
+            bool *hasError, int &objectCount);
+    /// queue a signal emitted by a recompute worker thread for the main thread
+    /// @return true if queued, false if not called from a worker thread.
+    static bool _deferSignal(std::function<void()> &&func);
     void _clearRedos();
 
     /// refresh the internal dependency graph
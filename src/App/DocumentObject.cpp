@@ -163,7 +163,7 @@ void DocumentObject::touch(bool noRecompute)
     if(!noRecompute)
         StatusBits.set(ObjectStatus::Enforce);
     StatusBits.set(ObjectStatus::Touch);
-    if (_pDoc)
+    if (_pDoc && !_pDoc->_deferSignal([this](){_pDoc->signalTouchedObject(*this);}))
         _pDoc->signalTouchedObject(*this);
 }
 
@@ -200,6 +200,11 @@ bool DocumentObject::mustRecompute(void) const
     return mustExecute() > 0;
 }
 
+bool DocumentObject::canRecomputeConcurrently() const
+{
+    return false;
+}
+
 short DocumentObject::mustExecute(void) const
 {
     if (ExpressionEngine.isTouched())
@@ -708,7 +713,8 @@ void DocumentObject::onBeforeChange(const Property* prop)
     if (_pDoc)
         onBeforeChangeProperty(_pDoc, prop);
 
-    signalBeforeChange(*this,*prop);
+    if (!_pDoc || !_pDoc->_deferSignal([this,prop](){signalBeforeChange(*this,*prop);}))
+        signalBeforeChange(*this,*prop);
 }
 
 /// get called by the container when a Property was changed
@@ -735,8 +741,10 @@ void DocumentObject::onChanged(const Property* prop)
     // if (_pDoc)
     //     _pDoc->onChangedProperty(this,prop);
 
-    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue())
-        _pDoc->signalRelabelObject(*this);
+    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()) {
+        if (!_pDoc->_deferSignal([this](){_pDoc->signalRelabelObject(*this);}))
+            _pDoc->signalRelabelObject(*this);
+    }
 
     // set object touched if it is an input property
     if (!testStatus(ObjectStatus::NoTouch) 
@@ -755,7 +763,14 @@ void DocumentObject::onChanged(const Property* prop)
     //call the parent for appropriate handling
     TransactionalObject::onChanged(prop);
 
-    // Now signal the view provider
+    // Now signal the view provider. If the object is recomputed by a worker
+    // thread the signals are queued and emitted later on the main thread.
+    if (_pDoc && _pDoc->_deferSignal([this,prop]() {
+                    _pDoc->onChangedProperty(this,prop);
+                    signalChanged(*this,*prop);
+                }))
+        return;
+
     if (_pDoc)
         _pDoc->onChangedProperty(this,prop);
 
@@ -1229,6 +1244,9 @@ bool DocumentObject::redirectSubName(std::ostringstream &, DocumentObject *, Doc
 
 void DocumentObject::onPropertyStatusChanged(const Property &prop, unsigned long oldStatus) {
     (void)oldStatus;
-    if(!Document::isAnyRestoring() && getNameInDocument() && getDocument())
-        getDocument()->signalChangePropertyEditor(*getDocument(),prop);
+    if(!Document::isAnyRestoring() && getNameInDocument() && getDocument()) {
+        auto doc = getDocument();
+        if(!doc->_deferSignal([doc,&prop](){doc->signalChangePropertyEditor(*doc,prop);}))
+            doc->signalChangePropertyEditor(*doc,prop);
+    }
 }
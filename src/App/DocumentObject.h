@@ -300,6 +300,17 @@ public:
      */
     virtual short mustExecute(void) const;
 
+    /** Check whether the object can be recomputed on a worker thread
+     *
+     * It is used by Document::recompute() if the concurrent recompute mode is
+     * enabled. Objects returning false are recomputed on the main thread
+     * while no other object is being recomputed. A type may only return true
+     * if its execute() neither changes other objects nor relies on state that
+     * is not thread safe. The default implementation returns false. Objects
+     * with a Python extension are always recomputed on the main thread.
+     */
+    virtual bool canRecomputeConcurrently() const;
+
     /** Recompute only this feature
      *
      * @param recursive: set to true to recompute any dependent objects as well
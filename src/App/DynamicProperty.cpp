@@ -30,6 +30,7 @@
 #include "Property.h"
 #include "PropertyContainer.h"
 #include "Application.h"
+#include "Document.h"
 #include "ExtensionContainer.h"
 #include <Base/Reader.h>
 #include <Base/Writer.h>
@@ -176,7 +177,8 @@ Property* DynamicProperty::addDynamicProperty(PropertyContainer &pc, const char*
     pcProperty->syncType(attr);
     pcProperty->StatusBits.set((size_t)Property::PropDynamic);
 
-    GetApplication().signalAppendDynamicProperty(*pcProperty);
+    if (!Document::_deferSignal([pcProperty](){GetApplication().signalAppendDynamicProperty(*pcProperty);}))
+        GetApplication().signalAppendDynamicProperty(*pcProperty);
 
     return pcProperty;
 }
@@ -213,6 +215,11 @@ bool DynamicProperty::removeDynamicProperty(const char* name)
             throw Base::RuntimeError("property is locked");
         else if(!it->property->testStatus(Property::PropDynamic))
             throw Base::RuntimeError("property is not dynamic");
+        // The signal of a recompute worker thread is emitted on the main
+        // thread, so the property is removed there as well
+        std::string propName(name);
+        if (Document::_deferSignal([this,propName](){removeDynamicProperty(propName.c_str());}))
+            return true;
         Property *prop = it->property;
         GetApplication().signalRemoveDynamicProperty(*prop);
         Property::destroy(prop);
@@ -53,6 +53,7 @@
 #include <stdio.h>
 #include <stack>
 #include <deque>
+#include <atomic>
 #include <algorithm>
 #include "ExpressionParser.h"
 #include <Base/Unit.h>
@@ -1187,6 +1188,12 @@ Expression* Expression::eval() const {
     return expressionFromPy(owner,getPyValue());
 }
 
+bool Expression::compile(ExpressionProgram &program) const {
+    if(components.size())
+        return false;
+    return _compile(program);
+}
+
 bool Expression::isSame(const Expression &other) const {
     if(&other == this)
         return true;
@@ -1315,6 +1322,19 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_compile(ExpressionProgram &program) const {
+    // Type the constant the same way as pyFromQuantity()
+    typedef ExpressionProgram::Value Value;
+    long l;
+    if(!quantity.getUnit().isEmpty())
+        program.emitConstant(Value(Value::Quantity,quantity));
+    else if(essentiallyInteger(quantity.getValue(),l))
+        program.emitConstant(Value(Value::Integer,quantity));
+    else
+        program.emitConstant(Value(Value::Float,quantity));
+    return true;
+}
+
 //
 // NumberExpression class
 //
@@ -1555,6 +1575,63 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+bool OperatorExpression::_compile(ExpressionProgram &program) const {
+    ExpressionProgram::OpCode code;
+    switch(op) {
+    case POS:
+        code = ExpressionProgram::Positive;
+        break;
+    case NEG:
+        code = ExpressionProgram::Negative;
+        break;
+    case ADD:
+        code = ExpressionProgram::Add;
+        break;
+    case SUB:
+        code = ExpressionProgram::Subtract;
+        break;
+    case MUL:
+    case UNIT:
+        code = ExpressionProgram::Multiply;
+        break;
+    case DIV:
+        code = ExpressionProgram::Divide;
+        break;
+    case POW:
+        code = ExpressionProgram::Power;
+        break;
+    case EQ:
+        code = ExpressionProgram::Equal;
+        break;
+    case NEQ:
+        code = ExpressionProgram::NotEqual;
+        break;
+    case LT:
+        code = ExpressionProgram::Less;
+        break;
+    case GT:
+        code = ExpressionProgram::Greater;
+        break;
+    case LTE:
+        code = ExpressionProgram::LessEqual;
+        break;
+    case GTE:
+        code = ExpressionProgram::GreaterEqual;
+        break;
+    default:
+        // MOD also formats strings, leave it to Python
+        return false;
+    }
+    if(!left->compile(program))
+        return false;
+    if(code!=ExpressionProgram::Positive && code!=ExpressionProgram::Negative) {
+        if(!right->compile(program))
+            return false;
+    }
+    program.emit(code);
+    return true;
+}
+
 /**
   * Simplify the expression. For OperatorExpressions, we return a NumberExpression if
   * both the left and right side can be simplified to NumberExpressions. In this case
@@ -2094,20 +2171,30 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         return res;
     }
 
-    Py::Object e1 = args[0]->getPyValue();
-    Quantity v1 = pyToQuantity(e1,expr,"Invalid first argument.");
-    Py::Object e2;
-    Quantity v2;
-    if(args.size()>1) {
-        e2 = args[1]->getPyValue();
-        v2 = pyToQuantity(e2,expr,"Invalid second argument.");
-    }
-    Py::Object e3;
-    Quantity v3;
-    if(args.size()>2) {
-        e3 = args[2]->getPyValue();
-        v3 = pyToQuantity(e3,expr,"Invalid third argument.");
-    }
+    Quantity values[3];
+    values[0] = pyToQuantity(args[0]->getPyValue(),expr,"Invalid first argument.");
+    if(args.size()>1)
+        values[1] = pyToQuantity(args[1]->getPyValue(),expr,"Invalid second argument.");
+    if(args.size()>2)
+        values[2] = pyToQuantity(args[2]->getPyValue(),expr,"Invalid third argument.");
+
+    Quantity res = evaluateQuantity(expr, f, values, std::min<size_t>(args.size(), 3));
+    return Py::asObject(new QuantityPy(new Quantity(res)));
+}
+
+/**
+  * Evaluate the scalar function \a f for the \a count quantities in \a args.
+  * It is shared by the Python evaluation and ExpressionProgram.
+  */
+
+Quantity FunctionExpression::evaluateQuantity(const Expression *expr, int f,
+        const Quantity *args, size_t count)
+{
+    const Quantity &v1 = args[0];
+    const Quantity v2 = count > 1 ? args[1] : Quantity();
+    const Quantity v3 = count > 2 ? args[2] : Quantity();
+    bool hasArg2 = count > 1;
+    bool hasArg3 = count > 2;
 
     double output;
     Unit unit;
@@ -2178,7 +2265,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case ATAN2:
-        if (e2.isNone())
+        if (!hasArg2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2187,12 +2274,12 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / M_PI;
         break;
     case MOD:
-        if (e2.isNone())
+        if (!hasArg2)
             _EXPR_THROW("Invalid second argument.",expr);
         unit = v1.getUnit() / v2.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (!hasArg2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.getUnit().isEmpty())
@@ -2210,14 +2297,12 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (!hasArg2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (hasArg3) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
@@ -2284,11 +2369,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (hasArg3 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (hasArg3 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2307,13 +2392,25 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         _EXPR_THROW("Unknown function: " << f,expr);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
     return evaluate(this,f,args);
 }
 
+bool FunctionExpression::_compile(ExpressionProgram &program) const {
+    // Only the scalar functions handled by evaluateQuantity()
+    if(f<ACOS || f>CATH || args.empty() || args.size()>3)
+        return false;
+    for(auto arg : args) {
+        if(!arg->compile(program))
+            return false;
+    }
+    program.emit(ExpressionProgram::Call,f,(int)args.size());
+    return true;
+}
+
 /**
   * Try to simplify the expression, i.e calculate all constant expressions.
   *
@@ -2567,6 +2664,14 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+bool VariableExpression::_compile(ExpressionProgram &program) const {
+    // Only plain property references, without sub-object or attribute access
+    if(var.numSubComponents()!=1 || var.getSubObjectName().size())
+        return false;
+    program.emitVariable(var);
+    return true;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -2841,6 +2946,20 @@ Py::Object ConditionalExpression::_getPyValue() const {
         return falseExpr->getPyValue();
 }
 
+bool ConditionalExpression::_compile(ExpressionProgram &program) const {
+    if(!condition->compile(program))
+        return false;
+    int jumpFalse = program.emit(ExpressionProgram::JumpIfFalse);
+    if(!trueExpr->compile(program))
+        return false;
+    int jumpEnd = program.emit(ExpressionProgram::Jump);
+    program.patch(jumpFalse);
+    if(!falseExpr->compile(program))
+        return false;
+    program.patch(jumpEnd);
+    return true;
+}
+
 Expression *ConditionalExpression::simplify() const
 {
     std::unique_ptr<Expression> e(condition->simplify());
@@ -2927,6 +3046,19 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_compile(ExpressionProgram &program) const {
+    typedef ExpressionProgram::Value Value;
+    if(strcmp(name,"None")==0)
+        return false;
+    else if(strcmp(name,"True")==0)
+        program.emitConstant(Value(Value::Boolean,Quantity(1.0)));
+    else if(strcmp(name,"False")==0)
+        program.emitConstant(Value(Value::Boolean,Quantity(0.0)));
+    else
+        return NumberExpression::_compile(program);
+    return true;
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
@@ -3102,6 +3234,386 @@ void RangeExpression::_offsetCells(int rowOffset, int colOffset, ExpressionVisit
 }
 
 
+////////////////////////////////////////////////////////////////////////////////////
+
+// Revision of the document structure, i.e. objects, dynamic properties and
+// labels. ExpressionProgram resolves its variables again on change.
+static std::atomic<unsigned long> _ProgramRevision(1);
+
+static bool connectProgramSignals() {
+    auto &app = GetApplication();
+    auto bump = []() {++_ProgramRevision;};
+    app.signalNewObject.connect([bump](const DocumentObject &) {bump();});
+    app.signalDeletedObject.connect([bump](const DocumentObject &) {bump();});
+    app.signalRelabelObject.connect([bump](const DocumentObject &) {bump();});
+    app.signalAppendDynamicProperty.connect([bump](const Property &) {bump();});
+    app.signalRemoveDynamicProperty.connect([bump](const Property &) {bump();});
+    app.signalNewDocument.connect([bump](const Document &, bool) {bump();});
+    app.signalDeleteDocument.connect([bump](const Document &) {bump();});
+    app.signalRelabelDocument.connect([bump](const Document &) {bump();});
+    app.signalFinishRestoreDocument.connect([bump](const Document &) {bump();});
+    app.signalUndo.connect(bump);
+    app.signalRedo.connect(bump);
+    return true;
+}
+
+// Largest integer a double holds exactly. Integer results beyond that are
+// left to Python, which uses arbitrary precision.
+static const double _MaxExactInteger = 9007199254740992.0;
+
+typedef ExpressionProgram::Value ProgramValue;
+
+static void unaryOp(int op, ProgramValue &a) {
+    if(op == ExpressionProgram::Negative)
+        a.quantity = -a.quantity;
+    if(a.type == ProgramValue::Boolean)
+        a.type = ProgramValue::Integer;
+}
+
+static bool compareOp(int op, ProgramValue &a, const ProgramValue &b) {
+    bool res;
+    if(a.type==ProgramValue::Quantity && b.type==ProgramValue::Quantity) {
+        // Same as QuantityPy::richCompare(), which refuses to order
+        // quantities of different units
+        const Quantity &qa = a.quantity;
+        const Quantity &qb = b.quantity;
+        if(qa.getUnit()!=qb.getUnit() && op!=ExpressionProgram::Equal && op!=ExpressionProgram::NotEqual)
+            return false;
+        switch(op) {
+        case ExpressionProgram::Equal:
+            res = qa == qb;
+            break;
+        case ExpressionProgram::NotEqual:
+            res = !(qa == qb);
+            break;
+        case ExpressionProgram::Less:
+            res = qa < qb;
+            break;
+        case ExpressionProgram::LessEqual:
+            res = (qa < qb) || (qa == qb);
+            break;
+        case ExpressionProgram::Greater:
+            res = !(qa < qb) && !(qa == qb);
+            break;
+        default:
+            res = !(qa < qb);
+            break;
+        }
+    } else {
+        double va = a.quantity.getValue();
+        double vb = b.quantity.getValue();
+        switch(op) {
+        case ExpressionProgram::Equal:
+            res = va == vb;
+            break;
+        case ExpressionProgram::NotEqual:
+            res = va != vb;
+            break;
+        case ExpressionProgram::Less:
+            res = va < vb;
+            break;
+        case ExpressionProgram::LessEqual:
+            res = va <= vb;
+            break;
+        case ExpressionProgram::Greater:
+            res = va > vb;
+            break;
+        default:
+            res = va >= vb;
+            break;
+        }
+    }
+    a.type = ProgramValue::Boolean;
+    a.quantity = Quantity(res?1.0:0.0);
+    return true;
+}
+
+static bool binaryOp(int op, ProgramValue &a, const ProgramValue &b) {
+    if(op >= ExpressionProgram::Equal && op <= ExpressionProgram::GreaterEqual)
+        return compareOp(op,a,b);
+
+    double va = a.quantity.getValue();
+    double vb = b.quantity.getValue();
+
+    if(a.type==ProgramValue::Quantity || b.type==ProgramValue::Quantity) {
+        // Same as the QuantityPy number handlers. A number is a quantity
+        // without unit there, so adding it to a length is a unit mismatch
+        // that is left to Python to report.
+        switch(op) {
+        case ExpressionProgram::Add:
+        case ExpressionProgram::Subtract:
+            if(a.quantity.getUnit() != b.quantity.getUnit())
+                return false;
+            break;
+        default:
+            break;
+        }
+        switch(op) {
+        case ExpressionProgram::Add:
+            a.quantity = a.quantity + b.quantity;
+            break;
+        case ExpressionProgram::Subtract:
+            a.quantity = a.quantity - b.quantity;
+            break;
+        case ExpressionProgram::Multiply:
+            a.quantity = a.quantity * b.quantity;
+            break;
+        case ExpressionProgram::Divide:
+            if(vb == 0.0)
+                return false;
+            a.quantity = a.quantity / b.quantity;
+            break;
+        case ExpressionProgram::Power:
+            // Python refuses a number raised to a quantity
+            if(a.type != ProgramValue::Quantity)
+                return false;
+            if(b.type == ProgramValue::Quantity)
+                a.quantity = a.quantity.pow(b.quantity);
+            else
+                a.quantity = a.quantity.pow(vb);
+            break;
+        default:
+            return false;
+        }
+        a.type = ProgramValue::Quantity;
+        return true;
+    }
+
+    // Booleans behave as integers in Python arithmetic
+    bool integer = a.type!=ProgramValue::Float && b.type!=ProgramValue::Float;
+    if(integer && (std::fabs(va)>_MaxExactInteger || std::fabs(vb)>_MaxExactInteger))
+        return false;
+
+    double res;
+    switch(op) {
+    case ExpressionProgram::Add:
+        res = va + vb;
+        break;
+    case ExpressionProgram::Subtract:
+        res = va - vb;
+        break;
+    case ExpressionProgram::Multiply:
+        res = va * vb;
+        break;
+    case ExpressionProgram::Divide:
+        if(vb == 0.0)
+            return false;
+        res = va / vb;
+        integer = false;
+        break;
+    case ExpressionProgram::Power:
+        // Leave division by zero and complex results to Python
+        if(va == 0.0 && vb < 0.0)
+            return false;
+        if(va < 0.0 && vb != std::floor(vb))
+            return false;
+        if(vb < 0.0)
+            integer = false;
+        res = std::pow(va,vb);
+        if(!std::isfinite(res))
+            return false;
+        break;
+    default:
+        return false;
+    }
+    if(integer) {
+        if(std::fabs(res) > _MaxExactInteger)
+            return false;
+        a.type = ProgramValue::Integer;
+    } else
+        a.type = ProgramValue::Float;
+    a.quantity = Quantity(res);
+    return true;
+}
+
+ExpressionProgram::ExpressionProgram(const Expression *expr)
+    : expression(expr), revision(0), depth(0), maxDepth(0), valid(false)
+{
+    static bool inited = connectProgramSignals();
+    (void)inited;
+
+    if(expr && expr->compile(*this)) {
+        valid = true;
+        stack.resize(maxDepth);
+    } else {
+        code.clear();
+        constants.clear();
+        variables.clear();
+    }
+}
+
+int ExpressionProgram::emit(OpCode op, int arg, int argc) {
+    switch(op) {
+    case PushConstant:
+    case PushVariable:
+        ++depth;
+        break;
+    case Positive:
+    case Negative:
+    case Jump:
+        break;
+    case Call:
+        depth -= argc - 1;
+        break;
+    default:
+        --depth;
+        break;
+    }
+    // The depth is counted across both branches of a conditional, which
+    // overestimates the stack needed, but never underestimates it.
+    maxDepth = std::max(maxDepth,depth);
+    Instruction instruction;
+    instruction.op = op;
+    instruction.arg = arg;
+    instruction.argc = argc;
+    code.push_back(instruction);
+    return (int)code.size()-1;
+}
+
+void ExpressionProgram::emitConstant(const Value &value) {
+    constants.push_back(value);
+    emit(PushConstant,(int)constants.size()-1);
+}
+
+void ExpressionProgram::emitVariable(const ObjectIdentifier &path) {
+    Variable var;
+    var.path = path;
+    var.prop = 0;
+    var.type = Value::Integer;
+    variables.push_back(var);
+    emit(PushVariable,(int)variables.size()-1);
+}
+
+void ExpressionProgram::patch(int index) {
+    assert(index>=0 && index<(int)code.size());
+    code[index].arg = (int)code.size();
+}
+
+bool ExpressionProgram::bind() const {
+    unsigned long rev = _ProgramRevision;
+    if(rev == revision)
+        return true;
+    for(auto &var : variables) {
+        var.prop = 0;
+        int ptype;
+        Property *prop = var.path.getProperty(&ptype);
+        if(!prop || ptype)
+            return false;
+        if(prop->isDerivedFrom(PropertyQuantity::getClassTypeId()))
+            var.type = Value::Quantity;
+        else if(prop->isDerivedFrom(PropertyFloat::getClassTypeId()))
+            var.type = Value::Float;
+        else if(prop->isDerivedFrom(PropertyInteger::getClassTypeId()))
+            var.type = Value::Integer;
+        else if(prop->isDerivedFrom(PropertyBool::getClassTypeId()))
+            var.type = Value::Boolean;
+        else
+            return false;
+        var.prop = prop;
+    }
+    revision = rev;
+    return true;
+}
+
+bool ExpressionProgram::run(Value &result) const {
+    size_t sp = 0;
+    int pc = 0;
+    int end = (int)code.size();
+    while(pc < end) {
+        const Instruction &instruction = code[pc++];
+        switch(instruction.op) {
+        case PushConstant:
+            stack[sp++] = constants[instruction.arg];
+            break;
+        case PushVariable: {
+            const Variable &var = variables[instruction.arg];
+            Value &value = stack[sp++];
+            value.type = var.type;
+            switch(var.type) {
+            case Value::Quantity:
+                value.quantity = static_cast<const PropertyQuantity*>(var.prop)->getQuantityValue();
+                break;
+            case Value::Float:
+                value.quantity = Quantity(static_cast<const PropertyFloat*>(var.prop)->getValue());
+                break;
+            case Value::Integer: {
+                long l = static_cast<const PropertyInteger*>(var.prop)->getValue();
+                if(std::fabs((double)l) > _MaxExactInteger)
+                    return false;
+                value.quantity = Quantity((double)l);
+                break;
+            }
+            case Value::Boolean:
+                value.quantity = Quantity(static_cast<const PropertyBool*>(var.prop)->getValue()?1.0:0.0);
+                break;
+            }
+            break;
+        }
+        case Positive:
+        case Negative:
+            unaryOp(instruction.op,stack[sp-1]);
+            break;
+        case Jump:
+            pc = instruction.arg;
+            break;
+        case JumpIfFalse:
+            --sp;
+            if(stack[sp].quantity.getValue() == 0.0)
+                pc = instruction.arg;
+            break;
+        case Call: {
+            Quantity args[3];
+            sp -= instruction.argc;
+            for(int i=0;i<instruction.argc;++i)
+                args[i] = stack[sp+i].quantity;
+            Value &value = stack[sp++];
+            value.quantity = FunctionExpression::evaluateQuantity(
+                    expression,instruction.arg,args,instruction.argc);
+            value.type = Value::Quantity;
+            break;
+        }
+        default:
+            --sp;
+            if(!binaryOp(instruction.op,stack[sp-1],stack[sp]))
+                return false;
+            break;
+        }
+    }
+    assert(sp == 1);
+    result = stack[0];
+    return true;
+}
+
+bool ExpressionProgram::evaluate(App::any &value) const {
+    if(!valid)
+        return false;
+    try {
+        if(!bind())
+            return false;
+        Value result;
+        if(!run(result))
+            return false;
+        switch(result.type) {
+        case Value::Quantity:
+            value = App::any(result.quantity);
+            break;
+        case Value::Float:
+            value = App::any(result.quantity.getValue());
+            break;
+        case Value::Boolean:
+            value = App::any(result.quantity.getValue() != 0.0);
+            break;
+        default:
+            value = App::any(static_cast<long>(result.quantity.getValue()));
+            break;
+        }
+        return true;
+    } catch (Base::Exception &) {
+        // Let Python evaluate the expression again to report the error
+        return false;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 
 static Base::XMLReader *_Reader = 0;
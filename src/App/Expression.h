@@ -44,6 +44,7 @@ namespace App  {
 
 class DocumentObject;
 class Expression;
+class ExpressionProgram;
 class Document;
 
 typedef std::unique_ptr<Expression> ExpressionPtr;
@@ -182,6 +183,12 @@ public:
 
     bool isSame(const Expression &other) const;
 
+    /** Append the instructions of this expression to a program
+     *
+     * @return false if the expression cannot be evaluated without Python
+     */
+    bool compile(ExpressionProgram &program) const;
+
     friend ExpressionVisitor;
 
 protected:
@@ -208,6 +215,7 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _compile(ExpressionProgram &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
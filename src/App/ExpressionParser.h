@@ -95,6 +95,7 @@ protected:
     virtual Expression * _copy() const override;
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
     virtual Py::Object _getPyValue() const override;
+    virtual bool _compile(ExpressionProgram &program) const override;
 
 protected:
     mutable PyObject *cache = 0;
@@ -137,6 +138,7 @@ public:
 
 protected:
     virtual Py::Object _getPyValue() const override;
+    virtual bool _compile(ExpressionProgram &program) const override;
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
     virtual Expression* _copy() const override;
 
@@ -191,6 +193,8 @@ protected:
 
     virtual Py::Object _getPyValue() const override;
 
+    virtual bool _compile(ExpressionProgram &program) const override;
+
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
 
     virtual void _visit(ExpressionVisitor & v) override;
@@ -224,6 +228,7 @@ protected:
     virtual void _visit(ExpressionVisitor & v) override;
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
     virtual Py::Object _getPyValue() const override;
+    virtual bool _compile(ExpressionProgram &program) const override;
 
 protected:
 
@@ -298,9 +303,13 @@ public:
 
     static Py::Object evaluate(const Expression *owner, int type, const std::vector<Expression*> &args);
 
+    static Base::Quantity evaluateQuantity(const Expression *owner, int type,
+            const Base::Quantity *args, size_t count);
+
 protected:
     static Py::Object evalAggregate(const Expression *owner, int type, const std::vector<Expression*> &args);
     virtual Py::Object _getPyValue() const override;
+    virtual bool _compile(ExpressionProgram &program) const override;
     virtual Expression * _copy() const override;
     virtual void _visit(ExpressionVisitor & v) override;
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
@@ -342,6 +351,7 @@ public:
 protected:
     virtual Expression * _copy() const override;
     virtual Py::Object _getPyValue() const override;
+    virtual bool _compile(ExpressionProgram &program) const override;
     virtual void _toString(std::ostream &ss, bool persistent, int indent) const override;
     virtual bool _isIndexable() const override;
     virtual void _getDeps(ExpressionDeps &) const override;
@@ -445,6 +455,111 @@ protected:
     std::string end;
 };
 
+/**
+  * Class holding an expression lowered to a compact instruction stream.
+  *
+  * The program is evaluated on a stack of Base::Quantity values without
+  * calling into Python, and therefore without the GIL. Only numbers,
+  * constants, references to numeric properties, arithmetic and comparison
+  * operators, conditionals and the scalar functions can be compiled. The
+  * caller falls back to Expression::getValueAsAny() if the expression cannot
+  * be compiled, or if evaluate() returns false for some other reason, e.g.
+  * to report an error.
+  *
+  * The properties referenced by the program are resolved on first use and
+  * only resolved again when objects, properties or labels are added, removed
+  * or changed anywhere in the application.
+  */
+
+class AppExport ExpressionProgram {
+public:
+    enum OpCode {
+        PushConstant,   /**< Push constant arg */
+        PushVariable,   /**< Push the value of variable arg */
+        Positive,
+        Negative,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Equal,
+        NotEqual,
+        Less,
+        Greater,
+        LessEqual,
+        GreaterEqual,
+        Jump,           /**< Continue at instruction arg */
+        JumpIfFalse,    /**< Pop a value and continue at instruction arg if it is false */
+        Call,           /**< Call function arg with argc arguments */
+    };
+
+    /// A value on the stack, its type follows the Python type of the value
+    struct Value {
+        enum Type {
+            Integer,
+            Float,
+            Boolean,
+            Quantity,
+        };
+        Type type;
+        Base::Quantity quantity;
+
+        Value(Type t=Integer, const Base::Quantity &q=Base::Quantity())
+            : type(t), quantity(q)
+        {}
+    };
+
+    ExpressionProgram(const Expression *expr);
+
+    /// Check if the expression has been compiled
+    bool isValid() const { return valid; }
+
+    /** Evaluate the program
+     *
+     * @param value: returns the value as Expression::getValueAsAny() does
+     * @return false if the expression has to be evaluated by Python instead
+     */
+    bool evaluate(App::any &value) const;
+
+    /** @name Functions used by Expression::compile() */
+    //@{
+    int emit(OpCode op, int arg=0, int argc=0);
+    void emitConstant(const Value &value);
+    void emitVariable(const ObjectIdentifier &path);
+    /// Let the jump instruction at index continue after the last instruction
+    void patch(int index);
+    const Expression *getExpression() const { return expression; }
+    //@}
+
+private:
+    bool bind() const;
+    bool run(Value &result) const;
+
+private:
+    struct Instruction {
+        OpCode op;
+        int arg;
+        int argc;
+    };
+
+    struct Variable {
+        ObjectIdentifier path;
+        mutable const Property *prop;
+        mutable Value::Type type;
+    };
+
+    const Expression *expression;
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::vector<Variable> variables;
+    mutable std::vector<Value> stack;
+    mutable unsigned long revision;
+    int depth;
+    int maxDepth;
+    bool valid;
+};
+
 namespace ExpressionParser {
 AppExport Expression * parse(const App::DocumentObject *owner, const char *buffer);
 AppExport UnitExpression * parseUnit(const App::DocumentObject *owner, const char *buffer);
@@ -29,6 +29,7 @@
 #include <Base/Reader.h>
 #include <Base/Tools.h>
 #include "Expression.h"
+#include "ExpressionParser.h"
 #include "ExpressionVisitors.h"
 #include "PropertyExpressionEngine.h"
 #include "PropertyStandard.h"
@@ -59,6 +60,12 @@ PropertyExpressionContainer::~PropertyExpressionContainer() {
     _ExprContainers.erase(this);
 }
 
+static bool useNativeEvaluation() {
+    static bool enabled = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Expression")->GetBool("NativeEvaluation", true);
+    return enabled;
+}
+
 void PropertyExpressionContainer::slotRelabelDocument(const App::Document &doc) {
     // For use a private _ExprContainers to track all living
     // PropertyExpressionContainer including those inside undo/redo stack,
@@ -119,6 +126,10 @@ Property *PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    // The expressions may have been modified in place, compile them again
+    for(auto &e : expressions)
+        e.second.program.reset();
+
     App::DocumentObject *owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if(!owner || !owner->getNameInDocument() || owner->isRestoring() || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -551,8 +562,13 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
         /* Set value of property */
         App::any value;
         try {
-            // Evaluate expression
-            value = expressions[*it].expression->getValueAsAny();
+            // Evaluate expression, natively if possible, so that it does not
+            // need the Python interpreter
+            ExpressionInfo &info = expressions[*it];
+            if(!info.program && useNativeEvaluation())
+                info.program = std::make_shared<ExpressionProgram>(info.expression.get());
+            if(!info.program || !info.program->evaluate(value))
+                value = info.expression->getValueAsAny();
             if(option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore)) {
                 if(isAnyEqual(value, prop->getPathValue(*it)))
                     continue;
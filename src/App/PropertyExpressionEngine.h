@@ -85,6 +85,7 @@ public:
 
     struct ExpressionInfo {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        std::shared_ptr<App::ExpressionProgram> program; /**< Compiled expression, created on first execution */
 
         ExpressionInfo(std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>()) {
             this->expression = expression;
@@ -92,10 +93,12 @@ public:
 
         ExpressionInfo(const ExpressionInfo & other) {
             expression = other.expression;
+            program = other.program;
         }
 
         ExpressionInfo & operator=(const ExpressionInfo & other) {
             expression = other.expression;
+            program = other.program;
             return *this;
         }
     };
@@ -154,6 +154,8 @@ void PropertyInteger::setPathValue(const ObjectIdentifier &path, const boost::an
         setValue(boost::any_cast<long>(value));
     else if (value.type() == typeid(int))
         setValue(boost::any_cast<int>(value));
+    else if (value.type() == typeid(bool))
+        setValue(boost::any_cast<bool>(value) ? 1 : 0);
     else if (value.type() == typeid(double))
         setValue(boost::math::round(boost::any_cast<double>(value)));
     else if (value.type() == typeid(float))
@@ -1072,6 +1074,8 @@ void PropertyFloat::setPathValue(const ObjectIdentifier &path, const boost::any
         setValue(boost::any_cast<unsigned long>(value));
     else if (value.type() == typeid(int))
         setValue(boost::any_cast<int>(value));
+    else if (value.type() == typeid(bool))
+        setValue(boost::any_cast<bool>(value) ? 1.0 : 0.0);
     else if (value.type() == typeid(double))
         setValue(boost::any_cast<double>(value));
     else if (value.type() == typeid(float))
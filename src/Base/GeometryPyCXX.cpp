@@ -23,6 +23,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <cstring>
 # include <sstream>
 #endif
 
@@ -90,6 +91,86 @@ Base::Vector3d Py::Vector::toVector() const
 
 namespace Base {
 
+std::vector<Vector3d> getVectorsFromPyObject(PyObject* o)
+{
+    std::vector<Vector3d> points;
+
+    if (PyObject_CheckBuffer(o)) {
+        Py_buffer view;
+        if (PyObject_GetBuffer(o, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+            throw Py::Exception();
+
+        // skip the byte order character of native or little endian data
+        const char* format = view.format ? view.format : "B";
+        if (*format == '@' || *format == '=' || *format == '<')
+            format++;
+        bool isFloat = (strcmp(format, "f") == 0);
+        bool isDouble = (strcmp(format, "d") == 0);
+        Py_ssize_t count = view.itemsize > 0 ? view.len / view.itemsize : 0;
+        bool hasRows = (view.ndim == 2 && view.shape[1] == 3) || (view.ndim == 1 && count % 3 == 0);
+        if (!(isFloat || isDouble) || !hasRows) {
+            PyBuffer_Release(&view);
+            throw Py::TypeError("buffer must hold float or double values of shape (n,3)");
+        }
+
+        points.resize(static_cast<std::size_t>(count / 3));
+        for (std::size_t i=0; i<points.size(); i++) {
+            if (isFloat) {
+                const float* v = static_cast<const float*>(view.buf) + 3*i;
+                points[i].Set(v[0], v[1], v[2]);
+            }
+            else {
+                const double* v = static_cast<const double*>(view.buf) + 3*i;
+                points[i].Set(v[0], v[1], v[2]);
+            }
+        }
+
+        PyBuffer_Release(&view);
+        return points;
+    }
+
+    Py::Sequence list(o);
+    points.reserve(list.size());
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        Py::Vector v(*it);
+        points.push_back(v.toVector());
+    }
+
+    return points;
+}
+
+Py::Object createBufferView(const char* format, std::size_t itemSize,
+                            std::size_t rows, std::size_t cols, void*& data)
+{
+    // memoryview.cast() doesn't accept a zero in the shape, so an empty view is
+    // cut from a view of one row
+    std::size_t numRows = rows > 0 ? rows : 1;
+    std::size_t numItems = cols > 0 ? numRows * cols : numRows;
+    Py::Object bytes(PyByteArray_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(numItems * itemSize)), true);
+    data = PyByteArray_AS_STRING(bytes.ptr());
+
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    PyObject* shaped;
+    if (cols > 0) {
+        shaped = PyObject_CallMethod(view.ptr(), "cast", "s(nn)", format,
+                                     static_cast<Py_ssize_t>(numRows), static_cast<Py_ssize_t>(cols));
+    }
+    else {
+        shaped = PyObject_CallMethod(view.ptr(), "cast", "s(n)", format,
+                                     static_cast<Py_ssize_t>(numRows));
+    }
+    if (!shaped)
+        throw Py::Exception();
+    Py::Object result(Py::asObject(shaped));
+    if (rows == 0) {
+        PyObject* empty = PySequence_GetSlice(result.ptr(), 0, 0);
+        if (!empty)
+            throw Py::Exception();
+        result = Py::asObject(empty);
+    }
+    return result;
+}
+
 Vector2dPy::Vector2dPy(Py::PythonClassInstance *self, Py::Tuple &args, Py::Dict &kwds)
     : Py::PythonClass<Vector2dPy>::PythonClass(self, args, kwds)
 {
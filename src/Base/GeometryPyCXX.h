@@ -47,6 +47,20 @@ inline Vector3<T> getVectorFromTuple(PyObject* o)
     return Vector3<T>(x,y,z);
 }
 
+/** Converts a sequence of vectors or tuples to a list of points. Objects that provide
+ * a C-contiguous buffer of float or double values with three values per row, like a
+ * numpy array of shape (n,3), are read directly from the buffer.
+ */
+BaseExport std::vector<Vector3d> getVectorsFromPyObject(PyObject* o);
+
+/** Creates a writable buffer for \a rows x \a cols items of the struct format \a format
+ * and returns a memoryview of it with this shape, which numpy can use without a copy.
+ * If \a cols is zero the view is one-dimensional. \a rows may be zero, then \a data
+ * points to unused memory of one row.
+ */
+BaseExport Py::Object createBufferView(const char* format, std::size_t itemSize,
+                                       std::size_t rows, std::size_t cols, void*& data);
+
 class BaseExport Vector2dPy : public Py::PythonClass<Vector2dPy>
 {
 public:
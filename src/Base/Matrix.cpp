@@ -32,6 +32,11 @@
 #include "Matrix.h"
 #include "Converter.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define FC_MATRIX_SSE2
+#endif
+
 using namespace Base;
 
 Matrix4D::Matrix4D (void)
@@ -79,6 +84,60 @@ Matrix4D::Matrix4D (const Matrix4D& rclMtrx)
     (*this) = rclMtrx;
 }
 
+namespace {
+// Transforms a vector with the upper three rows of the matrix. The terms are added in
+// the same order as in Matrix4D::multVec so that the results are identical.
+template <class Vec>
+inline void transformVector(const double m[4][4], Vec& v)
+{
+#if defined(FC_MATRIX_SSE2)
+    __m128d x = _mm_set1_pd(static_cast<double>(v.x));
+    __m128d y = _mm_set1_pd(static_cast<double>(v.y));
+    __m128d z = _mm_set1_pd(static_cast<double>(v.z));
+    // rows 0 and 1 in one register, row 2 in the lower half of another one
+    __m128d r01 = _mm_mul_pd(_mm_set_pd(m[1][0], m[0][0]), x);
+    r01 = _mm_add_pd(r01, _mm_mul_pd(_mm_set_pd(m[1][1], m[0][1]), y));
+    r01 = _mm_add_pd(r01, _mm_mul_pd(_mm_set_pd(m[1][2], m[0][2]), z));
+    r01 = _mm_add_pd(r01, _mm_set_pd(m[1][3], m[0][3]));
+    __m128d r2 = _mm_mul_sd(_mm_set_sd(m[2][0]), x);
+    r2 = _mm_add_sd(r2, _mm_mul_sd(_mm_set_sd(m[2][1]), y));
+    r2 = _mm_add_sd(r2, _mm_mul_sd(_mm_set_sd(m[2][2]), z));
+    r2 = _mm_add_sd(r2, _mm_set_sd(m[2][3]));
+
+    typedef decltype(v.x) num_type;
+    v.x = static_cast<num_type>(_mm_cvtsd_f64(r01));
+    v.y = static_cast<num_type>(_mm_cvtsd_f64(_mm_unpackhi_pd(r01, r01)));
+    v.z = static_cast<num_type>(_mm_cvtsd_f64(r2));
+#else
+    typedef decltype(v.x) num_type;
+    double sx = static_cast<double>(v.x);
+    double sy = static_cast<double>(v.y);
+    double sz = static_cast<double>(v.z);
+    v.x = static_cast<num_type>(m[0][0]*sx + m[0][1]*sy + m[0][2]*sz + m[0][3]);
+    v.y = static_cast<num_type>(m[1][0]*sx + m[1][1]*sy + m[1][2]*sz + m[1][3]);
+    v.z = static_cast<num_type>(m[2][0]*sx + m[2][1]*sy + m[2][2]*sz + m[2][3]);
+#endif
+}
+
+template <class Vec>
+inline void transformVectors(const double m[4][4], Vec* vec, std::size_t count, std::size_t stride)
+{
+    char* ptr = reinterpret_cast<char*>(vec);
+    for (std::size_t i = 0; i < count; i++, ptr += stride)
+        transformVector(m, *reinterpret_cast<Vec*>(ptr));
+}
+}
+
+void Matrix4D::multVec(Vector3f* vec, std::size_t count, std::size_t stride) const
+{
+    transformVectors(dMtrx4D, vec, count, stride);
+}
+
+void Matrix4D::multVec(Vector3d* vec, std::size_t count, std::size_t stride) const
+{
+    transformVectors(dMtrx4D, vec, count, stride);
+}
+
 Matrix4D::Matrix4D (const Vector3f& rclBase, const Vector3f& rclDir, float fAngle)
 {
     setToUnity();
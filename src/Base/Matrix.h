@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <string>
 
@@ -85,6 +86,12 @@ public:
   inline Vector3d  operator *  (const Vector3d& rclVct) const;
   inline void multVec(const Vector3d & src, Vector3d & dst) const;
   inline void multVec(const Vector3f & src, Vector3f & dst) const;
+  /** Transforms \a count vectors in place. \a stride is the distance in bytes between
+   * two vectors, so they can be members of larger structures. The result is the same
+   * as calling multVec for each vector but uses SIMD instructions where available.
+   */
+  void multVec(Vector3f* vec, std::size_t count, std::size_t stride = sizeof(Vector3f)) const;
+  void multVec(Vector3d* vec, std::size_t count, std::size_t stride = sizeof(Vector3d)) const;
   /// Comparison
   inline bool      operator != (const Matrix4D& rclMtrx) const;
   /// Comparison
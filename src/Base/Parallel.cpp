@@ -0,0 +1,61 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <atomic>
+#endif
+
+#include "Parallel.h"
+
+namespace {
+std::atomic<int> threadCount(0);
+thread_local bool parallelWorker = false;
+}
+
+int Base::parallelThreadCount()
+{
+    int count = threadCount.load();
+    if (count < 1)
+        count = static_cast<int>(std::thread::hardware_concurrency());
+    return count < 1 ? 1 : count;
+}
+
+void Base::setParallelThreadCount(int count)
+{
+    threadCount.store(count < 1 ? 0 : count);
+}
+
+bool Base::isParallelWorker()
+{
+    return parallelWorker;
+}
+
+bool Base::setParallelWorker(bool on)
+{
+    bool previous = parallelWorker;
+    parallelWorker = on;
+    return previous;
+}
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#ifndef BASE_PARALLEL_H
+#define BASE_PARALLEL_H
+
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../FCConfig.h"
+
+namespace Base
+{
+
+/// Returns the number of threads used by parallel_for, at least 1
+BaseExport int parallelThreadCount();
+/** Sets the number of threads used by parallel_for. A value less than 1 restores
+ * the default, which is the number of hardware threads.
+ */
+BaseExport void setParallelThreadCount(int);
+/// Returns true if the calling thread is running a chunk of parallel_for
+BaseExport bool isParallelWorker();
+/// Marks the calling thread as running a chunk of parallel_for and returns the previous state
+BaseExport bool setParallelWorker(bool);
+
+/**
+ * Splits the range [0, count) into chunks of at least \a grain elements and
+ * calls \a func(begin, end) for each chunk. There are at most parallelThreadCount()
+ * chunks, the last one is handled by the calling thread. If \a func throws an
+ * exception in any chunk the first one is rethrown after all chunks are done.
+ * A nested call from within a chunk runs in the calling thread, as all threads
+ * are already busy.
+ *
+ * Unlike QtConcurrent this does not depend on Qt, so it can be used by the
+ * Base classes and by modules that are not linked against QtConcurrent.
+ */
+template <class Size, class Func>
+void parallel_for(Size count, Size grain, Func func)
+{
+    Size threads = static_cast<Size>(parallelThreadCount());
+    if (grain < 1)
+        grain = 1;
+    if (count / grain < threads)
+        threads = count / grain;
+
+    if (threads < 2 || isParallelWorker()) {
+        func(Size(0), count);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex mutex;
+    auto run = [&](Size begin, Size end) {
+        bool worker = setParallelWorker(true);
+        try {
+            func(begin, end);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = std::current_exception();
+        }
+        setParallelWorker(worker);
+    };
+
+    Size chunk = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<std::size_t>(threads));
+    Size begin = 0;
+    for (; count - begin > chunk; begin += chunk)
+        workers.emplace_back(run, begin, begin + chunk);
+    run(begin, count);
+    for (auto& it : workers)
+        it.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace Base
+
+#endif // BASE_PARALLEL_H
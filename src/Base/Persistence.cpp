@@ -68,10 +68,25 @@ void Persistence::SaveDocFile (Writer &/*writer*/) const
 {
 }
 
+bool Persistence::isSaveDocFileConcurrent() const
+{
+    return false;
+}
+
 void Persistence::RestoreDocFile(Reader &/*reader*/)
 {
 }
 
+bool Persistence::isRestoreDocFileConcurrent() const
+{
+    return false;
+}
+
+std::function<void()> Persistence::RestoreDocFileConcurrent(Reader &/*reader*/)
+{
+    return std::function<void()>();
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
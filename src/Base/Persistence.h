@@ -28,6 +28,7 @@
 
 
 #include <assert.h>
+#include <functional>
 
 #include "BaseClass.h"
 
@@ -116,6 +117,13 @@ public:
      * In this method you can simply stream your content to the file (Base::Writer inheriting from ostream).
      */
     virtual void SaveDocFile (Writer &/*writer*/) const;
+    /** Returns true if SaveDocFile() can be called in a worker thread,
+     * concurrently with the SaveDocFile() of other objects. It then must
+     * not add further files to the writer.
+     * The default implementation returns false.
+     * @see Base::ZipWriter::writeFiles()
+     */
+    virtual bool isSaveDocFileConcurrent() const;
     /** This method is used to restore large amounts of data from a file
      * In this method you simply stream in your SaveDocFile() saved data.
      * Again you have to apply for the call of this method in the Restore() call:
@@ -146,6 +154,30 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader &/*reader*/);
+    /** Returns true if the file of this object can be read in a worker thread.
+     * Then RestoreDocFileConcurrent() is called instead of RestoreDocFile() and
+     * may run concurrently with the files of other objects.
+     * The default implementation returns false.
+     */
+    virtual bool isRestoreDocFileConcurrent() const;
+    /** This method is used to restore the file of an object in a worker thread.
+     * It reads the data saved by SaveDocFile() but must not change the object
+     * itself, because its container is notified of any change. Instead it returns
+     * a function that applies the read data to the object. After a batch of files
+     * is read these functions are called in the main thread in the order of the files.
+     * With a single thread RestoreDocFile() is called instead.
+     * \code
+     * std::function<void()> PropertyPointKernel::RestoreDocFileConcurrent(Base::Reader &reader)
+     * {
+     *     auto points = std::make_shared<std::vector<Base::Vector3f>>();
+     *     ... read the points ...
+     *     return [this, points]() { setValues(*points); };
+     * }
+     * \endcode
+     * The default implementation returns an empty function.
+     * @see Base::XMLReader::readFiles()
+     */
+    virtual std::function<void()> RestoreDocFileConcurrent(Reader &/*reader*/);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
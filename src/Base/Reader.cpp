@@ -24,6 +24,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <atomic>
 # include <xercesc/sax/SAXParseException.hpp>
 # include <xercesc/sax/SAXException.hpp>
 # include <xercesc/sax2/XMLReaderFactory.hpp>
@@ -39,7 +41,9 @@
 #include "Persistence.h"
 #include "InputSource.h"
 #include "Console.h"
+#include "Parallel.h"
 #include "Sequencer.h"
+#include "Stream.h"
 
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
@@ -317,6 +321,65 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream &zipstream) const
     // up. In this case the associated GUI document asks for its file which is not part of the ZIP
     // file, then.
     // In either case it's guaranteed that the order of the files is kept.
+    //
+    // The files of objects that can be restored concurrently are only inflated while
+    // walking through the zip file. Once the inflated data exceeds maxPendingBytes or
+    // the end of the zip file is reached, the pending files are read by worker threads,
+    // and the read data is applied to the objects in the main thread in the order of
+    // the files. So at most one batch of files is kept in memory.
+    struct PendingFile {
+        const FileEntry* file;
+        std::string name;
+        std::string data;
+        std::function<void()> apply;
+        bool failed;
+    };
+    static const std::size_t maxPendingBytes = 256 * 1024 * 1024;
+    std::vector<PendingFile> pending;
+    std::size_t pendingBytes = 0;
+    bool concurrent = parallelThreadCount() > 1;
+
+    auto restorePending = [&]() {
+        if (pending.empty())
+            return;
+
+        // Every worker takes the next file until all are read, so that a few large
+        // files don't hold up the others
+        std::atomic<std::size_t> next(0);
+        std::size_t threads = std::min<std::size_t>(pending.size(),
+                                                    static_cast<std::size_t>(parallelThreadCount()));
+        parallel_for(threads, std::size_t(1), [&](std::size_t, std::size_t) {
+            for (std::size_t i = next++; i < pending.size(); i = next++) {
+                PendingFile& file = pending[i];
+                try {
+                    MemoryIStreambuf buf(file.data.data(), file.data.size());
+                    std::istream str(&buf);
+                    Base::Reader reader(str, file.file->FileName, FileVersion);
+                    file.apply = file.file->Object->RestoreDocFileConcurrent(reader);
+                }
+                catch(...) {
+                    file.failed = true;
+                }
+                std::string().swap(file.data);
+            }
+        });
+
+        for (auto& file : pending) {
+            try {
+                if (file.failed)
+                    Base::Console().Error("Reading failed from embedded file: %s\n", file.name.c_str());
+                else if (file.apply)
+                    file.apply();
+            }
+            catch(...) {
+                Base::Console().Error("Reading failed from embedded file: %s\n", file.name.c_str());
+            }
+        }
+
+        pending.clear();
+        pendingBytes = 0;
+    };
+
     zipios::ConstEntryPointer entry;
     try {
         entry = zipstream.getNextEntry();
@@ -336,7 +399,26 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream &zipstream) const
             ++jt;
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (concurrent && jt != FileList.end() && jt->Object->isRestoreDocFileConcurrent()) {
+            try {
+                PendingFile file;
+                file.file = &*jt;
+                file.name = entry->toString();
+                char buffer[65536];
+                while (zipstream.read(buffer, sizeof(buffer)) || zipstream.gcount() > 0)
+                    file.data.append(buffer, static_cast<std::size_t>(zipstream.gcount()));
+                file.failed = false;
+                pendingBytes += file.data.size();
+                pending.push_back(std::move(file));
+            }
+            catch(...) {
+                Base::Console().Error("Reading failed from embedded file: %s\n", entry->toString().c_str());
+            }
+            if (pendingBytes >= maxPendingBytes)
+                restorePending();
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
             try {
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
@@ -366,6 +448,8 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream &zipstream) const
             break;
         }
     }
+
+    restorePending();
 }
 
 const char *Base::XMLReader::addFile(const char* Name, Base::Persistence *Object)
@@ -367,6 +367,52 @@ ByteArrayIStreambuf::seekpos(std::streambuf::pos_type pos,
 
 // ----------------------------------------------------------------------
 
+MemoryIStreambuf::MemoryIStreambuf(const char* data, std::size_t size)
+{
+    char* beg = const_cast<char*>(data);
+    setg(beg, beg, beg + size);
+}
+
+MemoryIStreambuf::~MemoryIStreambuf()
+{
+}
+
+std::streamsize MemoryIStreambuf::showmanyc()
+{
+    return egptr() - gptr();
+}
+
+std::streambuf::pos_type
+MemoryIStreambuf::seekoff(std::streambuf::off_type off,
+                          std::ios_base::seekdir way,
+                          std::ios_base::openmode /*mode*/ )
+{
+    char* p_pos = nullptr;
+    if (way == std::ios_base::beg)
+        p_pos = eback();
+    else if (way == std::ios_base::end)
+        p_pos = egptr();
+    else if (way == std::ios_base::cur)
+        p_pos = gptr();
+    else
+        return pos_type(off_type(-1));
+
+    if ((off > egptr() - p_pos) || (off < eback() - p_pos))
+        return pos_type(off_type(-1));
+
+    setg(eback(), p_pos + off, egptr());
+    return pos_type(gptr() - eback());
+}
+
+std::streambuf::pos_type
+MemoryIStreambuf::seekpos(std::streambuf::pos_type pos,
+                          std::ios_base::openmode /*mode*/)
+{
+    return seekoff(pos, std::ios_base::beg);
+}
+
+// ----------------------------------------------------------------------
+
 IODeviceOStreambuf::IODeviceOStreambuf(QIODevice* dev) : device(dev)
 {
 }
@@ -304,6 +304,36 @@ private:
     std::string::const_iterator _cur;
 };
 
+/**
+ * This class implements the streambuf interface to read data from a block
+ * of memory that is not owned by the class, e.g. a memory mapped file.
+ * Unlike ByteArrayIStreambuf the size of the block is not limited to 2 GB.
+ * This class can only be used for reading but not for writing purposes.
+ */
+class BaseExport MemoryIStreambuf : public std::streambuf
+{
+public:
+    MemoryIStreambuf(const char* data, std::size_t size);
+    ~MemoryIStreambuf();
+
+    /// Returns the data at the current read position
+    const char* current() const
+    { return gptr(); }
+    /// Returns the number of bytes from the current read position to the end
+    std::size_t available() const
+    { return static_cast<std::size_t>(egptr() - gptr()); }
+
+protected:
+    virtual std::streamsize showmanyc();
+    virtual pos_type seekoff(std::streambuf::off_type off,
+        std::ios_base::seekdir way,
+        std::ios_base::openmode which =
+            std::ios::in | std::ios::out);
+    virtual pos_type seekpos(std::streambuf::pos_type pos,
+        std::ios_base::openmode which =
+            std::ios::in | std::ios::out);
+};
+
 // ----------------------------------------------------------------------------
 
 class FileInfo;
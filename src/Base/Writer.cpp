@@ -24,6 +24,12 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <atomic>
+# include <cstring>
+# include <exception>
+# include <mutex>
+# include <sstream>
+# include <zlib.h>
 #endif
 
 /// Here the FreeCAD includes sorted by Base,App,Gui......
@@ -32,6 +38,7 @@
 #include "Exception.h"
 #include "Base64.h"
 #include "FileInfo.h"
+#include "Parallel.h"
 #include "Stream.h"
 #include "Tools.h"
 
@@ -241,7 +248,7 @@ void Writer::decInd(void)
 // ----------------------------------------------------------------------------
 
 ZipWriter::ZipWriter(const char* FileName)
-  : ZipStream(FileName)
+  : ZipStream(FileName), Level(Z_DEFAULT_COMPRESSION)
 {
 #ifdef _MSC_VER
     ZipStream.imbue(std::locale::empty());
@@ -253,7 +260,7 @@ ZipWriter::ZipWriter(const char* FileName)
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
-  : ZipStream(os)
+  : ZipStream(os), Level(Z_DEFAULT_COMPRESSION)
 {
 #ifdef _MSC_VER
     ZipStream.imbue(std::locale::empty());
@@ -264,16 +271,187 @@ ZipWriter::ZipWriter(std::ostream& os)
     ZipStream.setf(ios::fixed,ios::floatfield);
 }
 
+namespace {
+
+/// Writes the file of one object into memory, see ZipWriter::writeFiles()
+class ZipEntryWriter : public Writer
+{
+public:
+    ZipEntryWriter(Writer& parent, std::mutex& mutex)
+      : parent(parent), mutex(mutex)
+    {
+        setModes(parent.getModes());
+        setFileVersion(parent.getFileVersion());
+        setForceXML(parent.isForceXML());
+        ObjectName = parent.ObjectName;
+#ifdef _MSC_VER
+        stream.imbue(std::locale::empty());
+#else
+        stream.imbue(std::locale::classic());
+#endif
+        stream.precision(std::numeric_limits<double>::digits10 + 1);
+        stream.setf(ios::fixed,ios::floatfield);
+    }
+
+    virtual std::string addFile(const char* Name, const Base::Persistence *Object)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return parent.addFile(Name, Object);
+    }
+    virtual void writeFiles(void) {}
+    virtual std::ostream &Stream(void) {return stream;}
+
+    std::ostringstream stream;
+
+private:
+    Writer& parent;
+    std::mutex& mutex;
+};
+
+struct ZipEntryData
+{
+    std::string FileName;
+    const Base::Persistence* Object;
+    std::string data;
+    std::vector<std::string> errors;
+    std::exception_ptr exception;
+    uLong crc;
+    uLong size;
+    bool deflated;
+    bool concurrent;
+};
+
+void saveEntry(ZipEntryData& entry, Writer& parent, std::mutex& mutex)
+{
+    try {
+        ZipEntryWriter writer(parent, mutex);
+        entry.Object->SaveDocFile(writer);
+        entry.data = writer.stream.str();
+        entry.errors = writer.getErrors();
+    }
+    catch (...) {
+        entry.exception = std::current_exception();
+    }
+}
+
+void compressEntry(ZipEntryData& entry, int level)
+{
+    const Bytef* data = reinterpret_cast<const Bytef*>(entry.data.data());
+    entry.size = static_cast<uLong>(entry.data.size());
+    entry.crc = crc32(crc32(0L, Z_NULL, 0), data, static_cast<uInt>(entry.size));
+    entry.deflated = false;
+    if (level == Z_NO_COMPRESSION || entry.size == 0 || ZipWriter::isCompressedFile(entry.FileName))
+        return;
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    // negative window bits to omit the zlib header as required by zip
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return;
+
+    std::string out(deflateBound(&zs, entry.size), '\0');
+    zs.next_in = const_cast<Bytef*>(data);
+    zs.avail_in = static_cast<uInt>(entry.size);
+    zs.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    zs.avail_out = static_cast<uInt>(out.size());
+    int err = deflate(&zs, Z_FINISH);
+    // store the data if it doesn't get smaller
+    if (err == Z_STREAM_END && zs.total_out < entry.size) {
+        out.resize(zs.total_out);
+        entry.data.swap(out);
+        entry.deflated = true;
+    }
+    deflateEnd(&zs);
+}
+
+}
+
+bool ZipWriter::isCompressedFile(const std::string& FileName)
+{
+    static const char* extensions[] = {"png", "jpg", "jpeg", "gz", "zip", "fcstd"};
+    FileInfo fi(FileName);
+    for (const char* ext : extensions) {
+        if (fi.hasExtension(ext))
+            return true;
+    }
+    return false;
+}
+
 void ZipWriter::writeFiles(void)
 {
+    // The files are written into memory and compressed by worker threads, and then
+    // written to the archive in the order of the files. Files of objects that cannot
+    // write them concurrently are written into memory by this thread first.
+    //
+    // The files are collected in batches until the memory size of their objects
+    // exceeds maxPendingBytes, so that at most one batch of files is kept in memory.
+    // A file whose object alone exceeds it is written directly to the archive by this
+    // thread as it would be too expensive to keep it in memory.
+    //
     // use a while loop because it is possible that while
     // processing the files new ones can be added
+    static const std::size_t maxPendingBytes = 256 * 1024 * 1024;
+    std::mutex mutex;
+    std::size_t threads = static_cast<std::size_t>(parallelThreadCount());
     size_t index = 0;
     while (index < FileList.size()) {
-        FileEntry entry = FileList.begin()[index];
-        ZipStream.putNextEntry(entry.FileName);
-        entry.Object->SaveDocFile(*this);
-        index++;
+        std::vector<ZipEntryData> entries;
+        std::size_t pendingBytes = 0;
+        bool oversized = false;
+        while (index < FileList.size() && pendingBytes < maxPendingBytes) {
+            std::size_t bytes = FileList[index].Object->getMemSize();
+            if (bytes >= maxPendingBytes) {
+                oversized = true;
+                break;
+            }
+            entries.emplace_back();
+            ZipEntryData& entry = entries.back();
+            entry.FileName = FileList[index].FileName;
+            entry.Object = FileList[index].Object;
+            // ask only once and in this thread, the answer may depend on the object
+            entry.concurrent = entry.Object->isSaveDocFileConcurrent();
+            pendingBytes += bytes;
+            index++;
+        }
+        std::size_t count = entries.size();
+
+        for (auto& entry : entries) {
+            if (!entry.concurrent)
+                saveEntry(entry, *this, mutex);
+        }
+
+        std::atomic<std::size_t> next(0);
+        parallel_for(std::min(count, threads), std::size_t(1), [&](std::size_t, std::size_t) {
+            for (std::size_t i = next++; i < count; i = next++) {
+                ZipEntryData& entry = entries[i];
+                if (entry.concurrent)
+                    saveEntry(entry, *this, mutex);
+                if (!entry.exception)
+                    compressEntry(entry, Level);
+            }
+        });
+
+        for (auto& entry : entries) {
+            if (entry.exception)
+                std::rethrow_exception(entry.exception);
+            for (const auto& it : entry.errors)
+                addError(it);
+
+            ZipCDirEntry header(entry.FileName);
+            header.setMethod(entry.deflated ? DEFLATED : STORED);
+            header.setCrc(entry.crc);
+            header.setSize(entry.size);
+            header.setCompressedSize(static_cast<uint32>(entry.data.size()));
+            ZipStream.putRawEntry(header, entry.data.data(), static_cast<uint32>(entry.data.size()));
+            std::string().swap(entry.data);
+        }
+
+        if (oversized) {
+            FileEntry entry = FileList[index];
+            ZipStream.putNextEntry(entry.FileName);
+            entry.Object->SaveDocFile(*this);
+            index++;
+        }
     }
 }
 
@@ -76,7 +76,7 @@ public:
     /** @name additional file writing */
     //@{
     /// add a write request of a persistent object
-    std::string addFile(const char* Name, const Base::Persistence *Object);
+    virtual std::string addFile(const char* Name, const Base::Persistence *Object);
     /// process the requested file storing
     virtual void writeFiles(void)=0;
     /// get all registered file names
@@ -140,6 +140,11 @@ protected:
 /** The ZipWriter class
  * This is an important helper class implementation for the store and retrieval system
  * of persistent objects in FreeCAD.
+ *
+ * The files added with addFile() are written into memory and compressed by worker
+ * threads, and then written to the archive in the order they were added. Objects whose
+ * Persistence::isSaveDocFileConcurrent() returns true are also written by the worker
+ * threads, all others by the calling thread.
  * \see Base::Persistence
  * \author Juergen Riegel
  */
@@ -155,11 +160,16 @@ public:
     virtual std::ostream &Stream(void){return ZipStream;}
 
     void setComment(const char* str){ZipStream.setComment(str);}
-    void setLevel(int level){ZipStream.setLevel( level );}
+    void setLevel(int level){ZipStream.setLevel( level ); Level = level;}
     void putNextEntry(const char* str){ZipStream.putNextEntry(str);}
 
+    /** Returns true if a file is stored without compression because its
+     * data is already compressed, e.g. a PNG image. */
+    static bool isCompressedFile(const std::string& FileName);
+
 private:
     zipios::ZipOutputStream ZipStream;
+    int Level;
 };
 
 /** The StringWriter class
@@ -22,23 +22,31 @@
 
 
 #include "PreCompiled.h"
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <gp_Pnt.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepGProp_Face.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Vertex.hxx>
 
 #include <QEventLoop>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QTimer>
 #include <QtConcurrentMap>
 
 #include <boost_bind_bind.hpp>
 
 #include <Base/Console.h>
+#include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/FutureWatcherProgress.h>
 #include <Base/Parameter.h>
@@ -183,7 +191,7 @@ namespace Inspection {
             assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
         }
 
-        void AddFacet (const MeshCore::MeshGeomFacet &rclFacet, unsigned long ulFacetIndex)
+        void FacetGrids (const MeshCore::MeshGeomFacet &rclFacet, std::vector<std::size_t> &raulGrids) const
         {
             unsigned long ulX, ulY, ulZ;
             unsigned long ulX1, ulY1, ulZ1, ulX2, ulY2, ulZ2;
@@ -202,19 +210,17 @@ namespace Inspection {
                     for (ulY = ulY1; ulY <= ulY2; ulY++) {
                         for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                             if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ)))
-                                _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                                raulGrids.push_back(GridIndex(ulX, ulY, ulZ));
                         }
                     }
                 }
             }
             else
-                _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+                raulGrids.push_back(GridIndex(ulX1, ulY1, ulZ1));
         }
 
         void InitGrid (void)
         {
-            unsigned long i, j;
-
             Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
             float fLengthX = clBBMesh.LengthX(); 
@@ -230,13 +236,8 @@ namespace Inspection {
             _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
             _fMinZ = clBBMesh.MinZ - 0.5f;
 
-            _aulGrid.clear();
-            _aulGrid.resize(_ulCtGridsX);
-            for (i = 0; i < _ulCtGridsX; i++) {
-                _aulGrid[i].resize(_ulCtGridsY);
-                for (j = 0; j < _ulCtGridsY; j++)
-                    _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
+            _aulElements.clear();
+            _aulOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
         }
 
         void RebuildGrid (void)
@@ -244,12 +245,13 @@ namespace Inspection {
             _ulCtElements = _pclMesh->CountFacets();
             InitGrid();
  
-            unsigned long i = 0;
-            MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-            clFIter.Transform(_transform);
-            for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-                AddFacet(*clFIter, i++);
-            }
+            FillGrids(_ulCtElements, [this](MeshCore::ElementIndex ulIndex, std::vector<std::size_t>& raulGrids) {
+                MeshCore::MeshGeomFacet clFacet = _pclMesh->GetFacet(ulIndex);
+                for (int i = 0; i < 3; i++)
+                    clFacet._aclPoints[i] = _transform * clFacet._aclPoints[i];
+                clFacet.NormalInvalid();
+                FacetGrids(clFacet, raulGrids);
+            });
         }
 
     private:
@@ -293,17 +295,17 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
     if (!_box.IsInBox(point))
         return FLT_MAX; // must be inside bbox
 
-    std::vector<unsigned long> indices;
+    std::vector<MeshCore::ElementIndex> indices;
     //_pGrid->GetElements(point, indices);
     if (indices.empty()) {
-        std::set<unsigned long> inds;
+        std::set<MeshCore::ElementIndex> inds;
         _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
         indices.insert(indices.begin(), inds.begin(), inds.end());
     }
 
     float fMinDist=FLT_MAX;
     bool positive = true;
-    for (std::vector<unsigned long>::iterator it = indices.begin(); it != indices.end(); ++it) {
+    for (std::vector<MeshCore::ElementIndex>::iterator it = indices.begin(); it != indices.end(); ++it) {
         MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(*it);
         if (_bApply) {
             geomFace.Transform(_clTrf);
@@ -366,9 +368,9 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
     if (!_box.IsInBox(point))
         return FLT_MAX; // must be inside bbox
 
-    std::set<unsigned long> indices;
+    std::set<MeshCore::ElementIndex> indices;
 #if 0 // a point in a neighbour grid can be nearer
-    std::vector<unsigned long> elements;
+    std::vector<MeshCore::ElementIndex> elements;
     _pGrid->GetElements(point, elements);
     indices.insert(elements.begin(), elements.end());
 #else
@@ -383,7 +385,7 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 
     float fMinDist=FLT_MAX;
     bool positive = true;
-    for (std::set<unsigned long>::iterator it = indices.begin(); it != indices.end(); ++it) {
+    for (std::set<MeshCore::ElementIndex>::iterator it = indices.begin(); it != indices.end(); ++it) {
         MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(*it);
         if (_bApply) {
             geomFace.Transform(_clTrf);
@@ -438,74 +440,398 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
-    : _rShape(shape)
-    , isSolid(false)
+namespace Inspection {
+/*
+ * Bounding volume hierarchy of the triangles of a tessellated shape. The triangles
+ * are sorted so that every leaf holds a contiguous range of them. The second child
+ * of an inner node is stored in 'first', the first child directly follows its parent.
+ * The median split keeps the tree balanced, so a search needs a stack of the depth
+ * of the tree plus one. Only unexpectedly deep trees use a stack on the heap.
+ */
+class InspectNominalFastShape::Private
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+public:
+    struct Triangle
+    {
+        Base::Vector3f points[3];
+        Base::Vector3f normal;
+        int face;
+
+        Base::Vector3f center() const
+        {
+            return (points[0] + points[1] + points[2]) / 3.0f;
+        }
+    };
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        uint32_t first, count;
+    };
+
+    static const uint32_t LeafSize = 4;
+    static const int StackSize = 64;
 
-    // When having a solid then use its shell because otherwise the distance
-    // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
-        TopExp_Explorer xp;
-        xp.Init(_rShape, TopAbs_SHELL);
-        if (xp.More()) {
-           distss->LoadS1(xp.Current());
-           isSolid = true;
+    // Traversal stack of a search
+    class Stack
+    {
+    public:
+        Stack(std::size_t size)
+            : data(fixed), top(0)
+        {
+            if (size > StackSize) {
+                heap.resize(size);
+                data = heap.data();
+            }
+        }
+        bool empty() const
+        {
+            return top == 0;
+        }
+        void push(uint32_t index)
+        {
+            data[top++] = index;
+        }
+        uint32_t pop()
+        {
+            return data[--top];
         }
 
+    private:
+        uint32_t fixed[StackSize];
+        std::vector<uint32_t> heap;
+        uint32_t* data;
+        std::size_t top;
+    };
+
+    std::vector<Triangle> triangles;
+    std::vector<Node> nodes;
+    std::size_t depth = 0;
+    TopoDS_Shape shape;
+    Base::BoundBox3f box;
+    float deflection;
+    float band;
+    float maxDistance;
+
+    // BRepExtrema must not work on the same shape in several threads, so every thread
+    // computes the exact distances with its own copy of the faces
+    std::mutex facesMutex;
+    std::map<std::thread::id, std::vector<TopoDS_Face> > threadFaces;
+
+    const std::vector<TopoDS_Face>& faces()
+    {
+        std::lock_guard<std::mutex> lock(facesMutex);
+        std::vector<TopoDS_Face>& result = threadFaces[std::this_thread::get_id()];
+        if (result.empty()) {
+            BRepBuilderAPI_Copy copy(shape);
+            for (TopExp_Explorer xp(copy.Shape(), TopAbs_FACE); xp.More(); xp.Next())
+                result.push_back(TopoDS::Face(xp.Current()));
+        }
+        return result;
     }
-    //distss->SetDeflection(radius);
-}
 
-InspectNominalShape::~InspectNominalShape()
-{
-    delete distss;
-}
+    void build()
+    {
+        nodes.clear();
+        depth = 0;
+        if (!triangles.empty()) {
+            nodes.reserve(2 * triangles.size() / LeafSize + 1);
+            buildNode(0, static_cast<uint32_t>(triangles.size()), 0);
+        }
+    }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
-{
-    gp_Pnt pnt3d(point.x,point.y,point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    uint32_t buildNode(uint32_t first, uint32_t count, std::size_t level)
+    {
+        uint32_t index = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(Node());
+        depth = std::max(depth, level);
+
+        Base::BoundBox3f box, centers;
+        for (uint32_t i = first; i < first + count; i++) {
+            const Triangle& tria = triangles[i];
+            for (int j = 0; j < 3; j++)
+                box.Add(tria.points[j]);
+            centers.Add(tria.center());
+        }
+        nodes[index].box = box;
 
-    float fMinDist=FLT_MAX;
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
-        // the shape is a solid, check if the vertex is inside
-        if (isSolid) {
-            const Standard_Real tol = 0.001;
-            BRepClass3d_SolidClassifier classifier(_rShape);
-            classifier.Perform(pnt3d, tol);
-            if (classifier.State() == TopAbs_IN) {
-                fMinDist = -fMinDist;
-            }
+        if (count <= LeafSize) {
+            nodes[index].first = first;
+            nodes[index].count = count;
+            return index;
+        }
 
+        // split at the median of the centers along the longest axis
+        int axis = 0;
+        float length = centers.LengthX();
+        if (centers.LengthY() > length) {
+            axis = 1;
+            length = centers.LengthY();
         }
-        else if (fMinDist > 0) {
-            // check if the distance was compued from a face
-            for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-                if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-                    TopoDS_Shape face = distss->SupportOnShape1(index);
-                    Standard_Real u, v;
-                    distss->ParOnFaceS1(index, u, v);
-                    //gp_Pnt pnt = distss->PointOnShape1(index);
-                    BRepGProp_Face props(TopoDS::Face(face));
-                    gp_Vec normal;
-                    gp_Pnt center;
-                    props.Normal(u, v, center, normal);
-                    gp_Vec dir(center, pnt3d);
-                    Standard_Real scalar = normal.Dot(dir);
-                    if (scalar < 0) {
-                        fMinDist = -fMinDist;
+        if (centers.LengthZ() > length)
+            axis = 2;
+
+        uint32_t half = count / 2;
+        std::nth_element(triangles.begin() + first, triangles.begin() + first + half,
+                         triangles.begin() + first + count,
+                         [axis](const Triangle& t1, const Triangle& t2) {
+            return t1.center()[axis] < t2.center()[axis];
+        });
+
+        buildNode(first, half, level + 1);
+        uint32_t second = buildNode(first + half, count - half, level + 1);
+        nodes[index].first = second;
+        nodes[index].count = 0;
+        return index;
+    }
+
+    static float squaredDistance(const Base::BoundBox3f& box, const Base::Vector3f& p)
+    {
+        float dx = std::max(std::max(box.MinX - p.x, 0.0f), p.x - box.MaxX);
+        float dy = std::max(std::max(box.MinY - p.y, 0.0f), p.y - box.MaxY);
+        float dz = std::max(std::max(box.MinZ - p.z, 0.0f), p.z - box.MaxZ);
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Closest point of a triangle, see Ericson: Real-Time Collision Detection
+    static Base::Vector3f closestPoint(const Triangle& tria, const Base::Vector3f& p)
+    {
+        const Base::Vector3f& a = tria.points[0];
+        const Base::Vector3f& b = tria.points[1];
+        const Base::Vector3f& c = tria.points[2];
+        Base::Vector3f ab = b - a;
+        Base::Vector3f ac = c - a;
+
+        Base::Vector3f ap = p - a;
+        float d1 = ab * ap;
+        float d2 = ac * ap;
+        if (d1 <= 0.0f && d2 <= 0.0f)
+            return a;
+
+        Base::Vector3f bp = p - b;
+        float d3 = ab * bp;
+        float d4 = ac * bp;
+        if (d3 >= 0.0f && d4 <= d3)
+            return b;
+
+        float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+            return a + ab * (d1 / (d1 - d3));
+
+        Base::Vector3f cp = p - c;
+        float d5 = ab * cp;
+        float d6 = ac * cp;
+        if (d6 >= 0.0f && d5 <= d6)
+            return c;
+
+        float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+            return a + ac * (d2 / (d2 - d6));
+
+        float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+        float denom = va + vb + vc;
+        if (denom <= 0.0f) // degenerated triangle
+            return a;
+        return a + ab * (vb / denom) + ac * (vc / denom);
+    }
+
+    /*
+     * Searches the nearest triangle within maxDist and returns the signed distance to it.
+     * If the nearest point lies on an edge or corner shared by several triangles the sign
+     * is taken from the triangle whose normal is most aligned with the distance vector.
+     */
+    bool nearest(const Base::Vector3f& p, float maxDist, float& dist) const
+    {
+        if (nodes.empty())
+            return false;
+
+        float best = maxDist * maxDist;
+        float bestCos = 0.0f;
+        bool found = false;
+
+        Stack stack(depth + 1);
+        stack.push(0);
+        while (!stack.empty()) {
+            uint32_t index = stack.pop();
+            const Node& node = nodes[index];
+            if (squaredDistance(node.box, p) > best)
+                continue;
+
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    const Triangle& tria = triangles[i];
+                    Base::Vector3f dir = p - closestPoint(tria, p);
+                    float dist2 = dir.Sqr();
+                    if (dist2 > best * 1.0001f)
+                        continue;
+                    float len = std::sqrt(dist2);
+                    float cos = len > 0.0f ? (tria.normal * dir) / len : 1.0f;
+                    if (dist2 < best * 0.9999f || std::fabs(cos) > std::fabs(bestCos)) {
+                        best = std::min(best, dist2);
+                        bestCos = cos;
+                        found = true;
                     }
-                    break;
                 }
             }
+            else {
+                uint32_t first = index + 1;
+                uint32_t second = node.first;
+                // visit the nearer child first
+                if (squaredDistance(nodes[first].box, p) < squaredDistance(nodes[second].box, p))
+                    std::swap(first, second);
+                stack.push(first);
+                stack.push(second);
+            }
+        }
+
+        if (found) {
+            dist = std::sqrt(best);
+            if (bestCos < 0.0f)
+                dist = -dist;
         }
+        return found;
     }
-    return fMinDist;
+
+    // Collects the faces that have a triangle within range
+    void facesInRange(const Base::Vector3f& p, float range, std::vector<int>& result) const
+    {
+        if (nodes.empty())
+            return;
+
+        float range2 = range * range;
+        Stack stack(depth + 1);
+        stack.push(0);
+        while (!stack.empty()) {
+            uint32_t index = stack.pop();
+            const Node& node = nodes[index];
+            if (squaredDistance(node.box, p) > range2)
+                continue;
+
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    const Triangle& tria = triangles[i];
+                    if (Base::DistanceP2(p, closestPoint(tria, p)) <= range2 &&
+                        std::find(result.begin(), result.end(), tria.face) == result.end())
+                        result.push_back(tria.face);
+                }
+            }
+            else {
+                stack.push(index + 1);
+                stack.push(node.first);
+            }
+        }
+    }
+};
+}
+
+InspectNominalFastShape::InspectNominalFastShape(const TopoDS_Shape& shape, float offset,
+                                                 float deflection, float band)
+    : d(new Private)
+{
+    d->deflection = deflection;
+    d->band = band;
+    d->maxDistance = offset + deflection;
+    if (shape.IsNull())
+        return;
+
+    // Tessellate the shape once. Use the same angular deflection as Part does for
+    // a linear deflection.
+    BRepMesh_IncrementalMesh mesh(shape, deflection, Standard_False,
+                                  std::min(0.1, deflection * 5.0 + 0.005), Standard_True);
+
+    // The domains are in the order of the faces of the explorer
+    d->shape = shape;
+    std::size_t numFaces = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next())
+        numFaces++;
+    std::vector<Data::ComplexGeoData::Domain> domains;
+    Part::TopoShape(shape).getDomains(domains);
+
+    for (std::size_t i = 0; i < domains.size() && i < numFaces; i++) {
+        const Data::ComplexGeoData::Domain& domain = domains[i];
+        for (const auto& it : domain.facets) {
+            Private::Triangle tria;
+            tria.points[0] = Base::convertTo<Base::Vector3f>(domain.points[it.I1]);
+            tria.points[1] = Base::convertTo<Base::Vector3f>(domain.points[it.I2]);
+            tria.points[2] = Base::convertTo<Base::Vector3f>(domain.points[it.I3]);
+            tria.normal = (tria.points[1] - tria.points[0]) % (tria.points[2] - tria.points[0]);
+            tria.normal.Normalize();
+            tria.face = static_cast<int>(i);
+            d->triangles.push_back(tria);
+            for (int j = 0; j < 3; j++)
+                d->box.Add(tria.points[j]);
+        }
+    }
+
+    d->box.Enlarge(d->maxDistance);
+    d->build();
+}
+
+InspectNominalFastShape::~InspectNominalFastShape()
+{
+    delete d;
+}
+
+float InspectNominalFastShape::getDistance(const Base::Vector3f& point) const
+{
+    if (!d->box.IsInBox(point))
+        return FLT_MAX; // must be inside bbox
+
+    float fDist;
+    if (!d->nearest(point, d->maxDistance, fDist))
+        return FLT_MAX;
+    if (fabs(fDist) > d->band)
+        return fDist;
+
+    // The exact distance differs from the approximate one by at most the deflection,
+    // so only faces with a triangle within this range can be the nearest ones.
+    std::vector<int> faces;
+    d->facesInRange(point, fabs(fDist) + 2.0f * d->deflection, faces);
+    return exactDistance(point, fDist, faces);
+}
+
+float InspectNominalFastShape::exactDistance(const Base::Vector3f& point, float approx,
+                                             const std::vector<int>& faces) const
+{
+    gp_Pnt pnt3d(point.x,point.y,point.z);
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    TopoDS_Vertex vertex = mkVert.Vertex();
+
+    float fMinDist = FLT_MAX;
+    bool negative = approx < 0;
+    const std::vector<TopoDS_Face>& shapeFaces = d->faces();
+    for (std::vector<int>::const_iterator it = faces.begin(); it != faces.end(); ++it) {
+        const TopoDS_Face& face = shapeFaces[*it];
+        BRepExtrema_DistShapeShape distss(face, vertex);
+        if (!distss.IsDone() || distss.NbSolution() < 1)
+            continue;
+
+        float fDist = (float)distss.Value();
+        if (fDist >= fMinDist)
+            continue;
+
+        fMinDist = fDist;
+        negative = approx < 0;
+        // if the distance was computed from the inside of the face use its normal,
+        // otherwise keep the side of the tessellation
+        if (fDist > 0 && distss.SupportTypeShape1(1) == BRepExtrema_IsInFace) {
+            Standard_Real u, v;
+            distss.ParOnFaceS1(1, u, v);
+            BRepGProp_Face props(face);
+            gp_Vec normal;
+            gp_Pnt center;
+            props.Normal(u, v, center, normal);
+            gp_Vec dir(center, pnt3d);
+            negative = normal.Dot(dir) < 0;
+        }
+    }
+
+    if (fMinDist == FLT_MAX)
+        return approx;
+    return negative ? -fMinDist : fMinDist;
 }
 
 // ----------------------------------------------------------------
@@ -762,6 +1088,19 @@ App::DocumentObjectExecReturn* Feature::execute(void)
         throw Base::TypeError("Unknown geometric type");
     }
 
+    // Shapes are tessellated with the given deflection, by default a tenth of the search
+    // radius, and only within the band the exact distance to the shape is computed.
+    // Outside the band the distance to the tessellation is used, which is off by at most
+    // the deflection. So a wider band gives more exact distances but is slower, as the
+    // exact distance is expensive. By default it's a few times the deflection so that
+    // the error is small compared to the distance, 0 uses the tessellation only.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Inspection");
+    float deflection = static_cast<float>(hGrp->GetFloat("ShapeDeflection", 0.0));
+    if (deflection <= 0)
+        deflection = 0.1f * this->SearchRadius.getValue();
+    float band = static_cast<float>(hGrp->GetFloat("RefineBand", -1.0));
+
     // get a list of nominals
     std::vector<InspectNominalGeometry*> inspectNominal;
     const std::vector<App::DocumentObject*>& nominals = Nominals.getValues();
@@ -776,9 +1115,15 @@ App::DocumentObjectExecReturn* Feature::execute(void)
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if ((*it)->getTypeId().isDerivedFrom(Part::Feature::getClassTypeId())) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(*it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            const TopoDS_Shape& shape = part->Shape.getValue();
+            // avoid too many triangles for a small search radius
+            Base::BoundBox3d bbox = part->Shape.getBoundingBox();
+            float minDeflection = static_cast<float>(1.0e-4 * bbox.CalcDiagonalLength());
+            float shapeDeflection = std::max(deflection, minDeflection);
+            float shapeBand = band < 0 ? 4.0f * shapeDeflection : band;
+            nominal = new InspectNominalFastShape(shape, this->SearchRadius.getValue(),
+                                                  shapeDeflection, shapeBand);
         }
 
         if (nominal)
@@ -872,23 +1217,57 @@ App::DocumentObjectExecReturn* Feature::execute(void)
     DistanceInspectionRMS res;
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS computation
-        QFuture<DistanceInspectionRMS> future = QtConcurrent::mappedReduced(
-            index, fMap, &DistanceInspectionRMS::operator+=);
+        // Split the points into blocks. The distances of the finished blocks are published
+        // from time to time so that the colour map fills while the inspection is running.
+        const unsigned long blockSize = 16384;
+        std::vector<std::pair<unsigned long, unsigned long> > blocks;
+        for (unsigned long i = 0; i < count; i += blockSize)
+            blocks.emplace_back(i, std::min(count, i + blockSize));
+
+        std::function<DistanceInspectionRMS(const std::pair<unsigned long, unsigned long>&)> fBlock =
+            [&](const std::pair<unsigned long, unsigned long>& block)
+        {
+            DistanceInspectionRMS res;
+            for (unsigned long index = block.first; index < block.second; index++)
+                res += fMap(index);
+            return res;
+        };
+
+        // Perform map operation : compute distances and sum of squares for RMS computation per block
+        QFuture<DistanceInspectionRMS> future = QtConcurrent::mapped(blocks, fBlock);
         // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
+        Base::FutureWatcherProgress progress("Inspecting...", blocks.size());
         QFutureWatcher<DistanceInspectionRMS> watcher;
         QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
             &progress, SLOT(progressValueChanged(int)));
+
+        // The values of a finished block are not written any more and can be copied
+        std::vector<float> partial(count, FLT_MAX);
+        bool modified = false;
+        QObject::connect(&watcher, &QFutureWatcher<DistanceInspectionRMS>::resultReadyAt, [&](int index) {
+            const std::pair<unsigned long, unsigned long>& block = blocks[index];
+            std::copy(vals.begin() + block.first, vals.begin() + block.second, partial.begin() + block.first);
+            modified = true;
+        });
+        QTimer timer;
+        QObject::connect(&timer, &QTimer::timeout, [&]() {
+            if (modified) {
+                Distances.setValues(partial);
+                modified = false;
+            }
+        });
+        timer.start(1000);
+
         // Keep UI responsive during computation
         QEventLoop loop;
         QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
         watcher.setFuture(future);
         loop.exec();
-        res = future.result();
+        timer.stop();
+
+        QList<DistanceInspectionRMS> results = future.results();
+        for (QList<DistanceInspectionRMS>::iterator it = results.begin(); it != results.end(); ++it)
+            res += *it;
     }
     else {
         // Single-threaded operation
@@ -32,7 +32,6 @@
 #include <Mod/Points/App/Points.h>
 
 class TopoDS_Shape;
-class BRepExtrema_DistShapeShape;
 
 namespace MeshCore {
 class MeshKernel;
@@ -146,17 +145,26 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
-class InspectionExport InspectNominalShape : public InspectNominalGeometry
+/**
+ * Calculates the distance to a shape with the help of a tessellation of the shape.
+ * The triangles are kept in a bounding volume hierarchy so that the nearest triangle
+ * of a point is found quickly. Only if the approximate distance lies within \a band
+ * the exact distance is computed, and then only to the faces whose triangles are
+ * near the point. Outside the band the distance may be off by up to \a deflection.
+ */
+class InspectionExport InspectNominalFastShape : public InspectNominalGeometry
 {
 public:
-    InspectNominalShape(const TopoDS_Shape&, float offset);
-    ~InspectNominalShape();
+    InspectNominalFastShape(const TopoDS_Shape&, float offset, float deflection, float band);
+    ~InspectNominalFastShape();
     virtual float getDistance(const Base::Vector3f&) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
-    const TopoDS_Shape& _rShape;
-    bool isSolid;
+    float exactDistance(const Base::Vector3f&, float approx, const std::vector<int>& faces) const;
+
+private:
+    class Private;
+    Private* d;
 };
 
 class InspectionExport PropertyDistanceList: public App::PropertyLists
@@ -0,0 +1,104 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+
+import math
+import random
+import unittest
+import FreeCAD, Points
+
+# the distance of points beyond the search radius
+OutOfRange = 1e30
+
+class InspectionShapeTestCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("InspectionShapeTest")
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+
+    def inspect(self, points, nominal, radius):
+        actual = self.doc.addObject("Points::Feature", "Actual")
+        kernel = Points.Points()
+        kernel.addPoints(points)
+        actual.Points = kernel
+        inspection = self.doc.addObject("Inspection::Feature", "Inspection")
+        inspection.Actual = actual
+        inspection.Nominals = [nominal]
+        inspection.SearchRadius = radius
+        self.doc.recompute()
+        return inspection.Distances
+
+    def testBox(self):
+        box = self.doc.addObject("Part::Box", "Box")
+        points = [(5, 5, 10.02), (5, 5, 9.97), (10.03, 5, 5), (-0.01, 5, 5),
+                  (10.02, 10.02, 10.02), (10.03, 10.03, 5), (5, 5, 11)]
+        expected = [0.02, -0.03, 0.03, 0.01,
+                    math.sqrt(3) * 0.02, math.sqrt(2) * 0.03, OutOfRange]
+        distances = self.inspect(points, box, 0.05)
+        self.assertEqual(len(distances), len(points))
+        for dist, ref in zip(distances, expected):
+            if ref == OutOfRange:
+                self.assertGreater(dist, ref)
+            else:
+                self.assertAlmostEqual(dist, ref, 4)
+
+    def inspectCylinder(self, band):
+        # Enough points for several blocks, so the exact distances to the curved face
+        # are computed in several threads at the same time
+        cylinder = self.doc.addObject("Part::Cylinder", "Cylinder")
+        cylinder.Radius = 5
+        cylinder.Height = 10
+        random.seed(1)
+        points = []
+        expected = []
+        for i in range(50000):
+            angle = random.uniform(0, 2 * math.pi)
+            offset = random.uniform(-0.04, 0.04)
+            radius = 5 + offset
+            points.append((radius * math.cos(angle), radius * math.sin(angle), random.uniform(1, 9)))
+            expected.append(offset)
+
+        hGrp = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Inspection")
+        refineBand = hGrp.GetFloat("RefineBand", -1.0)
+        try:
+            hGrp.SetFloat("RefineBand", band)
+            distances = self.inspect(points, cylinder, 0.05)
+        finally:
+            hGrp.SetFloat("RefineBand", refineBand)
+        self.assertEqual(len(distances), len(points))
+        return distances, expected
+
+    def testCylinder(self):
+        # the band covers the search radius, so all distances are exact
+        distances, expected = self.inspectCylinder(0.05)
+        for dist, ref in zip(distances, expected):
+            self.assertAlmostEqual(dist, ref, 4)
+
+    def testCylinderDefaultBand(self):
+        # outside the default band the distances are off by at most the deflection,
+        # which is a tenth of the search radius
+        distances, expected = self.inspectCylinder(-1.0)
+        for dist, ref in zip(distances, expected):
+            self.assertAlmostEqual(dist, ref, delta=0.005)
+            if abs(ref) < 0.01:
+                self.assertAlmostEqual(dist, ref, 4)
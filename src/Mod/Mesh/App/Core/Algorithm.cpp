@@ -25,6 +25,7 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <atomic>
 #endif
 
 #include "Algorithm.h"
@@ -33,6 +34,7 @@
 #include "Iterator.h"
 #include "Grid.h"
 #include "Triangulation.h"
+#include "Functional.h"
 
 #include <Base/Console.h>
 #include <Base/Sequencer.h>
@@ -47,7 +49,7 @@ bool MeshAlgorithm::IsVertexVisible (const Base::Vector3f &rcVertex, const Base:
 {
     Base::Vector3f cDirection = rcVertex - rcView;
     float fDistance = cDirection.Length();
-    Base::Vector3f cIntsct; unsigned long uInd;
+    Base::Vector3f cIntsct; FacetIndex uInd;
 
     // search for the nearest facet to rcView in direction to rcVertex
     if (NearestFacetOnRay(rcView, cDirection, /*1.2f*fDistance,*/ rclGrid, cIntsct, uInd)) {
@@ -66,11 +68,11 @@ bool MeshAlgorithm::IsVertexVisible (const Base::Vector3f &rcVertex, const Base:
 }
 
 bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, Base::Vector3f &rclRes,
-                                       unsigned long &rulFacet) const
+                                       FacetIndex &rulFacet) const
 {
     Base::Vector3f clProj, clRes;
     bool bSol = false;
-    unsigned long ulInd = 0;
+    FacetIndex ulInd = 0;
 
     // langsame Ausfuehrung ohne Grid
     MeshFacetIterator  clFIter(_rclMesh);
@@ -99,9 +101,9 @@ bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::
 }
 
 bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const MeshFacetGrid &rclGrid,
-                                       Base::Vector3f &rclRes, unsigned long &rulFacet) const
+                                       Base::Vector3f &rclRes, FacetIndex &rulFacet) const
 {
-    std::vector<unsigned long> aulFacets;
+    std::vector<FacetIndex> aulFacets;
     MeshGridIterator clGridIter(rclGrid);
 
     if (clGridIter.InitOnRay(rclPt, rclDir, aulFacets) == true) {
@@ -120,9 +122,9 @@ bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::
 }
 
 bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, float fMaxSearchArea,
-                                       const MeshFacetGrid &rclGrid, Base::Vector3f &rclRes, unsigned long &rulFacet) const
+                                       const MeshFacetGrid &rclGrid, Base::Vector3f &rclRes, FacetIndex &rulFacet) const
 {
-    std::vector<unsigned long> aulFacets;
+    std::vector<FacetIndex> aulFacets;
     MeshGridIterator  clGridIter(rclGrid);
 
     if (clGridIter.InitOnRay(rclPt, rclDir, fMaxSearchArea, aulFacets) == true) {
@@ -140,14 +142,14 @@ bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::
     return false;
 }
 
-bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<unsigned long> &raulFacets,
-                                       Base::Vector3f &rclRes, unsigned long &rulFacet) const
+bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<FacetIndex> &raulFacets,
+                                       Base::Vector3f &rclRes, FacetIndex &rulFacet) const
 {
     Base::Vector3f  clProj, clRes;
     bool bSol = false;
-    unsigned long ulInd = 0;
+    FacetIndex ulInd = 0;
 
-    for (std::vector<unsigned long>::const_iterator pI = raulFacets.begin(); pI != raulFacets.end(); ++pI) {
+    for (std::vector<FacetIndex>::const_iterator pI = raulFacets.begin(); pI != raulFacets.end(); ++pI) {
         MeshGeomFacet rclSFacet = _rclMesh.GetFacet(*pI);
         if (rclSFacet.Foraminate(rclPt, rclDir, clRes) == true) {
             if (bSol == false) {// erste Loesung
@@ -172,14 +174,14 @@ bool MeshAlgorithm::NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::
     return bSol;
 }
 
-bool MeshAlgorithm::RayNearestField (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<unsigned long> &raulFacets,
-                                     Base::Vector3f &rclRes, unsigned long &rulFacet, float /*fMaxAngle*/) const
+bool MeshAlgorithm::RayNearestField (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<FacetIndex> &raulFacets,
+                                     Base::Vector3f &rclRes, FacetIndex &rulFacet, float /*fMaxAngle*/) const
 {
     Base::Vector3f  clProj, clRes;
     bool bSol = false;
-    unsigned long ulInd = 0;
+    FacetIndex ulInd = 0;
 
-    for (std::vector<unsigned long>::const_iterator pF = raulFacets.begin(); pF != raulFacets.end(); ++pF) {
+    for (std::vector<FacetIndex>::const_iterator pF = raulFacets.begin(); pF != raulFacets.end(); ++pF) {
         if (_rclMesh.GetFacet(*pF).Foraminate(rclPt, rclDir, clRes/*, fMaxAngle*/) == true) {
             if (bSol == false) { // erste Loesung
                 bSol   = true;
@@ -203,18 +205,18 @@ bool MeshAlgorithm::RayNearestField (const Base::Vector3f &rclPt, const Base::Ve
     return bSol;
 }
 
-bool MeshAlgorithm::FirstFacetToVertex(const Base::Vector3f &rPt, float fMaxDistance, const MeshFacetGrid &rGrid, unsigned long &uIndex) const
+bool MeshAlgorithm::FirstFacetToVertex(const Base::Vector3f &rPt, float fMaxDistance, const MeshFacetGrid &rGrid, FacetIndex &uIndex) const
 {
     const float fEps = 0.001f;
 
     bool found = false;
-    std::vector<unsigned long> facets;
+    std::vector<FacetIndex> facets;
 
     // get the facets of the grid the point lies into
     rGrid.GetElements(rPt, facets);
 
     // Check all facets inside the grid if the point is part of it
-    for (std::vector<unsigned long>::iterator it = facets.begin(); it != facets.end(); ++it) {
+    for (std::vector<FacetIndex>::iterator it = facets.begin(); it != facets.end(); ++it) {
         MeshGeomFacet cFacet = this->_rclMesh.GetFacet(*it);
         if (cFacet.IsPointOfFace(rPt, fMaxDistance)) {
             found = true;
@@ -289,37 +291,37 @@ Base::Vector3f MeshAlgorithm::GetGravityPoint() const
 
 void MeshAlgorithm::GetMeshBorders (std::list<std::vector<Base::Vector3f> > &rclBorders) const
 {
-    std::vector<unsigned long> aulAllFacets(_rclMesh.CountFacets());
+    std::vector<FacetIndex> aulAllFacets(_rclMesh.CountFacets());
     unsigned long k = 0;
-    for (std::vector<unsigned long>::iterator pI = aulAllFacets.begin(); pI != aulAllFacets.end(); ++pI)
+    for (std::vector<FacetIndex>::iterator pI = aulAllFacets.begin(); pI != aulAllFacets.end(); ++pI)
         *pI = k++;
 
     GetFacetBorders(aulAllFacets, rclBorders);
 }
 
-void MeshAlgorithm::GetMeshBorders (std::list<std::vector<unsigned long> > &rclBorders) const
+void MeshAlgorithm::GetMeshBorders (std::list<std::vector<PointIndex> > &rclBorders) const
 {
-    std::vector<unsigned long> aulAllFacets(_rclMesh.CountFacets());
+    std::vector<FacetIndex> aulAllFacets(_rclMesh.CountFacets());
     unsigned long k = 0;
-    for (std::vector<unsigned long>::iterator pI = aulAllFacets.begin(); pI != aulAllFacets.end(); ++pI)
+    for (std::vector<FacetIndex>::iterator pI = aulAllFacets.begin(); pI != aulAllFacets.end(); ++pI)
         *pI = k++;
 
     GetFacetBorders(aulAllFacets, rclBorders, true);
 }
 
-void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd, std::list<std::vector<Base::Vector3f> > &rclBorders) const
+void MeshAlgorithm::GetFacetBorders (const std::vector<FacetIndex> &raulInd, std::list<std::vector<Base::Vector3f> > &rclBorders) const
 {
 #if 1
   const MeshPointArray &rclPAry = _rclMesh._aclPointArray;
-  std::list<std::vector<unsigned long> > aulBorders;
+  std::list<std::vector<PointIndex> > aulBorders;
 
   GetFacetBorders (raulInd, aulBorders, true);
-  for ( std::list<std::vector<unsigned long> >::iterator it = aulBorders.begin(); it != aulBorders.end(); ++it )
+  for ( std::list<std::vector<PointIndex> >::iterator it = aulBorders.begin(); it != aulBorders.end(); ++it )
   {
     std::vector<Base::Vector3f> boundary;
     boundary.reserve( it->size() );
 
-    for ( std::vector<unsigned long>::iterator jt = it->begin(); jt != it->end(); ++jt )
+    for ( std::vector<PointIndex>::iterator jt = it->begin(); jt != it->end(); ++jt )
       boundary.push_back(rclPAry[*jt]);
 
     rclBorders.push_back( boundary );
@@ -330,18 +332,18 @@ void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd,
 
   // alle Facets markieren die in der Indizie-Liste vorkommen
   ResetFacetFlag(MeshFacet::VISIT);
-  for (std::vector<unsigned long>::const_iterator pIter = raulInd.begin(); pIter != raulInd.end(); ++pIter)
+  for (std::vector<FacetIndex>::const_iterator pIter = raulInd.begin(); pIter != raulInd.end(); ++pIter)
     rclFAry[*pIter].SetFlag(MeshFacet::VISIT);
 
   std::list<std::pair<unsigned long, unsigned long> >  aclEdges;
   // alle Randkanten suchen und ablegen (unsortiert)
-  for (std::vector<unsigned long>::const_iterator pIter2 = raulInd.begin(); pIter2 != raulInd.end(); ++pIter2)
+  for (std::vector<FacetIndex>::const_iterator pIter2 = raulInd.begin(); pIter2 != raulInd.end(); ++pIter2)
   {
     const MeshFacet  &rclFacet = rclFAry[*pIter2];
     for (int i = 0; i < 3; i++)
     {
-      unsigned long ulNB = rclFacet._aulNeighbours[i];
-      if (ulNB != ULONG_MAX)
+      FacetIndex ulNB = rclFacet._aulNeighbours[i];
+      if (ulNB != FACET_INDEX_MAX)
       {
         if (rclFAry[ulNB].IsFlag(MeshFacet::VISIT) == true)
           continue;
@@ -356,7 +358,7 @@ void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd,
 
   // Kanten aus der unsortieren Kantenliste suchen
   const MeshPointArray &rclPAry = _rclMesh._aclPointArray;
-  unsigned long              ulFirst, ulLast;
+  PointIndex              ulFirst, ulLast;
   std::list<Base::Vector3f>   clBorder;
   ulFirst = aclEdges.begin()->first;
   ulLast  = aclEdges.begin()->second;
@@ -418,24 +420,24 @@ void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd,
 #endif
 }
 
-void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd, 
-                                     std::list<std::vector<unsigned long> > &rclBorders,
+void MeshAlgorithm::GetFacetBorders (const std::vector<FacetIndex> &raulInd, 
+                                     std::list<std::vector<FacetIndex> > &rclBorders,
                                      bool ignoreOrientation) const
 {
     const MeshFacetArray &rclFAry = _rclMesh._aclFacetArray;
 
     // mark all facets that are in the indices list
     ResetFacetFlag(MeshFacet::VISIT);
-    for (std::vector<unsigned long>::const_iterator it = raulInd.begin(); it != raulInd.end(); ++it)
+    for (std::vector<FacetIndex>::const_iterator it = raulInd.begin(); it != raulInd.end(); ++it)
         rclFAry[*it].SetFlag(MeshFacet::VISIT);
 
     // collect all boundary edges (unsorted)
     std::list<std::pair<unsigned long, unsigned long> >  aclEdges;
-    for (std::vector<unsigned long>::const_iterator it = raulInd.begin(); it != raulInd.end(); ++it) {
+    for (std::vector<FacetIndex>::const_iterator it = raulInd.begin(); it != raulInd.end(); ++it) {
         const MeshFacet  &rclFacet = rclFAry[*it];
         for (unsigned short i = 0; i < 3; i++) {
-            unsigned long ulNB = rclFacet._aulNeighbours[i];
-            if (ulNB != ULONG_MAX) {
+            FacetIndex ulNB = rclFacet._aulNeighbours[i];
+            if (ulNB != FACET_INDEX_MAX) {
                 if (rclFAry[ulNB].IsFlag(MeshFacet::VISIT) == true)
                     continue;
             }
@@ -448,7 +450,7 @@ void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd,
         return; // no borders found (=> solid)
 
     // search for edges in the unsorted list
-    unsigned long              ulFirst, ulLast;
+    FacetIndex              ulFirst, ulLast;
     std::list<unsigned long>   clBorder;
     ulFirst = aclEdges.begin()->first;
     ulLast  = aclEdges.begin()->second;
@@ -513,7 +515,7 @@ void MeshAlgorithm::GetFacetBorders (const std::vector<unsigned long> &raulInd,
     }
 }
 
-void MeshAlgorithm::GetMeshBorder(unsigned long uFacet, std::list<unsigned long>& rBorder) const
+void MeshAlgorithm::GetMeshBorder(FacetIndex uFacet, std::list<FacetIndex>& rBorder) const
 {
     const MeshFacetArray &rFAry = _rclMesh._aclFacetArray;
     std::list<std::pair<unsigned long, unsigned long> >  openEdges;
@@ -523,7 +525,7 @@ void MeshAlgorithm::GetMeshBorder(unsigned long uFacet, std::list<unsigned long>
     MeshFacetArray::_TConstIterator face = rFAry.begin() + uFacet;
     for (unsigned short i = 0; i < 3; i++)
     {
-        if (face->_aulNeighbours[i] == ULONG_MAX)
+        if (face->_aulNeighbours[i] == FACET_INDEX_MAX)
             openEdges.push_back(face->GetEdge(i));
     }
 
@@ -536,14 +538,14 @@ void MeshAlgorithm::GetMeshBorder(unsigned long uFacet, std::list<unsigned long>
             continue;
         for (unsigned short i = 0; i < 3; i++)
         {
-            if (it->_aulNeighbours[i] == ULONG_MAX)
+            if (it->_aulNeighbours[i] == FACET_INDEX_MAX)
                 openEdges.push_back(it->GetEdge(i));
         }
     }
 
     // Start with the edge that is associated to uFacet
-    unsigned long ulFirst = openEdges.begin()->first;
-    unsigned long ulLast  = openEdges.begin()->second;
+    FacetIndex ulFirst = openEdges.begin()->first;
+    FacetIndex ulLast  = openEdges.begin()->second;
 
     openEdges.erase(openEdges.begin());
     rBorder.push_back(ulFirst);
@@ -579,14 +581,14 @@ void MeshAlgorithm::GetMeshBorder(unsigned long uFacet, std::list<unsigned long>
     }
 }
 
-void MeshAlgorithm::SplitBoundaryLoops( std::list<std::vector<unsigned long> >& aBorders )
+void MeshAlgorithm::SplitBoundaryLoops( std::list<std::vector<PointIndex> >& aBorders )
 {
     // Count the number of open edges for each point
-    std::map<unsigned long, int> openPointDegree;
+    std::map<PointIndex, int> openPointDegree;
     for (MeshFacetArray::_TConstIterator jt = _rclMesh._aclFacetArray.begin();
         jt != _rclMesh._aclFacetArray.end(); ++jt) {
         for (int i=0; i<3; i++) {
-            if (jt->_aulNeighbours[i] == ULONG_MAX) {
+            if (jt->_aulNeighbours[i] == FACET_INDEX_MAX) {
                 openPointDegree[jt->_aulPoints[i]]++;
                 openPointDegree[jt->_aulPoints[(i+1)%3]]++;
             }
@@ -594,11 +596,11 @@ void MeshAlgorithm::SplitBoundaryLoops( std::list<std::vector<unsigned long> >&
     }
 
     // go through all boundaries and split them if needed
-    std::list<std::vector<unsigned long> > aSplitBorders;
-    for (std::list<std::vector<unsigned long> >::iterator it = aBorders.begin();
+    std::list<std::vector<PointIndex> > aSplitBorders;
+    for (std::list<std::vector<PointIndex> >::iterator it = aBorders.begin();
         it != aBorders.end(); ++it) {
         bool split=false;
-        for (std::vector<unsigned long>::iterator jt = it->begin(); jt != it->end(); ++jt) {
+        for (std::vector<PointIndex>::iterator jt = it->begin(); jt != it->end(); ++jt) {
             // two (or more) boundaries meet in one non-manifold point
             if (openPointDegree[*jt] > 2) {
                 split = true;
@@ -615,17 +617,17 @@ void MeshAlgorithm::SplitBoundaryLoops( std::list<std::vector<unsigned long> >&
     aBorders = aSplitBorders;
 }
 
-void MeshAlgorithm::SplitBoundaryLoops(const std::vector<unsigned long>& rBound,
-                                       std::list<std::vector<unsigned long> >& aBorders)
+void MeshAlgorithm::SplitBoundaryLoops(const std::vector<PointIndex>& rBound,
+                                       std::list<std::vector<PointIndex> >& aBorders)
 {
-    std::map<unsigned long, int> aPtDegree;
-    std::vector<unsigned long> cBound;
-    for (std::vector<unsigned long>::const_iterator it = rBound.begin(); it != rBound.end(); ++it) {
+    std::map<PointIndex, int> aPtDegree;
+    std::vector<PointIndex> cBound;
+    for (std::vector<PointIndex>::const_iterator it = rBound.begin(); it != rBound.end(); ++it) {
         int deg = (aPtDegree[*it]++);
         if (deg > 0) {
-            for (std::vector<unsigned long>::iterator jt = cBound.begin(); jt != cBound.end(); ++jt) {
+            for (std::vector<PointIndex>::iterator jt = cBound.begin(); jt != cBound.end(); ++jt) {
                 if (*jt == *it) {
-                    std::vector<unsigned long> cBoundLoop;
+                    std::vector<PointIndex> cBoundLoop;
                     cBoundLoop.insert(cBoundLoop.end(), jt, cBound.end());
                     cBoundLoop.push_back(*it);
                     cBound.erase(jt, cBound.end());
@@ -640,10 +642,10 @@ void MeshAlgorithm::SplitBoundaryLoops(const std::vector<unsigned long>& rBound,
     }
 }
 
-bool MeshAlgorithm::FillupHole(const std::vector<unsigned long>& boundary, 
+bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary, 
                                AbstractPolygonTriangulator& cTria, 
                                MeshFacetArray& rFaces, MeshPointArray& rPoints,
-                               int level, const MeshRefPointToFacets* pP2FStructure) const
+                               int level, const MeshCsrPointToFacets* pP2FStructure) const
 {
     if (boundary.front() == boundary.back()) {
         // first and last vertex are identical
@@ -657,14 +659,10 @@ bool MeshAlgorithm::FillupHole(const std::vector<unsigned long>& boundary,
     // Get a facet as reference coordinate system
     MeshGeomFacet rTriangle;
     MeshFacet rFace;
-    unsigned long refPoint0 = *(boundary.begin());
-    unsigned long refPoint1 = *(boundary.begin()+1);
+    PointIndex refPoint0 = *(boundary.begin());
+    PointIndex refPoint1 = *(boundary.begin()+1);
     if (pP2FStructure) {
-        const std::set<unsigned long>& ring1 = (*pP2FStructure)[refPoint0];
-        const std::set<unsigned long>& ring2 = (*pP2FStructure)[refPoint1];
-        std::vector<unsigned long> f_int;
-        std::set_intersection(ring1.begin(), ring1.end(), ring2.begin(), ring2.end(),
-            std::back_insert_iterator<std::vector<unsigned long> >(f_int));
+        std::vector<FacetIndex> f_int = pP2FStructure->GetIndices(refPoint0, refPoint1);
         if (f_int.size() != 1)
             return false; // error, this must be an open edge!
 
@@ -691,13 +689,13 @@ bool MeshAlgorithm::FillupHole(const std::vector<unsigned long>& boundary,
 
     // add points to the polygon
     std::vector<Base::Vector3f> polygon;
-    for (std::vector<unsigned long>::const_iterator jt = boundary.begin(); jt != boundary.end(); ++jt) {
+    for (std::vector<PointIndex>::const_iterator jt = boundary.begin(); jt != boundary.end(); ++jt) {
         polygon.push_back(_rclMesh._aclPointArray[*jt]);
         rPoints.push_back(_rclMesh._aclPointArray[*jt]);
     }
 
     // remove the last added point if it is duplicated
-    std::vector<unsigned long> bounds = boundary;
+    std::vector<PointIndex> bounds = boundary;
     if (boundary.front() == boundary.back()) {
         bounds.pop_back();
         polygon.pop_back();
@@ -712,8 +710,8 @@ bool MeshAlgorithm::FillupHole(const std::vector<unsigned long>& boundary,
 
     std::vector<Base::Vector3f> surf_pts = cTria.GetPolygon();
     if (pP2FStructure && level > 0) {
-        std::set<unsigned long> index = pP2FStructure->NeighbourPoints(boundary, level);
-        for (std::set<unsigned long>::iterator it = index.begin(); it != index.end(); ++it) {
+        std::set<PointIndex> index = pP2FStructure->NeighbourPoints(boundary, level);
+        for (std::set<PointIndex>::iterator it = index.begin(); it != index.end(); ++it) {
             Base::Vector3f pt(_rclMesh._aclPointArray[*it]);
             surf_pts.push_back(pt);
         }
@@ -816,28 +814,28 @@ bool MeshAlgorithm::FillupHole(const std::vector<unsigned long>& boundary,
     return false;
 }
 
-void MeshAlgorithm::SetFacetsProperty(const std::vector<unsigned long> &raulInds, const std::vector<unsigned long> &raulProps) const
+void MeshAlgorithm::SetFacetsProperty(const std::vector<FacetIndex> &raulInds, const std::vector<unsigned long> &raulProps) const
 {
     if (raulInds.size() != raulProps.size()) return;
 
     std::vector<unsigned long>::const_iterator iP = raulProps.begin();
-    for (std::vector<unsigned long>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i, ++iP)
+    for (std::vector<FacetIndex>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i, ++iP)
         _rclMesh._aclFacetArray[*i].SetProperty(*iP);
 }
 
-void MeshAlgorithm::SetFacetsFlag (const std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const
+void MeshAlgorithm::SetFacetsFlag (const std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const
 {
-    for (std::vector<unsigned long>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
+    for (std::vector<FacetIndex>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
         _rclMesh._aclFacetArray[*i].SetFlag(tF);
 }
 
-void MeshAlgorithm::SetPointsFlag (const std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const 
+void MeshAlgorithm::SetPointsFlag (const std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const 
 {
-    for (std::vector<unsigned long>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
+    for (std::vector<PointIndex>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
         _rclMesh._aclPointArray[*i].SetFlag(tF);
 }
 
-void MeshAlgorithm::GetFacetsFlag (std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const
+void MeshAlgorithm::GetFacetsFlag (std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const
 {
     raulInds.reserve(raulInds.size() + CountFacetFlag(tF));
     MeshFacetArray::_TConstIterator beg = _rclMesh._aclFacetArray.begin();
@@ -848,7 +846,7 @@ void MeshAlgorithm::GetFacetsFlag (std::vector<unsigned long> &raulInds, MeshFac
     }
 }
 
-void MeshAlgorithm::GetPointsFlag (std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const
+void MeshAlgorithm::GetPointsFlag (std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const
 {
     raulInds.reserve(raulInds.size() + CountPointFlag(tF));
     MeshPointArray::_TConstIterator beg = _rclMesh._aclPointArray.begin();
@@ -859,15 +857,15 @@ void MeshAlgorithm::GetPointsFlag (std::vector<unsigned long> &raulInds, MeshPoi
     }
 }
 
-void MeshAlgorithm::ResetFacetsFlag (const std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const
+void MeshAlgorithm::ResetFacetsFlag (const std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const
 {
-    for (std::vector<unsigned long>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
+    for (std::vector<FacetIndex>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
         _rclMesh._aclFacetArray[*i].ResetFlag(tF);
 }
 
-void MeshAlgorithm::ResetPointsFlag (const std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const
+void MeshAlgorithm::ResetPointsFlag (const std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const
 {
-    for (std::vector<unsigned long>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
+    for (std::vector<PointIndex>::const_iterator i = raulInds.begin(); i != raulInds.end(); ++i)
         _rclMesh._aclPointArray[*i].ResetFlag(tF);
 }
 
@@ -905,7 +903,7 @@ unsigned long MeshAlgorithm::CountPointFlag (MeshPoint::TFlagType tF) const
                          [flag, tF](const MeshPoint& f) { return flag(f, tF);});
 }
 
-void MeshAlgorithm::GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, std::vector<unsigned long> &raclCutted ) const
+void MeshAlgorithm::GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, std::vector<FacetIndex> &raclCutted ) const
 {
     MeshFacetIterator cFIt(_rclMesh);
     MeshFacetIterator cTIt(rToolMesh);
@@ -948,7 +946,7 @@ void MeshAlgorithm::GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Ba
 }
 
 void MeshAlgorithm::GetFacetsFromToolMesh(const MeshKernel& rToolMesh, const Base::Vector3f& rcDir,
-                                          const MeshFacetGrid& rGrid, std::vector<unsigned long> &raclCutted) const
+                                          const MeshFacetGrid& rGrid, std::vector<FacetIndex> &raclCutted) const
 {
     // iterator over grid structure
     MeshGridIterator clGridIter(rGrid);
@@ -966,7 +964,7 @@ void MeshAlgorithm::GetFacetsFromToolMesh(const MeshKernel& rToolMesh, const Bas
     // box is inside the toolmesh all facets are stored with no further tests because they must
     // also lie inside the toolmesh. Finally, if the grid box intersects with the toolmesh we must
     // also check for each whether it intersects with the toolmesh as well.
-    std::vector<unsigned long> aulInds;
+    std::vector<FacetIndex> aulInds;
     for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
         int ret = cToolAlg.Surround(clGridIter.GetBoundBox(), rcDir);
 
@@ -997,7 +995,7 @@ void MeshAlgorithm::GetFacetsFromToolMesh(const MeshKernel& rToolMesh, const Bas
     Base::SequencerLauncher seq("Check facets...", aulInds.size());
 
     // check all facets
-    for (std::vector<unsigned long>::iterator it = aulInds.begin(); it != aulInds.end(); ++it) {
+    for (std::vector<FacetIndex>::iterator it = aulInds.begin(); it != aulInds.end(); ++it) {
         cFIt.Set(*it);
 
         // check each point of each facet
@@ -1104,9 +1102,9 @@ int MeshAlgorithm::Surround(const Base::BoundBox3f& rBox, const Base::Vector3f&
 }
 
 void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid, const Base::ViewProjMethod* pclProj, const Base::Polygon2d& rclPoly,
-                                bool bInner, std::vector<unsigned long> &raulFacets) const
+                                bool bInner, std::vector<FacetIndex> &raulFacets) const
 {
-    std::vector<unsigned long>::iterator it;
+    std::vector<FacetIndex>::iterator it;
     MeshFacetIterator clIter(_rclMesh, 0);
     Base::Vector3f clPt2d;
     Base::Vector3f clGravityOfFacet;
@@ -1120,7 +1118,7 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid, const Base::ViewPr
     if (bInner) {
         BoundBox3f clBBox3d;
         BoundBox2d clViewBBox;
-        std::vector<unsigned long> aulAllElements;
+        std::vector<FacetIndex> aulAllElements;
         // iterator for the bounding box grids
         MeshGridIterator clGridIter(rclGrid);
         for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
@@ -1183,7 +1181,7 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid, const Base::ViewPr
 }
 
 void MeshAlgorithm::CheckFacets(const Base::ViewProjMethod* pclProj, const Base::Polygon2d& rclPoly,
-                                bool bInner, std::vector<unsigned long> &raulFacets) const
+                                bool bInner, std::vector<FacetIndex> &raulFacets) const
 {
     const MeshPointArray& p = _rclMesh.GetPoints();
     const MeshFacetArray& f = _rclMesh.GetFacets();
@@ -1250,13 +1248,13 @@ void MeshAlgorithm::SubSampleByCount (unsigned long ulCtPoints, std::vector<Base
 }
 
 void MeshAlgorithm::SearchFacetsFromPolyline (const std::vector<Base::Vector3f> &rclPolyline, float fRadius,
-                                              const MeshFacetGrid& rclGrid, std::vector<unsigned long> &rclResultFacetsIndices) const
+                                              const MeshFacetGrid& rclGrid, std::vector<FacetIndex> &rclResultFacetsIndices) const
 {
   rclResultFacetsIndices.clear();
   if ( rclPolyline.size() < 3 )
     return; // no polygon defined
 
-  std::set<unsigned long>  aclFacets;
+  std::set<FacetIndex>  aclFacets;
   for (std::vector<Base::Vector3f>::const_iterator pV = rclPolyline.begin(); pV < (rclPolyline.end() - 1); ++pV)
   {
     const Base::Vector3f &rclP0 = *pV, &rclP1 = *(pV + 1);
@@ -1266,7 +1264,7 @@ void MeshAlgorithm::SearchFacetsFromPolyline (const std::vector<Base::Vector3f>
     clSegmBB.Add(rclP1);
     clSegmBB.Enlarge(fRadius);  // BB um Suchradius vergroessern
 
-    std::vector<unsigned long> aclBBFacets;
+    std::vector<FacetIndex> aclBBFacets;
     unsigned long k = rclGrid.Inside(clSegmBB, aclBBFacets, false);
     for (unsigned long i = 0; i < k; i++)
     {
@@ -1278,17 +1276,17 @@ void MeshAlgorithm::SearchFacetsFromPolyline (const std::vector<Base::Vector3f>
   rclResultFacetsIndices.insert(rclResultFacetsIndices.begin(), aclFacets.begin(), aclFacets.end());
 }
 
-void MeshAlgorithm::CutBorderFacets (std::vector<unsigned long> &raclFacetIndices, unsigned short usLevel) const
+void MeshAlgorithm::CutBorderFacets (std::vector<FacetIndex> &raclFacetIndices, unsigned short usLevel) const
 {
-  std::vector<unsigned long> aclToDelete;
+  std::vector<FacetIndex> aclToDelete;
 
   CheckBorderFacets(raclFacetIndices, aclToDelete, usLevel);
 
   // alle gefunden "Rand"-Facetsindizes" aus dem Array loeschen
-  std::vector<unsigned long>  aclResult;
-  std::set<unsigned long>     aclTmp(aclToDelete.begin(), aclToDelete.end());
+  std::vector<FacetIndex>  aclResult;
+  std::set<FacetIndex>     aclTmp(aclToDelete.begin(), aclToDelete.end());
 
-  for (std::vector<unsigned long>::iterator pI = raclFacetIndices.begin(); pI != raclFacetIndices.end(); ++pI)
+  for (std::vector<FacetIndex>::iterator pI = raclFacetIndices.begin(); pI != raclFacetIndices.end(); ++pI)
   {
     if (aclTmp.find(*pI) == aclTmp.end())
       aclResult.push_back(*pI);
@@ -1304,7 +1302,7 @@ unsigned long MeshAlgorithm::CountBorderEdges() const
     MeshFacetArray::_TConstIterator end = rclFAry.end();
     for (MeshFacetArray::_TConstIterator it = rclFAry.begin(); it != end; ++it) {
         for (int i=0; i<3; i++) {
-            if (it->_aulNeighbours[i] == ULONG_MAX)
+            if (it->_aulNeighbours[i] == FACET_INDEX_MAX)
                 cnt++;
         }
     }
@@ -1312,7 +1310,7 @@ unsigned long MeshAlgorithm::CountBorderEdges() const
     return cnt;
 }
 
-void MeshAlgorithm::CheckBorderFacets (const std::vector<unsigned long> &raclFacetIndices, std::vector<unsigned long> &raclResultIndices, unsigned short usLevel) const
+void MeshAlgorithm::CheckBorderFacets (const std::vector<FacetIndex> &raclFacetIndices, std::vector<FacetIndex> &raclResultIndices, unsigned short usLevel) const
 {
   ResetFacetFlag(MeshFacet::TMP0);
   SetFacetsFlag(raclFacetIndices, MeshFacet::TMP0);
@@ -1321,12 +1319,12 @@ void MeshAlgorithm::CheckBorderFacets (const std::vector<unsigned long> &raclFac
 
   for (unsigned short usL = 0; usL < usLevel; usL++)
   {
-    for (std::vector<unsigned long>::const_iterator pF = raclFacetIndices.begin(); pF != raclFacetIndices.end(); ++pF)
+    for (std::vector<FacetIndex>::const_iterator pF = raclFacetIndices.begin(); pF != raclFacetIndices.end(); ++pF)
     {
       for (int i = 0; i < 3; i++)
       {
-        unsigned long ulNB = rclFAry[*pF]._aulNeighbours[i];
-        if (ulNB == ULONG_MAX)
+        FacetIndex ulNB = rclFAry[*pF]._aulNeighbours[i];
+        if (ulNB == FACET_INDEX_MAX)
         {
           raclResultIndices.push_back(*pF);
           rclFAry[*pF].ResetFlag(MeshFacet::TMP0);
@@ -1343,20 +1341,20 @@ void MeshAlgorithm::CheckBorderFacets (const std::vector<unsigned long> &raclFac
   }
 }
 
-void MeshAlgorithm::GetBorderPoints (const std::vector<unsigned long> &raclFacetIndices, std::set<unsigned long> &raclResultPointsIndices) const
+void MeshAlgorithm::GetBorderPoints (const std::vector<FacetIndex> &raclFacetIndices, std::set<PointIndex> &raclResultPointsIndices) const
 {
   ResetFacetFlag(MeshFacet::TMP0);
   SetFacetsFlag(raclFacetIndices, MeshFacet::TMP0);
 
   const MeshFacetArray &rclFAry = _rclMesh._aclFacetArray;
 
-  for (std::vector<unsigned long>::const_iterator pF = raclFacetIndices.begin(); pF != raclFacetIndices.end(); ++pF)
+  for (std::vector<FacetIndex>::const_iterator pF = raclFacetIndices.begin(); pF != raclFacetIndices.end(); ++pF)
   {
     for (int i = 0; i < 3; i++)
     {
       const MeshFacet &rclFacet = rclFAry[*pF];
-      unsigned long      ulNB     = rclFacet._aulNeighbours[i];
-      if (ulNB == ULONG_MAX)
+      FacetIndex      ulNB     = rclFacet._aulNeighbours[i];
+      if (ulNB == FACET_INDEX_MAX)
       {
         raclResultPointsIndices.insert(rclFacet._aulPoints[i]);
         raclResultPointsIndices.insert(rclFacet._aulPoints[(i+1)%3]);
@@ -1372,14 +1370,14 @@ void MeshAlgorithm::GetBorderPoints (const std::vector<unsigned long> &raclFacet
   }
 }
 
-bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const
+bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const
 {
   if (_rclMesh.CountFacets() == 0)
     return false;
 
   // calc each facet
   float fMinDist = FLOAT_MAX;
-  unsigned long ulInd   = ULONG_MAX;
+  unsigned long ulInd   = FACET_INDEX_MAX;
   MeshFacetIterator pF(_rclMesh);
   for (pF.Init(); pF.More(); pF.Next())
   {
@@ -1398,11 +1396,11 @@ bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, unsigned
   return true;
 }
 
-bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, const MeshFacetGrid& rclGrid, unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const
+bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, const MeshFacetGrid& rclGrid, FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const
 {
-  unsigned long ulInd = rclGrid.SearchNearestFromPoint(rclPt);
+  FacetIndex ulInd = rclGrid.SearchNearestFromPoint(rclPt);
 
-  if (ulInd == ULONG_MAX)
+  if (ulInd == FACET_INDEX_MAX)
   {
     return false;
   }
@@ -1415,11 +1413,11 @@ bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, const Me
 }
 
 bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, const MeshFacetGrid& rclGrid, float fMaxSearchArea,
-                                           unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const
+                                           FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const
 {
-  unsigned long ulInd = rclGrid.SearchNearestFromPoint(rclPt, fMaxSearchArea);
+  FacetIndex ulInd = rclGrid.SearchNearestFromPoint(rclPt, fMaxSearchArea);
 
-  if (ulInd == ULONG_MAX)
+  if (ulInd == FACET_INDEX_MAX)
     return false;  // no facets inside BoundingBox
 
   MeshGeomFacet rclSFacet = _rclMesh.GetFacet(ulInd);
@@ -1432,7 +1430,7 @@ bool MeshAlgorithm::NearestPointFromPoint (const Base::Vector3f &rclPt, const Me
 bool MeshAlgorithm::CutWithPlane (const Base::Vector3f &clBase, const Base::Vector3f &clNormal, const MeshFacetGrid &rclGrid,
                                   std::list<std::vector<Base::Vector3f> > &rclResult, float fMinEps, bool bConnectPolygons) const
 {
-  std::vector<unsigned long>  aulFacets;  
+  std::vector<FacetIndex>  aulFacets;  
 
   // Grid durschsuchen
   MeshGridIterator clGridIter(rclGrid);
@@ -1450,7 +1448,7 @@ bool MeshAlgorithm::CutWithPlane (const Base::Vector3f &clBase, const Base::Vect
   // alle Facets mit Ebene schneiden
   std::list<std::pair<Base::Vector3f, Base::Vector3f> > clTempPoly;  // Feld mit Schnittlinien (unsortiert, nicht verkettet)
 
-  for (std::vector<unsigned long>::iterator pF = aulFacets.begin(); pF != aulFacets.end(); ++pF)
+  for (std::vector<FacetIndex>::iterator pF = aulFacets.begin(); pF != aulFacets.end(); ++pF)
   {
     Base::Vector3f  clE1, clE2;
     const MeshGeomFacet clF(_rclMesh.GetFacet(*pF));
@@ -1630,9 +1628,9 @@ bool MeshAlgorithm::ConnectPolygons(std::list<std::vector<Base::Vector3f> > &clP
 }
 
 void MeshAlgorithm::GetFacetsFromPlane (const MeshFacetGrid &rclGrid, const Base::Vector3f& clNormal, float d, const Base::Vector3f &rclLeft,
-                                        const Base::Vector3f &rclRight, std::vector<unsigned long> &rclRes) const
+                                        const Base::Vector3f &rclRight, std::vector<FacetIndex> &rclRes) const
 {
-    std::vector<unsigned long> aulFacets;
+    std::vector<FacetIndex> aulFacets;
 
     Base::Vector3f clBase = d * clNormal;
 
@@ -1648,7 +1646,7 @@ void MeshAlgorithm::GetFacetsFromPlane (const MeshFacetGrid &rclGrid, const Base
     }
 
     // testing facet against planes
-    for (std::vector<unsigned long>::iterator pI = aulFacets.begin(); pI != aulFacets.end(); ++pI) {
+    for (std::vector<FacetIndex>::iterator pI = aulFacets.begin(); pI != aulFacets.end(); ++pI) {
         MeshGeomFacet clSFacet = _rclMesh.GetFacet(*pI);
         if (clSFacet.IntersectWithPlane(clBase, clNormal) == true) {
             bool bInner = false;
@@ -1664,29 +1662,29 @@ void MeshAlgorithm::GetFacetsFromPlane (const MeshFacetGrid &rclGrid, const Base
     }
 }
 
-void MeshAlgorithm::PointsFromFacetsIndices (const std::vector<unsigned long> &rvecIndices, std::vector<Base::Vector3f> &rvecPoints) const
+void MeshAlgorithm::PointsFromFacetsIndices (const std::vector<FacetIndex> &rvecIndices, std::vector<Base::Vector3f> &rvecPoints) const
 {
   const MeshFacetArray &rclFAry = _rclMesh._aclFacetArray;
   const MeshPointArray &rclPAry = _rclMesh._aclPointArray;
 
-  std::set<unsigned long> setPoints;
+  std::set<PointIndex> setPoints;
 
-  for (std::vector<unsigned long>::const_iterator itI = rvecIndices.begin(); itI != rvecIndices.end(); ++itI)
+  for (std::vector<FacetIndex>::const_iterator itI = rvecIndices.begin(); itI != rvecIndices.end(); ++itI)
   {
     for (int i = 0; i < 3; i++)
       setPoints.insert(rclFAry[*itI]._aulPoints[i]);
   }
 
   rvecPoints.clear();
-  for (std::set<unsigned long>::iterator itP = setPoints.begin(); itP != setPoints.end(); ++itP)
+  for (std::set<PointIndex>::iterator itP = setPoints.begin(); itP != setPoints.end(); ++itP)
     rvecPoints.push_back(rclPAry[*itP]);
 }
 
-bool MeshAlgorithm::Distance (const Base::Vector3f &rclPt, unsigned long ulFacetIdx, float fMaxDistance, float &rfDistance) const
+bool MeshAlgorithm::Distance (const Base::Vector3f &rclPt, FacetIndex ulFacetIdx, float fMaxDistance, float &rfDistance) const
 {
   const MeshFacetArray &rclFAry = _rclMesh._aclFacetArray;
   const MeshPointArray &rclPAry = _rclMesh._aclPointArray;
-  const unsigned long *pulIdx = rclFAry[ulFacetIdx]._aulPoints;
+  const PointIndex *pulIdx = rclFAry[ulFacetIdx]._aulPoints;
 
   BoundBox3f clBB;
   clBB.Add(rclPAry[*(pulIdx++)]);
@@ -1714,29 +1712,18 @@ float MeshAlgorithm::CalculateMinimumGridLength(float fLength, const Base::Bound
 
 // ----------------------------------------------------
 
-void MeshRefPointToFacets::Rebuild (void)
-{
-    _map.clear();
-
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    _map.resize(rPoints.size());
-
-    MeshFacetArray::_TConstIterator pFBegin = rFacets.begin();
-    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
-        _map[pFIter->_aulPoints[0]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[1]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[2]].insert(pFIter - pFBegin);
-    }
-}
+namespace {
+// The algorithms on the point or facet neighbourhoods are shared by the MeshRef* classes
+// and the adjacency classes in compressed row storage. A row can be a std::set or a
+// MeshIndexRange.
 
-Base::Vector3f MeshRefPointToFacets::GetNormal(unsigned long pos) const
+template <class Map>
+Base::Vector3f facets_normal(const MeshKernel& mesh, const Map& map, PointIndex pos)
 {
-    const std::set<unsigned long>& n = _map[pos];
     Base::Vector3f normal;
     MeshGeomFacet f;
-    for (std::set<unsigned long>::const_iterator it = n.begin(); it != n.end(); ++it) {
-        f = _rclMesh.GetFacet(*it);
+    for (auto it : map[pos]) {
+        f = mesh.GetFacet(it);
         normal += f.Area() * f.GetNormal();
     }
 
@@ -1744,19 +1731,20 @@ Base::Vector3f MeshRefPointToFacets::GetNormal(unsigned long pos) const
     return normal;
 }
 
-std::set<unsigned long> MeshRefPointToFacets::NeighbourPoints(const std::vector<unsigned long>& pt, int level) const
+template <class Map>
+std::set<PointIndex> neighbour_points(const MeshKernel& mesh, const Map& map,
+                                      const std::vector<PointIndex>& pt, int level)
 {
-    std::set<unsigned long> cp,nb,lp;
+    std::set<PointIndex> cp,nb,lp;
     cp.insert(pt.begin(), pt.end());
     lp.insert(pt.begin(), pt.end());
-    MeshFacetArray::_TConstIterator f_it = _rclMesh.GetFacets().begin();
+    MeshFacetArray::_TConstIterator f_it = mesh.GetFacets().begin();
     for (int i=0; i < level; i++) {
-        std::set<unsigned long> cur;
-        for (std::set<unsigned long>::iterator it = lp.begin(); it != lp.end(); ++it) {
-            const std::set<unsigned long>& ft = (*this)[*it];
-            for (std::set<unsigned long>::const_iterator jt = ft.begin(); jt != ft.end(); ++jt) {
+        std::set<PointIndex> cur;
+        for (std::set<PointIndex>::iterator it = lp.begin(); it != lp.end(); ++it) {
+            for (auto jt : map[*it]) {
                 for (int j = 0; j < 3; j++) {
-                    unsigned long index = f_it[*jt]._aulPoints[j];
+                    PointIndex index = f_it[jt]._aulPoints[j];
                     if (cp.find(index) == cp.end() && nb.find(index) == nb.end()) {
                         nb.insert(index);
                         cur.insert(index);
@@ -1772,13 +1760,13 @@ std::set<unsigned long> MeshRefPointToFacets::NeighbourPoints(const std::vector<
     return nb;
 }
 
-std::set<unsigned long> MeshRefPointToFacets::NeighbourPoints(unsigned long pos) const
+template <class Map>
+std::set<PointIndex> neighbour_points(const MeshKernel& mesh, const Map& map, PointIndex pos)
 {
-    std::set<unsigned long> p;
-    const std::set<unsigned long>& vf = _map[pos];
-    for (std::set<unsigned long>::const_iterator it = vf.begin(); it != vf.end(); ++it) {
-        unsigned long p1, p2, p3;
-        _rclMesh.GetFacetPoints(*it, p1, p2, p3);
+    std::set<PointIndex> p;
+    for (auto it : map[pos]) {
+        PointIndex p1, p2, p3;
+        mesh.GetFacetPoints(it, p1, p2, p3);
         if (p1 != pos)
             p.insert(p1);
         if (p2 != pos)
@@ -1790,83 +1778,247 @@ std::set<unsigned long> MeshRefPointToFacets::NeighbourPoints(unsigned long pos)
     return p;
 }
 
-void MeshRefPointToFacets::Neighbours (unsigned long ulFacetInd, float fMaxDist, MeshCollector& collect) const
-{
-    std::set<unsigned long> visited;
-    Base::Vector3f  clCenter = _rclMesh.GetFacet(ulFacetInd).GetGravityPoint();
-
-    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    SearchNeighbours(rFacets, ulFacetInd, clCenter, fMaxDist * fMaxDist, visited, collect);
-}
-
-void MeshRefPointToFacets::SearchNeighbours(const MeshFacetArray& rFacets, unsigned long index, const Base::Vector3f &rclCenter,
-                                            float fMaxDist2, std::set<unsigned long>& visited, MeshCollector& collect) const
+template <class Map>
+void search_neighbours(const MeshKernel& mesh, const Map& map, FacetIndex index, const Base::Vector3f &rclCenter,
+                       float fMaxDist2, std::set<FacetIndex>& visited, MeshCollector& collect)
 {
     if (visited.find(index) != visited.end())
         return;
 
-    const MeshFacet& face = rFacets[index];
-    if (Base::DistanceP2(rclCenter, _rclMesh.GetFacet(face).GetGravityPoint()) > fMaxDist2)
+    const MeshFacet& face = mesh.GetFacets()[index];
+    if (Base::DistanceP2(rclCenter, mesh.GetFacet(face).GetGravityPoint()) > fMaxDist2)
         return;
 
     visited.insert(index);
-    collect.Append(_rclMesh, index);
+    collect.Append(mesh, index);
     for (int i = 0; i < 3; i++) {
-        const std::set<unsigned long> &f = (*this)[face._aulPoints[i]];
+        for (auto j : map[face._aulPoints[i]]) {
+            search_neighbours(mesh, map, j, rclCenter, fMaxDist2, visited, collect);
+        }
+    }
+}
+
+template <class Map>
+void neighbour_facets(const MeshKernel& mesh, const Map& map, FacetIndex ulFacetInd,
+                      float fMaxDist, MeshCollector& collect)
+{
+    std::set<FacetIndex> visited;
+    Base::Vector3f  clCenter = mesh.GetFacet(ulFacetInd).GetGravityPoint();
+    search_neighbours(mesh, map, ulFacetInd, clCenter, fMaxDist * fMaxDist, visited, collect);
+}
+
+template <class Map>
+std::vector<ElementIndex> common_indices(const Map& map, ElementIndex pos1, ElementIndex pos2)
+{
+    std::vector<ElementIndex> intersection;
+    std::back_insert_iterator<std::vector<ElementIndex> > result(intersection);
+    const auto& set1 = map[pos1];
+    const auto& set2 = map[pos2];
+    std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
+    return intersection;
+}
+
+template <class Map>
+std::vector<ElementIndex> common_indices(const Map& map, ElementIndex pos1, ElementIndex pos2, ElementIndex pos3)
+{
+    std::vector<ElementIndex> intersection;
+    std::back_insert_iterator<std::vector<ElementIndex> > result(intersection);
+    std::vector<ElementIndex> set1 = common_indices(map, pos1, pos2);
+    const auto& set2 = map[pos3];
+    std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
+    return intersection;
+}
+
+template <class Map>
+Base::Vector3f points_normal(const MeshKernel& mesh, const Map& map, PointIndex pos)
+{
+    const MeshPointArray& rPoints = mesh.GetPoints();
+    MeshCore::PlaneFit pf;
+    pf.AddPoint(rPoints[pos]);
+    for (auto cv_it : map[pos]) {
+        pf.AddPoint(rPoints[cv_it]);
+    }
+
+    pf.Fit();
+
+    Base::Vector3f normal = pf.GetNormal();
+    normal.Normalize();
+    return normal;
+}
 
-        for (std::set<unsigned long>::const_iterator j = f.begin(); j != f.end(); ++j) {
-            SearchNeighbours(rFacets, *j, rclCenter, fMaxDist2, visited, collect);
+template <class Map>
+float average_edge_length(const MeshKernel& mesh, const Map& map, PointIndex index)
+{
+    const MeshPointArray& rPoints = mesh.GetPoints();
+    float len=0.0f;
+    const auto& n = map[index];
+    const Base::Vector3f& p = rPoints[index];
+    for (auto it : n) {
+        len += Base::Distance(p, rPoints[it]);
+    }
+    return (len/n.size());
+}
+
+/**
+ * Builds the rows of an adjacency structure in two parallel passes over the items.
+ * For each item \a pairs(item, rows, values) writes up to six (row, value) pairs and
+ * returns their number. The first pass counts the values of each row, the second one
+ * writes them to the slots reserved by the counts. Afterwards the rows are sorted and,
+ * if requested, duplicates are removed.
+ */
+template <class Pairs>
+void build_rows(std::size_t numRows, std::size_t numItems, Pairs pairs, bool unique,
+                std::vector<std::size_t>& offsets, std::vector<ElementIndex>& indices)
+{
+    int threads = QThread::idealThreadCount();
+    std::vector<std::atomic<std::size_t> > fill(numRows);
+    parallel_for(numItems, threads, [&](std::size_t begin, std::size_t end) {
+        ElementIndex rows[6], values[6];
+        for (std::size_t i = begin; i < end; i++) {
+            int num = pairs(i, rows, values);
+            for (int j = 0; j < num; j++)
+                fill[rows[j]].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    offsets.resize(numRows + 1);
+    offsets[0] = 0;
+    for (std::size_t i = 0; i < numRows; i++) {
+        offsets[i+1] = offsets[i] + fill[i].load(std::memory_order_relaxed);
+        fill[i].store(offsets[i], std::memory_order_relaxed);
+    }
+
+    indices.resize(offsets.back());
+    parallel_for(numItems, threads, [&](std::size_t begin, std::size_t end) {
+        ElementIndex rows[6], values[6];
+        for (std::size_t i = begin; i < end; i++) {
+            int num = pairs(i, rows, values);
+            for (int j = 0; j < num; j++)
+                indices[fill[rows[j]].fetch_add(1, std::memory_order_relaxed)] = values[j];
+        }
+    });
+
+    std::vector<std::size_t> sizes(numRows);
+    parallel_for(numRows, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::vector<ElementIndex>::iterator first = indices.begin() + offsets[i];
+            std::vector<ElementIndex>::iterator last = indices.begin() + offsets[i+1];
+            std::sort(first, last);
+            if (unique)
+                last = std::unique(first, last);
+            sizes[i] = last - first;
+        }
+    });
+
+    if (!unique)
+        return;
+
+    // move the rows together
+    std::vector<std::size_t> compact(numRows + 1);
+    compact[0] = 0;
+    for (std::size_t i = 0; i < numRows; i++)
+        compact[i+1] = compact[i] + sizes[i];
+    if (compact.back() == offsets.back())
+        return;
+
+    std::vector<ElementIndex> values(compact.back());
+    parallel_for(numRows, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::copy(indices.begin() + offsets[i], indices.begin() + offsets[i] + sizes[i],
+                      values.begin() + compact[i]);
         }
+    });
+
+    offsets.swap(compact);
+    indices.swap(values);
+}
+
+std::size_t set_map_size(const std::vector<std::set<ElementIndex> >& map)
+{
+    // a tree node holds the value, three links and the color
+    const std::size_t node = sizeof(ElementIndex) + 4 * sizeof(void*);
+    std::size_t size = map.capacity() * sizeof(std::set<ElementIndex>);
+    for (const auto& it : map)
+        size += it.size() * node;
+    return size;
+}
+}
+
+// ----------------------------------------------------
+
+void MeshRefPointToFacets::Rebuild (void)
+{
+    _map.clear();
+
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    _map.resize(rPoints.size());
+
+    MeshFacetArray::_TConstIterator pFBegin = rFacets.begin();
+    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
+        _map[pFIter->_aulPoints[0]].insert(pFIter - pFBegin);
+        _map[pFIter->_aulPoints[1]].insert(pFIter - pFBegin);
+        _map[pFIter->_aulPoints[2]].insert(pFIter - pFBegin);
     }
 }
 
+Base::Vector3f MeshRefPointToFacets::GetNormal(PointIndex pos) const
+{
+    return facets_normal(_rclMesh, *this, pos);
+}
+
+std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(const std::vector<PointIndex>& pt, int level) const
+{
+    return neighbour_points(_rclMesh, *this, pt, level);
+}
+
+std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(PointIndex pos) const
+{
+    return neighbour_points(_rclMesh, *this, pos);
+}
+
+void MeshRefPointToFacets::Neighbours (FacetIndex ulFacetInd, float fMaxDist, MeshCollector& collect) const
+{
+    neighbour_facets(_rclMesh, *this, ulFacetInd, fMaxDist, collect);
+}
+
 MeshFacetArray::_TConstIterator
-MeshRefPointToFacets::GetFacet (unsigned long index) const
+MeshRefPointToFacets::GetFacet (FacetIndex index) const
 {
     return _rclMesh.GetFacets().begin() + index;
 }
 
-const std::set<unsigned long>&
-MeshRefPointToFacets::operator[] (unsigned long pos) const
+const std::set<FacetIndex>&
+MeshRefPointToFacets::operator[] (PointIndex pos) const
 {
     return _map[pos];
 }
 
-std::vector<unsigned long>
-MeshRefPointToFacets::GetIndices(unsigned long pos1, unsigned long pos2) const
+std::vector<FacetIndex>
+MeshRefPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2) const
 {
-    std::vector<unsigned long> intersection;
-    std::back_insert_iterator<std::vector<unsigned long> > result(intersection);
-    const std::set<unsigned long>& set1 = _map[pos1];
-    const std::set<unsigned long>& set2 = _map[pos2];
-    std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
-    return intersection;
+    return common_indices(*this, pos1, pos2);
 }
 
-std::vector<unsigned long>
-MeshRefPointToFacets::GetIndices(unsigned long pos1, unsigned long pos2, unsigned long pos3) const
+std::vector<FacetIndex>
+MeshRefPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2, PointIndex pos3) const
 {
-    std::vector<unsigned long> intersection;
-    std::back_insert_iterator<std::vector<unsigned long> > result(intersection);
-    std::vector<unsigned long> set1 = GetIndices(pos1, pos2);
-    const std::set<unsigned long>& set2 = _map[pos3];
-    std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
-    return intersection;
+    return common_indices(*this, pos1, pos2, pos3);
 }
 
-void MeshRefPointToFacets::AddNeighbour(unsigned long pos, unsigned long facet)
+void MeshRefPointToFacets::AddNeighbour(PointIndex pos, FacetIndex facet)
 {
     _map[pos].insert(facet);
 }
 
-void MeshRefPointToFacets::RemoveNeighbour(unsigned long pos, unsigned long facet)
+void MeshRefPointToFacets::RemoveNeighbour(PointIndex pos, FacetIndex facet)
 {
     _map[pos].erase(facet);
 }
 
-void MeshRefPointToFacets::RemoveFacet(unsigned long facetIndex)
+void MeshRefPointToFacets::RemoveFacet(FacetIndex facetIndex)
 {
-    unsigned long p0, p1, p2;
+    PointIndex p0, p1, p2;
     _rclMesh.GetFacetPoints(facetIndex, p0, p1, p2);
 
     _map[p0].erase(facetIndex);
@@ -1874,6 +2026,11 @@ void MeshRefPointToFacets::RemoveFacet(unsigned long facetIndex)
     _map[p2].erase(facetIndex);
 }
 
+std::size_t MeshRefPointToFacets::MemSize() const
+{
+    return set_map_size(_map);
+}
+
 //----------------------------------------------------------------------------
 
 void MeshRefFacetToFacets::Rebuild (void)
@@ -1887,28 +2044,28 @@ void MeshRefFacetToFacets::Rebuild (void)
     MeshFacetArray::_TConstIterator pFBegin = rFacets.begin();
     for (MeshFacetArray::_TConstIterator pFIter = pFBegin; pFIter != rFacets.end(); ++pFIter) {
         for (int i = 0; i < 3; i++) {
-            const std::set<unsigned long>& faces = vertexFace[pFIter->_aulPoints[i]];
-            for (std::set<unsigned long>::const_iterator it = faces.begin(); it != faces.end(); ++it)
+            const std::set<FacetIndex>& faces = vertexFace[pFIter->_aulPoints[i]];
+            for (std::set<FacetIndex>::const_iterator it = faces.begin(); it != faces.end(); ++it)
                 _map[pFIter - pFBegin].insert(*it);
         }
     }
 }
 
-const std::set<unsigned long>&
-MeshRefFacetToFacets::operator[] (unsigned long pos) const
+const std::set<FacetIndex>&
+MeshRefFacetToFacets::operator[] (FacetIndex pos) const
 {
     return _map[pos];
 }
 
-std::vector<unsigned long>
-MeshRefFacetToFacets::GetIndices(unsigned long pos1, unsigned long pos2) const
+std::vector<FacetIndex>
+MeshRefFacetToFacets::GetIndices(FacetIndex pos1, FacetIndex pos2) const
 {
-    std::vector<unsigned long> intersection;
-    std::back_insert_iterator<std::vector<unsigned long> > result(intersection);
-    const std::set<unsigned long>& set1 = _map[pos1];
-    const std::set<unsigned long>& set2 = _map[pos2];
-    std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
-    return intersection;
+    return common_indices(*this, pos1, pos2);
+}
+
+std::size_t MeshRefFacetToFacets::MemSize() const
+{
+    return set_map_size(_map);
 }
 
 //----------------------------------------------------------------------------
@@ -1922,9 +2079,9 @@ void MeshRefPointToPoints::Rebuild (void)
 
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
     for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
-        unsigned long ulP0 = pFIter->_aulPoints[0];
-        unsigned long ulP1 = pFIter->_aulPoints[1];
-        unsigned long ulP2 = pFIter->_aulPoints[2];
+        PointIndex ulP0 = pFIter->_aulPoints[0];
+        PointIndex ulP1 = pFIter->_aulPoints[1];
+        PointIndex ulP2 = pFIter->_aulPoints[2];
 
         _map[ulP0].insert(ulP1);
         _map[ulP0].insert(ulP2);
@@ -1935,53 +2092,37 @@ void MeshRefPointToPoints::Rebuild (void)
     }
 }
 
-Base::Vector3f MeshRefPointToPoints::GetNormal(unsigned long pos) const
+Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
 {
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    MeshCore::PlaneFit pf;
-    pf.AddPoint(rPoints[pos]);
-    MeshCore::MeshPoint center = rPoints[pos];
-    const std::set<unsigned long>& cv = _map[pos];
-    for (std::set<unsigned long>::const_iterator cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-        pf.AddPoint(rPoints[*cv_it]);
-        center += rPoints[*cv_it];
-    }
-
-    pf.Fit();
-
-    Base::Vector3f normal = pf.GetNormal();
-    normal.Normalize();
-    return normal;
+    return points_normal(_rclMesh, *this, pos);
 }
 
-float MeshRefPointToPoints::GetAverageEdgeLength(unsigned long index) const
+float MeshRefPointToPoints::GetAverageEdgeLength(PointIndex index) const
 {
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    float len=0.0f;
-    const std::set<unsigned long>& n = (*this)[index];
-    const Base::Vector3f& p = rPoints[index];
-    for (std::set<unsigned long>::const_iterator it = n.begin(); it != n.end(); ++it) {
-        len += Base::Distance(p, rPoints[*it]);
-    }
-    return (len/n.size());
+    return average_edge_length(_rclMesh, *this, index);
 }
 
-const std::set<unsigned long>&
-MeshRefPointToPoints::operator[] (unsigned long pos) const
+const std::set<PointIndex>&
+MeshRefPointToPoints::operator[] (PointIndex pos) const
 {
     return _map[pos];
 }
 
-void MeshRefPointToPoints::AddNeighbour(unsigned long pos, unsigned long facet)
+void MeshRefPointToPoints::AddNeighbour(PointIndex pos, PointIndex facet)
 {
     _map[pos].insert(facet);
 }
 
-void MeshRefPointToPoints::RemoveNeighbour(unsigned long pos, unsigned long facet)
+void MeshRefPointToPoints::RemoveNeighbour(PointIndex pos, PointIndex facet)
 {
     _map[pos].erase(facet);
 }
 
+std::size_t MeshRefPointToPoints::MemSize() const
+{
+    return set_map_size(_map);
+}
+
 //----------------------------------------------------------------------------
 
 void MeshRefEdgeToFacets::Rebuild (void)
@@ -1989,7 +2130,7 @@ void MeshRefEdgeToFacets::Rebuild (void)
     _map.clear();
 
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    unsigned long index = 0;
+    FacetIndex index = 0;
     for (MeshFacetArray::_TConstIterator it = rFacets.begin(); it != rFacets.end(); ++it, ++index) {
         for (int i=0; i<3; i++) {
             MeshEdge e;
@@ -1999,7 +2140,7 @@ void MeshRefEdgeToFacets::Rebuild (void)
                 _map.find(e);
             if (jt == _map.end()) {
                 _map[e].first = index;
-                _map[e].second = ULONG_MAX;
+                _map[e].second = FACET_INDEX_MAX;
             }
             else {
                 _map[e].second = index;
@@ -2008,7 +2149,7 @@ void MeshRefEdgeToFacets::Rebuild (void)
     }
 }
 
-const std::pair<unsigned long, unsigned long>&
+const std::pair<FacetIndex, FacetIndex>&
 MeshRefEdgeToFacets::operator[] (const MeshEdge& edge) const
 {
     return _map.find(edge)->second;
@@ -2042,7 +2183,155 @@ void MeshRefNormalToPoints::Rebuild (void)
 }
 
 const Base::Vector3f&
-MeshRefNormalToPoints::operator[] (unsigned long pos) const
+MeshRefNormalToPoints::operator[] (PointIndex pos) const
 {
     return _norm[pos];
 }
+
+//----------------------------------------------------------------------------
+
+std::size_t MeshCsrAdjacency::MemSize() const
+{
+    return _offsets.capacity() * sizeof(std::size_t) +
+           _indices.capacity() * sizeof(ElementIndex);
+}
+
+//----------------------------------------------------------------------------
+
+void MeshCsrPointToFacets::Rebuild (void)
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    build_rows(_rclMesh.CountPoints(), rFacets.size(),
+               [&rFacets](std::size_t index, ElementIndex* rows, ElementIndex* values) {
+        const MeshFacet& face = rFacets[index];
+        for (int i = 0; i < 3; i++) {
+            rows[i] = face._aulPoints[i];
+            values[i] = static_cast<ElementIndex>(index);
+        }
+        return 3;
+    }, true, _offsets, _indices);
+}
+
+Base::Vector3f MeshCsrPointToFacets::GetNormal(PointIndex pos) const
+{
+    return facets_normal(_rclMesh, *this, pos);
+}
+
+std::set<PointIndex> MeshCsrPointToFacets::NeighbourPoints(const std::vector<PointIndex>& pt, int level) const
+{
+    return neighbour_points(_rclMesh, *this, pt, level);
+}
+
+std::set<PointIndex> MeshCsrPointToFacets::NeighbourPoints(PointIndex pos) const
+{
+    return neighbour_points(_rclMesh, *this, pos);
+}
+
+void MeshCsrPointToFacets::Neighbours (FacetIndex ulFacetInd, float fMaxDist, MeshCollector& collect) const
+{
+    neighbour_facets(_rclMesh, *this, ulFacetInd, fMaxDist, collect);
+}
+
+MeshFacetArray::_TConstIterator
+MeshCsrPointToFacets::GetFacet (FacetIndex index) const
+{
+    return _rclMesh.GetFacets().begin() + index;
+}
+
+std::vector<FacetIndex>
+MeshCsrPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2) const
+{
+    return common_indices(*this, pos1, pos2);
+}
+
+std::vector<FacetIndex>
+MeshCsrPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2, PointIndex pos3) const
+{
+    return common_indices(*this, pos1, pos2, pos3);
+}
+
+//----------------------------------------------------------------------------
+
+void MeshCsrFacetToFacets::Rebuild (void)
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    std::size_t numFacets = rFacets.size();
+    MeshCsrPointToFacets vertexFace(_rclMesh);
+    int threads = QThread::idealThreadCount();
+
+    // the facets of the three points give the upper bound of a row
+    _offsets.resize(numFacets + 1);
+    _offsets[0] = 0;
+    for (std::size_t index = 0; index < numFacets; index++) {
+        const MeshFacet& face = rFacets[index];
+        _offsets[index+1] = _offsets[index] +
+                            vertexFace[face._aulPoints[0]].size() +
+                            vertexFace[face._aulPoints[1]].size() +
+                            vertexFace[face._aulPoints[2]].size();
+    }
+
+    std::vector<ElementIndex> candidates(_offsets.back());
+    std::vector<std::size_t> sizes(numFacets);
+    parallel_for(numFacets, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            std::vector<ElementIndex>::iterator first = candidates.begin() + _offsets[index];
+            std::vector<ElementIndex>::iterator last = first;
+            for (int i = 0; i < 3; i++) {
+                MeshIndexRange faces = vertexFace[rFacets[index]._aulPoints[i]];
+                last = std::copy(faces.begin(), faces.end(), last);
+            }
+            std::sort(first, last);
+            sizes[index] = std::unique(first, last) - first;
+        }
+    });
+
+    std::vector<std::size_t> offsets(numFacets + 1);
+    offsets[0] = 0;
+    for (std::size_t index = 0; index < numFacets; index++)
+        offsets[index+1] = offsets[index] + sizes[index];
+
+    _indices.resize(offsets.back());
+    parallel_for(numFacets, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            std::copy(candidates.begin() + _offsets[index],
+                      candidates.begin() + _offsets[index] + sizes[index],
+                      _indices.begin() + offsets[index]);
+        }
+    });
+
+    _offsets.swap(offsets);
+}
+
+std::vector<FacetIndex>
+MeshCsrFacetToFacets::GetIndices(FacetIndex pos1, FacetIndex pos2) const
+{
+    return common_indices(*this, pos1, pos2);
+}
+
+//----------------------------------------------------------------------------
+
+void MeshCsrPointToPoints::Rebuild (void)
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    build_rows(_rclMesh.CountPoints(), rFacets.size(),
+               [&rFacets](std::size_t index, ElementIndex* rows, ElementIndex* values) {
+        const MeshFacet& face = rFacets[index];
+        for (int i = 0; i < 3; i++) {
+            rows[2*i] = face._aulPoints[i];
+            values[2*i] = face._aulPoints[(i+1)%3];
+            rows[2*i+1] = face._aulPoints[i];
+            values[2*i+1] = face._aulPoints[(i+2)%3];
+        }
+        return 6;
+    }, true, _offsets, _indices);
+}
+
+Base::Vector3f MeshCsrPointToPoints::GetNormal(PointIndex pos) const
+{
+    return points_normal(_rclMesh, *this, pos);
+}
+
+float MeshCsrPointToPoints::GetAverageEdgeLength(PointIndex index) const
+{
+    return average_edge_length(_rclMesh, *this, index);
+}
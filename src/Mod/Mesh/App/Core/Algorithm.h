@@ -24,6 +24,7 @@
 #ifndef MESHALGORITHM_H
 #define MESHALGORITHM_H
 
+#include <algorithm>
 #include <set>
 #include <vector>
 #include <map>
@@ -46,7 +47,7 @@ class MeshGeomEdge;
 class MeshKernel;
 class MeshFacetGrid;
 class MeshFacetArray;
-class MeshRefPointToFacets;
+class MeshCsrPointToFacets;
 class AbstractPolygonTriangulator;
 
 /**
@@ -70,7 +71,7 @@ public:
    * occasionally.
    */
   bool NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, Base::Vector3f &rclRes,
-                          unsigned long &rulFacet) const;
+                          FacetIndex &rulFacet) const;
   /**
    * Searches for the nearest facet to the ray defined by
    * (\a rclPt, \a rclDir).
@@ -80,7 +81,7 @@ public:
    * used for a lot of tests.
    */
   bool NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const MeshFacetGrid &rclGrid,
-                          Base::Vector3f &rclRes, unsigned long &rulFacet) const;
+                          Base::Vector3f &rclRes, FacetIndex &rulFacet) const;
   /**
    * Searches for the nearest facet to the ray defined by
    * (\a rclPt, \a rclDir).
@@ -90,8 +91,8 @@ public:
    * the attached mesh. So the caller must ensure that the indices are valid
    * facets.
    */
-  bool NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<unsigned long> &raulFacets,
-                          Base::Vector3f &rclRes, unsigned long &rulFacet) const;
+  bool NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<FacetIndex> &raulFacets,
+                          Base::Vector3f &rclRes, FacetIndex &rulFacet) const;
   /**
    * Searches for the nearest facet to the ray defined by (\a rclPt, \a  rclDir). The point \a rclRes holds
    * the intersection point with the ray and the nearest facet with index \a rulFacet.
@@ -99,13 +100,13 @@ public:
    * \note This method is optimized by using a grid. So this method can be used for a lot of tests.
    */
   bool NearestFacetOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, float fMaxSearchArea,
-                          const MeshFacetGrid &rclGrid, Base::Vector3f &rclRes, unsigned long &rulFacet) const;
+                          const MeshFacetGrid &rclGrid, Base::Vector3f &rclRes, FacetIndex &rulFacet) const;
   /**
    * Searches for the first facet of the grid element (\a rclGrid) in that the point \a rclPt lies into which is a distance not
    * higher than \a fMaxDistance. Of no such facet is found \a rulFacet is undefined and false is returned, otherwise true.
    * \note If the point \a rclPt is outside of the grid \a rclGrid nothing is done.
    */
-  bool FirstFacetToVertex(const Base::Vector3f &rclPt, float fMaxDistance, const MeshFacetGrid &rclGrid, unsigned long &rulFacet) const;
+  bool FirstFacetToVertex(const Base::Vector3f &rclPt, float fMaxDistance, const MeshFacetGrid &rclGrid, FacetIndex &rulFacet) const;
   /**
    * Checks from the viewpoint \a rcView if the vertex \a rcVertex is visible or it is hidden by a facet. 
    * If the vertex is visible true is returned, false otherwise.
@@ -135,11 +136,11 @@ public:
    * Returns all boundaries of the mesh. This method does basically the same as above unless that it returns the point indices
    * of the boundaries.
    */
-  void GetMeshBorders (std::list<std::vector<unsigned long> > &rclBorders) const;
+  void GetMeshBorders (std::list<std::vector<PointIndex> > &rclBorders) const;
   /**
    * Returns all boundaries of a subset the mesh defined by \a raulInd.
    */
-  void GetFacetBorders (const std::vector<unsigned long> &raulInd, std::list<std::vector<Base::Vector3f> > &rclBorders) const;
+  void GetFacetBorders (const std::vector<FacetIndex> &raulInd, std::list<std::vector<Base::Vector3f> > &rclBorders) const;
   /**
    * Returns all boundaries of a subset the mesh defined by \a raulInd. This method does basically the same as above unless 
    * that it returns the point indices of the boundaries.
@@ -148,18 +149,18 @@ public:
    * orientation even if the mesh is topologically correct. You should let the default value unless you exactly
    * know what you do.
    */
-  void GetFacetBorders (const std::vector<unsigned long> &raulInd, std::list<std::vector<unsigned long> > &rclBorders,
+  void GetFacetBorders (const std::vector<FacetIndex> &raulInd, std::list<std::vector<PointIndex> > &rclBorders,
                         bool ignoreOrientation = false) const;
   /**
    * Returns the boundary of the mesh to the facet \a uFacet. If this facet does not have an open edge the returned
    * boundary is empty.
    */
-  void GetMeshBorder(unsigned long uFacet, std::list<unsigned long>& rBorder) const;
+  void GetMeshBorder(FacetIndex uFacet, std::list<PointIndex>& rBorder) const;
   /**
    * Boundaries that consist of several loops must be split in several independent boundaries
    * to perform e.g. a polygon triangulation algorithm on them.
    */
-  void SplitBoundaryLoops( std::list<std::vector<unsigned long> >& aBorders );
+  void SplitBoundaryLoops( std::list<std::vector<PointIndex> >& aBorders );
   /**
    * Fills up the single boundary if it is a hole with high quality triangles and a maximum area of \a fMaxArea.
    * The triangulation information is stored in \a rFaces and \a rPoints.
@@ -172,14 +173,14 @@ public:
    * @note If the number of geometric points exceeds the number of boundary indices then the triangulation algorithm has 
    * introduced new points which are added to the end of \a rPoints.
    */
-  bool FillupHole(const std::vector<unsigned long>& boundary,
+  bool FillupHole(const std::vector<PointIndex>& boundary,
                   AbstractPolygonTriangulator& cTria,
                   MeshFacetArray& rFaces, MeshPointArray& rPoints,
-                  int level, const MeshRefPointToFacets* pP2FStructure=0) const;
+                  int level, const MeshCsrPointToFacets* pP2FStructure=0) const;
   /** Sets to all facets in \a raulInds the properties in raulProps. 
    * \note Both arrays must have the same size.
    */
-  void SetFacetsProperty(const std::vector<unsigned long> &raulInds, const std::vector<unsigned long> &raulProps) const;
+  void SetFacetsProperty(const std::vector<FacetIndex> &raulInds, const std::vector<unsigned long> &raulProps) const;
   /** Sets to all facets the flag \a tF. */
   void SetFacetFlag (MeshFacet::TFlagType tF) const;
   /** Sets to all points the flag \a tF. */
@@ -189,23 +190,23 @@ public:
   /** Resets of all points the flag \a tF. */
   void ResetPointFlag (MeshPoint::TFlagType tF) const;
   /** Sets to all facets in \a raulInds the flag \a tF. */
-  void SetFacetsFlag (const std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const;
+  void SetFacetsFlag (const std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const;
   /** Sets to all points in \a raulInds the flag \a tF. */
-  void SetPointsFlag (const std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const;
+  void SetPointsFlag (const std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const;
   /** Gets all facets in \a raulInds with the flag \a tF. */
-  void GetFacetsFlag (std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const;
+  void GetFacetsFlag (std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const;
   /** Gets all points in \a raulInds with the flag \a tF. */
-  void GetPointsFlag (std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const;
+  void GetPointsFlag (std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const;
   /** Resets from all facets in \a raulInds the flag \a tF. */
-  void ResetFacetsFlag (const std::vector<unsigned long> &raulInds, MeshFacet::TFlagType tF) const;
+  void ResetFacetsFlag (const std::vector<FacetIndex> &raulInds, MeshFacet::TFlagType tF) const;
   /** Resets from all points in \a raulInds the flag \a tF. */
-  void ResetPointsFlag (const std::vector<unsigned long> &raulInds, MeshPoint::TFlagType tF) const;
+  void ResetPointsFlag (const std::vector<PointIndex> &raulInds, MeshPoint::TFlagType tF) const;
   /** Count all facets with the flag \a tF. */
   unsigned long CountFacetFlag (MeshFacet::TFlagType tF) const;
   /** Count all points with the flag \a tF. */
   unsigned long CountPointFlag (MeshPoint::TFlagType tF) const;
   /** Returns all geometric points from the facets in \a rvecIndices. */
-  void PointsFromFacetsIndices (const std::vector<unsigned long> &rvecIndices, std::vector<Base::Vector3f> &rvecPoints) const;
+  void PointsFromFacetsIndices (const std::vector<FacetIndex> &rvecIndices, std::vector<Base::Vector3f> &rvecPoints) const;
   /**
    * Returns the indices of all facets that have at least one point that lies inside the tool mesh. The direction
    * \a dir is used to try to foraminate the facets of the tool mesh and counts the number of foraminated facets.
@@ -213,11 +214,11 @@ public:
    * @note The tool mesh must be a valid solid.
    * @note It's not tested if \a rToolMesh is a valid solid. In case it is not the result is undefined.
    */
-  void GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, std::vector<unsigned long> &raclCutted ) const;
+  void GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, std::vector<FacetIndex> &raclCutted ) const;
   /**
    * Does basically the same as method above except it uses a mesh grid to speed up the computation.
    */
-  void GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, const MeshFacetGrid& rGrid, std::vector<unsigned long> &raclCutted ) const;
+  void GetFacetsFromToolMesh( const MeshKernel& rToolMesh, const Base::Vector3f& rcDir, const MeshFacetGrid& rGrid, std::vector<FacetIndex> &raclCutted ) const;
   /** 
    * Checks whether the bounding box \a rBox is surrounded by the attached mesh which must be a solid.
    * The direction \a rcDir is used to try to foraminate the facets of the tool mesh and counts the number of foraminated facets.
@@ -234,32 +235,32 @@ public:
    * This algorithm is optimized by using a grid.
    */
   void CheckFacets (const MeshFacetGrid &rclGrid, const Base::ViewProjMethod* pclProj, const Base::Polygon2d& rclPoly,
-                    bool bInner, std::vector<unsigned long> &rclRes) const;
+                    bool bInner, std::vector<FacetIndex> &rclRes) const;
   /**
    * Does the same as the above method unless that it doesn't use a grid.
    */
   void CheckFacets (const Base::ViewProjMethod* pclProj, const Base::Polygon2d& rclPoly,
-                    bool bInner, std::vector<unsigned long> &rclRes) const;
+                    bool bInner, std::vector<FacetIndex> &rclRes) const;
   /**
    * Determines all facets of the given array \a raclFacetIndices that lie at the edge or that
    * have at least neighbour facet that is not inside the array. The resulting array \a raclResultIndices
    * is not be deleted before the algorithm starts. \a usLevel indicates how often the algorithm is 
    * repeated.
    */
-  void CheckBorderFacets (const std::vector<unsigned long> &raclFacetIndices, 
-                          std::vector<unsigned long> &raclResultIndices, unsigned short usLevel = 1) const;
+  void CheckBorderFacets (const std::vector<FacetIndex> &raclFacetIndices, 
+                          std::vector<FacetIndex> &raclResultIndices, unsigned short usLevel = 1) const;
   /**
    * Invokes CheckBorderFacets() to get all border facets of \a raclFacetIndices. Then the content of
    * \a raclFacetIndices is replaced by all facets that can be deleted.
    * \note The mesh structure is not modified by this method. This is in the responsibility of the user.
    */
-  void CutBorderFacets (std::vector<unsigned long> &raclFacetIndices, unsigned short usLevel = 1) const;
+  void CutBorderFacets (std::vector<FacetIndex> &raclFacetIndices, unsigned short usLevel = 1) const;
   /** Returns the number of border edges */
   unsigned long CountBorderEdges() const;
   /**
    * Determines all border points as indices of the facets in \a raclFacetIndices. The points are unsorted.
    */
-  void GetBorderPoints (const std::vector<unsigned long> &raclFacetIndices, std::set<unsigned long> &raclResultPointsIndices) const;
+  void GetBorderPoints (const std::vector<FacetIndex> &raclFacetIndices, std::set<PointIndex> &raclResultPointsIndices) const;
   /** Computes the surface of the mesh. */
   float Surface (void) const;
   /** Subsamples the mesh with point distance \a fDist and stores the points in \a rclPoints. */
@@ -275,15 +276,15 @@ public:
    * Searches for all facets that intersect the "search tube" with radius \a r around the polyline. 
    */
   void SearchFacetsFromPolyline (const std::vector<Base::Vector3f> &rclPolyline, float fRadius,
-                                 const MeshFacetGrid& rclGrid, std::vector<unsigned long> &rclResultFacetsIndices) const;
+                                 const MeshFacetGrid& rclGrid, std::vector<FacetIndex> &rclResultFacetsIndices) const;
   /** Projects a point directly to the mesh (means nearest facet), the result is the facet index and
    * the foraminate point, use second version with grid for more performance.
    */
-  bool NearestPointFromPoint (const Base::Vector3f &rclPt, unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
+  bool NearestPointFromPoint (const Base::Vector3f &rclPt, FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
   bool NearestPointFromPoint (const Base::Vector3f &rclPt, const MeshFacetGrid& rclGrid,
-                              unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
+                              FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
   bool NearestPointFromPoint (const Base::Vector3f &rclPt, const MeshFacetGrid& rclGrid, float fMaxSearchArea,
-                              unsigned long &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
+                              FacetIndex &rclResFacetIndex, Base::Vector3f &rclResPoint) const;
   /** Cuts the mesh with a plane. The result is a list of polylines. */
   bool CutWithPlane (const Base::Vector3f &clBase, const Base::Vector3f &clNormal, const MeshFacetGrid &rclGrid,
                      std::list<std::vector<Base::Vector3f> > &rclResult, float fMinEps = 1.0e-2f, bool bConnectPolygons = false) const;
@@ -292,12 +293,12 @@ public:
    * The plane is defined by it normalized normal and the signed distance to the origin.
    */
   void GetFacetsFromPlane (const MeshFacetGrid &rclGrid, const Base::Vector3f& clNormal, float dist, 
-      const Base::Vector3f &rclLeft, const Base::Vector3f &rclRight, std::vector<unsigned long> &rclRes) const;
+      const Base::Vector3f &rclLeft, const Base::Vector3f &rclRight, std::vector<FacetIndex> &rclRes) const;
 
   /** Returns true if the distance from the \a rclPt to the facet \a ulFacetIdx is less than \a fMaxDistance.
    * If this restriction is met \a rfDistance is set to the actual distance, otherwise false is returned.
    */
-  bool Distance (const Base::Vector3f &rclPt, unsigned long ulFacetIdx, float fMaxDistance, float &rfDistance) const;
+  bool Distance (const Base::Vector3f &rclPt, FacetIndex ulFacetIdx, float fMaxDistance, float &rfDistance) const;
   /**
    * Calculates the minimum grid length so that not more elements than \a maxElements will be created when the grid gets
    * built up. The minimum grid length must be at least \a fLength.
@@ -311,12 +312,12 @@ protected:
   bool ConnectPolygons(std::list<std::vector<Base::Vector3f> > &clPolyList, std::list<std::pair<Base::Vector3f,
                        Base::Vector3f> > &rclLines) const;
   /** Searches the nearest facet in \a raulFacets to the ray (\a rclPt, \a rclDir). */
-  bool RayNearestField (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<unsigned long> &raulFacets,
-                        Base::Vector3f &rclRes, unsigned long &rulFacet, float fMaxAngle = Mathf::PI) const;
+  bool RayNearestField (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, const std::vector<FacetIndex> &raulFacets,
+                        Base::Vector3f &rclRes, FacetIndex &rulFacet, float fMaxAngle = Mathf::PI) const;
   /** 
    * Splits the boundary \a rBound in several loops and append this loops to the list of borders.
    */
-  void SplitBoundaryLoops( const std::vector<unsigned long>& rBound, std::list<std::vector<unsigned long> >& aBorders );
+  void SplitBoundaryLoops( const std::vector<PointIndex>& rBound, std::list<std::vector<PointIndex> >& aBorders );
 
 protected:
   const MeshKernel      &_rclMesh; /**< The mesh kernel. */
@@ -327,17 +328,17 @@ class MeshExport MeshCollector
 public:
     MeshCollector(){}
     virtual ~MeshCollector(){}
-    virtual void Append(const MeshCore::MeshKernel&, unsigned long index) = 0;
+    virtual void Append(const MeshCore::MeshKernel&, FacetIndex index) = 0;
 };
 
 class MeshExport PointCollector : public MeshCollector
 {
 public:
-    PointCollector(std::vector<unsigned long>& ind) : indices(ind){}
+    PointCollector(std::vector<PointIndex>& ind) : indices(ind){}
     virtual ~PointCollector(){}
-    virtual void Append(const MeshCore::MeshKernel& kernel, unsigned long index)
+    virtual void Append(const MeshCore::MeshKernel& kernel, FacetIndex index)
     {
-        unsigned long ulP1, ulP2, ulP3;
+        PointIndex ulP1, ulP2, ulP3;
         kernel.GetFacetPoints(index, ulP1, ulP2, ulP3);
         indices.push_back(ulP1);
         indices.push_back(ulP2);
@@ -345,21 +346,21 @@ public:
     }
 
 private:
-    std::vector<unsigned long>& indices;
+    std::vector<PointIndex>& indices;
 };
 
 class MeshExport FacetCollector : public MeshCollector
 {
 public:
-    FacetCollector(std::vector<unsigned long>& ind) : indices(ind){}
+    FacetCollector(std::vector<FacetIndex>& ind) : indices(ind){}
     virtual ~FacetCollector(){}
-    void Append(const MeshCore::MeshKernel&, unsigned long index)
+    void Append(const MeshCore::MeshKernel&, FacetIndex index)
     {
         indices.push_back(index);
     }
 
 private:
-    std::vector<unsigned long>& indices;
+    std::vector<FacetIndex>& indices;
 };
 
 /**
@@ -380,25 +381,23 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild (void);
-    const std::set<unsigned long>& operator[] (unsigned long) const;
-    std::vector<unsigned long> GetIndices(unsigned long, unsigned long) const;
-    std::vector<unsigned long> GetIndices(unsigned long, unsigned long, unsigned long) const;
-    MeshFacetArray::_TConstIterator GetFacet (unsigned long) const;
-    std::set<unsigned long> NeighbourPoints(const std::vector<unsigned long>& , int level) const;
-    std::set<unsigned long> NeighbourPoints(unsigned long) const;
-    void Neighbours (unsigned long ulFacetInd, float fMaxDist, MeshCollector& collect) const;
-    Base::Vector3f GetNormal(unsigned long) const;
-    void AddNeighbour(unsigned long, unsigned long);
-    void RemoveNeighbour(unsigned long, unsigned long);
-    void RemoveFacet(unsigned long);
-
-protected:
-    void SearchNeighbours(const MeshFacetArray& rFacets, unsigned long index, const Base::Vector3f &rclCenter, 
-        float fMaxDist, std::set<unsigned long> &visit, MeshCollector& collect) const;
+    const std::set<FacetIndex>& operator[] (PointIndex) const;
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex) const;
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex, PointIndex) const;
+    MeshFacetArray::_TConstIterator GetFacet (FacetIndex) const;
+    std::set<PointIndex> NeighbourPoints(const std::vector<PointIndex>& , int level) const;
+    std::set<PointIndex> NeighbourPoints(PointIndex) const;
+    void Neighbours (FacetIndex ulFacetInd, float fMaxDist, MeshCollector& collect) const;
+    Base::Vector3f GetNormal(PointIndex) const;
+    void AddNeighbour(PointIndex, FacetIndex);
+    void RemoveNeighbour(PointIndex, FacetIndex);
+    void RemoveFacet(FacetIndex);
+    /// Returns an estimate of the number of bytes used by the structure
+    std::size_t MemSize() const;
 
 protected:
     const MeshKernel  &_rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<unsigned long> > _map;
+    std::vector<std::set<FacetIndex> > _map;
 };
 
 /**
@@ -421,13 +420,15 @@ public:
 
     /// Returns a set of facets sharing one or more points with the facet with
     /// index \a ulFacetIndex.
-    const std::set<unsigned long>& operator[] (unsigned long) const;
+    const std::set<FacetIndex>& operator[] (FacetIndex) const;
     /// Returns an array of common facets of the passed facet indexes.
-    std::vector<unsigned long> GetIndices(unsigned long, unsigned long) const;
+    std::vector<FacetIndex> GetIndices(FacetIndex, FacetIndex) const;
+    /// Returns an estimate of the number of bytes used by the structure
+    std::size_t MemSize() const;
 
 protected:
     const MeshKernel  &_rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<unsigned long> > _map;
+    std::vector<std::set<FacetIndex> > _map;
 };
 
 /**
@@ -448,15 +449,17 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild (void);
-    const std::set<unsigned long>& operator[] (unsigned long) const;
-    Base::Vector3f GetNormal(unsigned long) const;
-    float GetAverageEdgeLength(unsigned long) const;
-    void AddNeighbour(unsigned long, unsigned long);
-    void RemoveNeighbour(unsigned long, unsigned long);
+    const std::set<PointIndex>& operator[] (PointIndex) const;
+    Base::Vector3f GetNormal(PointIndex) const;
+    float GetAverageEdgeLength(PointIndex) const;
+    void AddNeighbour(PointIndex, PointIndex);
+    void RemoveNeighbour(PointIndex, PointIndex);
+    /// Returns an estimate of the number of bytes used by the structure
+    std::size_t MemSize() const;
 
 protected:
     const MeshKernel  &_rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<unsigned long> > _map;
+    std::vector<std::set<PointIndex> > _map;
 };
 
 /**
@@ -477,7 +480,7 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild (void);
-    const std::pair<unsigned long, unsigned long>& operator[] (const MeshEdge&) const;
+    const std::pair<FacetIndex, FacetIndex>& operator[] (const MeshEdge&) const;
 
 protected:
     class EdgeOrder {
@@ -494,7 +497,7 @@ protected:
                 return false;
         }
     };
-    typedef std::pair<unsigned long, unsigned long> MeshFacetPair;
+    typedef std::pair<FacetIndex, FacetIndex> MeshFacetPair;
     const MeshKernel  &_rclMesh; /**< The mesh kernel. */
     std::map<MeshEdge, MeshFacetPair, EdgeOrder> _map;
 };
@@ -516,13 +519,150 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild (void);
-    const Base::Vector3f& operator[] (unsigned long) const;
+    const Base::Vector3f& operator[] (PointIndex) const;
 
 protected:
     const MeshKernel  &_rclMesh; /**< The mesh kernel. */
     std::vector<Base::Vector3f> _norm;
 };
 
+/**
+ * The MeshIndexRange is a sorted row of element indices of an adjacency structure
+ * in compressed row storage. It offers the read-only part of the interface of the
+ * std::set that the MeshRef* classes return.
+ */
+class MeshIndexRange
+{
+public:
+    typedef const ElementIndex* const_iterator;
+    typedef const_iterator iterator;
+    typedef ElementIndex value_type;
+    typedef std::size_t size_type;
+
+    MeshIndexRange (const_iterator first, const_iterator last)
+      : _first(first), _last(last)
+    { }
+
+    const_iterator begin() const
+    { return _first; }
+    const_iterator end() const
+    { return _last; }
+    size_type size() const
+    { return static_cast<size_type>(_last - _first); }
+    bool empty() const
+    { return _first == _last; }
+    /// Returns the position of \a index or end() if it is not part of the row
+    const_iterator find(ElementIndex index) const
+    {
+        const_iterator it = std::lower_bound(_first, _last, index);
+        return (it != _last && *it == index) ? it : _last;
+    }
+    size_type count(ElementIndex index) const
+    { return find(index) != _last ? 1 : 0; }
+
+private:
+    const_iterator _first;
+    const_iterator _last;
+};
+
+/**
+ * The MeshCsrAdjacency is the base class of the adjacency structures in compressed row
+ * storage. The sorted indices of row \a i are kept in one array from _offsets[i] to
+ * _offsets[i+1]. Compared to the MeshRef* classes that keep a std::set per row this
+ * needs a fraction of the memory and a row is a contiguous block.
+ * Unlike the MeshRef* classes the rows cannot be modified after building them.
+ */
+class MeshExport MeshCsrAdjacency
+{
+public:
+    /// Returns the sorted indices of row \a pos
+    MeshIndexRange operator[] (ElementIndex pos) const
+    {
+        const ElementIndex* data = _indices.data();
+        return MeshIndexRange(data + _offsets[pos], data + _offsets[pos+1]);
+    }
+    /// Returns the number of rows
+    std::size_t CountRows() const
+    { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+    /// Returns the number of bytes used by the structure
+    std::size_t MemSize() const;
+
+protected:
+    std::vector<std::size_t> _offsets;
+    std::vector<ElementIndex> _indices;
+};
+
+/**
+ * The MeshCsrPointToFacets is the compressed counterpart of MeshRefPointToFacets.
+ * It is built in parallel and gives access to all facets indexing a point.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshCsrPointToFacets : public MeshCsrAdjacency
+{
+public:
+    /// Construction
+    MeshCsrPointToFacets (const MeshKernel &rclM) : _rclMesh(rclM)
+    { Rebuild(); }
+
+    /// Rebuilds up data structure
+    void Rebuild (void);
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex) const;
+    std::vector<FacetIndex> GetIndices(PointIndex, PointIndex, PointIndex) const;
+    MeshFacetArray::_TConstIterator GetFacet (FacetIndex) const;
+    std::set<PointIndex> NeighbourPoints(const std::vector<PointIndex>& , int level) const;
+    std::set<PointIndex> NeighbourPoints(PointIndex) const;
+    void Neighbours (FacetIndex ulFacetInd, float fMaxDist, MeshCollector& collect) const;
+    Base::Vector3f GetNormal(PointIndex) const;
+
+protected:
+    const MeshKernel  &_rclMesh; /**< The mesh kernel. */
+};
+
+/**
+ * The MeshCsrFacetToFacets is the compressed counterpart of MeshRefFacetToFacets.
+ * It gives access to all facets sharing at least one point with a facet.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshCsrFacetToFacets : public MeshCsrAdjacency
+{
+public:
+    /// Construction
+    MeshCsrFacetToFacets (const MeshKernel &rclM) : _rclMesh(rclM)
+    { Rebuild(); }
+
+    /// Rebuilds up data structure
+    void Rebuild (void);
+    /// Returns an array of common facets of the passed facet indexes.
+    std::vector<FacetIndex> GetIndices(FacetIndex, FacetIndex) const;
+
+protected:
+    const MeshKernel  &_rclMesh; /**< The mesh kernel. */
+};
+
+/**
+ * The MeshCsrPointToPoints is the compressed counterpart of MeshRefPointToPoints.
+ * It gives access to all neighbour points of a point.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshCsrPointToPoints : public MeshCsrAdjacency
+{
+public:
+    /// Construction
+    MeshCsrPointToPoints (const MeshKernel &rclM) : _rclMesh(rclM)
+    { Rebuild(); }
+
+    /// Rebuilds up data structure
+    void Rebuild (void);
+    Base::Vector3f GetNormal(PointIndex) const;
+    float GetAverageEdgeLength(PointIndex) const;
+
+protected:
+    const MeshKernel  &_rclMesh; /**< The mesh kernel. */
+};
+
 } // namespace MeshCore 
 
 #endif  // MESH_ALGORITHM_H 
@@ -156,7 +156,7 @@ void MeshBuilder::AddFacet (Base::Vector3f* facetPoints, unsigned char flag, uns
 void MeshBuilder::SetNeighbourhood ()
 {
     std::set<Edge> edges;
-    unsigned long facetIdx = 0;
+    FacetIndex facetIdx = 0;
 
     for (MeshFacetArray::_TIterator it = _meshKernel._aclFacetArray.begin(); it != _meshKernel._aclFacetArray.end(); ++it)
     {
@@ -322,44 +322,68 @@ void MeshFastBuilder::AddFacet (const MeshGeomFacet& facetPoints)
     }
 }
 
+void MeshFastBuilder::Resize (size_type ctFacets)
+{
+    p->verts.resize(ctFacets * 3);
+}
+
+void MeshFastBuilder::SetFacet (size_type index, const Base::Vector3f* facetPoints)
+{
+    Private::Vertex* v = p->verts.data() + 3 * index;
+    for (int i=0; i<3; i++) {
+        v[i].x = facetPoints[i].x;
+        v[i].y = facetPoints[i].y;
+        v[i].z = facetPoints[i].z;
+    }
+}
+
 void MeshFastBuilder::Finish ()
 {
     typedef QVector<Private::Vertex>::size_type size_type;
     QVector<Private::Vertex>& verts = p->verts;
     size_type ulCtPts = verts.size();
-    for (size_type i=0; i < ulCtPts; ++i) {
-        verts[i].i = i;
-    }
+    int threads = std::max(1, QThread::idealThreadCount());
+
+    Private::Vertex* data = verts.data();
+    MeshCore::parallel_for(ulCtPts, threads, [data](size_type begin, size_type end) {
+        for (size_type i=begin; i < end; ++i) {
+            data[i].i = i;
+        }
+    });
 
     //std::sort(verts.begin(), verts.end());
-    int threads = std::max(1, QThread::idealThreadCount());
     MeshCore::parallel_sort(verts.begin(), verts.end(), std::less<Private::Vertex>(), threads);
 
-    QVector<unsigned long> indices(ulCtPts);
+    QVector<PointIndex> indices(ulCtPts);
 
     size_type vertex_count = 0;
     for (QVector<Private::Vertex>::iterator v = verts.begin(); v != verts.end(); ++v) {
         if (!vertex_count || *v != verts[vertex_count-1])
             verts[vertex_count++] = *v;
 
-        indices[v->i] = static_cast<unsigned long>(vertex_count - 1);
+        indices[v->i] = static_cast<PointIndex>(vertex_count - 1);
     }
 
     size_type ulCt = verts.size()/3;
-    MeshFacetArray rFacets(static_cast<unsigned long>(ulCt));
-    for (size_type i=0; i < ulCt; ++i) {
-        rFacets[static_cast<size_t>(i)]._aulPoints[0] = indices[3*i];
-        rFacets[static_cast<size_t>(i)]._aulPoints[1] = indices[3*i + 1];
-        rFacets[static_cast<size_t>(i)]._aulPoints[2] = indices[3*i + 2];
-    }
+    MeshFacetArray rFacets(static_cast<size_t>(ulCt));
+    const PointIndex* index = indices.constData();
+    MeshCore::parallel_for(ulCt, threads, [&rFacets, index](size_type begin, size_type end) {
+        for (size_type i=begin; i < end; ++i) {
+            rFacets[static_cast<size_t>(i)]._aulPoints[0] = index[3*i];
+            rFacets[static_cast<size_t>(i)]._aulPoints[1] = index[3*i + 1];
+            rFacets[static_cast<size_t>(i)]._aulPoints[2] = index[3*i + 2];
+        }
+    });
 
     verts.resize(vertex_count);
 
-    MeshPointArray rPoints;
-    rPoints.reserve(static_cast<size_t>(vertex_count));
-    for (QVector<Private::Vertex>::iterator v = verts.begin(); v != verts.end(); ++v) {
-        rPoints.push_back(MeshPoint(v->x, v->y, v->z));
-    }
+    MeshPointArray rPoints(static_cast<size_t>(vertex_count));
+    const Private::Vertex* unique = verts.constData();
+    MeshCore::parallel_for(vertex_count, threads, [&rPoints, unique](size_type begin, size_type end) {
+        for (size_type i=begin; i < end; ++i) {
+            rPoints[static_cast<size_t>(i)].Set(unique[i].x, unique[i].y, unique[i].z);
+        }
+    });
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
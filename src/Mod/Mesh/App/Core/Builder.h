@@ -66,7 +66,7 @@ private:
         public:
         unsigned long	pt1, pt2, facetIdx;
 
-        Edge (unsigned long p1, unsigned long p2, unsigned long idx)
+        Edge (PointIndex p1, PointIndex p2, FacetIndex idx)
         {
             facetIdx = idx;
             if (p1 > p2)
@@ -201,6 +201,15 @@ public:
     /** Add new facet
      */
     void AddFacet (const MeshGeomFacet& facetPoints);
+    /** Resizes the builder to \a ctFacets facets whose points must then be set
+     * with SetFacet(). This can be used instead of Initialize() and AddFacet()
+     * to fill the builder from several threads.
+     */
+    void Resize (size_type ctFacets);
+    /** Sets the points of the facet at the given index. Different facets can be
+     * set concurrently.
+     */
+    void SetFacet (size_type index, const Base::Vector3f* facetPoints);
 
     /** Finishes building up the mesh structure. Must be done after adding facets.
      */
@@ -57,7 +57,7 @@ MeshCurvature::MeshCurvature(const MeshKernel& kernel)
     std::generate(mySegment.begin(), mySegment.end(), Base::iotaGen<unsigned long>(0));
 }
 
-MeshCurvature::MeshCurvature(const MeshKernel& kernel, const std::vector<unsigned long>& segm)
+MeshCurvature::MeshCurvature(const MeshKernel& kernel, const std::vector<FacetIndex>& segm)
   : myKernel(kernel), myMinPoints(20), myRadius(0.5f), mySegment(segm)
 {
 }
@@ -67,12 +67,12 @@ void MeshCurvature::ComputePerFace(bool parallel)
     Base::Vector3f rkDir0, rkDir1, rkPnt;
     Base::Vector3f rkNormal;
     myCurvature.clear();
-    MeshRefPointToFacets search(myKernel);
+    MeshCsrPointToFacets search(myKernel);
     FacetCurvature face(myKernel, search, myRadius, myMinPoints);
 
     if (!parallel) {
         Base::SequencerLauncher seq("Curvature estimation", mySegment.size());
-        for (std::vector<unsigned long>::iterator it = mySegment.begin(); it != mySegment.end(); ++it) {
+        for (std::vector<FacetIndex>::iterator it = mySegment.begin(); it != mySegment.end(); ++it) {
             CurvatureInfo info = face.Compute(*it);
             myCurvature.push_back(info);
             seq.next();
@@ -127,8 +127,8 @@ void MeshCurvature::ComputePerVertex()
     // get all points
     const MeshPointArray& pts = myKernel.GetPoints();
 
-    MeshCore::MeshRefPointToFacets pt2f(myKernel);
-    MeshCore::MeshRefPointToPoints pt2p(myKernel);
+    MeshCore::MeshCsrPointToFacets pt2f(myKernel);
+    MeshCore::MeshCsrPointToPoints pt2p(myKernel);
     unsigned long numPoints = myKernel.CountPoints();
 
     myCurvature.clear();
@@ -162,8 +162,8 @@ void MeshCurvature::ComputePerVertex()
 
         int iV0 = i;
         int iV1;
-        const std::set<unsigned long>& nb = pt2p[i];
-        for (std::set<unsigned long>::const_iterator it = nb.begin(); it != nb.end(); ++it) {
+        MeshIndexRange nb = pt2p[i];
+        for (MeshIndexRange::const_iterator it = nb.begin(); it != nb.end(); ++it) {
             iV1 = *it;
 
             // Compute edge from V0 to V1, project to tangent plane of vertex,
@@ -343,10 +343,10 @@ namespace MeshCore {
 class FitPointCollector : public MeshCollector
 {
 public:
-    FitPointCollector(std::set<unsigned long>& ind) : indices(ind){}
-    virtual void Append(const MeshCore::MeshKernel& kernel, unsigned long index)
+    FitPointCollector(std::set<PointIndex>& ind) : indices(ind){}
+    virtual void Append(const MeshCore::MeshKernel& kernel, FacetIndex index)
     {
-        unsigned long ulP1, ulP2, ulP3;
+        PointIndex ulP1, ulP2, ulP3;
         kernel.GetFacetPoints(index, ulP1, ulP2, ulP3);
         indices.insert(ulP1);
         indices.insert(ulP2);
@@ -354,18 +354,18 @@ public:
     }
 
 private:
-    std::set<unsigned long>& indices;
+    std::set<PointIndex>& indices;
 };
 }
 
 // --------------------------------------------------------
 
-FacetCurvature::FacetCurvature(const MeshKernel& kernel, const MeshRefPointToFacets& search, float r, unsigned long pt)
+FacetCurvature::FacetCurvature(const MeshKernel& kernel, const MeshCsrPointToFacets& search, float r, unsigned long pt)
   : myKernel(kernel), mySearch(search), myMinPoints(pt), myRadius(r)
 {
 }
 
-CurvatureInfo FacetCurvature::Compute(unsigned long index) const
+CurvatureInfo FacetCurvature::Compute(FacetIndex index) const
 {
     Base::Vector3f rkDir0, rkDir1, rkPnt;
     Base::Vector3f rkNormal;
@@ -373,7 +373,7 @@ CurvatureInfo FacetCurvature::Compute(unsigned long index) const
     MeshGeomFacet face = myKernel.GetFacet(index);
     Base::Vector3f face_gravity = face.GetGravityPoint();
     Base::Vector3f face_normal = face.GetNormal();
-    std::set<unsigned long> point_indices;
+    std::set<PointIndex> point_indices;
     FitPointCollector collect(point_indices);
 
     float searchDist = myRadius;
@@ -391,7 +391,7 @@ CurvatureInfo FacetCurvature::Compute(unsigned long index) const
     std::vector<Base::Vector3f> fitPoints;
     const MeshPointArray& verts = myKernel.GetPoints();
     fitPoints.reserve(point_indices.size());
-    for (std::set<unsigned long>::iterator it = point_indices.begin(); it != point_indices.end(); ++it) {
+    for (std::set<PointIndex>::iterator it = point_indices.begin(); it != point_indices.end(); ++it) {
         fitPoints.push_back(verts[*it] - face_gravity);
     }
 
@@ -25,11 +25,12 @@
 
 #include <vector>
 #include <Base/Vector3D.h>
+#include "Definitions.h"
 
 namespace MeshCore {
 
 class MeshKernel;
-class MeshRefPointToFacets;
+class MeshCsrPointToFacets;
 
 /** Curvature information. */
 struct MeshExport CurvatureInfo
@@ -41,12 +42,12 @@ struct MeshExport CurvatureInfo
 class MeshExport FacetCurvature
 {
 public:
-    FacetCurvature(const MeshKernel& kernel, const MeshRefPointToFacets& search, float, unsigned long);
-    CurvatureInfo Compute(unsigned long index) const;
+    FacetCurvature(const MeshKernel& kernel, const MeshCsrPointToFacets& search, float, unsigned long);
+    CurvatureInfo Compute(FacetIndex index) const;
 
 private:
     const MeshKernel& myKernel;
-    const MeshRefPointToFacets& mySearch;
+    const MeshCsrPointToFacets& mySearch;
     unsigned long myMinPoints;
     float myRadius;
 };
@@ -55,7 +56,7 @@ class MeshExport MeshCurvature
 {
 public:
     MeshCurvature(const MeshKernel& kernel);
-    MeshCurvature(const MeshKernel& kernel, const std::vector<unsigned long>& segm);
+    MeshCurvature(const MeshKernel& kernel, const std::vector<FacetIndex>& segm);
     float GetRadius() const { return myRadius; }
     void SetRadius(float r) { myRadius = r; }
     void ComputePerFace(bool parallel);
@@ -66,7 +67,7 @@ private:
     const MeshKernel& myKernel;
     unsigned long myMinPoints;
     float myRadius;
-    std::vector<unsigned long> mySegment;
+    std::vector<FacetIndex> mySegment;
     std::vector<CurvatureInfo> myCurvature;
 };
 
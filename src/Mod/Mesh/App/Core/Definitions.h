@@ -24,6 +24,9 @@
 #ifndef MESH_DEFINITIONS_H
 #define MESH_DEFINITIONS_H
 
+#include <climits>
+#include <cstdint>
+
 // default values
 #define MESH_MIN_PT_DIST           1.0e-6f
 #define MESH_MIN_EDGE_LEN          1.0e-3f
@@ -60,6 +63,27 @@ public:
 typedef Math<float> Mathf;
 typedef Math<double> Mathd;
 
+/**
+ * Type of the indices that reference facets and points of a mesh.
+ * By default an index is an unsigned long. If MESH_COMPACT_INDICES is defined
+ * (CMake option FREECAD_USE_MESH_COMPACT_INDICES) 32-bit indices are used instead
+ * which halves the memory of the topology data on 64-bit platforms but limits a
+ * mesh to 2^32-1 facets and points.
+ */
+#if defined(MESH_COMPACT_INDICES)
+typedef std::uint32_t ElementIndex;
+const ElementIndex ELEMENT_INDEX_MAX = UINT32_MAX;
+#else
+typedef unsigned long ElementIndex;
+const ElementIndex ELEMENT_INDEX_MAX = ULONG_MAX;
+#endif
+/// Index of a facet, FACET_INDEX_MAX marks an invalid index or a missing neighbour
+typedef ElementIndex FacetIndex;
+const FacetIndex FACET_INDEX_MAX = ELEMENT_INDEX_MAX;
+/// Index of a point, POINT_INDEX_MAX marks an invalid index
+typedef ElementIndex PointIndex;
+const PointIndex POINT_INDEX_MAX = ELEMENT_INDEX_MAX;
+
 /**
  * Global defined tolerances used to compare points
  * for equality.
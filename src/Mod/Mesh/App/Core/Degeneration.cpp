@@ -63,9 +63,9 @@ bool MeshEvalInvalids::Evaluate()
   return true;
 }
 
-std::vector<unsigned long> MeshEvalInvalids::GetIndices() const
+std::vector<FacetIndex> MeshEvalInvalids::GetIndices() const
 {
-  std::vector<unsigned long> aInds;
+  std::vector<FacetIndex> aInds;
   const MeshFacetArray& rFaces = _rclMesh.GetFacets();
   const MeshPointArray& rPoints = _rclMesh.GetPoints();
   unsigned long ind=0;
@@ -144,7 +144,7 @@ bool MeshEvalDuplicatePoints::Evaluate()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalDuplicatePoints::GetIndices() const
+std::vector<PointIndex> MeshEvalDuplicatePoints::GetIndices() const
 {
     //Note: We must neither use map or set to get duplicated indices because
     //the sort algorithms deliver different results compared to std::sort of
@@ -157,7 +157,7 @@ std::vector<unsigned long> MeshEvalDuplicatePoints::GetIndices() const
     }
 
     // if there are two adjacent vertices which have the same coordinates
-    std::vector<unsigned long> aInds;
+    std::vector<PointIndex> aInds;
     Vertex_EqualTo pred;
     std::sort(vertices.begin(), vertices.end(), Vertex_Less());
 
@@ -187,21 +187,21 @@ bool MeshFixDuplicatePoints::Fixup()
     }
 
     // get the indices of adjacent vertices which have the same coordinates
-    std::vector<unsigned long> aInds;
+    std::vector<PointIndex> aInds;
     std::sort(vertices.begin(), vertices.end(), Vertex_Less());
 
     Vertex_EqualTo pred;
     std::vector<VertexIterator>::iterator next = vertices.begin();
     std::map<unsigned long, unsigned long> mapPointIndex;
-    std::vector<unsigned long> pointIndices;
+    std::vector<PointIndex> pointIndices;
     while (next < vertices.end()) {
         next = std::adjacent_find(next, vertices.end(), pred);
         if (next < vertices.end()) {
             std::vector<VertexIterator>::iterator first = next;
-            unsigned long first_index = *first - rPoints.begin();
+            PointIndex first_index = *first - rPoints.begin();
             ++next;
             while (next < vertices.end() && pred(*first, *next)) {
-                unsigned long next_index = *next - rPoints.begin();
+                PointIndex next_index = *next - rPoints.begin();
                 mapPointIndex[next_index] = first_index;
                 pointIndices.push_back(next_index);
                 ++next;
@@ -239,9 +239,9 @@ bool MeshEvalNaNPoints::Evaluate()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalNaNPoints::GetIndices() const
+std::vector<PointIndex> MeshEvalNaNPoints::GetIndices() const
 {
-    std::vector<unsigned long> aInds;
+    std::vector<PointIndex> aInds;
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
     for (MeshPointArray::_TConstIterator it = rPoints.begin(); it != rPoints.end(); ++it) {
         if (boost::math::isnan(it->x) || boost::math::isnan(it->y) || boost::math::isnan(it->z))
@@ -253,7 +253,7 @@ std::vector<unsigned long> MeshEvalNaNPoints::GetIndices() const
 
 bool MeshFixNaNPoints::Fixup()
 {
-    std::vector<unsigned long> aInds;
+    std::vector<PointIndex> aInds;
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
     for (MeshPointArray::_TConstIterator it = rPoints.begin(); it != rPoints.end(); ++it) {
         if (boost::math::isnan(it->x) || boost::math::isnan(it->y) || boost::math::isnan(it->z))
@@ -351,7 +351,7 @@ bool MeshEvalDuplicateFacets::Evaluate()
   return true;
 }
 
-std::vector<unsigned long> MeshEvalDuplicateFacets::GetIndices() const
+std::vector<FacetIndex> MeshEvalDuplicateFacets::GetIndices() const
 {
 #if 1
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
@@ -362,7 +362,7 @@ std::vector<unsigned long> MeshEvalDuplicateFacets::GetIndices() const
     }
 
     // if there are two adjacent faces which references the same vertices
-    std::vector<unsigned long> aInds;
+    std::vector<FacetIndex> aInds;
     MeshFacet_EqualTo pred;
     std::sort(faces.begin(), faces.end(), MeshFacet_Less());
 
@@ -378,9 +378,9 @@ std::vector<unsigned long> MeshEvalDuplicateFacets::GetIndices() const
 
     return aInds;
 #else
-  std::vector<unsigned long> aInds;
+  std::vector<FacetIndex> aInds;
   const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-  unsigned long uIndex=0;
+  FacetIndex uIndex=0;
 
   // get all facets
   std::set<FaceIterator, MeshFacet_Less > aFaceSet;
@@ -398,8 +398,8 @@ std::vector<unsigned long> MeshEvalDuplicateFacets::GetIndices() const
 
 bool MeshFixDuplicateFacets::Fixup()
 {
-    unsigned long uIndex=0;
-    std::vector<unsigned long> aRemoveFaces;
+    FacetIndex uIndex=0;
+    std::vector<FacetIndex> aRemoveFaces;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
 
     // get all facets
@@ -422,7 +422,7 @@ bool MeshFixDuplicateFacets::Fixup()
 bool MeshEvalInternalFacets::Evaluate()
 {
     _indices.clear();
-    unsigned long uIndex=0;
+    FacetIndex uIndex=0;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
 
     // get all facets
@@ -470,9 +470,9 @@ unsigned long MeshEvalDegeneratedFacets::CountEdgeTooSmall (float fMinEdgeLength
     return k;
 }
 
-std::vector<unsigned long> MeshEvalDegeneratedFacets::GetIndices() const
+std::vector<FacetIndex> MeshEvalDegeneratedFacets::GetIndices() const
 {
-    std::vector<unsigned long> aInds;
+    std::vector<FacetIndex> aInds;
     MeshFacetIterator it(_rclMesh);
     for (it.Init(); it.More(); it.Next()) {
         if (it->IsDegenerated(fEpsilon))
@@ -490,7 +490,7 @@ bool MeshFixDegeneratedFacets::Fixup()
     for (it.Init(); it.More(); it.Next()) {
         if (it->IsDegenerated(fEpsilon)) {
             unsigned long uCt = _rclMesh.CountFacets();
-            unsigned long uId = it.Position();
+            FacetIndex uId = it.Position();
             cTopAlg.RemoveDegeneratedFacet(uId);
             if (uCt != _rclMesh.CountFacets()) {
                 // due to a modification of the array the iterator became invalid
@@ -530,7 +530,7 @@ bool MeshRemoveNeedles::Fixup()
 
             float distance = Base::Distance(p1, p2);
             if (distance < fMinLen) {
-                unsigned long facetIndex = static_cast<unsigned long>(index);
+                FacetIndex facetIndex = static_cast<unsigned long>(index);
                 todo.push(std::make_pair(distance, std::make_pair(facetIndex, i)));
             }
         }
@@ -562,18 +562,18 @@ bool MeshRemoveNeedles::Fixup()
         ce._toPoint = rclFAry[faceedge.first]._aulPoints[(faceedge.second+1)%3];
 
         ce._removeFacets.push_back(faceedge.first);
-        unsigned long neighbour = rclFAry[faceedge.first]._aulNeighbours[faceedge.second];
-        if (neighbour != ULONG_MAX)
+        FacetIndex neighbour = rclFAry[faceedge.first]._aulNeighbours[faceedge.second];
+        if (neighbour != FACET_INDEX_MAX)
             ce._removeFacets.push_back(neighbour);
 
-        std::set<unsigned long> vf = vf_it[ce._fromPoint];
+        std::set<PointIndex> vf = vf_it[ce._fromPoint];
         vf.erase(faceedge.first);
-        if (neighbour != ULONG_MAX)
+        if (neighbour != FACET_INDEX_MAX)
             vf.erase(neighbour);
         ce._changeFacets.insert(ce._changeFacets.begin(), vf.begin(), vf.end());
 
         // get adjacent points
-        std::set<unsigned long> vv;
+        std::set<PointIndex> vv;
         vv = vf_it.NeighbourPoints(ce._fromPoint);
         ce._adjacentFrom.insert(ce._adjacentFrom.begin(), vv.begin(),vv.end());
         vv = vf_it.NeighbourPoints(ce._toPoint);
@@ -625,9 +625,9 @@ bool MeshRemoveNeedles::Fixup()
             Base::Vector3f clE12 = clP2 - clP1;
             Base::Vector3f clE20 = clP2 - clP0;
             MeshFacet clFacet = clFIter.GetIndices();
-            unsigned long    ulP0 = clFacet._aulPoints[0];
-            unsigned long    ulP1 = clFacet._aulPoints[1];
-            unsigned long    ulP2 = clFacet._aulPoints[2];
+            PointIndex    ulP0 = clFacet._aulPoints[0];
+            PointIndex    ulP1 = clFacet._aulPoints[1];
+            PointIndex    ulP2 = clFacet._aulPoints[2];
 
             if (Base::Distance(clP0, clP1) < fMinEdgeLength) {
                 // delete point P1 on P0
@@ -663,8 +663,8 @@ bool MeshRemoveNeedles::Fixup()
 
             // Redirect all point-indices to the new neighbour point of all facets referencing the
             // deleted point
-            const std::set<unsigned long>& faces = clPt2Facets[pI->second];
-            for (std::set<unsigned long>::const_iterator pF = faces.begin(); pF != faces.end(); ++pF) {
+            const std::set<FacetIndex>& faces = clPt2Facets[pI->second];
+            for (std::set<FacetIndex>::const_iterator pF = faces.begin(); pF != faces.end(); ++pF) {
                 const MeshFacet &rclF = f_beg[*pF];
 
                 for (int i = 0; i < 3; i++) {
@@ -720,7 +720,7 @@ bool MeshFixCaps::Fixup()
 
             float fCosAngle = dir1.Dot(dir2);
             if (fCosAngle < fCosMaxAngle) {
-                unsigned long facetIndex = static_cast<unsigned long>(index);
+                FacetIndex facetIndex = static_cast<unsigned long>(index);
                 todo.push(std::make_pair(fCosAngle, std::make_pair(facetIndex, i)));
             }
         }
@@ -754,9 +754,9 @@ bool MeshFixCaps::Fixup()
         if (distP2P4/distP2P3 < fSplitFactor || distP3P4/distP2P3 < fSplitFactor)
             continue;
 
-        unsigned long facetpos = facevertex.first;
-        unsigned long neighbour = rclFAry[facetpos]._aulNeighbours[(facevertex.second+1)%3];
-        if (neighbour != ULONG_MAX)
+        FacetIndex facetpos = facevertex.first;
+        FacetIndex neighbour = rclFAry[facetpos]._aulNeighbours[(facevertex.second+1)%3];
+        if (neighbour != FACET_INDEX_MAX)
             topAlg.SwapEdge(facetpos, neighbour);
     }
 
@@ -779,12 +779,12 @@ bool MeshEvalDeformedFacets::Evaluate()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalDeformedFacets::GetIndices() const
+std::vector<FacetIndex> MeshEvalDeformedFacets::GetIndices() const
 {
     float fCosMinAngle = cos(fMinAngle);
     float fCosMaxAngle = cos(fMaxAngle);
 
-    std::vector<unsigned long> aInds;
+    std::vector<FacetIndex> aInds;
     MeshFacetIterator it(_rclMesh);
     for (it.Init(); it.More(); it.Next()) {
         if (it->IsDeformed(fCosMinAngle, fCosMaxAngle))
@@ -825,8 +825,8 @@ bool MeshFixDeformedFacets::Fixup()
                 float fCosAngle = fCosAngles[i];
                 if (fCosAngle < fCosMaxAngle) {
                     const MeshFacet& face = it.GetReference();
-                    unsigned long uNeighbour = face._aulNeighbours[(i+1)%3];
-                    if (uNeighbour!=ULONG_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
+                    FacetIndex uNeighbour = face._aulNeighbours[(i+1)%3];
+                    if (uNeighbour!=FACET_INDEX_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
                         cTopAlg.SwapEdge(it.Position(), uNeighbour);
                         done = true;
                     }
@@ -844,14 +844,14 @@ bool MeshFixDeformedFacets::Fixup()
                 if (fCosAngle > fCosMinAngle) {
                     const MeshFacet& face = it.GetReference();
 
-                    unsigned long uNeighbour = face._aulNeighbours[j];
-                    if (uNeighbour!=ULONG_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
+                    FacetIndex uNeighbour = face._aulNeighbours[j];
+                    if (uNeighbour!=FACET_INDEX_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
                         cTopAlg.SwapEdge(it.Position(), uNeighbour);
                         break;
                     }
 
                     uNeighbour = face._aulNeighbours[(j+2)%3];
-                    if (uNeighbour!=ULONG_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
+                    if (uNeighbour!=FACET_INDEX_MAX && cTopAlg.ShouldSwapEdge(it.Position(), uNeighbour, fMaxSwapAngle)) {
                         cTopAlg.SwapEdge(it.Position(), uNeighbour);
                         break;
                     }
@@ -867,8 +867,8 @@ bool MeshFixDeformedFacets::Fixup()
 
 bool MeshFixMergeFacets::Fixup()
 {
-    MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
-    MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
+    MeshCore::MeshCsrPointToPoints vv_it(_rclMesh);
+    MeshCore::MeshCsrPointToFacets vf_it(_rclMesh);
     unsigned long countPoints = _rclMesh.CountPoints();
 
     std::vector<MeshFacet> newFacets;
@@ -879,9 +879,9 @@ bool MeshFixMergeFacets::Fixup()
         if (vv_it[i].size() == 3 && vf_it[i].size() == 3) {
             VertexCollapse vc;
             vc._point = i;
-            const std::set<unsigned long>& adjPts = vv_it[i];
+            MeshIndexRange adjPts = vv_it[i];
             vc._circumPoints.insert(vc._circumPoints.begin(), adjPts.begin(), adjPts.end());
-            const std::set<unsigned long>& adjFts = vf_it[i];
+            MeshIndexRange adjFts = vf_it[i];
             vc._circumFacets.insert(vc._circumFacets.begin(), adjFts.begin(), adjFts.end());
             topAlg.CollapseVertex(vc);
         }
@@ -896,24 +896,24 @@ bool MeshFixMergeFacets::Fixup()
 bool MeshEvalDentsOnSurface::Evaluate()
 {
     this->indices.clear();
-    MeshRefPointToFacets  clPt2Facets(_rclMesh);
+    MeshCsrPointToFacets  clPt2Facets(_rclMesh);
     const MeshPointArray& rPntAry = _rclMesh.GetPoints();
     MeshFacetArray::_TConstIterator f_beg = _rclMesh.GetFacets().begin();
 
     MeshGeomFacet rTriangle;
     Base::Vector3f tmp;
     unsigned long ctPoints = _rclMesh.CountPoints();
-    for (unsigned long index=0; index < ctPoints; index++) {
-        std::vector<unsigned long> point;
+    for (PointIndex index=0; index < ctPoints; index++) {
+        std::vector<PointIndex> point;
         point.push_back(index);
 
         // get the local neighbourhood of the point
-        std::set<unsigned long> nb = clPt2Facets.NeighbourPoints(point,1);
-        const std::set<unsigned long>& faces = clPt2Facets[index];
+        std::set<PointIndex> nb = clPt2Facets.NeighbourPoints(point,1);
+        MeshIndexRange faces = clPt2Facets[index];
 
-        for (std::set<unsigned long>::iterator pt = nb.begin(); pt != nb.end(); ++pt) {
+        for (std::set<PointIndex>::iterator pt = nb.begin(); pt != nb.end(); ++pt) {
             const MeshPoint& mp = rPntAry[*pt];
-            for (std::set<unsigned long>::const_iterator
+            for (MeshIndexRange::const_iterator
                 ft = faces.begin(); ft != faces.end(); ++ft) {
                     // the point must not be part of the facet we test
                     if (f_beg[*ft]._aulPoints[0] == *pt)
@@ -925,7 +925,7 @@ bool MeshEvalDentsOnSurface::Evaluate()
                     // is the point projectable onto the facet?
                     rTriangle = _rclMesh.GetFacet(f_beg[*ft]);
                     if (rTriangle.IntersectWithLine(mp,rTriangle.GetNormal(),tmp)) {
-                        const std::set<unsigned long>& f = clPt2Facets[*pt];
+                        MeshIndexRange f = clPt2Facets[*pt];
                         this->indices.insert(this->indices.end(), f.begin(), f.end());
                         break;
                     }
@@ -941,7 +941,7 @@ bool MeshEvalDentsOnSurface::Evaluate()
     return this->indices.empty();
 }
 
-std::vector<unsigned long> MeshEvalDentsOnSurface::GetIndices() const
+std::vector<FacetIndex> MeshEvalDentsOnSurface::GetIndices() const
 {
     return this->indices;
 }
@@ -961,7 +961,7 @@ bool MeshFixDentsOnSurface::Fixup()
 {
     MeshEvalDentsOnSurface eval(_rclMesh);
     if (!eval.Evaluate()) {
-        std::vector<unsigned long> inds = eval.GetIndices();
+        std::vector<FacetIndex> inds = eval.GetIndices();
         _rclMesh.DeleteFacets(inds);
     }
 
@@ -977,10 +977,10 @@ bool MeshEvalFoldsOnSurface::Evaluate()
     unsigned long ct=0;
     for (MeshFacetArray::const_iterator it = rFAry.begin(); it != rFAry.end(); ++it, ct++) {
         for (int i=0; i<3; i++) {
-            unsigned long n1 = it->_aulNeighbours[i];
-            unsigned long n2 = it->_aulNeighbours[(i+1)%3];
+            FacetIndex n1 = it->_aulNeighbours[i];
+            FacetIndex n2 = it->_aulNeighbours[(i+1)%3];
             Base::Vector3f v1 =_rclMesh.GetFacet(*it).GetNormal();
-            if (n1 != ULONG_MAX && n2 != ULONG_MAX) {
+            if (n1 != FACET_INDEX_MAX && n2 != FACET_INDEX_MAX) {
                 Base::Vector3f v2 = _rclMesh.GetFacet(n1).GetNormal();
                 Base::Vector3f v3 = _rclMesh.GetFacet(n2).GetNormal();
                 if (v2 * v3 > 0.0f) {
@@ -1001,7 +1001,7 @@ bool MeshEvalFoldsOnSurface::Evaluate()
     return this->indices.empty();
 }
 
-std::vector<unsigned long> MeshEvalFoldsOnSurface::GetIndices() const
+std::vector<FacetIndex> MeshEvalFoldsOnSurface::GetIndices() const
 {
     return this->indices;
 }
@@ -1017,7 +1017,7 @@ bool MeshEvalFoldsOnBoundary::Evaluate()
     for (MeshFacetArray::_TConstIterator it = rFacAry.begin(); it != rFacAry.end(); ++it) {
         if (it->CountOpenEdges() == 2) {
             for (int i=0; i<3; i++) {
-                if (it->_aulNeighbours[i] != ULONG_MAX) {
+                if (it->_aulNeighbours[i] != FACET_INDEX_MAX) {
                     MeshGeomFacet f1 = _rclMesh.GetFacet(*it);
                     MeshGeomFacet f2 = _rclMesh.GetFacet(it->_aulNeighbours[i]);
                     float cos_angle = f1.GetNormal() * f2.GetNormal();
@@ -1031,7 +1031,7 @@ bool MeshEvalFoldsOnBoundary::Evaluate()
     return this->indices.empty();
 }
 
-std::vector<unsigned long> MeshEvalFoldsOnBoundary::GetIndices() const
+std::vector<FacetIndex> MeshEvalFoldsOnBoundary::GetIndices() const
 {
     return this->indices;
 }
@@ -1040,7 +1040,7 @@ bool MeshFixFoldsOnBoundary::Fixup()
 {
     MeshEvalFoldsOnBoundary eval(_rclMesh);
     if (!eval.Evaluate()) {
-        std::vector<unsigned long> inds = eval.GetIndices();
+        std::vector<FacetIndex> inds = eval.GetIndices();
         _rclMesh.DeleteFacets(inds);
     }
 
@@ -1059,9 +1059,9 @@ bool MeshEvalFoldOversOnSurface::Evaluate()
     Base::Vector3f n1, n2;
     for (f_it = facets.begin(); f_it != f_end; ++f_it) {
         for (int i=0; i<3; i++) {
-            unsigned long index1 = f_it->_aulNeighbours[i];
-            unsigned long index2 = f_it->_aulNeighbours[(i+1)%3];
-            if (index1 != ULONG_MAX && index2 != ULONG_MAX) {
+            FacetIndex index1 = f_it->_aulNeighbours[i];
+            FacetIndex index2 = f_it->_aulNeighbours[(i+1)%3];
+            if (index1 != FACET_INDEX_MAX && index2 != FACET_INDEX_MAX) {
                 // if the topology is correct but the normals flip from
                 // two neighbours we have a fold
                 if (f_it->HasSameOrientation(f_beg[index1]) &&
@@ -1087,13 +1087,13 @@ bool MeshEvalBorderFacet::Evaluate()
     const MeshCore::MeshFacetArray& facets = _rclMesh.GetFacets();
     MeshCore::MeshFacetArray::_TConstIterator f_it,
         f_beg = facets.begin(), f_end = facets.end();
-    MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
-    MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
+    MeshCore::MeshCsrPointToPoints vv_it(_rclMesh);
+    MeshCore::MeshCsrPointToFacets vf_it(_rclMesh);
 
     for (f_it = facets.begin(); f_it != f_end; ++f_it) {
         bool ok = true;
         for (int i=0; i<3; i++) {
-            unsigned long index = f_it->_aulPoints[i];
+            PointIndex index = f_it->_aulPoints[i];
             if (vv_it[index].size() == vf_it[index].size()) {
                 ok = false;
                 break;
@@ -1116,7 +1116,7 @@ bool MeshEvalRangeFacet::Evaluate()
 
     for (MeshFacetArray::_TConstIterator it = rFaces.begin(); it != rFaces.end(); ++it) {
         for (int i = 0; i < 3; i++) {
-            if ((it->_aulNeighbours[i] >= ulCtFacets) && (it->_aulNeighbours[i] < ULONG_MAX)) {
+            if ((it->_aulNeighbours[i] >= ulCtFacets) && (it->_aulNeighbours[i] < FACET_INDEX_MAX)) {
                 return false;
             }
         }
@@ -1125,16 +1125,16 @@ bool MeshEvalRangeFacet::Evaluate()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalRangeFacet::GetIndices() const
+std::vector<FacetIndex> MeshEvalRangeFacet::GetIndices() const
 {
-    std::vector<unsigned long> aInds;
+    std::vector<FacetIndex> aInds;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
     unsigned long ulCtFacets = rFaces.size();
 
-    unsigned long ind=0;
+    FacetIndex ind=0;
     for (MeshFacetArray::_TConstIterator it = rFaces.begin(); it != rFaces.end(); ++it, ind++) {
         for (int i = 0; i < 3; i++) {
-            if ((it->_aulNeighbours[i] >= ulCtFacets) && (it->_aulNeighbours[i] < ULONG_MAX)) {
+            if ((it->_aulNeighbours[i] >= ulCtFacets) && (it->_aulNeighbours[i] < FACET_INDEX_MAX)) {
                 aInds.push_back(ind);
                 break;
             }
@@ -1165,9 +1165,9 @@ bool MeshEvalRangePoint::Evaluate()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalRangePoint::GetIndices() const
+std::vector<PointIndex> MeshEvalRangePoint::GetIndices() const
 {
-    std::vector<unsigned long> aInds;
+    std::vector<FacetIndex> aInds;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
     unsigned long ulCtPoints = _rclMesh.CountPoints();
 
@@ -1190,10 +1190,10 @@ bool MeshFixRangePoint::Fixup()
     else {
         // facets with point indices out of range cannot be directly deleted because
         // 'DeleteFacets' will segfault. But setting all point indices to 0 works.
-        std::vector<unsigned long> invalid = eval.GetIndices();
+        std::vector<FacetIndex> invalid = eval.GetIndices();
         if (!invalid.empty()) {
             const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-            for (std::vector<unsigned long>::iterator it = invalid.begin(); it != invalid.end(); ++it) {
+            for (std::vector<FacetIndex>::iterator it = invalid.begin(); it != invalid.end(); ++it) {
                 MeshFacet& face = const_cast<MeshFacet&>(rFaces[*it]);
                 face._aulPoints[0] = 0;
                 face._aulPoints[1] = 0;
@@ -1223,9 +1223,9 @@ bool MeshEvalCorruptedFacets::Evaluate()
   return true;
 }
 
-std::vector<unsigned long> MeshEvalCorruptedFacets::GetIndices() const
+std::vector<FacetIndex> MeshEvalCorruptedFacets::GetIndices() const
 {
-  std::vector<unsigned long> aInds;
+  std::vector<FacetIndex> aInds;
   const MeshFacetArray& rFaces = _rclMesh.GetFacets();
   unsigned long ind=0;
 
@@ -1248,7 +1248,7 @@ bool MeshFixCorruptedFacets::Fixup()
   {
     if ( it->Area() <= FLOAT_EPS )
     {
-      unsigned long uId = it.Position();
+      FacetIndex uId = it.Position();
       cTopAlg.RemoveCorruptedFacet(uId);
       // due to a modification of the array the iterator became invalid
       it.Set(uId-1);
@@ -30,6 +30,7 @@
 #include <Mod/Mesh/App/WildMagic4/Wm4IntrSegment3Box3.h>
 #include <Mod/Mesh/App/WildMagic4/Wm4DistVector3Triangle3.h>
 #include <Mod/Mesh/App/WildMagic4/Wm4DistSegment3Triangle3.h>
+#include <Base/Parallel.h>
 
 #include "Elements.h"
 #include "Algorithm.h"
@@ -44,7 +45,7 @@ MeshPointArray::MeshPointArray(const MeshPointArray& ary)
 {
 }
 
-unsigned long MeshPointArray::Get (const MeshPoint &rclPoint)
+PointIndex MeshPointArray::Get (const MeshPoint &rclPoint)
 {
   iterator clIter;
 
@@ -52,14 +53,14 @@ unsigned long MeshPointArray::Get (const MeshPoint &rclPoint)
   if (clIter != end())
     return clIter - begin();
   else
-    return ULONG_MAX;  
+    return POINT_INDEX_MAX;  
 }
 
-unsigned long MeshPointArray::GetOrAddIndex (const MeshPoint &rclPoint)
+PointIndex MeshPointArray::GetOrAddIndex (const MeshPoint &rclPoint)
 {
-  unsigned long ulIndex;
+  PointIndex ulIndex;
 
-  if ((ulIndex = Get(rclPoint)) == ULONG_MAX)
+  if ((ulIndex = Get(rclPoint)) == POINT_INDEX_MAX)
   {
     push_back(rclPoint);
     return static_cast<unsigned long>(size() - 1);
@@ -98,8 +99,10 @@ MeshPointArray& MeshPointArray::operator = (const MeshPointArray &rclPAry)
 
 void MeshPointArray::Transform(const Base::Matrix4D& mat)
 {
-  for (_TIterator pP = begin(); pP != end(); ++pP)
-    mat.multVec(*pP,*pP);
+  MeshPoint* pts = data();
+  Base::parallel_for<std::size_t>(size(), 4096, [&](std::size_t first, std::size_t last) {
+    mat.multVec(pts + first, last - first, sizeof(MeshPoint));
+  });
 }
 
 MeshFacetArray::MeshFacetArray(const MeshFacetArray& ary)
@@ -110,9 +113,10 @@ MeshFacetArray::MeshFacetArray(const MeshFacetArray& ary)
 
 void MeshFacetArray::Erase (_TIterator pIter)
 {
-  unsigned long i, *pulN;
+  unsigned long i;
+  FacetIndex *pulN;
   _TIterator  pPass, pEnd;
-  unsigned long ulInd = pIter - begin();
+  FacetIndex ulInd = pIter - begin();
   erase(pIter);
   pPass = begin();
   pEnd  = end();
@@ -121,14 +125,14 @@ void MeshFacetArray::Erase (_TIterator pIter)
     for (i = 0; i < 3; i++)
     {
       pulN = &pPass->_aulNeighbours[i];
-      if ((*pulN > ulInd) && (*pulN != ULONG_MAX))
+      if ((*pulN > ulInd) && (*pulN != FACET_INDEX_MAX))
         (*pulN)--;
     }
     pPass++;
   }
 }
 
-void MeshFacetArray::TransposeIndices (unsigned long ulOrig, unsigned long ulNew)
+void MeshFacetArray::TransposeIndices (PointIndex ulOrig, PointIndex ulNew)
 {
   _TIterator  pIter = begin(), pEnd = end();
 
@@ -139,7 +143,7 @@ void MeshFacetArray::TransposeIndices (unsigned long ulOrig, unsigned long ulNew
   }
 }
 
-void MeshFacetArray::DecrementIndices (unsigned long ulIndex)
+void MeshFacetArray::DecrementIndices (PointIndex ulIndex)
 {
   _TIterator  pIter = begin(), pEnd = end();
 
@@ -54,7 +54,7 @@ class MeshExport MeshHelpEdge
 {
 public:
   inline bool operator == (const MeshHelpEdge &rclEdge) const;
-  unsigned long   _ulIndex[2];  // point indices
+  PointIndex  _ulIndex[2];  // point indices
 };
 
 /**
@@ -64,28 +64,28 @@ public:
 class MeshExport MeshIndexEdge
 {
 public:
-  unsigned long  _ulFacetIndex;  // Facet index
+  FacetIndex  _ulFacetIndex;  // Facet index
   unsigned short _ausCorner[2];  // corner point indices of the facet
 };
 
 /** MeshEdge just a pair of two point indices */
-typedef std::pair<unsigned long, unsigned long> MeshEdge;
+typedef std::pair<PointIndex, PointIndex> MeshEdge;
 
 struct MeshExport EdgeCollapse
 {
-  unsigned long _fromPoint;
-  unsigned long _toPoint;
-  std::vector<unsigned long> _adjacentFrom; // adjacent points to _fromPoint
-  std::vector<unsigned long> _adjacentTo;   // adjacent points to _toPoint
-  std::vector<unsigned long> _removeFacets;
-  std::vector<unsigned long> _changeFacets;
+  PointIndex _fromPoint;
+  PointIndex _toPoint;
+  std::vector<PointIndex> _adjacentFrom; // adjacent points to _fromPoint
+  std::vector<PointIndex> _adjacentTo;   // adjacent points to _toPoint
+  std::vector<FacetIndex> _removeFacets;
+  std::vector<FacetIndex> _changeFacets;
 };
 
 struct MeshExport VertexCollapse
 {
-  unsigned long _point;
-  std::vector<unsigned long> _circumPoints;
-  std::vector<unsigned long> _circumFacets;
+  PointIndex _point;
+  std::vector<PointIndex> _circumPoints;
+  std::vector<FacetIndex> _circumFacets;
 };
 
 /**
@@ -146,7 +146,7 @@ public:
 
 public:
   unsigned char _ucFlag; /**< Flag member */
-  unsigned long _ulProp; /**< Free usable property */
+  ElementIndex  _ulProp; /**< Free usable property */
 };
 
 /**
@@ -199,7 +199,7 @@ public:
  * \li neighbour or edge number of 0 is defined by corner 0 and 1
  * \li neighbour or edge number of 1 is defined by corner 1 and 2
  * \li neighbour or edge number of 2 is defined by corner 2 and 0
- * \li neighbour index is set to ULONG_MAX if there is no neighbour facet
+ * \li neighbour index is set to FACET_INDEX_MAX if there is no neighbour facet
  *
  * Note: The status flag SEGMENT mark a facet to be part of certain subset, a segment.
  * This flag must not be set by any algorithm unless it adds or removes facets to a segment.
@@ -217,7 +217,7 @@ public:
   //@{
   inline MeshFacet (void);
   inline MeshFacet(const MeshFacet &rclF);
-  inline MeshFacet(unsigned long p1,unsigned long p2,unsigned long p3,unsigned long n1=ULONG_MAX,unsigned long n2=ULONG_MAX,unsigned long n3=ULONG_MAX);
+  inline MeshFacet(PointIndex p1,PointIndex p2,PointIndex p3,FacetIndex n1=FACET_INDEX_MAX,FacetIndex n2=FACET_INDEX_MAX,FacetIndex n3=FACET_INDEX_MAX);
   ~MeshFacet (void) { }
   //@}
 
@@ -248,8 +248,8 @@ public:
 
   // Assignment
   inline MeshFacet& operator = (const MeshFacet &rclF);
-  inline void SetVertices(unsigned long,unsigned long,unsigned long);
-  inline void SetNeighbours(unsigned long,unsigned long,unsigned long);
+  inline void SetVertices(PointIndex,PointIndex,PointIndex);
+  inline void SetNeighbours(FacetIndex,FacetIndex,FacetIndex);
 
   /**
    * Returns the indices of the corner points of the given edge number. 
@@ -258,17 +258,17 @@ public:
   /**
    * Returns the indices of the corner points of the given edge number. 
    */
-  inline std::pair<unsigned long, unsigned long> GetEdge (unsigned short usSide) const;
+  inline std::pair<PointIndex, PointIndex> GetEdge (unsigned short usSide) const;
   /**
    * Returns the edge-number to the given index of neighbour facet.
    * If \a ulNIndex is not a neighbour USHRT_MAX is returned.
    */
-  inline unsigned short Side (unsigned long ulNIndex) const;
+  inline unsigned short Side (FacetIndex ulNIndex) const;
   /**
    * Returns the edge-number defined by two points. If one point is
    * not a corner point USHRT_MAX is returned.
    */
-  inline unsigned short Side (unsigned long ulP0, unsigned long P1) const;
+  inline unsigned short Side (PointIndex ulP0, PointIndex P1) const;
   /**
    * Returns the edge-number defined by the shared edge of both facets. If the facets don't 
    * share a common edge USHRT_MAX is returned.
@@ -284,26 +284,26 @@ public:
    * by \a ulNew. If the facet does not have a corner point with this index
    * nothing happens.
    */
-  inline void Transpose (unsigned long ulOrig, unsigned long ulNew);
+  inline void Transpose (PointIndex ulOrig, PointIndex ulNew);
   /**
    * Decrement the index for each corner point that is higher than \a ulIndex.
    */
-  inline void Decrement (unsigned long ulIndex);
+  inline void Decrement (PointIndex ulIndex);
   /**
    * Checks if the facets references the given point index.
    */
-  inline bool HasPoint(unsigned long) const;
+  inline bool HasPoint(PointIndex) const;
   /**
    * Replaces the index of the neighbour facet that is equal to \a ulOrig
    * by \a ulNew. If the facet does not have a neighbourt with this index
    * nothing happens.
    */
-  inline void ReplaceNeighbour (unsigned long ulOrig, unsigned long ulNew);
+  inline void ReplaceNeighbour (FacetIndex ulOrig, FacetIndex ulNew);
   /**
    * Checks if the neighbour exists at the given edge-number.
    */
   bool HasNeighbour (unsigned short usSide) const
-  { return (_aulNeighbours[usSide] != ULONG_MAX); }
+  { return (_aulNeighbours[usSide] != FACET_INDEX_MAX); }
   /** Counts the number of edges without neighbour. */
   inline unsigned short CountOpenEdges() const;
   /** Returns true if there is an edge without neighbour, otherwise false. */
@@ -323,9 +323,9 @@ public:
 
 public:
   unsigned char _ucFlag; /**< Flag member. */
-  unsigned long _ulProp; /**< Free usable property. */
-  unsigned long _aulPoints[3];     /**< Indices of corner points. */
-  unsigned long _aulNeighbours[3]; /**< Indices of neighbour facets. */
+  ElementIndex  _ulProp; /**< Free usable property. */
+  PointIndex _aulPoints[3];     /**< Indices of corner points. */
+  FacetIndex _aulNeighbours[3]; /**< Indices of neighbour facets. */
 };
 
 /**
@@ -573,15 +573,15 @@ public:
   void Transform(const Base::Matrix4D&);
   /**
    * Searches for the first point index  Two points are equal if the distance is less
-   * than EPSILON. If no such points is found ULONG_MAX is returned. 
+   * than EPSILON. If no such points is found POINT_INDEX_MAX is returned. 
    */
-  unsigned long Get (const MeshPoint &rclPoint);
+  PointIndex Get (const MeshPoint &rclPoint);
   /**
    * Searches for the first point index  Two points are equal if the distance is less
    * than EPSILON. If no such points is found the point is added to the array at end
    * and its index is returned. 
    */
-  unsigned long GetOrAddIndex (const MeshPoint &rclPoint);
+  PointIndex GetOrAddIndex (const MeshPoint &rclPoint);
 };
 
 typedef std::vector<MeshFacet>  TMeshFacetArray;
@@ -634,11 +634,11 @@ public:
     /**
      * Checks and flips the point indices if needed. @see MeshFacet::Transpose().
      */
-    void TransposeIndices (unsigned long ulOrig, unsigned long ulNew);
+    void TransposeIndices (PointIndex ulOrig, PointIndex ulNew);
     /**
      * Decrements all point indices that are higher than \a ulIndex.
      */
-    void DecrementIndices (unsigned long ulIndex);
+    void DecrementIndices (PointIndex ulIndex);
 };
 
 /**
@@ -684,7 +684,7 @@ public:
      * that is equal to \a old by \a now. If the facet does not have a corner
      * point with this index nothing happens.
      */
-    void Transpose(unsigned long pos, unsigned long old, unsigned long now)
+    void Transpose(FacetIndex pos, PointIndex old, PointIndex now)
     {
         rFacets[pos].Transpose(old, now);
     }
@@ -861,8 +861,8 @@ inline MeshFacet::MeshFacet (void)
 : _ucFlag(0),
   _ulProp(0)
 {
-    memset(_aulNeighbours, 0xff, sizeof(unsigned long) * 3);
-    memset(_aulPoints, 0xff, sizeof(unsigned long) * 3);
+    memset(_aulNeighbours, 0xff, sizeof(FacetIndex) * 3);
+    memset(_aulPoints, 0xff, sizeof(PointIndex) * 3);
 }
 
 inline MeshFacet::MeshFacet(const MeshFacet &rclF)
@@ -878,8 +878,8 @@ inline MeshFacet::MeshFacet(const MeshFacet &rclF)
     _aulNeighbours[2] = rclF._aulNeighbours[2];
 }
 
-inline MeshFacet::MeshFacet(unsigned long p1,unsigned long p2,unsigned long p3,
-                            unsigned long n1,unsigned long n2,unsigned long n3)
+inline MeshFacet::MeshFacet(PointIndex p1,PointIndex p2,PointIndex p3,
+                            FacetIndex n1,FacetIndex n2,FacetIndex n3)
 : _ucFlag(0),
   _ulProp(0)
 {
@@ -908,14 +908,14 @@ inline MeshFacet& MeshFacet::operator = (const MeshFacet &rclF)
     return *this;
 }
 
-void MeshFacet::SetVertices(unsigned long p1,unsigned long p2,unsigned long p3)
+void MeshFacet::SetVertices(PointIndex p1,PointIndex p2,PointIndex p3)
 {
     _aulPoints[0] = p1;
     _aulPoints[1] = p2;
     _aulPoints[2] = p3;
 }
 
-void MeshFacet::SetNeighbours(unsigned long n1,unsigned long n2,unsigned long n3)
+void MeshFacet::SetNeighbours(FacetIndex n1,FacetIndex n2,FacetIndex n3)
 {
     _aulNeighbours[0] = n1;
     _aulNeighbours[1] = n2;
@@ -928,12 +928,12 @@ inline void MeshFacet::GetEdge (unsigned short usSide, MeshHelpEdge &rclEdge) co
     rclEdge._ulIndex[1] = _aulPoints[(usSide+1) % 3];
 }
 
-inline std::pair<unsigned long, unsigned long> MeshFacet::GetEdge (unsigned short usSide) const
+inline std::pair<PointIndex, PointIndex> MeshFacet::GetEdge (unsigned short usSide) const
 {
-    return std::pair<unsigned long, unsigned long>(_aulPoints[usSide], _aulPoints[(usSide+1)%3]);
+    return std::pair<PointIndex, PointIndex>(_aulPoints[usSide], _aulPoints[(usSide+1)%3]);
 }
 
-inline void MeshFacet::Transpose (unsigned long ulOrig, unsigned long ulNew)
+inline void MeshFacet::Transpose (PointIndex ulOrig, PointIndex ulNew)
 {
     if (_aulPoints[0] == ulOrig)
         _aulPoints[0] = ulNew;
@@ -943,14 +943,14 @@ inline void MeshFacet::Transpose (unsigned long ulOrig, unsigned long ulNew)
         _aulPoints[2] = ulNew;
 }
 
-inline void MeshFacet::Decrement (unsigned long ulIndex)
+inline void MeshFacet::Decrement (PointIndex ulIndex)
 {
     if (_aulPoints[0] > ulIndex) _aulPoints[0]--;
     if (_aulPoints[1] > ulIndex) _aulPoints[1]--;
     if (_aulPoints[2] > ulIndex) _aulPoints[2]--;
 }
 
-inline bool MeshFacet::HasPoint(unsigned long ulIndex) const
+inline bool MeshFacet::HasPoint(PointIndex ulIndex) const
 {
     if (_aulPoints[0] == ulIndex)
         return true;
@@ -961,7 +961,7 @@ inline bool MeshFacet::HasPoint(unsigned long ulIndex) const
     return false;
 }
 
-inline void MeshFacet::ReplaceNeighbour (unsigned long ulOrig, unsigned long ulNew)
+inline void MeshFacet::ReplaceNeighbour (FacetIndex ulOrig, FacetIndex ulNew)
 {
     if (_aulNeighbours[0] == ulOrig)
         _aulNeighbours[0] = ulNew;
@@ -1011,7 +1011,7 @@ inline bool MeshFacet::IsDegenerated() const
     return false;
 }
 
-inline unsigned short MeshFacet::Side (unsigned long ulNIndex) const
+inline unsigned short MeshFacet::Side (FacetIndex ulNIndex) const
 {
     if (_aulNeighbours[0] == ulNIndex)
         return 0;
@@ -1023,7 +1023,7 @@ inline unsigned short MeshFacet::Side (unsigned long ulNIndex) const
         return USHRT_MAX;
 }
 
-inline unsigned short MeshFacet::Side (unsigned long ulP0, unsigned long ulP1) const
+inline unsigned short MeshFacet::Side (PointIndex ulP0, PointIndex ulP1) const
 {
     if (_aulPoints[0] == ulP0) {
         if (_aulPoints[1] == ulP1)
@@ -25,6 +25,8 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <array>
+# include <atomic>
 # include <vector>
 #endif
 
@@ -40,6 +42,7 @@
 #include "Grid.h"
 #include "TopoAlgorithm.h"
 #include "Functional.h"
+#include <boost/math/special_functions/fpclassify.hpp>
 #include <Base/Matrix.h>
 
 #include <Base/Sequencer.h>
@@ -52,7 +55,7 @@ MeshOrientationVisitor::MeshOrientationVisitor() : _nonuniformOrientation(false)
 }
 
 bool MeshOrientationVisitor::Visit (const MeshFacet &rclFacet, const MeshFacet &rclFrom,
-                                    unsigned long ulFInd, unsigned long ulLevel)
+                                    FacetIndex ulFInd, unsigned long ulLevel)
 {
     (void)ulFInd;
     (void)ulLevel;
@@ -69,13 +72,13 @@ bool MeshOrientationVisitor::HasNonUnifomOrientedFacets() const
     return _nonuniformOrientation;
 }
 
-MeshOrientationCollector::MeshOrientationCollector(std::vector<unsigned long>& aulIndices, std::vector<unsigned long>& aulComplement)
+MeshOrientationCollector::MeshOrientationCollector(std::vector<FacetIndex>& aulIndices, std::vector<FacetIndex>& aulComplement)
  : _aulIndices(aulIndices), _aulComplement(aulComplement)
 {
 }
 
 bool MeshOrientationCollector::Visit (const MeshFacet &rclFacet, const MeshFacet &rclFrom,
-                                      unsigned long ulFInd, unsigned long ulLevel)
+                                      FacetIndex ulFInd, unsigned long ulLevel)
 {
     (void)ulLevel;
     // different orientation of rclFacet and rclFrom
@@ -104,13 +107,13 @@ bool MeshOrientationCollector::Visit (const MeshFacet &rclFacet, const MeshFacet
     return true;
 }
 
-MeshSameOrientationCollector::MeshSameOrientationCollector(std::vector<unsigned long>& aulIndices)
+MeshSameOrientationCollector::MeshSameOrientationCollector(std::vector<FacetIndex>& aulIndices)
   : _aulIndices(aulIndices)
 {
 }
 
 bool MeshSameOrientationCollector::Visit (const MeshFacet &rclFacet, const MeshFacet &rclFrom, 
-                                          unsigned long ulFInd, unsigned long ulLevel)
+                                          FacetIndex ulFInd, unsigned long ulLevel)
 {
     // different orientation of rclFacet and rclFrom
     (void)ulLevel;
@@ -139,7 +142,7 @@ bool MeshEvalOrientation::Evaluate ()
     MeshFacetArray::_TConstIterator iEnd = rFAry.end();
     for (MeshFacetArray::_TConstIterator it = iBeg; it != iEnd; ++it) {
         for (int i = 0; i < 3; i++) {
-            if (it->_aulNeighbours[i] != ULONG_MAX) {
+            if (it->_aulNeighbours[i] != FACET_INDEX_MAX) {
                 const MeshFacet& rclFacet = iBeg[it->_aulNeighbours[i]];
                 for (int j = 0; j < 3; j++) {
                     if (it->_aulPoints[i] == rclFacet._aulPoints[j]) {
@@ -156,7 +159,7 @@ bool MeshEvalOrientation::Evaluate ()
     return true;
 }
 
-unsigned long MeshEvalOrientation::HasFalsePositives(const std::vector<unsigned long>& inds) const
+unsigned long MeshEvalOrientation::HasFalsePositives(const std::vector<FacetIndex>& inds) const
 {
     // All faces with wrong orientation (i.e. adjacent faces with a normal flip and their neighbours)
     // build a segment and are marked as TMP0. Now we check all border faces of the segments with 
@@ -166,10 +169,10 @@ unsigned long MeshEvalOrientation::HasFalsePositives(const std::vector<unsigned
     // algorithm fail to detect the faces with wrong orientation.
     const MeshFacetArray& rFAry = _rclMesh.GetFacets();
     MeshFacetArray::_TConstIterator iBeg = rFAry.begin();
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         const MeshFacet& f = iBeg[*it];
         for (int i = 0; i < 3; i++) {
-            if (f._aulNeighbours[i] != ULONG_MAX) {
+            if (f._aulNeighbours[i] != FACET_INDEX_MAX) {
                 const MeshFacet& n = iBeg[f._aulNeighbours[i]];
                 if (f.IsFlag(MeshFacet::TMP0) && !n.IsFlag(MeshFacet::TMP0)) {
                     for (int j = 0; j < 3; j++) {
@@ -183,15 +186,15 @@ unsigned long MeshEvalOrientation::HasFalsePositives(const std::vector<unsigned
         }
     }
 
-    return ULONG_MAX;
+    return FACET_INDEX_MAX;
 }
 
-std::vector<unsigned long> MeshEvalOrientation::GetIndices() const
+std::vector<FacetIndex> MeshEvalOrientation::GetIndices() const
 {
-    unsigned long ulStartFacet, ulVisited;
+    FacetIndex ulStartFacet, ulVisited;
 
     if (_rclMesh.CountFacets() == 0)
-        return std::vector<unsigned long>();
+        return std::vector<FacetIndex>();
 
     // reset VISIT flags
     MeshAlgorithm cAlg(_rclMesh);
@@ -205,10 +208,10 @@ std::vector<unsigned long> MeshEvalOrientation::GetIndices() const
 
     ulStartFacet = 0;
 
-    std::vector<unsigned long> uIndices, uComplement;
+    std::vector<FacetIndex> uIndices, uComplement;
     MeshOrientationCollector clHarmonizer(uIndices, uComplement);
 
-    while (ulStartFacet !=  ULONG_MAX) {
+    while (ulStartFacet !=  FACET_INDEX_MAX) {
         unsigned long wrongFacets = uIndices.size();
 
         uComplement.clear();
@@ -234,7 +237,7 @@ std::vector<unsigned long> MeshEvalOrientation::GetIndices() const
         if (iTri < iEnd)
             ulStartFacet = iTri - iBeg;
         else
-            ulStartFacet = ULONG_MAX;
+            ulStartFacet = FACET_INDEX_MAX;
     }
 
     // in some very rare cases where we have some strange artifacts in the mesh structure
@@ -242,23 +245,23 @@ std::vector<unsigned long> MeshEvalOrientation::GetIndices() const
     cAlg.ResetFacetFlag(MeshFacet::TMP0);
     cAlg.SetFacetsFlag(uIndices, MeshFacet::TMP0);
     ulStartFacet = HasFalsePositives(uIndices);
-    while (ulStartFacet != ULONG_MAX) {
+    while (ulStartFacet != FACET_INDEX_MAX) {
         cAlg.ResetFacetsFlag(uIndices, MeshFacet::VISIT);
-        std::vector<unsigned long> falsePos;
+        std::vector<FacetIndex> falsePos;
         MeshSameOrientationCollector coll(falsePos);
         _rclMesh.VisitNeighbourFacets(coll, ulStartFacet);
 
         std::sort(uIndices.begin(), uIndices.end());
         std::sort(falsePos.begin(), falsePos.end());
 
-        std::vector<unsigned long> diff;
-        std::back_insert_iterator<std::vector<unsigned long> > biit(diff);
+        std::vector<FacetIndex> diff;
+        std::back_insert_iterator<std::vector<FacetIndex> > biit(diff);
         std::set_difference(uIndices.begin(), uIndices.end(), falsePos.begin(), falsePos.end(), biit);
         uIndices = diff;
 
         cAlg.ResetFacetFlag(MeshFacet::TMP0);
         cAlg.SetFacetsFlag(uIndices, MeshFacet::TMP0);
-        unsigned long current = ulStartFacet;
+        FacetIndex current = ulStartFacet;
         ulStartFacet = HasFalsePositives(uIndices);
         if (current == ulStartFacet)
             break; // avoid an endless loop
@@ -312,7 +315,7 @@ namespace MeshCore {
 
 struct Edge_Index
 {
-    unsigned long p0, p1, f;
+    PointIndex p0, p1, f;
 };
 
 struct Edge_Less
@@ -360,12 +363,12 @@ bool MeshEvalTopology::Evaluate ()
     std::sort(edges.begin(), edges.end(), Edge_Less());
 
     // search for non-manifold edges
-    unsigned long p0 = ULONG_MAX, p1 = ULONG_MAX;
+    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
     nonManifoldList.clear();
     nonManifoldFacets.clear();
 
     int count = 0;
-    std::vector<unsigned long> facets;
+    std::vector<FacetIndex> facets;
     std::vector<Edge_Index>::iterator pE;
     for (pE = edges.begin(); pE != edges.end(); ++pE) {
         if (p0 == pE->p0 && p1 == pE->p1) {
@@ -391,7 +394,7 @@ bool MeshEvalTopology::Evaluate ()
 }
 
 // generate indexed edge list which tangents non-manifolds
-void MeshEvalTopology::GetFacetManifolds (std::vector<unsigned long> &raclFacetIndList) const
+void MeshEvalTopology::GetFacetManifolds (std::vector<FacetIndex> &raclFacetIndList) const
 {
     raclFacetIndList.clear();
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
@@ -399,9 +402,9 @@ void MeshEvalTopology::GetFacetManifolds (std::vector<unsigned long> &raclFacetI
 
     for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
         for (int i = 0; i < 3; i++) {
-            unsigned long ulPt0 = std::min<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
-            unsigned long ulPt1 = std::max<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
-            std::pair<unsigned long,unsigned long> edge  = std::make_pair(ulPt0, ulPt1);
+            PointIndex ulPt0 = std::min<PointIndex>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+            PointIndex ulPt1 = std::max<PointIndex>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+            std::pair<PointIndex,PointIndex> edge  = std::make_pair(ulPt0, ulPt1);
 
             if (std::find(nonManifoldList.begin(), nonManifoldList.end(), edge) != nonManifoldList.end())
                 raclFacetIndList.push_back(pI - rclFAry.begin());
@@ -430,11 +433,11 @@ bool MeshFixTopology::Fixup ()
 #else
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
     deletedFaces.reserve(3 * nonManifoldList.size()); // allocate some memory
-    std::list<std::vector<unsigned long> >::const_iterator it;
+    std::list<std::vector<FacetIndex> >::const_iterator it;
     for (it = nonManifoldList.begin(); it != nonManifoldList.end(); ++it) {
-        std::vector<unsigned long> non_mf;
+        std::vector<FacetIndex> non_mf;
         non_mf.reserve(it->size());
-        for (std::vector<unsigned long>::const_iterator jt = it->begin(); jt != it->end(); ++jt) {
+        for (std::vector<FacetIndex>::const_iterator jt = it->begin(); jt != it->end(); ++jt) {
             // facet is only connected with one edge and there causes a non-manifold
             unsigned short numOpenEdges = rFaces[*jt].CountOpenEdges();
             if (numOpenEdges == 2)
@@ -470,16 +473,16 @@ bool MeshEvalPointManifolds::Evaluate ()
     this->nonManifoldPoints.clear();
     this->facetsOfNonManifoldPoints.clear();
 
-    MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
-    MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
+    MeshCore::MeshCsrPointToPoints vv_it(_rclMesh);
+    MeshCore::MeshCsrPointToFacets vf_it(_rclMesh);
 
     unsigned long ctPoints = _rclMesh.CountPoints();
-    for (unsigned long index=0; index < ctPoints; index++) {
+    for (PointIndex index=0; index < ctPoints; index++) {
         // get the local neighbourhood of the point
-        const std::set<unsigned long>& nf = vf_it[index];
-        const std::set<unsigned long>& np = vv_it[index];
+        MeshIndexRange nf = vf_it[index];
+        MeshIndexRange np = vv_it[index];
 
-        std::set<unsigned long>::size_type sp, sf;
+        MeshIndexRange::size_type sp, sf;
         sp = np.size();
         sf = nf.size();
         // for an inner point the number of adjacent points is equal to the number of shared faces
@@ -487,7 +490,7 @@ bool MeshEvalPointManifolds::Evaluate ()
         // for a non-manifold point the number of adjacent points is higher by more than one than the number of shared faces
         if (sp > sf + 1) {
             nonManifoldPoints.push_back(index);
-            std::vector<unsigned long> faces;
+            std::vector<FacetIndex> faces;
             faces.insert(faces.end(), nf.begin(), nf.end());
             this->facetsOfNonManifoldPoints.push_back(faces);
         }
@@ -496,9 +499,9 @@ bool MeshEvalPointManifolds::Evaluate ()
     return this->nonManifoldPoints.empty();
 }
 
-void MeshEvalPointManifolds::GetFacetIndices (std::vector<unsigned long> &facets) const
+void MeshEvalPointManifolds::GetFacetIndices (std::vector<FacetIndex> &facets) const
 {
-    std::list<std::vector<unsigned long> >::const_iterator it;
+    std::list<std::vector<FacetIndex> >::const_iterator it;
     for (it = facetsOfNonManifoldPoints.begin(); it != facetsOfNonManifoldPoints.end(); ++it) {
         facets.insert(facets.end(), it->begin(), it->end());
     }
@@ -523,11 +526,11 @@ bool MeshEvalSingleFacet::Evaluate ()
   const std::vector<MeshFacet>& rclFAry = _rclMesh.GetFacets();
   std::vector<MeshFacet>::const_iterator pI;
 
-  std::vector<std::list<unsigned long> > aclMf = _aclManifoldList;
+  std::vector<std::list<FacetIndex> > aclMf = _aclManifoldList;
   _aclManifoldList.clear();
 
-  std::map<std::pair<unsigned long, unsigned long>, std::list<unsigned long> > aclHits;
-  std::map<std::pair<unsigned long, unsigned long>, std::list<unsigned long> >::iterator pEdge;
+  std::map<std::pair<PointIndex, PointIndex>, std::list<FacetIndex> > aclHits;
+  std::map<std::pair<PointIndex, PointIndex>, std::list<FacetIndex> >::iterator pEdge;
 
   // search for single links (a non-manifold edge and two open edges)
   //
@@ -537,26 +540,26 @@ bool MeshEvalSingleFacet::Evaluate ()
   {
     for (int i = 0; i < 3; i++)
     {
-      unsigned long ulPt0 = std::min<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
-      unsigned long ulPt1 = std::max<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
-      aclHits[std::pair<unsigned long, unsigned long>(ulPt0, ulPt1)].push_front(pI - rclFAry.begin());
+      PointIndex ulPt0 = std::min<PointIndex>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+      PointIndex ulPt1 = std::max<PointIndex>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+      aclHits[std::pair<PointIndex, PointIndex>(ulPt0, ulPt1)].push_front(pI - rclFAry.begin());
     }
   }
 
   // now search for single links
-  for (std::vector<std::list<unsigned long> >::const_iterator pMF = aclMf.begin(); pMF != aclMf.end(); ++pMF)
+  for (std::vector<std::list<PointIndex> >::const_iterator pMF = aclMf.begin(); pMF != aclMf.end(); ++pMF)
   {
-    std::list<unsigned long> aulManifolds;
-    for (std::list<unsigned long>::const_iterator pF = pMF->begin(); pF != pMF->end(); ++pF)
+    std::list<PointIndex> aulManifolds;
+    for (std::list<PointIndex>::const_iterator pF = pMF->begin(); pF != pMF->end(); ++pF)
     {
       const MeshFacet& rclF = rclFAry[*pF];
 
       unsigned long ulCtNeighbours=0;
       for (int i = 0; i < 3; i++)
       {
-        unsigned long ulPt0 = std::min<unsigned long>(rclF._aulPoints[i],  rclF._aulPoints[(i+1)%3]);
-        unsigned long ulPt1 = std::max<unsigned long>(rclF._aulPoints[i],  rclF._aulPoints[(i+1)%3]);
-        std::pair<unsigned long, unsigned long> clEdge(ulPt0, ulPt1); 
+        PointIndex ulPt0 = std::min<PointIndex>(rclF._aulPoints[i],  rclF._aulPoints[(i+1)%3]);
+        PointIndex ulPt1 = std::max<PointIndex>(rclF._aulPoints[i],  rclF._aulPoints[(i+1)%3]);
+        std::pair<PointIndex, PointIndex> clEdge(ulPt0, ulPt1); 
 
         // number of facets sharing this edge
         ulCtNeighbours += aclHits[clEdge].size();
@@ -576,11 +579,11 @@ bool MeshEvalSingleFacet::Evaluate ()
 
 bool MeshFixSingleFacet::Fixup ()
 {
-  std::vector<unsigned long> aulInvalids;
+  std::vector<FacetIndex> aulInvalids;
 //  MeshFacetArray& raFacets = _rclMesh._aclFacetArray;
-  for ( std::vector<std::list<unsigned long> >::const_iterator it=_raclManifoldList.begin();it!=_raclManifoldList.end();++it )
+  for ( std::vector<std::list<FacetIndex> >::const_iterator it=_raclManifoldList.begin();it!=_raclManifoldList.end();++it )
   {
-    for ( std::list<unsigned long>::const_iterator it2 = it->begin(); it2 != it->end(); ++it2 )
+    for ( std::list<FacetIndex>::const_iterator it2 = it->begin(); it2 != it->end(); ++it2 )
     {
       aulInvalids.push_back(*it2);
 //      MeshFacet& rF = raFacets[*it2];
@@ -593,79 +596,115 @@ bool MeshFixSingleFacet::Fixup ()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate ()
-{
-    // Contains bounding boxes for every facet 
-    std::vector<Base::BoundBox3f> boxes;
+namespace MeshCore {
 
+/*
+ * Searches the grid elements in parallel for pairs of intersecting facets. Facets that share
+ * a common vertex are not checked. If \a firstOnly is true the search stops after the first
+ * intersection.
+ */
+static void SearchSelfIntersections(const MeshKernel& rclMesh, bool firstOnly,
+                                    std::vector<std::pair<FacetIndex, FacetIndex> >& intersection)
+{
     // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
+    MeshFacetGrid cMeshFacetGrid(rclMesh);
+    const MeshFacetArray& rFaces = rclMesh.GetFacets();
     unsigned long ulGridX, ulGridY, ulGridZ;
     cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
+    std::size_t ulCtGrids = std::size_t(ulGridX) * ulGridY * ulGridZ;
+    int threads = std::max(1, QThread::idealThreadCount());
 
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX*ulGridY*ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        //Get the facet indices, belonging to the current grid unit
-        std::vector<unsigned long> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.size()==0)
-            continue;
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<unsigned long>::iterator it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<unsigned long>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) // the identical facet
-                    continue;
-                // If the facets share a common vertex we do not check for self-intersections because they 
-                // could but usually do not intersect each other and the algorithm below would detect false-positives,
-                // otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[0] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[0] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-                if (rface1._aulPoints[1] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[1] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[1] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-                if (rface1._aulPoints[2] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[2] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[2] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes(rFaces.size());
+    MeshCore::parallel_for(rFaces.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++)
+            boxes[i] = rclMesh.GetFacet(rFaces[i]).GetBoundBox();
+    });
+
+    // The grid elements are handled in blocks so that the progress can be shown and
+    // the search can be stopped. Each thread takes every n-th grid element of a block.
+    std::size_t ulBlock = 64 * static_cast<std::size_t>(threads);
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex> > > found(threads);
+    std::atomic<bool> stop(false);
+
+    Base::SequencerLauncher seq("Checking for self-intersections...", (ulCtGrids + ulBlock - 1) / ulBlock);
+    for (std::size_t ulStart = 0; ulStart < ulCtGrids && !stop; ulStart += ulBlock) {
+        std::size_t ulEnd = std::min(ulCtGrids, ulStart + ulBlock);
+        MeshCore::parallel_for<std::size_t>(threads, threads, [&](std::size_t first, std::size_t last) {
+            std::vector<FacetIndex> aulGridElements;
+            for (std::size_t t = first; t < last; t++) {
+                for (std::size_t id = ulStart + t; id < ulEnd && !stop; id += threads) {
+                    //Get the facet indices, belonging to the current grid unit
+                    unsigned long ulX, ulY, ulZ;
+                    cMeshFacetGrid.GetPositionToIndex(static_cast<unsigned long>(id), ulX, ulY, ulZ);
+                    aulGridElements.clear();
+                    cMeshFacetGrid.GetElements(ulX, ulY, ulZ, aulGridElements);
+
+                    MeshGeomFacet facet1, facet2;
+                    Base::Vector3f pt1, pt2;
+                    for (std::vector<FacetIndex>::iterator it = aulGridElements.begin(); it != aulGridElements.end() && !stop; ++it) {
+                        const Base::BoundBox3f& box1 = boxes[*it];
+                        const MeshFacet& rface1 = rFaces[*it];
+                        facet1 = rclMesh.GetFacet(rface1);
+                        for (std::vector<FacetIndex>::iterator jt = it + 1; jt != aulGridElements.end(); ++jt) {
+                            // If the facets share a common vertex we do not check for self-intersections because they 
+                            // could but usually do not intersect each other and the algorithm below would detect false-positives,
+                            // otherwise
+                            const MeshFacet& rface2 = rFaces[*jt];
+                            if (rface1._aulPoints[0] == rface2._aulPoints[0] || 
+                                rface1._aulPoints[0] == rface2._aulPoints[1] ||
+                                rface1._aulPoints[0] == rface2._aulPoints[2])
+                                continue; // ignore facets sharing a common vertex
+                            if (rface1._aulPoints[1] == rface2._aulPoints[0] || 
+                                rface1._aulPoints[1] == rface2._aulPoints[1] ||
+                                rface1._aulPoints[1] == rface2._aulPoints[2])
+                                continue; // ignore facets sharing a common vertex
+                            if (rface1._aulPoints[2] == rface2._aulPoints[0] || 
+                                rface1._aulPoints[2] == rface2._aulPoints[1] ||
+                                rface1._aulPoints[2] == rface2._aulPoints[2])
+                                continue; // ignore facets sharing a common vertex
+
+                            const Base::BoundBox3f& box2 = boxes[*jt];
+                            if (box1 && box2) {
+                                facet2 = rclMesh.GetFacet(rface2);
+                                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                                if (ret == 2) {
+                                    found[t].emplace_back(*it, *jt);
+                                    if (firstOnly) {
+                                        stop = true;
+                                        break;
+                                    }
+                                }
+                            }
+                        }
                     }
                 }
             }
-        }
+        });
+
+        seq.next(true);
     }
 
-    return true;
+    // a pair of facets can be found in several grid elements
+    std::vector<std::pair<FacetIndex, FacetIndex> > pairs;
+    for (std::vector<std::vector<std::pair<FacetIndex, FacetIndex> > >::iterator it = found.begin(); it != found.end(); ++it)
+        pairs.insert(pairs.end(), it->begin(), it->end());
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
-void MeshEvalSelfIntersection::GetIntersections(const std::vector<std::pair<unsigned long, unsigned long> >& indices,
+}
+
+bool MeshEvalSelfIntersection::Evaluate ()
+{
+    // abort after the first detected self-intersection
+    std::vector<std::pair<FacetIndex, FacetIndex> > intersection;
+    SearchSelfIntersections(_rclMesh, true, intersection);
+    return intersection.empty();
+}
+
+void MeshEvalSelfIntersection::GetIntersections(const std::vector<std::pair<FacetIndex, FacetIndex> >& indices,
                                                 std::vector<std::pair<Base::Vector3f, Base::Vector3f> >& intersection) const
 {
     intersection.reserve(indices.size());
@@ -673,7 +712,7 @@ void MeshEvalSelfIntersection::GetIntersections(const std::vector<std::pair<unsi
     MeshFacetIterator cMF2(_rclMesh);
 
     Base::Vector3f pt1, pt2;
-    std::vector<std::pair<unsigned long, unsigned long> >::const_iterator it;
+    std::vector<std::pair<FacetIndex, FacetIndex> >::const_iterator it;
     for (it = indices.begin(); it != indices.end(); ++it) {
         cMF1.Set(it->first);
         cMF2.Set(it->second);
@@ -689,81 +728,16 @@ void MeshEvalSelfIntersection::GetIntersections(const std::vector<std::pair<unsi
     }
 }
 
-void MeshEvalSelfIntersection::GetIntersections(std::vector<std::pair<unsigned long, unsigned long> >& intersection) const
+void MeshEvalSelfIntersection::GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex> >& intersection) const
 {
-    // Contains bounding boxes for every facet 
-    std::vector<Base::BoundBox3f> boxes;
-    //intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX, ulGridY, ulGridZ;
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for(cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX*ulGridY*ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        //Get the facet indices, belonging to the current grid unit
-        std::vector<unsigned long> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.size()==0)
-            continue;
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<unsigned long>::iterator it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<unsigned long>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) // the identical facet
-                    continue;
-                // If the facets share a common vertex we do not check for self-intersections because they 
-                // could but usually do not intersect each other and the algorithm below would detect false-positives,
-                // otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[0] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[0] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-                if (rface1._aulPoints[1] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[1] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[1] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-                if (rface1._aulPoints[2] == rface2._aulPoints[0] || 
-                    rface1._aulPoints[2] == rface2._aulPoints[1] ||
-                    rface1._aulPoints[2] == rface2._aulPoints[2])
-                    continue; // ignore facets sharing a common vertex
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back (*it,*jt);
-                    }
-                }
-            }
-        }
-    }
+    SearchSelfIntersections(_rclMesh, false, intersection);
 }
 
-std::vector<unsigned long> MeshFixSelfIntersection::GetFacets() const
+std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
 {
-    std::vector<unsigned long> indices;
+    std::vector<FacetIndex> indices;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    for (std::vector<std::pair<unsigned long, unsigned long> >::const_iterator
+    for (std::vector<std::pair<FacetIndex, FacetIndex> >::const_iterator
         it = selfIntersectons.begin(); it != selfIntersectons.end(); ++it) {
         unsigned short numOpenEdges1 = rFaces[it->first].CountOpenEdges();
         unsigned short numOpenEdges2 = rFaces[it->second].CountOpenEdges();
@@ -831,8 +805,8 @@ bool MeshEvalNeighbourhood::Evaluate ()
     // sort the edges
     std::sort(edges.begin(), edges.end(), Edge_Less());
 
-    unsigned long p0 = ULONG_MAX, p1 = ULONG_MAX;
-    unsigned long f0 = ULONG_MAX, f1 = ULONG_MAX;
+    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
+    FacetIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
     int count = 0;
     std::vector<Edge_Index>::iterator pE;
     for (pE = edges.begin(); pE != edges.end(); ++pE) {
@@ -858,7 +832,7 @@ bool MeshEvalNeighbourhood::Evaluate ()
                 const MeshFacet& rFace = rclFAry[f0];
                 unsigned short side = rFace.Side(p0,p1);
                 // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != ULONG_MAX)
+                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX)
                     return false;
             }
 
@@ -872,9 +846,9 @@ bool MeshEvalNeighbourhood::Evaluate ()
     return true;
 }
 
-std::vector<unsigned long> MeshEvalNeighbourhood::GetIndices() const
+std::vector<FacetIndex> MeshEvalNeighbourhood::GetIndices() const
 {
-    std::vector<unsigned long> inds;
+    std::vector<FacetIndex> inds;
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
     std::vector<Edge_Index> edges;
     edges.reserve(3*rclFAry.size());
@@ -897,8 +871,8 @@ std::vector<unsigned long> MeshEvalNeighbourhood::GetIndices() const
     // sort the edges
     std::sort(edges.begin(), edges.end(), Edge_Less());
 
-    unsigned long p0 = ULONG_MAX, p1 = ULONG_MAX;
-    unsigned long f0 = ULONG_MAX, f1 = ULONG_MAX;
+    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
+    FacetIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
     int count = 0;
     std::vector<Edge_Index>::iterator pE;
     for (pE = edges.begin(); pE != edges.end(); ++pE) {
@@ -926,7 +900,7 @@ std::vector<unsigned long> MeshEvalNeighbourhood::GetIndices() const
                 const MeshFacet& rFace = rclFAry[f0];
                 unsigned short side = rFace.Side(p0,p1);
                 // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != ULONG_MAX)
+                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX)
                     inds.push_back(f0);
             }
 
@@ -950,83 +924,407 @@ bool MeshFixNeighbourhood::Fixup()
     return true;
 }
 
-void MeshKernel::RebuildNeighbours (unsigned long index)
+void MeshKernel::RebuildNeighbours (FacetIndex index)
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
+    int threads = std::max(1, QThread::idealThreadCount());
+    std::size_t numFacets = this->_aclFacetArray.size() - index;
+    std::vector<Edge_Index> edges(3 * numFacets);
 
     // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    MeshFacetArray::_TConstIterator pB = this->_aclFacetArray.begin();
-    for (pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item;
-            item.p0 = std::min<unsigned long>(pI->_aulPoints[i], pI->_aulPoints[(i+1)%3]);
-            item.p1 = std::max<unsigned long>(pI->_aulPoints[i], pI->_aulPoints[(i+1)%3]);
-            item.f  = pI - pB;
-            edges.push_back(item);
+    const MeshFacetArray& rFacets = this->_aclFacetArray;
+    MeshCore::parallel_for(numFacets, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& rFace = rFacets[index + i];
+            for (int j = 0; j < 3; j++) {
+                Edge_Index& item = edges[3 * i + j];
+                item.p0 = std::min<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j+1)%3]);
+                item.p1 = std::max<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j+1)%3]);
+                item.f  = static_cast<FacetIndex>(index + i);
+            }
         }
-    }
+    });
 
     // sort the edges
-    //std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = std::max(1, QThread::idealThreadCount());
     MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
 
-    unsigned long p0 = ULONG_MAX, p1 = ULONG_MAX;
-    unsigned long f0 = ULONG_MAX, f1 = ULONG_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
+    // Each chunk handles the edges that start in its range. As an edge appears
+    // only once in the array each facet side is set by exactly one thread.
+    MeshFacetArray& rFaces = this->_aclFacetArray;
+    MeshCore::parallel_for(edges.size(), threads, [&](std::size_t begin, std::size_t end) {
+        // skip the rest of an edge that started in the previous chunk
+        while (begin > 0 && begin < end && edges[begin].p0 == edges[begin-1].p0 &&
+                                           edges[begin].p1 == edges[begin-1].p1)
+            begin++;
+
+        std::size_t pos = begin;
+        while (pos < end) {
+            const Edge_Index& edge = edges[pos];
+            std::size_t next = pos + 1;
+            while (next < edges.size() && edges[next].p0 == edge.p0 && edges[next].p1 == edge.p1)
+                next++;
+
             // we handle only the cases for 1 and 2, for all higher
             // values we have a non-manifold that is ignored here
+            std::size_t count = next - pos;
             if (count == 2) {
-                MeshFacet& rFace0 = this->_aclFacetArray[f0];
-                MeshFacet& rFace1 = this->_aclFacetArray[f1];
-                unsigned short side0 = rFace0.Side(p0,p1);
-                unsigned short side1 = rFace1.Side(p0,p1);
+                FacetIndex f0 = edge.f;
+                FacetIndex f1 = edges[pos+1].f;
+                MeshFacet& rFace0 = rFaces[f0];
+                MeshFacet& rFace1 = rFaces[f1];
+                unsigned short side0 = rFace0.Side(edge.p0, edge.p1);
+                unsigned short side1 = rFace1.Side(edge.p0, edge.p1);
                 rFace0._aulNeighbours[side0] = f1;
                 rFace1._aulNeighbours[side1] = f0;
             }
             else if (count == 1) {
-                MeshFacet& rFace = this->_aclFacetArray[f0];
-                unsigned short side = rFace.Side(p0,p1);
-                rFace._aulNeighbours[side] = ULONG_MAX;
+                MeshFacet& rFace = rFaces[edge.f];
+                unsigned short side = rFace.Side(edge.p0, edge.p1);
+                rFace._aulNeighbours[side] = FACET_INDEX_MAX;
             }
 
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
+            pos = next;
         }
+    });
+}
+
+void MeshKernel::RebuildNeighbours (void)
+{
+    // complete rebuild
+    RebuildNeighbours(0);
+}
+
+// ----------------------------------------------------------------
+
+bool MeshDefectReport::IsValid() const
+{
+    return invalidPoints.empty() &&
+           duplicatedPoints.empty() &&
+           pointsOutOfRange.empty() &&
+           facetsOutOfRange.empty() &&
+           corruptedFacets.empty() &&
+           degeneratedFacets.empty() &&
+           duplicatedFacets.empty() &&
+           foldsOnSurface.empty() &&
+           nonManifolds.empty() &&
+           invalidNeighbourhood.empty() &&
+           nonUniformOrientedFacets.empty() &&
+           selfIntersections.empty();
+}
+
+void MeshDefectReport::Append(const MeshDefectReport& rclReport)
+{
+    invalidPoints.insert(invalidPoints.end(), rclReport.invalidPoints.begin(), rclReport.invalidPoints.end());
+    duplicatedPoints.insert(duplicatedPoints.end(), rclReport.duplicatedPoints.begin(), rclReport.duplicatedPoints.end());
+    pointsOutOfRange.insert(pointsOutOfRange.end(), rclReport.pointsOutOfRange.begin(), rclReport.pointsOutOfRange.end());
+    facetsOutOfRange.insert(facetsOutOfRange.end(), rclReport.facetsOutOfRange.begin(), rclReport.facetsOutOfRange.end());
+    corruptedFacets.insert(corruptedFacets.end(), rclReport.corruptedFacets.begin(), rclReport.corruptedFacets.end());
+    degeneratedFacets.insert(degeneratedFacets.end(), rclReport.degeneratedFacets.begin(), rclReport.degeneratedFacets.end());
+    duplicatedFacets.insert(duplicatedFacets.end(), rclReport.duplicatedFacets.begin(), rclReport.duplicatedFacets.end());
+    foldsOnSurface.insert(foldsOnSurface.end(), rclReport.foldsOnSurface.begin(), rclReport.foldsOnSurface.end());
+    nonManifolds.insert(nonManifolds.end(), rclReport.nonManifolds.begin(), rclReport.nonManifolds.end());
+    invalidNeighbourhood.insert(invalidNeighbourhood.end(), rclReport.invalidNeighbourhood.begin(), rclReport.invalidNeighbourhood.end());
+    nonUniformOrientedFacets.insert(nonUniformOrientedFacets.end(), rclReport.nonUniformOrientedFacets.begin(), rclReport.nonUniformOrientedFacets.end());
+    selfIntersections.insert(selfIntersections.end(), rclReport.selfIntersections.begin(), rclReport.selfIntersections.end());
+}
+
+namespace MeshCore {
+
+/*
+ * Splits the range [0, count) into one part per thread and calls func(begin, end, report)
+ * for each part in parallel. The partial reports are appended to \a report in the order of
+ * the parts.
+ */
+template <class Func>
+static void parallel_report(std::size_t count, MeshDefectReport& report, Func func)
+{
+    std::size_t parts = std::max<std::size_t>(1, std::min<std::size_t>(
+        static_cast<std::size_t>(std::max(1, QThread::idealThreadCount())), count / 1024));
+    std::size_t size = (count + parts - 1) / parts;
+    std::vector<MeshDefectReport> reports(parts);
+    MeshCore::parallel_for(parts, static_cast<int>(parts), [&](std::size_t first, std::size_t last) {
+        for (std::size_t p = first; p < last; p++)
+            func(p * size, std::min(count, (p + 1) * size), reports[p]);
+    });
+
+    for (std::vector<MeshDefectReport>::iterator it = reports.begin(); it != reports.end(); ++it)
+        report.Append(*it);
+}
+
+template <class T>
+static void sort_unique(std::vector<T>& indices)
+{
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+}
+
+MeshEvalDefects::MeshEvalDefects (const MeshKernel &rclB, float fEps)
+  : MeshEvaluation(rclB), fEpsilon(fEps)
+{
+}
+
+bool MeshEvalDefects::Evaluate ()
+{
+    report = MeshDefectReport();
+
+    Base::SequencerLauncher seq("Analyzing mesh...", 5);
+
+    // checks the indices and all properties of a single facet
+    EvaluateFacets();
+    seq.next(true);
+
+    // the remaining checks would access points out of range
+    if (!report.pointsOutOfRange.empty())
+        return false;
+
+    EvaluatePoints();
+    seq.next(true);
+    EvaluateEdges();
+    seq.next(true);
+    EvaluateDuplicatedFacets();
+    seq.next(true);
+
+    // the region growing is only needed if adjacent facets with different orientation
+    // were found
+    if (!report.nonUniformOrientedFacets.empty()) {
+        MeshEvalOrientation eval(_rclMesh);
+        report.nonUniformOrientedFacets = eval.GetIndices();
+        sort_unique(report.nonUniformOrientedFacets);
     }
+    seq.next(true);
 
-    // we handle only the cases for 1 and 2, for all higher
-    // values we have a non-manifold that is ignored here
-    if (count == 2) {
-        MeshFacet& rFace0 = this->_aclFacetArray[f0];
-        MeshFacet& rFace1 = this->_aclFacetArray[f1];
-        unsigned short side0 = rFace0.Side(p0,p1);
-        unsigned short side1 = rFace1.Side(p0,p1);
-        rFace0._aulNeighbours[side0] = f1;
-        rFace1._aulNeighbours[side1] = f0;
+    // NaN coordinates make the grid useless
+    if (report.invalidPoints.empty()) {
+        MeshEvalSelfIntersection eval(_rclMesh);
+        eval.GetIntersections(report.selfIntersections);
     }
-    else if (count == 1) {
-        MeshFacet& rFace = this->_aclFacetArray[f0];
-        unsigned short side = rFace.Side(p0,p1);
-        rFace._aulNeighbours[side] = ULONG_MAX;
+
+    return report.IsValid();
+}
+
+void MeshEvalDefects::EvaluateFacets()
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    std::size_t ulCtFacets = rFacets.size();
+    std::size_t ulCtPoints = _rclMesh.CountPoints();
+    float fEps = fEpsilon;
+    const MeshKernel& rclMesh = _rclMesh;
+
+    auto pointsInRange = [&](const MeshFacet& rFace) {
+        return rFace._aulPoints[0] < ulCtPoints &&
+               rFace._aulPoints[1] < ulCtPoints &&
+               rFace._aulPoints[2] < ulCtPoints;
+    };
+
+    parallel_report(ulCtFacets, report, [&](std::size_t begin, std::size_t end, MeshDefectReport& part) {
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& rFace = rFacets[index];
+            FacetIndex ulIndex = static_cast<FacetIndex>(index);
+
+            bool validPoints = pointsInRange(rFace);
+            if (!validPoints)
+                part.pointsOutOfRange.push_back(ulIndex);
+            if (rFace._aulPoints[0] == rFace._aulPoints[1] ||
+                rFace._aulPoints[1] == rFace._aulPoints[2] ||
+                rFace._aulPoints[2] == rFace._aulPoints[0])
+                part.corruptedFacets.push_back(ulIndex);
+
+            bool validNeighbours = true;
+            for (int i = 0; i < 3; i++) {
+                FacetIndex n = rFace._aulNeighbours[i];
+                if (n >= ulCtFacets && n < FACET_INDEX_MAX) {
+                    part.facetsOutOfRange.push_back(ulIndex);
+                    validNeighbours = false;
+                    break;
+                }
+            }
+
+            if (!validPoints)
+                continue;
+
+            MeshGeomFacet clFacet = rclMesh.GetFacet(rFace);
+            if (clFacet.IsDegenerated(fEps))
+                part.degeneratedFacets.push_back(ulIndex);
+
+            if (!validNeighbours)
+                continue;
+
+            // adjacent facets with wrong orientation, see MeshEvalOrientation
+            for (int i = 0; i < 3; i++) {
+                FacetIndex n = rFace._aulNeighbours[i];
+                if (n != FACET_INDEX_MAX) {
+                    const MeshFacet& rNeighbour = rFacets[n];
+                    for (int j = 0; j < 3; j++) {
+                        if (rFace._aulPoints[i] == rNeighbour._aulPoints[j]) {
+                            if ((rFace._aulPoints[(i+1)%3] == rNeighbour._aulPoints[(j+1)%3]) ||
+                                (rFace._aulPoints[(i+2)%3] == rNeighbour._aulPoints[(j+2)%3])) {
+                                part.nonUniformOrientedFacets.push_back(ulIndex);
+                            }
+                        }
+                    }
+                }
+            }
+
+            // folds on the surface, see MeshEvalFoldsOnSurface
+            Base::Vector3f v1 = clFacet.GetNormal();
+            for (int i = 0; i < 3; i++) {
+                FacetIndex n1 = rFace._aulNeighbours[i];
+                FacetIndex n2 = rFace._aulNeighbours[(i+1)%3];
+                if (n1 != FACET_INDEX_MAX && n2 != FACET_INDEX_MAX &&
+                    pointsInRange(rFacets[n1]) && pointsInRange(rFacets[n2])) {
+                    Base::Vector3f v2 = rclMesh.GetFacet(n1).GetNormal();
+                    Base::Vector3f v3 = rclMesh.GetFacet(n2).GetNormal();
+                    if (v2 * v3 > 0.0f) {
+                        if (v1 * v2 < -0.1f && v1 * v3 < -0.1f) {
+                            part.foldsOnSurface.push_back(n1);
+                            part.foldsOnSurface.push_back(n2);
+                            part.foldsOnSurface.push_back(ulIndex);
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    sort_unique(report.foldsOnSurface);
+    sort_unique(report.nonUniformOrientedFacets);
+}
+
+void MeshEvalDefects::EvaluatePoints()
+{
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    parallel_report(rPoints.size(), report, [&](std::size_t begin, std::size_t end, MeshDefectReport& part) {
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshPoint& rPoint = rPoints[index];
+            if (boost::math::isnan(rPoint.x) || boost::math::isnan(rPoint.y) || boost::math::isnan(rPoint.z))
+                part.invalidPoints.push_back(static_cast<PointIndex>(index));
+        }
+    });
+
+    // points with NaN coordinates cannot be sorted
+    if (!report.invalidPoints.empty())
+        return;
+
+    // sort the point indices by the coordinates, see MeshEvalDuplicatePoints
+    std::vector<PointIndex> indices(rPoints.size());
+    for (std::size_t i = 0; i < indices.size(); i++)
+        indices[i] = static_cast<PointIndex>(i);
+    MeshCore::parallel_sort(indices.begin(), indices.end(), [&rPoints](PointIndex a, PointIndex b) {
+        return rPoints[a] < rPoints[b];
+    }, QThread::idealThreadCount());
+
+    for (std::size_t i = 1; i < indices.size(); i++) {
+        const MeshPoint& p0 = rPoints[indices[i-1]];
+        const MeshPoint& p1 = rPoints[indices[i]];
+        if (!(p0 < p1) && !(p1 < p0))
+            report.duplicatedPoints.push_back(indices[i]);
     }
+
+    std::sort(report.duplicatedPoints.begin(), report.duplicatedPoints.end());
 }
 
-void MeshKernel::RebuildNeighbours (void)
+void MeshEvalDefects::EvaluateEdges()
 {
-    // complete rebuild
-    RebuildNeighbours(0);
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    int threads = std::max(1, QThread::idealThreadCount());
+
+    // build up an array of edges, see MeshEvalTopology and MeshEvalNeighbourhood
+    std::vector<Edge_Index> edges(3 * rFacets.size());
+    MeshCore::parallel_for(rFacets.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& rFace = rFacets[index];
+            for (int i = 0; i < 3; i++) {
+                Edge_Index& item = edges[3 * index + i];
+                item.p0 = std::min<PointIndex>(rFace._aulPoints[i], rFace._aulPoints[(i+1)%3]);
+                item.p1 = std::max<PointIndex>(rFace._aulPoints[i], rFace._aulPoints[(i+1)%3]);
+                item.f  = static_cast<FacetIndex>(index);
+            }
+        }
+    });
+
+    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+
+    // a part starts with the first edge that differs from its predecessor
+    std::size_t ulCtEdges = edges.size();
+    auto sameEdge = [&edges](std::size_t i, std::size_t j) {
+        return edges[i].p0 == edges[j].p0 && edges[i].p1 == edges[j].p1;
+    };
+    parallel_report(ulCtEdges, report, [&](std::size_t begin, std::size_t end, MeshDefectReport& part) {
+        while (begin > 0 && begin < end && sameEdge(begin - 1, begin))
+            begin++;
+        std::size_t pos = begin;
+        while (pos < end) {
+            std::size_t next = pos + 1;
+            while (next < ulCtEdges && sameEdge(pos, next))
+                next++;
+
+            const Edge_Index& edge = edges[pos];
+            std::size_t count = next - pos;
+            if (count > 2) {
+                // Edge that is shared by more than 2 facets
+                for (std::size_t i = pos; i < next; i++)
+                    part.nonManifolds.push_back(edges[i].f);
+            }
+            else if (count == 2) {
+                FacetIndex f0 = edge.f;
+                FacetIndex f1 = edges[pos + 1].f;
+                const MeshFacet& rFace0 = rFacets[f0];
+                const MeshFacet& rFace1 = rFacets[f1];
+                unsigned short side0 = rFace0.Side(edge.p0, edge.p1);
+                unsigned short side1 = rFace1.Side(edge.p0, edge.p1);
+                // Check whether rFace0 and rFace1 reference each other as neighbours
+                if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
+                    part.invalidNeighbourhood.push_back(f0);
+                    part.invalidNeighbourhood.push_back(f1);
+                }
+            }
+            else {
+                const MeshFacet& rFace = rFacets[edge.f];
+                unsigned short side = rFace.Side(edge.p0, edge.p1);
+                // should be "open edge" but isn't marked as such
+                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX)
+                    part.invalidNeighbourhood.push_back(edge.f);
+            }
+
+            pos = next;
+        }
+    });
+
+    sort_unique(report.nonManifolds);
+    sort_unique(report.invalidNeighbourhood);
+}
+
+void MeshEvalDefects::EvaluateDuplicatedFacets()
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+
+    // two facets are equal if they reference the same points, see MeshEvalDuplicateFacets
+    std::vector<std::array<PointIndex, 3> > keys(rFacets.size());
+    MeshCore::parallel_for(rFacets.size(), QThread::idealThreadCount(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& rFace = rFacets[index];
+            std::array<PointIndex, 3>& key = keys[index];
+            key[0] = rFace._aulPoints[0];
+            key[1] = rFace._aulPoints[1];
+            key[2] = rFace._aulPoints[2];
+            std::sort(key.begin(), key.end());
+        }
+    });
+
+    std::vector<FacetIndex> indices(rFacets.size());
+    for (std::size_t i = 0; i < indices.size(); i++)
+        indices[i] = static_cast<FacetIndex>(i);
+    MeshCore::parallel_sort(indices.begin(), indices.end(), [&keys](FacetIndex a, FacetIndex b) {
+        return keys[a] < keys[b];
+    }, QThread::idealThreadCount());
+
+    for (std::size_t i = 1; i < indices.size(); i++) {
+        if (keys[indices[i-1]] == keys[indices[i]])
+            report.duplicatedFacets.push_back(indices[i]);
+    }
+
+    std::sort(report.duplicatedFacets.begin(), report.duplicatedFacets.end());
 }
 
 // ----------------------------------------------------------------
@@ -25,6 +25,7 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <vector>
 #include <QtConcurrentRun>
 #include <QFuture>
 #include <QThread>
@@ -58,6 +59,36 @@ namespace MeshCore
         }
     }
 
+    /**
+     * Splits the range [0, count) into \a threads chunks of about the same size
+     * and calls \a func(begin, end) for each chunk. The last chunk is handled
+     * by the calling thread, the others by the global thread pool.
+     */
+    template <class Size, class Func>
+    static void parallel_for(Size count, int threads, Func func)
+    {
+        if (threads < 2 || count < static_cast<Size>(threads))
+        {
+            func(Size(0), count);
+        }
+        else
+        {
+            Size chunk = (count + threads - 1) / threads;
+            std::vector<QFuture<void> > futures;
+            Size begin = 0;
+            for (; count - begin > chunk; begin += chunk)
+            {
+                Size end = begin + chunk;
+                futures.push_back(QtConcurrent::run([&func, begin, end]() {
+                    func(begin, end);
+                }));
+            }
+            func(begin, count);
+            for (std::vector<QFuture<void> >::iterator it = futures.begin(); it != futures.end(); ++it)
+                it->waitForFinished();
+        }
+    }
+
 } // namespace MeshCore
 
 
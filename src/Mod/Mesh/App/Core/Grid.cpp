@@ -32,6 +32,7 @@
 
 #include "MeshKernel.h"
 #include "Algorithm.h"
+#include "Functional.h"
 #include "Tools.h"
 
 using namespace MeshCore;
@@ -62,7 +63,8 @@ void MeshGrid::Attach (const MeshKernel &rclM)
 
 void MeshGrid::Clear (void)
 {
-  _aulGrid.clear();
+  _aulElements.clear();
+  _aulOffsets.clear();
   _pclMesh = NULL;  
 }
 
@@ -93,8 +95,6 @@ void MeshGrid::InitGrid (void)
 {
   assert(_pclMesh != NULL);
 
-  unsigned long i, j;
-
   // Grid Laengen berechnen wenn nicht initialisiert
   //
   if ((_ulCtGridsX == 0) || (_ulCtGridsY == 0) || (_ulCtGridsZ == 0))
@@ -128,17 +128,65 @@ void MeshGrid::InitGrid (void)
   }
 
   // Daten-Struktur anlegen
-  _aulGrid.clear();
-  _aulGrid.resize(_ulCtGridsX);
-  for (i = 0; i < _ulCtGridsX; i++)
-  {
-    _aulGrid[i].resize(_ulCtGridsY);
-    for (j = 0; j < _ulCtGridsY; j++)
-      _aulGrid[i][j].resize(_ulCtGridsZ);
+  _aulElements.clear();
+  _aulOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+}
+
+void MeshGrid::FillGrids (std::size_t ulCtElements,
+                          const std::function<void(ElementIndex, std::vector<std::size_t>&)>& fillGrids)
+{
+  std::size_t ulCtGrids = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+
+  // Each chunk of elements collects the pairs of grid and element index and counts the
+  // elements per grid. Small meshes are handled in a single chunk.
+  std::size_t ulCtChunks = std::max<std::size_t>(1, std::min<std::size_t>(
+      static_cast<std::size_t>(std::max(1, QThread::idealThreadCount())), ulCtElements / 1024));
+  std::size_t ulChunkSize = (ulCtElements + ulCtChunks - 1) / ulCtChunks;
+  std::vector<std::vector<std::pair<std::size_t, ElementIndex> > > aclPairs(ulCtChunks);
+  std::vector<std::vector<std::size_t> > aulCounts(ulCtChunks);
+
+  MeshCore::parallel_for(ulCtChunks, static_cast<int>(ulCtChunks), [&](std::size_t first, std::size_t last) {
+    std::vector<std::size_t> aulGrids;
+    for (std::size_t c = first; c < last; c++) {
+      std::vector<std::size_t>& counts = aulCounts[c];
+      counts.resize(ulCtGrids, 0);
+      std::size_t end = std::min(ulCtElements, (c + 1) * ulChunkSize);
+      for (std::size_t i = c * ulChunkSize; i < end; i++) {
+        aulGrids.clear();
+        fillGrids(static_cast<ElementIndex>(i), aulGrids);
+        for (std::vector<std::size_t>::iterator it = aulGrids.begin(); it != aulGrids.end(); ++it) {
+          aclPairs[c].emplace_back(*it, static_cast<ElementIndex>(i));
+          counts[*it]++;
+        }
+      }
+    }
+  });
+
+  // Counting sort: the counts become the insert positions of each chunk. As the chunks are
+  // ordered by element index the elements of a grid end up in ascending order.
+  _aulOffsets.resize(ulCtGrids + 1);
+  std::size_t ulPos = 0;
+  for (std::size_t g = 0; g < ulCtGrids; g++) {
+    _aulOffsets[g] = ulPos;
+    for (std::size_t c = 0; c < ulCtChunks; c++) {
+      std::size_t ulCount = aulCounts[c][g];
+      aulCounts[c][g] = ulPos;
+      ulPos += ulCount;
+    }
   }
+  _aulOffsets[ulCtGrids] = ulPos;
+
+  _aulElements.resize(ulPos);
+  MeshCore::parallel_for(ulCtChunks, static_cast<int>(ulCtChunks), [&](std::size_t first, std::size_t last) {
+    for (std::size_t c = first; c < last; c++) {
+      std::vector<std::size_t>& pos = aulCounts[c];
+      for (std::vector<std::pair<std::size_t, ElementIndex> >::const_iterator it = aclPairs[c].begin(); it != aclPairs[c].end(); ++it)
+        _aulElements[pos[it->first]++] = it->second;
+    }
+  });
 }
 
-unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsigned long> &raulElements,
+unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<ElementIndex> &raulElements,
                                 bool bDelDoubles) const
 {
   unsigned long i, j, k, ulMinX, ulMinY, ulMinZ,  ulMaxX, ulMaxY, ulMaxZ;
@@ -155,7 +203,7 @@ unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsig
     {
       for (k = ulMinZ; k <= ulMaxZ; k++)
       {
-        raulElements.insert(raulElements.end(), _aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+        raulElements.insert(raulElements.end(), GridBegin(i, j, k), GridEnd(i, j, k));
       }
     }
   }  
@@ -170,7 +218,7 @@ unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsig
   return raulElements.size();
 }
 
-unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsigned long> &raulElements,
+unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<ElementIndex> &raulElements,
                                 const Base::Vector3f &rclOrg, float fMaxDist, bool bDelDoubles) const
 {
   unsigned long i, j, k, ulMinX, ulMinY, ulMinZ,  ulMaxX, ulMaxY, ulMaxZ;
@@ -190,7 +238,7 @@ unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsig
       for (k = ulMinZ; k <= ulMaxZ; k++)
       {
         if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2)
-          raulElements.insert(raulElements.end(), _aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+          raulElements.insert(raulElements.end(), GridBegin(i, j, k), GridEnd(i, j, k));
       }
     }
   }  
@@ -205,7 +253,7 @@ unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::vector<unsig
   return raulElements.size();
 }
 
-unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::set<unsigned long> &raulElements) const
+unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::set<ElementIndex> &raulElements) const
 {
   unsigned long i, j, k, ulMinX, ulMinY, ulMinZ,  ulMaxX, ulMaxY, ulMaxZ;
   
@@ -221,7 +269,7 @@ unsigned long MeshGrid::Inside (const Base::BoundBox3f &rclBB, std::set<unsigned
     {
       for (k = ulMinZ; k <= ulMaxZ; k++)
       {
-        raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+        raulElements.insert(GridBegin(i, j, k), GridEnd(i, j, k));
       }
     }
   }  
@@ -450,7 +498,7 @@ void MeshGrid::CalculateGridLength (int iCtGridPerAxis)
   }
 }
 
-void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<unsigned long> &raclInd) const
+void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<ElementIndex> &raclInd) const
 {
   raclInd.clear();
   Base::BoundBox3f  clBB = GetBoundBox();
@@ -479,7 +527,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsY; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsZ; j++)
-              raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+              raclInd.insert(GridBegin(nX, i, j), GridEnd(nX, i, j));
           }
           nX++;
         }
@@ -493,7 +541,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsY; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsZ; j++)
-              raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+              raclInd.insert(GridBegin(nX, i, j), GridEnd(nX, i, j));
           }
           nX++;
         }
@@ -507,7 +555,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsX; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsZ; j++)
-              raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+              raclInd.insert(GridBegin(i, nY, j), GridEnd(i, nY, j));
           }
           nY++;
         }
@@ -521,7 +569,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsX; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsZ; j++)
-              raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+              raclInd.insert(GridBegin(i, nY, j), GridEnd(i, nY, j));
           }
           nY--;
         }
@@ -535,7 +583,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsX; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsY; j++)
-              raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+              raclInd.insert(GridBegin(i, j, nZ), GridEnd(i, j, nZ));
           }
           nZ++;
         }
@@ -549,7 +597,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
           for (unsigned long i = 0; i < _ulCtGridsX; i++)
           {
             for (unsigned long j = 0; j < _ulCtGridsY; j++)
-              raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+              raclInd.insert(GridBegin(i, j, nZ), GridEnd(i, j, nZ));
           }
           nZ--;
         }
@@ -563,7 +611,7 @@ void MeshGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<uns
 }
 
 void MeshGrid::GetHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ, 
-                        unsigned long ulDistance, std::set<unsigned long> &raclInd) const
+                        unsigned long ulDistance, std::set<ElementIndex> &raclInd) const
 {
   int nX1 = std::max<int>(0, int(ulX) - int(ulDistance));
   int nY1 = std::max<int>(0, int(ulY) - int(ulDistance));
@@ -643,27 +691,35 @@ void MeshGrid::GetHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ,
 }
 
 unsigned long MeshGrid::GetElements (unsigned long ulX, unsigned long ulY, unsigned long ulZ,  
-                                     std::set<unsigned long> &raclInd) const
+                                     std::set<ElementIndex> &raclInd) const
 {
-  const std::set<unsigned long> &rclSet = _aulGrid[ulX][ulY][ulZ];
-  if (rclSet.size() > 0)
+  const ElementIndex* pBegin = GridBegin(ulX, ulY, ulZ);
+  const ElementIndex* pEnd = GridEnd(ulX, ulY, ulZ);
+  if (pBegin != pEnd)
   {
-    raclInd.insert(rclSet.begin(), rclSet.end());
-    return rclSet.size();
+    raclInd.insert(pBegin, pEnd);
+    return static_cast<unsigned long>(pEnd - pBegin);
   }
 
   return 0;
 }
 
-unsigned long MeshGrid::GetElements(const Base::Vector3f &rclPoint, std::vector<unsigned long>& aulFacets) const
+unsigned long MeshGrid::GetElements (unsigned long ulX, unsigned long ulY, unsigned long ulZ,
+                                     std::vector<ElementIndex> &raulElements) const
+{
+  const ElementIndex* pBegin = GridBegin(ulX, ulY, ulZ);
+  const ElementIndex* pEnd = GridEnd(ulX, ulY, ulZ);
+  raulElements.insert(raulElements.end(), pBegin, pEnd);
+  return static_cast<unsigned long>(pEnd - pBegin);
+}
+
+unsigned long MeshGrid::GetElements(const Base::Vector3f &rclPoint, std::vector<ElementIndex>& aulFacets) const
 {
   unsigned long ulX, ulY, ulZ;
   if (!CheckPosition(rclPoint, ulX, ulY, ulZ))
     return 0;
 
-  aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-  std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+  aulFacets.assign(GridBegin(ulX, ulY, ulZ), GridEnd(ulX, ulY, ulZ));
   return aulFacets.size();
 }
 
@@ -748,9 +804,9 @@ bool MeshFacetGrid::Verify() const
   MeshFacetIterator cF(*_pclMesh);
   for ( it.Init(); it.More(); it.Next() )
   {
-    std::vector<unsigned long> aulElements;
+    std::vector<FacetIndex> aulElements;
     it.GetElements( aulElements );
-    for ( std::vector<unsigned long>::iterator itF = aulElements.begin(); itF != aulElements.end(); ++itF )
+    for ( std::vector<FacetIndex>::iterator itF = aulElements.begin(); itF != aulElements.end(); ++itF )
     {
       cF.Set( *itF );
       if ( cF->IntersectBoundingBox( it.GetBoundBox() ) == false )
@@ -768,20 +824,14 @@ void MeshFacetGrid::RebuildGrid (void)
   InitGrid();
  
   // Daten-Struktur fuellen
-  MeshFacetIterator clFIter(*_pclMesh);
-
-  unsigned long i = 0;
-  for (clFIter.Init(); clFIter.More(); clFIter.Next())
-  {
-//    AddFacet(*clFIter, i++, 2.0f);
-    AddFacet(*clFIter, i++);
-  }
-
+  FillGrids(_ulCtElements, [this](ElementIndex ulIndex, std::vector<std::size_t>& raulGrids) {
+    FacetGrids(_pclMesh->GetFacet(ulIndex), raulGrids);
+  });
 }
 
-unsigned long MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt) const
+FacetIndex MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt) const
 {
-  unsigned long ulFacetInd = ULONG_MAX;
+  FacetIndex ulFacetInd = FACET_INDEX_MAX;
   float fMinDist    = FLOAT_MAX;
   Base::BoundBox3f  clBB = GetBoundBox();
 
@@ -895,10 +945,10 @@ unsigned long MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt
   return ulFacetInd;
 }
 
-unsigned long MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, float fMaxSearchArea) const
+FacetIndex MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt, float fMaxSearchArea) const
 {
-  std::vector<unsigned long> aulFacets;
-  unsigned long ulFacetInd = ULONG_MAX;
+  std::vector<FacetIndex> aulFacets;
+  FacetIndex ulFacetInd = FACET_INDEX_MAX;
   float fMinDist   = fMaxSearchArea;
 
   MeshAlgorithm clFTool(*_pclMesh);
@@ -908,7 +958,7 @@ unsigned long MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt
 
   Inside(clBB, aulFacets, rclPt, fMaxSearchArea, true);
 
-  for (std::vector<unsigned long>::const_iterator pI = aulFacets.begin(); pI != aulFacets.end(); ++pI)
+  for (std::vector<FacetIndex>::const_iterator pI = aulFacets.begin(); pI != aulFacets.end(); ++pI)
   {    
     float fDist;
 
@@ -922,9 +972,32 @@ unsigned long MeshFacetGrid::SearchNearestFromPoint (const Base::Vector3f &rclPt
   return ulFacetInd;
 }
 
+std::vector<FacetIndex> MeshFacetGrid::SearchNearestFromPoints (const std::vector<Base::Vector3f> &raclPts) const
+{
+  std::vector<FacetIndex> aulFacets(raclPts.size());
+  MeshCore::parallel_for(raclPts.size(), QThread::idealThreadCount(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+      aulFacets[i] = SearchNearestFromPoint(raclPts[i]);
+  });
+
+  return aulFacets;
+}
+
+std::vector<FacetIndex> MeshFacetGrid::SearchNearestFromPoints (const std::vector<Base::Vector3f> &raclPts,
+                                                                float fMaxSearchArea) const
+{
+  std::vector<FacetIndex> aulFacets(raclPts.size());
+  MeshCore::parallel_for(raclPts.size(), QThread::idealThreadCount(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+      aulFacets[i] = SearchNearestFromPoint(raclPts[i], fMaxSearchArea);
+  });
+
+  return aulFacets;
+}
+
 void MeshFacetGrid::SearchNearestFacetInHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ, 
                                               unsigned long ulDistance, const Base::Vector3f &rclPt,
-                                              unsigned long &rulFacetInd, float &rfMinDist) const
+                                              FacetIndex &rulFacetInd, float &rfMinDist) const
 {
   int nX1 = std::max<int>(0, int(ulX) - int(ulDistance));
   int nY1 = std::max<int>(0, int(ulY) - int(ulDistance));
@@ -1005,10 +1078,10 @@ void MeshFacetGrid::SearchNearestFacetInHull (unsigned long ulX, unsigned long u
 
 void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX, unsigned long ulY, unsigned long ulZ, 
                                              const Base::Vector3f &rclPt, float &rfMinDist,
-                                             unsigned long &rulFacetInd) const
+                                             FacetIndex &rulFacetInd) const
 {
-  const std::set<unsigned long> &rclSet = _aulGrid[ulX][ulY][ulZ];
-  for (std::set<unsigned long>::const_iterator pI = rclSet.begin(); pI != rclSet.end(); ++pI)
+  const FacetIndex* pEnd = GridEnd(ulX, ulY, ulZ);
+  for (const FacetIndex* pI = GridBegin(ulX, ulY, ulZ); pI != pEnd; ++pI)
   {
     float fDist = _pclMesh->GetFacet(*pI).DistanceToPoint(rclPt);
     if (fDist < rfMinDist)
@@ -1053,15 +1126,6 @@ MeshPointGrid::MeshPointGrid (const MeshKernel &rclM, float fGridLen)
           std::max<unsigned long>(static_cast<unsigned long>(clBBMesh.LengthZ() / fGridLen), 1));
 }
 
-void MeshPointGrid::AddPoint (const MeshPoint &rclPt, unsigned long ulPtIndex, float fEpsilon)
-{
-  (void)fEpsilon;
-  unsigned long ulX, ulY, ulZ;
-  Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
-  if ( (ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ) )
-    _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
-}
-
 void MeshPointGrid::Validate (const MeshKernel &rclMesh)
 {
   if (_pclMesh != &rclMesh)
@@ -1090,9 +1154,9 @@ bool MeshPointGrid::Verify() const
   MeshPointIterator cP(*_pclMesh);
   for ( it.Init(); it.More(); it.Next() )
   {
-    std::vector<unsigned long> aulElements;
+    std::vector<PointIndex> aulElements;
     it.GetElements( aulElements );
-    for ( std::vector<unsigned long>::iterator itP = aulElements.begin(); itP != aulElements.end(); ++itP )
+    for ( std::vector<PointIndex>::iterator itP = aulElements.begin(); itP != aulElements.end(); ++itP )
     {
       cP.Set( *itP );
       if ( it.GetBoundBox().IsInBox( *cP ) == false )
@@ -1110,14 +1174,13 @@ void MeshPointGrid::RebuildGrid (void)
   InitGrid();
  
   // Daten-Struktur fuellen
-
-  MeshPointIterator cPIter(*_pclMesh);
-
-  unsigned long i = 0;
-  for (cPIter.Init(); cPIter.More(); cPIter.Next())
-  {
-    AddPoint(*cPIter, i++);
-  }
+  const MeshPointArray& rclPoints = _pclMesh->GetPoints();
+  FillGrids(_ulCtElements, [this, &rclPoints](ElementIndex ulIndex, std::vector<std::size_t>& raulGrids) {
+    unsigned long ulX, ulY, ulZ;
+    Pos(rclPoints[ulIndex], ulX, ulY, ulZ);
+    if ( (ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ) )
+      raulGrids.push_back(GridIndex(ulX, ulY, ulZ));
+  });
 }
 
 void MeshPointGrid::Pos (const Base::Vector3f &rclPoint, unsigned long &rulX, unsigned long &rulY, unsigned long &rulZ) const
@@ -1127,7 +1190,7 @@ void MeshPointGrid::Pos (const Base::Vector3f &rclPoint, unsigned long &rulX, un
   rulZ = static_cast<unsigned long>((rclPoint.z - _fMinZ) / _fGridLenZ);
 }
 
-unsigned long MeshPointGrid::FindElements (const Base::Vector3f &rclPoint, std::set<unsigned long>& aulElements) const
+unsigned long MeshPointGrid::FindElements (const Base::Vector3f &rclPoint, std::set<PointIndex>& aulElements) const
 {
   unsigned long ulX, ulY, ulZ;
   Pos(rclPoint, ulX, ulY, ulZ);
@@ -1154,7 +1217,7 @@ MeshGridIterator::MeshGridIterator (const MeshGrid &rclG)
 }
 
 bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, float fMaxSearchArea,
-                                  std::vector<unsigned long> &raulElements)
+                                  std::vector<ElementIndex> &raulElements)
 {
   bool ret = InitOnRay (rclPt, rclDir, raulElements);
   _fMaxSearchArea = fMaxSearchArea;
@@ -1162,7 +1225,7 @@ bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vecto
 }
 
 bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir,
-                                  std::vector<unsigned long> &raulElements)
+                                  std::vector<ElementIndex> &raulElements)
 {
   // needed in NextOnRay() to avoid an infinite loop
   _cSearchPositions.clear();
@@ -1179,7 +1242,7 @@ bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vecto
   if ((_rclGrid.GetBoundBox().IsInBox(rclPt)) == true)
   {  // Voxel bestimmen, indem der Startpunkt liegt
     _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-    raulElements.insert(raulElements.end(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+    raulElements.insert(raulElements.end(), _rclGrid.GridBegin(_ulX, _ulY, _ulZ), _rclGrid.GridEnd(_ulX, _ulY, _ulZ));
     _bValidRay = true;
   }
   else
@@ -1192,7 +1255,7 @@ bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vecto
       else
         _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
 
-      raulElements.insert(raulElements.end(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+      raulElements.insert(raulElements.end(), _rclGrid.GridBegin(_ulX, _ulY, _ulZ), _rclGrid.GridEnd(_ulX, _ulY, _ulZ));
       _bValidRay = true;
     }
   }
@@ -1200,7 +1263,7 @@ bool MeshGridIterator::InitOnRay (const Base::Vector3f &rclPt, const Base::Vecto
   return _bValidRay;
 }
 
-bool MeshGridIterator::NextOnRay (std::vector<unsigned long> &raulElements)
+bool MeshGridIterator::NextOnRay (std::vector<ElementIndex> &raulElements)
 {
   if (_bValidRay == false)
     return false;  // nicht initialisiert oder Strahl ausgetreten
@@ -1243,7 +1306,7 @@ bool MeshGridIterator::NextOnRay (std::vector<unsigned long> &raulElements)
   if ((_bValidRay == true) && (_rclGrid.CheckPos(_ulX, _ulY, _ulZ) == true))
   {
     GridElement pos(_ulX, _ulY, _ulZ); _cSearchPositions.insert(pos);
-    raulElements.insert(raulElements.end(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()); 
+    raulElements.insert(raulElements.end(), _rclGrid.GridBegin(_ulX, _ulY, _ulZ), _rclGrid.GridEnd(_ulX, _ulY, _ulZ)); 
   }
   else
     _bValidRay = false;  // Strahl ausgetreten
@@ -24,6 +24,7 @@
 #ifndef MESH_GRID_H
 #define MESH_GRID_H
 
+#include <functional>
 #include <set>
 
 #include "MeshKernel.h"
@@ -51,6 +52,10 @@ class MeshGrid;
  *
  * Grids can be used within algorithms to avoid to iterate through all elements,
  * so grids can speed up algorithms dramatically.
+ *
+ * The element indices of all grid elements are kept in one flat array, ordered
+ * by grid element and in ascending order within a grid element. The array of
+ * offsets gives the start of each grid element in this array.
  */
 class MeshExport MeshGrid
 {
@@ -81,21 +86,23 @@ public:
   /** @name Search */
   //@{
   /** Searches for elements lying in the intersection area of the grid and the bounding box. */
-  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::vector<unsigned long> &raulElements, bool bDelDoubles = true) const;
+  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::vector<ElementIndex> &raulElements, bool bDelDoubles = true) const;
   /** Searches for elements lying in the intersection area of the grid and the bounding box. */
-  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::set<unsigned long> &raulElementss) const;
+  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::set<ElementIndex> &raulElementss) const;
   /** Searches for elements lying in the intersection area of the grid and the bounding box. */
-  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::vector<unsigned long> &raulElements,
+  virtual unsigned long Inside (const Base::BoundBox3f &rclBB, std::vector<ElementIndex> &raulElements,
                                 const Base::Vector3f &rclOrg, float fMaxDist, bool bDelDoubles = true) const;
   /** Searches for the nearest grids that contain elements from a point, the result are grid indices. */
-  void SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<unsigned long> &rclInd) const;
+  void SearchNearestFromPoint (const Base::Vector3f &rclPt, std::set<ElementIndex> &rclInd) const;
   //@}
 
   /** @name Getters */
   //@{
   /** Returns the indices of the elements in the given grid. */
-  unsigned long GetElements (unsigned long ulX, unsigned long ulY, unsigned long ulZ,  std::set<unsigned long> &raclInd) const;
-  unsigned long GetElements (const Base::Vector3f &rclPoint, std::vector<unsigned long>& aulFacets) const;
+  unsigned long GetElements (unsigned long ulX, unsigned long ulY, unsigned long ulZ,  std::set<ElementIndex> &raclInd) const;
+  /** Appends the indices of the elements in the given grid. */
+  unsigned long GetElements (unsigned long ulX, unsigned long ulY, unsigned long ulZ,  std::vector<ElementIndex> &raulElements) const;
+  unsigned long GetElements (const Base::Vector3f &rclPoint, std::vector<ElementIndex>& aulFacets) const;
   //@}
 
   /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -125,7 +132,7 @@ public:
   bool GetPositionToIndex(unsigned long id, unsigned long& ulX, unsigned long& ulY, unsigned long& ulZ) const;
   /** Returns the number of elements in a given grid. */
   unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
-  { return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size()); }
+  { return static_cast<unsigned long>(GridEnd(ulX, ulY, ulZ) - GridBegin(ulX, ulY, ulZ)); }
   /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes. */
   virtual void Validate (const MeshKernel &rclM) = 0;
   /** Verifies the grid structure and returns false if inconsistencies are found. */
@@ -140,7 +147,7 @@ public:
   /** Checks if this is a valid grid position. */
   inline bool CheckPos (unsigned long ulX, unsigned long ulY, unsigned long ulZ) const;
   /** Get the indices of all elements lying in the grids around a given grid with distance \a ulDistance. */
-  void GetHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ, unsigned long ulDistance, std::set<unsigned long> &raclInd) const;
+  void GetHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ, unsigned long ulDistance, std::set<ElementIndex> &raclInd) const;
 
 protected:
   /** Initializes the size of the internal structure. */
@@ -155,9 +162,24 @@ protected:
   virtual void RebuildGrid (void) = 0;
   /** Returns the number of stored elements. Must be implemented in sub-classes. */
   virtual unsigned long HasElements (void) const = 0;
+  /** Fills the grid with \a ulCtElements elements. \a fillGrids must append the index of each grid element
+   * (see GridIndex()) the given element belongs to. The elements are processed in parallel, so
+   * \a fillGrids must be thread-safe. */
+  void FillGrids (std::size_t ulCtElements,
+                  const std::function<void(ElementIndex, std::vector<std::size_t>&)>& fillGrids);
+  /** Returns the index of the grid element in the flat grid structure. */
+  std::size_t GridIndex (unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+  { return (std::size_t(ulZ) * _ulCtGridsY + ulY) * _ulCtGridsX + ulX; }
+  /** Returns the first element of the given grid. */
+  const ElementIndex* GridBegin (unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+  { return _aulElements.data() + _aulOffsets[GridIndex(ulX, ulY, ulZ)]; }
+  /** Returns the end of the elements of the given grid. */
+  const ElementIndex* GridEnd (unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+  { return _aulElements.data() + _aulOffsets[GridIndex(ulX, ulY, ulZ) + 1]; }
 
 protected:
-  std::vector<std::vector<std::vector<std::set<unsigned long> > > >  _aulGrid;   /**< Grid data structure. */
+  std::vector<ElementIndex> _aulElements; /**< Element indices of all grid elements. */
+  std::vector<std::size_t>  _aulOffsets;  /**< Start of each grid element in _aulElements. */
   const MeshKernel* _pclMesh;     /**< The mesh kernel. */
   unsigned long     _ulCtElements;/**< Number of grid elements for validation issues. */
   unsigned long     _ulCtGridsX;  /**< Number of grid elements in z. */
@@ -200,16 +222,21 @@ public:
   /** @name Search */
   //@{
   /** Searches for the nearest facet from a point. */
-  unsigned long SearchNearestFromPoint (const Base::Vector3f &rclPt) const;
+  FacetIndex SearchNearestFromPoint (const Base::Vector3f &rclPt) const;
   /** Searches for the nearest facet from a point with the maximum search area. */
-  unsigned long SearchNearestFromPoint (const Base::Vector3f &rclPt, float fMaxSearchArea) const;
+  FacetIndex SearchNearestFromPoint (const Base::Vector3f &rclPt, float fMaxSearchArea) const;
+  /** Searches for the nearest facet of each point. The points are processed in parallel. */
+  std::vector<FacetIndex> SearchNearestFromPoints (const std::vector<Base::Vector3f> &raclPts) const;
+  /** Searches for the nearest facet of each point with the maximum search area. The points are processed
+   * in parallel. If no facet is inside the search area FACET_INDEX_MAX is set. */
+  std::vector<FacetIndex> SearchNearestFromPoints (const std::vector<Base::Vector3f> &raclPts, float fMaxSearchArea) const;
   /** Searches for the nearest facet in a given grid element and returns the facet index and the actual distance. */
   void SearchNearestFacetInGrid(unsigned long ulX, unsigned long ulY, unsigned long ulZ, const Base::Vector3f &rclPt,
-                                float &rfMinDist, unsigned long &rulFacetInd) const;
+                                float &rfMinDist, FacetIndex &rulFacetInd) const;
   /** Does basically the same as the method above unless that grid neighbours up to the order of \a ulDistance
    * are introduced into the search. */
   void SearchNearestFacetInHull (unsigned long ulX, unsigned long ulY, unsigned long ulZ, unsigned long ulDistance, 
-                                 const Base::Vector3f &rclPt, unsigned long &rulFacetInd, float &rfMinDist) const;
+                                 const Base::Vector3f &rclPt, FacetIndex &rulFacetInd, float &rfMinDist) const;
   //@}
 
   /** Validates the grid structure and rebuilds it if needed. */
@@ -224,10 +251,8 @@ protected:
   inline void Pos (const Base::Vector3f &rclPoint, unsigned long &rulX, unsigned long &rulY, unsigned long &rulZ) const;
   /** Returns the grid numbers to the given point \a rclPoint. */
   inline void PosWithCheck (const Base::Vector3f &rclPoint, unsigned long &rulX, unsigned long &rulY, unsigned long &rulZ) const;
-  /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a ulFacetIndex 
-   * the corresponding index in the mesh kernel. The facet is added to each grid element that intersects 
-   * the facet. */
-  inline void AddFacet (const MeshGeomFacet &rclFacet, unsigned long ulFacetIndex, float fEpsilon = 0.0f);
+  /** Appends the index of each grid element that intersects the facet \a rclFacet to \a raulGrids. */
+  inline void FacetGrids (const MeshGeomFacet &rclFacet, std::vector<std::size_t> &raulGrids) const;
   /** Returns the number of stored elements. */
   unsigned long HasElements (void) const
   { return _pclMesh->CountFacets(); }
@@ -259,7 +284,7 @@ public:
   //@}
 
   /** Finds all points that lie in the same grid as the point \a rclPoint. */
-  unsigned long FindElements(const Base::Vector3f &rclPoint, std::set<unsigned long>& aulElements) const;
+  unsigned long FindElements(const Base::Vector3f &rclPoint, std::set<PointIndex>& aulElements) const;
   /** Validates the grid structure and rebuilds it if needed. */
   virtual void Validate (const MeshKernel &rclM);
   /** Validates the grid structure and rebuilds it if needed. */
@@ -268,9 +293,6 @@ public:
   virtual bool Verify() const;
 
 protected:
-  /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a ulPtIndex 
-   * the corresponding index in the mesh kernel. */
-  void AddPoint (const MeshPoint &rclPt, unsigned long ulPtIndex, float fEpsilon = 0.0f);
   /** Returns the grid numbers to the given point \a rclPoint. */
   void Pos(const Base::Vector3f &rclPoint, unsigned long &rulX, unsigned long &rulY, unsigned long &rulZ) const;
   /** Returns the number of stored elements. */
@@ -293,9 +315,9 @@ public:
   Base::BoundBox3f GetBoundBox (void) const
   { return _rclGrid.GetBoundBox(_ulX, _ulY, _ulZ); }
   /** Returns indices of the elements in the current grid. */
-  void GetElements (std::vector<unsigned long> &raulElements) const
+  void GetElements (std::vector<ElementIndex> &raulElements) const
   {
-    raulElements.insert(raulElements.end(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(), _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+    raulElements.insert(raulElements.end(), _rclGrid.GridBegin(_ulX, _ulY, _ulZ), _rclGrid.GridEnd(_ulX, _ulY, _ulZ));
   }
   /** Returns the number of elements in the current grid. */
   unsigned long GetCtElements() const
@@ -321,11 +343,11 @@ public:
   /** @name Tests with rays */
   //@{
   /** Searches for facets around the ray. */
-  bool InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, std::vector<unsigned long> &raulElements);
+  bool InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, std::vector<ElementIndex> &raulElements);
   /** Searches for facets around the ray. */
-  bool InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, float fMaxSearchArea, std::vector<unsigned long> &raulElements);
+  bool InitOnRay (const Base::Vector3f &rclPt, const Base::Vector3f &rclDir, float fMaxSearchArea, std::vector<ElementIndex> &raulElements);
   /** Searches for facets around the ray. */
-  bool NextOnRay (std::vector<unsigned long> &raulElements);
+  bool NextOnRay (std::vector<ElementIndex> &raulElements);
   //@}
   
   /** Returns the grid number of the current position. */
@@ -434,38 +456,8 @@ inline void MeshFacetGrid::PosWithCheck (const Base::Vector3f &rclPoint, unsigne
   assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet (const MeshGeomFacet &rclFacet, unsigned long ulFacetIndex, float /*fEpsilon*/)
+inline void MeshFacetGrid::FacetGrids (const MeshGeomFacet &rclFacet, std::vector<std::size_t> &raulGrids) const
 {
-#if 0
-  unsigned long  i, ulX, ulY, ulZ, ulX1, ulY1, ulZ1, ulX2, ulY2, ulZ2;
-  
-  ulX1 = ulY1 = ulZ1 = ULONG_MAX;
-  ulX2 = ulY2 = ulZ2 = 0;
-
-  for (i = 0; i < 3; i++)
-  {
-    Pos(rclFacet._aclPoints[i], ulX, ulY, ulZ);
-    _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
-    ulX1 = RSmin<unsigned long>(ulX1, ulX); ulY1 = RSmin<unsigned long>(ulY1, ulY); ulZ1 = RSmin<unsigned long>(ulZ1, ulZ);
-    ulX2 = RSmax<unsigned long>(ulX2, ulX); ulY2 = RSmax<unsigned long>(ulY2, ulY); ulZ2 = RSmax<unsigned long>(ulZ2, ulZ);
-  }
-  
-  // falls Facet ueber mehrere BB reicht
-  if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2))
-  {
-    for (ulX = ulX1; ulX <= ulX2; ulX++)
-    {
-      for (ulY = ulY1; ulY <= ulY2; ulY++)
-      {
-        for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++)
-        {
-          if (CMeshFacetFunc::BBoxContainFacet(GetBoundBox(ulX, ulY, ulZ), rclFacet) == true)
-            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
-        }
-      }
-    }
-  }
-#else
   unsigned long ulX, ulY, ulZ;
 
   unsigned long ulX1, ulY1, ulZ1, ulX2, ulY2, ulZ2;
@@ -476,22 +468,8 @@ inline void MeshFacetGrid::AddFacet (const MeshGeomFacet &rclFacet, unsigned lon
   clBB.Add(rclFacet._aclPoints[1]);
   clBB.Add(rclFacet._aclPoints[2]);
 
-  //float fDiagonalLength = clBB.CalcDiagonalLength();
-
-  //clBB.Enlarge(fEpsilon*fDiagonalLength);
-
   Pos(Base::Vector3f(clBB.MinX,clBB.MinY,clBB.MinZ), ulX1, ulY1, ulZ1);
   Pos(Base::Vector3f(clBB.MaxX,clBB.MaxY,clBB.MaxZ), ulX2, ulY2, ulZ2);
-  
-  /*
-  if (ulX1 > 0) ulX1--;
-  if (ulY1 > 0) ulY1--;
-  if (ulZ1 > 0) ulZ1--;
-  
-  if (ulX2 < (_ulCtGridsX-1)) ulX2++;
-  if (ulY2 < (_ulCtGridsY-1)) ulY2++;
-  if (ulZ2 < (_ulCtGridsZ-1)) ulZ2++;
-  */
 
   // falls Facet ueber mehrere BB reicht
   if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2))
@@ -503,15 +481,13 @@ inline void MeshFacetGrid::AddFacet (const MeshGeomFacet &rclFacet, unsigned lon
         for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++)
         {
           if ( rclFacet.IntersectBoundingBox( GetBoundBox(ulX, ulY, ulZ) ) )
-            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+            raulGrids.push_back(GridIndex(ulX, ulY, ulZ));
         }
       }
     }
   }
   else
-    _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
-
-#endif
+    raulGrids.push_back(GridIndex(ulX1, ulY1, ulZ1));
 }
 
 } // namespace MeshCore
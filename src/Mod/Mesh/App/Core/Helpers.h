@@ -36,12 +36,12 @@ namespace MeshCore {
  */
 struct MeshExport MeshHelpPoint
 {
-  inline void Set (unsigned long ulCorner, unsigned long ulFacet, const Base::Vector3f &rclPt);
+  inline void Set (unsigned long ulCorner, FacetIndex ulFacet, const Base::Vector3f &rclPt);
 
   inline bool operator < (const MeshHelpPoint &rclObj) const;
   inline bool operator == (const MeshHelpPoint &rclObj) const;
 
-  unsigned long Index (void) const
+  FacetIndex Index (void) const
   { return _ulInd >> 2; }
 
   unsigned long Corner (void) const
@@ -56,7 +56,7 @@ struct MeshExport MeshHelpPoint
  */
 struct MeshPointBuilder: public std::vector<MeshHelpPoint>
 {
-  inline void Add (unsigned long ulCorner, unsigned long ulFacet, const Base::Vector3f &rclPt);
+  inline void Add (unsigned long ulCorner, FacetIndex ulFacet, const Base::Vector3f &rclPt);
 };
 
 /**
@@ -67,11 +67,11 @@ struct MeshExport MeshHelpBuilderEdge
   unsigned long Side (void) const
   { return _ulFIndex & 3; }
 
-  unsigned long Index (void) const
+  FacetIndex Index (void) const
   { return _ulFIndex >> 2; }
 
-  inline void Set (unsigned long ulInd1, unsigned long ulInd2,
-                                         unsigned long ulSide, unsigned long ulFInd);
+  inline void Set (PointIndex ulInd1, PointIndex ulInd2,
+                                         unsigned long ulSide, FacetIndex ulFInd);
 
   inline bool operator < (const MeshHelpBuilderEdge &rclObj) const;
 
@@ -81,7 +81,7 @@ struct MeshExport MeshHelpBuilderEdge
   inline bool operator != (const MeshHelpBuilderEdge &rclObj) const;
 
   unsigned long  _ulFIndex;    // facet index
-  unsigned long  _aulInd[2];   // point index
+  PointIndex  _aulInd[2];   // point index
 };
 
 /**
@@ -90,12 +90,12 @@ struct MeshExport MeshHelpBuilderEdge
 struct MeshEdgeBuilder: public std::vector<MeshHelpBuilderEdge>
 {
   typedef std::vector<MeshHelpBuilderEdge>::iterator  _TIterator;
-  inline void Add (unsigned long ulInd1, unsigned long ulInd2, unsigned long ulSide, unsigned long ulFInd);
+  inline void Add (PointIndex ulInd1, PointIndex ulInd2, unsigned long ulSide, FacetIndex ulFInd);
 };
 
-inline void MeshHelpPoint::Set (unsigned long ulCorner, unsigned long ulFacet, const Base::Vector3f &rclPt)
+inline void MeshHelpPoint::Set (unsigned long ulCorner, FacetIndex ulFacet, const Base::Vector3f &rclPt)
 {
-  _ulInd = (ulFacet << 2) | ulCorner;
+  _ulInd = (static_cast<unsigned long>(ulFacet) << 2) | ulCorner;
   _clPt  = rclPt;
 }
 
@@ -148,15 +148,15 @@ inline bool MeshHelpPoint::operator == (const MeshHelpPoint &rclObj) const
 */
 }
 
-inline void MeshPointBuilder::Add (unsigned long ulCorner, unsigned long ulFacet, const Base::Vector3f &rclPt)
+inline void MeshPointBuilder::Add (unsigned long ulCorner, FacetIndex ulFacet, const Base::Vector3f &rclPt)
 {
   MeshHelpPoint  clObj;
   clObj.Set(ulCorner, ulFacet, rclPt);
   push_back(clObj);
 }
 
-inline void MeshHelpBuilderEdge::Set ( unsigned long ulInd1, unsigned long ulInd2,
-                                       unsigned long ulSide, unsigned long ulFInd)
+inline void MeshHelpBuilderEdge::Set ( PointIndex ulInd1, PointIndex ulInd2,
+                                       unsigned long ulSide, FacetIndex ulFInd)
 {
   if (ulInd1 < ulInd2)
   {
@@ -168,7 +168,7 @@ inline void MeshHelpBuilderEdge::Set ( unsigned long ulInd1, unsigned long ulInd
     _aulInd[0] = ulInd2;
     _aulInd[1] = ulInd1; 
   }
-  _ulFIndex = (ulFInd << 2) | ulSide;
+  _ulFIndex = (static_cast<unsigned long>(ulFInd) << 2) | ulSide;
 }
 
 inline bool MeshHelpBuilderEdge::operator < (const MeshHelpBuilderEdge &rclObj) const
@@ -190,8 +190,8 @@ inline bool MeshHelpBuilderEdge::operator != (const MeshHelpBuilderEdge &rclObj)
 }
 
 
-inline void MeshEdgeBuilder::Add (unsigned long ulInd1, unsigned long ulInd2, 
-                                  unsigned long ulSide, unsigned long ulFInd)
+inline void MeshEdgeBuilder::Add (PointIndex ulInd1, PointIndex ulInd2, 
+                                  unsigned long ulSide, FacetIndex ulFInd)
 {
   MeshHelpBuilderEdge  clObj;
   clObj.Set(ulInd1, ulInd2, ulSide, ulFInd);
@@ -100,8 +100,8 @@ std::ostream& MeshInfo::DetailedEdgeInfo (std::ostream& rclStream) const
     const MeshFacet& rFacet = *pFIter;
     for ( int j=0; j<3; j++ )
     {
-      unsigned long ulPt0 = std::min<unsigned long>(rFacet._aulPoints[j],  rFacet._aulPoints[(j+1)%3]);
-      unsigned long ulPt1 = std::max<unsigned long>(rFacet._aulPoints[j],  rFacet._aulPoints[(j+1)%3]);
+      PointIndex ulPt0 = std::min<unsigned long>(rFacet._aulPoints[j],  rFacet._aulPoints[(j+1)%3]);
+      PointIndex ulPt1 = std::max<unsigned long>(rFacet._aulPoints[j],  rFacet._aulPoints[(j+1)%3]);
       std::pair<unsigned long, unsigned long> cEdge(ulPt0, ulPt1);
       lEdges[ cEdge ]++;
     }
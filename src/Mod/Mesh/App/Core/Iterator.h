@@ -53,7 +53,7 @@ public:
   /// construction
   inline MeshFacetIterator (const MeshKernel &rclM);
   /// construction
-  inline MeshFacetIterator (const MeshKernel &rclM, unsigned long ulPos);
+  inline MeshFacetIterator (const MeshKernel &rclM, FacetIndex ulPos);
   /// construction
   inline MeshFacetIterator (const MeshFacetIterator &rclI);
   //@}
@@ -104,7 +104,7 @@ public:
   void End (void)
   { _clIter = _rclFAry.end(); }
   /// Returns the current position of the iterator in the array.
-  unsigned long Position (void) const
+  FacetIndex Position (void) const
   { return _clIter - _rclFAry.begin(); }
   /// Checks if the end is already reached.
   bool EndReached (void) const
@@ -119,7 +119,7 @@ public:
   void  Next (void)
   { operator++(); }
   /// Sets the iterator to a given position.
-  inline bool Set (unsigned long ulIndex);
+  inline bool Set (FacetIndex ulIndex);
   /// Returns the topologic facet.
   inline MeshFacet GetIndices (void) const
   { return *_clIter; }
@@ -176,7 +176,7 @@ public:
   /** @name Construction */
   //@{
   inline MeshPointIterator (const MeshKernel &rclM);
-  inline MeshPointIterator (const MeshKernel &rclM, unsigned long ulPos);
+  inline MeshPointIterator (const MeshKernel &rclM, PointIndex ulPos);
   inline MeshPointIterator (const MeshPointIterator &rclI);
   //@}
  
@@ -220,7 +220,7 @@ public:
   void End (void)
   { _clIter = _rclPAry.end(); }
   /// Returns the current position of the iterator in the array.
-  unsigned long Position (void) const
+  PointIndex Position (void) const
   { return _clIter - _rclPAry.begin(); }
   /// Checks if the end is already reached.
   bool EndReached (void) const
@@ -235,7 +235,7 @@ public:
   void  Next (void)
   { operator++(); }
   /// Sets the iterator to a given position.
-  inline bool Set (unsigned long ulIndex);
+  inline bool Set (PointIndex ulIndex);
   /// Checks if the iterator points to a valid element inside the array.
   inline bool IsValid (void) const
   { return (_clIter >= _rclPAry.begin()) && (_clIter < _rclPAry.end()); }
@@ -301,7 +301,7 @@ inline MeshFastFacetIterator::MeshFastFacetIterator (const MeshKernel &rclM)
 
 inline void MeshFastFacetIterator::Next (void)
 {
-  const unsigned long *paulPt = _clIter->_aulPoints;
+  const PointIndex *paulPt = _clIter->_aulPoints;
   Base::Vector3f *pfPt = _afPoints;
   *(pfPt++)      = _rclPAry[*(paulPt++)];
   *(pfPt++)      = _rclPAry[*(paulPt++)];
@@ -317,7 +317,7 @@ inline MeshFacetIterator::MeshFacetIterator (const MeshKernel &rclM)
 {
 }
 
-inline MeshFacetIterator::MeshFacetIterator (const MeshKernel &rclM, unsigned long ulPos)
+inline MeshFacetIterator::MeshFacetIterator (const MeshKernel &rclM, FacetIndex ulPos)
 : _rclMesh(rclM),
   _rclFAry(rclM._aclFacetArray),
   _rclPAry(rclM._aclPointArray),
@@ -347,7 +347,7 @@ inline void MeshFacetIterator::Transform( const Base::Matrix4D& rclTrf )
 inline const MeshGeomFacet& MeshFacetIterator::Dereference (void)
 {
   MeshFacet rclF             = *_clIter;
-  const unsigned long *paulPt        = &(_clIter->_aulPoints[0]);
+  const PointIndex *paulPt        = &(_clIter->_aulPoints[0]);
   Base::Vector3f  *pclPt = _clFacet._aclPoints;
   *(pclPt++)       = _rclPAry[*(paulPt++)];
   *(pclPt++)       = _rclPAry[*(paulPt++)];
@@ -364,7 +364,7 @@ inline const MeshGeomFacet& MeshFacetIterator::Dereference (void)
   return _clFacet;
 }
 
-inline bool MeshFacetIterator::Set (unsigned long ulIndex)
+inline bool MeshFacetIterator::Set (FacetIndex ulIndex)
 {
   if (ulIndex < _rclFAry.size())
   {
@@ -393,17 +393,17 @@ inline unsigned long MeshFacetIterator::GetProperty (void) const
 
 inline void MeshFacetIterator::GetNeighbours (MeshFacetIterator &rclN0, MeshFacetIterator &rclN1, MeshFacetIterator &rclN2) const
 {
-  if (_clIter->_aulNeighbours[0] != ULONG_MAX)
+  if (_clIter->_aulNeighbours[0] != FACET_INDEX_MAX)
     rclN0.Set(_clIter->_aulNeighbours[0]);
   else
     rclN0.End();
 
-  if (_clIter->_aulNeighbours[1] != ULONG_MAX)
+  if (_clIter->_aulNeighbours[1] != FACET_INDEX_MAX)
     rclN1.Set(_clIter->_aulNeighbours[1]);
   else
     rclN1.End();
 
-  if (_clIter->_aulNeighbours[2] != ULONG_MAX)
+  if (_clIter->_aulNeighbours[2] != FACET_INDEX_MAX)
     rclN2.Set(_clIter->_aulNeighbours[2]);
   else
     rclN2.End();
@@ -411,7 +411,7 @@ inline void MeshFacetIterator::GetNeighbours (MeshFacetIterator &rclN0, MeshFace
 
 inline void MeshFacetIterator::SetToNeighbour (unsigned short usN)
 { 
-  if (_clIter->_aulNeighbours[usN] != ULONG_MAX)
+  if (_clIter->_aulNeighbours[usN] != FACET_INDEX_MAX)
     _clIter = _rclFAry.begin() + _clIter->_aulNeighbours[usN];
   else
     End();
@@ -423,7 +423,7 @@ inline MeshPointIterator::MeshPointIterator (const MeshKernel &rclM)
   _clIter = _rclPAry.begin();
 }
 
-inline MeshPointIterator::MeshPointIterator (const MeshKernel &rclM, unsigned long ulPos)
+inline MeshPointIterator::MeshPointIterator (const MeshKernel &rclM, PointIndex ulPos)
 : _rclMesh(rclM), _rclPAry(_rclMesh._aclPointArray), _bApply(false)
 {
   _clIter = _rclPAry.begin() + ulPos;
@@ -450,7 +450,7 @@ inline const MeshPoint& MeshPointIterator::Dereference (void) const
   return _clPoint; 
 }
 
-inline bool MeshPointIterator::Set (unsigned long ulIndex)
+inline bool MeshPointIterator::Set (PointIndex ulIndex)
 {
   if (ulIndex < _rclPAry.size())
   {
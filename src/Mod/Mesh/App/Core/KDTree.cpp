@@ -26,9 +26,14 @@
 # pragma warning(disable : 4396)
 #endif
 #ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <limits>
+# include <mutex>
 #endif
 
 #include "KDTree.h"
+#include "Functional.h"
 #include <kdtree++/kdtree.hpp>
 
 using namespace MeshCore;
@@ -76,10 +81,162 @@ struct Point3d
 
 typedef KDTree::KDTree<3, Point3d> MyKDTree;
 
+namespace {
+/// The k nearest points found so far, sorted by squared distance
+struct NearestPoints
+{
+    PointIndex* indices;
+    float* distances;
+    std::size_t k;
+    std::size_t count;
+
+    float worst() const
+    {
+        return count < k ? std::numeric_limits<float>::max() : distances[count-1];
+    }
+    void insert(PointIndex index, float dist)
+    {
+        if (count == k && dist >= distances[count-1])
+            return;
+        std::size_t pos = count < k ? count++ : count - 1;
+        for (; pos > 0 && distances[pos-1] > dist; pos--) {
+            indices[pos] = indices[pos-1];
+            distances[pos] = distances[pos-1];
+        }
+        indices[pos] = index;
+        distances[pos] = dist;
+    }
+};
+
+/// The points within range
+struct RangePoints
+{
+    PointIndex* indices;
+    std::size_t maxCount;
+    std::size_t count;
+    float range2;
+
+    void insert(PointIndex index, float dist)
+    {
+        if (dist > range2)
+            return;
+        if (count < maxCount)
+            indices[count] = index;
+        count++;
+    }
+};
+}
+
+/**
+ * For the batched queries the points are also kept in a balanced kd-tree that is
+ * stored in one array: the median of the range [begin, end) is at its middle and
+ * splits it along the axis stored for this position.
+ */
 class MeshKDTree::Private
 {
 public:
     MyKDTree kd_tree;
+
+    struct FlatPoint
+    {
+        Base::Vector3f p;
+        PointIndex i;
+    };
+
+    static const std::size_t LeafSize = 8;
+    std::mutex mutex;
+    bool flatValid = false;
+    std::vector<FlatPoint> flat;
+    std::vector<unsigned char> axes;
+
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flatValid = false;
+        std::vector<FlatPoint>().swap(flat);
+        std::vector<unsigned char>().swap(axes);
+    }
+
+    void buildFlat()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (flatValid)
+            return;
+        flat.clear();
+        flat.reserve(kd_tree.size());
+        for (MyKDTree::const_iterator it = kd_tree.begin(); it != kd_tree.end(); ++it) {
+            FlatPoint fp = { it->p, static_cast<PointIndex>(it->i) };
+            flat.push_back(fp);
+        }
+        axes.assign(flat.size(), 0);
+        split(0, flat.size());
+        flatValid = true;
+    }
+
+    void split(std::size_t begin, std::size_t end)
+    {
+        if (end - begin <= LeafSize)
+            return;
+
+        Base::BoundBox3f box;
+        for (std::size_t i = begin; i < end; i++)
+            box.Add(flat[i].p);
+        float len[3] = { box.LengthX(), box.LengthY(), box.LengthZ() };
+        int axis = static_cast<int>(std::max_element(len, len + 3) - len);
+
+        std::size_t mid = begin + (end - begin) / 2;
+        std::nth_element(flat.begin() + begin, flat.begin() + mid, flat.begin() + end,
+                         [axis](const FlatPoint& a, const FlatPoint& b) {
+            return a.p[axis] < b.p[axis];
+        });
+        axes[mid] = static_cast<unsigned char>(axis);
+        split(begin, mid);
+        split(mid + 1, end);
+    }
+
+    void nearest(const Base::Vector3f& q, std::size_t begin, std::size_t end, NearestPoints& res) const
+    {
+        if (end - begin <= LeafSize) {
+            for (std::size_t i = begin; i < end; i++)
+                res.insert(flat[i].i, Base::DistanceP2(q, flat[i].p));
+            return;
+        }
+
+        std::size_t mid = begin + (end - begin) / 2;
+        const FlatPoint& median = flat[mid];
+        res.insert(median.i, Base::DistanceP2(q, median.p));
+
+        float diff = q[axes[mid]] - median.p[axes[mid]];
+        if (diff < 0.0f) {
+            nearest(q, begin, mid, res);
+            if (diff * diff < res.worst())
+                nearest(q, mid + 1, end, res);
+        }
+        else {
+            nearest(q, mid + 1, end, res);
+            if (diff * diff < res.worst())
+                nearest(q, begin, mid, res);
+        }
+    }
+
+    void inRange(const Base::Vector3f& q, std::size_t begin, std::size_t end, RangePoints& res) const
+    {
+        if (end - begin <= LeafSize) {
+            for (std::size_t i = begin; i < end; i++)
+                res.insert(flat[i].i, Base::DistanceP2(q, flat[i].p));
+            return;
+        }
+
+        std::size_t mid = begin + (end - begin) / 2;
+        const FlatPoint& median = flat[mid];
+        res.insert(median.i, Base::DistanceP2(q, median.p));
+
+        float diff = q[axes[mid]] - median.p[axes[mid]];
+        if (diff <= 0.0f || diff * diff <= res.range2)
+            inRange(q, begin, mid, res);
+        if (diff >= 0.0f || diff * diff <= res.range2)
+            inRange(q, mid + 1, end, res);
+    }
 };
 
 MeshKDTree::MeshKDTree() : d(new Private)
@@ -88,7 +245,7 @@ MeshKDTree::MeshKDTree() : d(new Private)
 
 MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points) : d(new Private)
 {
-    unsigned long index=0;
+    PointIndex index=0;
     for (std::vector<Base::Vector3f>::const_iterator it = points.begin(); it != points.end(); ++it) {
         d->kd_tree.insert(Point3d(*it, index++));
     }
@@ -96,7 +253,7 @@ MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points) : d(new Privat
 
 MeshKDTree::MeshKDTree(const MeshPointArray& points) : d(new Private)
 {
-    unsigned long index=0;
+    PointIndex index=0;
     for (MeshPointArray::_TConstIterator it = points.begin(); it != points.end(); ++it) {
         d->kd_tree.insert(Point3d(*it, index++));
     }
@@ -109,13 +266,15 @@ MeshKDTree::~MeshKDTree()
 
 void MeshKDTree::AddPoint(Base::Vector3f& point)
 {
-    unsigned long index=d->kd_tree.size();
+    d->invalidate();
+    PointIndex index=d->kd_tree.size();
     d->kd_tree.insert(Point3d(point, index));
 }
 
 void MeshKDTree::AddPoints(const std::vector<Base::Vector3f>& points)
 {
-    unsigned long index=d->kd_tree.size();
+    d->invalidate();
+    PointIndex index=d->kd_tree.size();
     for (std::vector<Base::Vector3f>::const_iterator it = points.begin(); it != points.end(); ++it) {
         d->kd_tree.insert(Point3d(*it, index++));
     }
@@ -123,7 +282,8 @@ void MeshKDTree::AddPoints(const std::vector<Base::Vector3f>& points)
 
 void MeshKDTree::AddPoints(const MeshPointArray& points)
 {
-    unsigned long index=d->kd_tree.size();
+    d->invalidate();
+    PointIndex index=d->kd_tree.size();
     for (MeshPointArray::_TConstIterator it = points.begin(); it != points.end(); ++it) {
         d->kd_tree.insert(Point3d(*it, index++));
     }
@@ -136,50 +296,52 @@ bool MeshKDTree::IsEmpty() const
 
 void MeshKDTree::Clear()
 {
+    d->invalidate();
     d->kd_tree.clear();
 }
 
 void MeshKDTree::Optimize()
 {
+    d->invalidate();
     d->kd_tree.optimize();
 }
 
-unsigned long MeshKDTree::FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float& dist) const
+PointIndex MeshKDTree::FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float& dist) const
 {
     std::pair<MyKDTree::const_iterator, MyKDTree::distance_type> it =
         d->kd_tree.find_nearest(Point3d(p,0));
     if (it.first == d->kd_tree.end())
-        return ULONG_MAX;
-    unsigned long index = it.first->i;
+        return POINT_INDEX_MAX;
+    PointIndex index = it.first->i;
     n = it.first->p;
     dist = it.second;
     return index;
 }
 
-unsigned long MeshKDTree::FindNearest(const Base::Vector3f& p, float max_dist,
+PointIndex MeshKDTree::FindNearest(const Base::Vector3f& p, float max_dist,
                                       Base::Vector3f& n, float& dist) const
 {
     std::pair<MyKDTree::const_iterator, MyKDTree::distance_type> it =
         d->kd_tree.find_nearest(Point3d(p,0), max_dist);
     if (it.first == d->kd_tree.end())
-        return ULONG_MAX;
-    unsigned long index = it.first->i;
+        return POINT_INDEX_MAX;
+    PointIndex index = it.first->i;
     n = it.first->p;
     dist = it.second;
     return index;
 }
 
-unsigned long MeshKDTree::FindExact(const Base::Vector3f& p) const
+PointIndex MeshKDTree::FindExact(const Base::Vector3f& p) const
 {
     MyKDTree::const_iterator it = 
         d->kd_tree.find_exact(Point3d(p,0));
     if (it == d->kd_tree.end())
-        return ULONG_MAX;
-    unsigned long index = it->i;
+        return POINT_INDEX_MAX;
+    PointIndex index = it->i;
     return index;
 }
 
-void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<unsigned long>& indices) const
+void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<PointIndex>& indices) const
 {
     std::vector<Point3d> v;
     d->kd_tree.find_within_range(Point3d(p,0), range, std::back_inserter(v));
@@ -187,3 +349,41 @@ void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<u
     for (std::vector<Point3d>::iterator it = v.begin(); it != v.end(); ++it)
         indices.push_back(it->i);
 }
+
+void MeshKDTree::FindNearest(const Base::Vector3f* queries, std::size_t count, std::size_t k,
+                             PointIndex* indices, float* distances) const
+{
+    if (k == 0)
+        return;
+
+    d->buildFlat();
+    int threads = std::max(1, QThread::idealThreadCount());
+    MeshCore::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            NearestPoints res = { indices + i * k, distances + i * k, k, 0 };
+            if (!d->flat.empty())
+                d->nearest(queries[i], 0, d->flat.size(), res);
+            for (std::size_t j = 0; j < res.count; j++)
+                res.distances[j] = std::sqrt(res.distances[j]);
+            for (std::size_t j = res.count; j < k; j++) {
+                res.indices[j] = POINT_INDEX_MAX;
+                res.distances[j] = -1.0f;
+            }
+        }
+    });
+}
+
+void MeshKDTree::FindInRange(const Base::Vector3f* queries, std::size_t count, float range,
+                             std::size_t maxCount, PointIndex* indices, std::size_t* counts) const
+{
+    d->buildFlat();
+    int threads = std::max(1, QThread::idealThreadCount());
+    MeshCore::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            RangePoints res = { indices + i * maxCount, maxCount, 0, range * range };
+            if (!d->flat.empty())
+                d->inRange(queries[i], 0, d->flat.size(), res);
+            counts[i] = res.count;
+        }
+    });
+}
@@ -45,11 +45,32 @@ public:
     void Clear();
     void Optimize();
 
-    unsigned long FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float&) const;
-    unsigned long FindNearest(const Base::Vector3f& p, float max_dist,
+    PointIndex FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float&) const;
+    PointIndex FindNearest(const Base::Vector3f& p, float max_dist,
                               Base::Vector3f& n, float&) const;
-    unsigned long FindExact(const Base::Vector3f& p) const;
-    void FindInRange(const Base::Vector3f&, float, std::vector<unsigned long>&) const;
+    PointIndex FindExact(const Base::Vector3f& p) const;
+    void FindInRange(const Base::Vector3f&, float, std::vector<PointIndex>&) const;
+
+    /** @name Batched search
+     * The queries are distributed over several threads and the results are written
+     * into arrays of the caller, so that no memory is allocated per query.
+     */
+    //@{
+    /** For each of the \a count queries finds the \a k nearest points. The indices and
+     * distances of query i are written sorted by distance to \a indices[i*k] and
+     * \a distances[i*k]. If there are less than \a k points the remaining entries are
+     * set to POINT_INDEX_MAX and -1.
+     */
+    void FindNearest(const Base::Vector3f* queries, std::size_t count, std::size_t k,
+                     PointIndex* indices, float* distances) const;
+    /** For each of the \a count queries finds the points within \a range. At most
+     * \a maxCount indices of query i are written to \a indices[i*maxCount] in no
+     * particular order. \a counts[i] is set to the number of points within range
+     * which may exceed \a maxCount.
+     */
+    void FindInRange(const Base::Vector3f* queries, std::size_t count, float range,
+                     std::size_t maxCount, PointIndex* indices, std::size_t* counts) const;
+    //@}
 
 private:
     class Private;
@@ -29,6 +29,7 @@
 #include "MeshIO.h"
 #include "Algorithm.h"
 #include "Builder.h"
+#include "Functional.h"
 
 #include <Base/Builder3D.h>
 #include <Base/Console.h>
@@ -38,6 +39,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Swap.h>
 #include <Base/Placement.h>
 #include <Base/Tools.h>
 #include <zipios++/gzipoutputstream.h>
@@ -46,9 +48,11 @@
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <atomic>
 #include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
+#include <QFile>
 
 
 using namespace MeshCore;
@@ -160,6 +164,24 @@ bool MeshInput::LoadAny(const char* FileName)
     if (!fi.isReadable())
         throw Base::FileException("No permission on the file",FileName);
 
+    // STL and PLY files can be huge, so read them from a memory map of the file.
+    // For binary files the loaders then access the data directly.
+    if (fi.hasExtension("stl") || fi.hasExtension("ply")) {
+        QFile file(QString::fromUtf8(fi.filePath().c_str()));
+        uchar* data = nullptr;
+        if (file.open(QIODevice::ReadOnly) && file.size() > 0)
+            data = file.map(0, file.size());
+        if (data) {
+            Base::MemoryIStreambuf buf(reinterpret_cast<const char*>(data),
+                                       static_cast<std::size_t>(file.size()));
+            std::istream mem(&buf);
+            if (fi.hasExtension("stl"))
+                return LoadSTL(mem);
+            else
+                return LoadPLY(mem);
+        }
+    }
+
     Base::ifstream str(fi, std::ios::in | std::ios::binary);
 
     if (fi.hasExtension("bms")) {
@@ -792,6 +814,149 @@ namespace MeshCore {
                 return x.first == y;
             }
         };
+
+        std::size_t sizeOf(Number number)
+        {
+            switch (number) {
+            case int8:
+            case uint8:
+                return 1;
+            case int16:
+            case uint16:
+                return 2;
+            case int32:
+            case uint32:
+            case float32:
+                return 4;
+            case float64:
+                return 8;
+            }
+            return 0;
+        }
+
+        template <typename T>
+        float readValue(const char* data, bool swap)
+        {
+            T v;
+            std::memcpy(&v, data, sizeof(T));
+            if (swap)
+                Base::SwapEndian<T>(v);
+            return static_cast<float>(v);
+        }
+
+        float readNumber(const char* data, Number number, bool swap)
+        {
+            switch (number) {
+            case int8:
+                return readValue<int8_t>(data, false);
+            case uint8:
+                return readValue<uint8_t>(data, false);
+            case int16:
+                return readValue<int16_t>(data, swap);
+            case uint16:
+                return readValue<uint16_t>(data, swap);
+            case int32:
+                return readValue<int32_t>(data, swap);
+            case uint32:
+                return readValue<uint32_t>(data, swap);
+            case float32:
+                return readValue<float>(data, swap);
+            case float64:
+                return readValue<double>(data, swap);
+            }
+            return 0.0f;
+        }
+
+        /*!
+         * Reads the vertices and faces of a binary PLY file from memory in
+         * parallel. Each face is expected to be a triangle of 32-bit indices
+         * without further properties. If a face is not a triangle false is
+         * returned.
+         */
+        class BinaryReader
+        {
+        public:
+            BinaryReader(const std::vector<std::pair<std::string, Number> >& props, bool swap)
+                : props(props), swap(swap), stride(0)
+            {
+                for (std::vector<std::pair<std::string, Number> >::const_iterator it =
+                    props.begin(); it != props.end(); ++it) {
+                    offsets[it->first] = stride;
+                    stride += sizeOf(it->second);
+                }
+            }
+            std::size_t size(std::size_t v_count, std::size_t f_count) const
+            {
+                return v_count * stride + f_count * (1 + 3 * sizeof(uint32_t));
+            }
+            bool read(const char* data, std::size_t v_count, std::size_t f_count,
+                      MeshPointArray& meshPoints, MeshFacetArray& meshFacets,
+                      std::vector<App::Color>* colors) const
+            {
+                std::size_t x = offsets.at("x"), y = offsets.at("y"), z = offsets.at("z");
+                Number tx = type("x"), ty = type("y"), tz = type("z");
+                int threads = std::max(1, QThread::idealThreadCount());
+
+                meshPoints.resize(v_count);
+                if (colors)
+                    colors->resize(v_count);
+                MeshCore::parallel_for(v_count, threads, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; i++) {
+                        const char* v = data + i * stride;
+                        meshPoints[i].Set(readNumber(v + x, tx, swap),
+                                          readNumber(v + y, ty, swap),
+                                          readNumber(v + z, tz, swap));
+                        if (colors) {
+                            float r = readNumber(v + offsets.at("red"), type("red"), swap) / 255.0f;
+                            float g = readNumber(v + offsets.at("green"), type("green"), swap) / 255.0f;
+                            float b = readNumber(v + offsets.at("blue"), type("blue"), swap) / 255.0f;
+                            (*colors)[i] = App::Color(r, g, b);
+                        }
+                    }
+                });
+
+                std::atomic<bool> triangles(true);
+                const char* faces = data + v_count * stride;
+                const std::size_t f_stride = 1 + 3 * sizeof(uint32_t);
+                meshFacets.resize(f_count);
+                MeshCore::parallel_for(f_count, threads, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end && triangles; i++) {
+                        const char* f = faces + i * f_stride;
+                        if (static_cast<unsigned char>(f[0]) != 3) {
+                            triangles = false;
+                            break;
+                        }
+                        uint32_t index[3];
+                        std::memcpy(index, f + 1, sizeof(index));
+                        if (swap) {
+                            for (int j = 0; j < 3; j++)
+                                Base::SwapEndian<uint32_t>(index[j]);
+                        }
+                        // out of range indices are removed by MeshCleanup
+                        meshFacets[i].SetVertices(index[0], index[1], index[2]);
+                    }
+                });
+
+                return triangles;
+            }
+
+        private:
+            Number type(const std::string& name) const
+            {
+                for (std::vector<std::pair<std::string, Number> >::const_iterator it =
+                    props.begin(); it != props.end(); ++it) {
+                    if (it->first == name)
+                        return it->second;
+                }
+                return float32;
+            }
+
+        private:
+            const std::vector<std::pair<std::string, Number> >& props;
+            std::map<std::string, std::size_t> offsets;
+            bool swap;
+            std::size_t stride;
+        };
     }
     using namespace Ply;
 }
@@ -1116,6 +1281,31 @@ bool MeshInput::LoadPLY (std::istream &inp)
     }
     // binary
     else {
+        // a memory mapped file is read in parallel
+        Base::MemoryIStreambuf* mem = dynamic_cast<Base::MemoryIStreambuf*>(buf);
+        Ply::BinaryReader reader(vertex_props, format == binary_big_endian);
+        if (mem && face_props.empty() && mem->available() >= reader.size(v_count, f_count)) {
+            std::vector<App::Color>* colors = nullptr;
+            if (_material && (rgb_value == MeshIO::PER_VERTEX))
+                colors = &_material->diffuseColor;
+            if (reader.read(mem->current(), v_count, f_count, meshPoints, meshFacets, colors)) {
+                this->_rclMesh.Clear(); // remove all data before
+
+                MeshCleanup meshCleanup(meshPoints,meshFacets);
+                if (_material)
+                    meshCleanup.SetMaterial(_material);
+                meshCleanup.RemoveInvalids();
+                this->_rclMesh.Adopt(meshPoints,meshFacets,true);
+                return true;
+            }
+
+            // not all faces are triangles, use the sequential reader
+            meshPoints.clear();
+            meshFacets.clear();
+            if (colors)
+                colors->clear();
+        }
+
         Base::InputStream is(inp);
         if (format == binary_little_endian)
             is.setByteOrder(Base::Stream::LittleEndian);
@@ -1419,6 +1609,29 @@ bool MeshInput::LoadBinarySTL (std::istream &rstrIn)
     if (ulCt > ulFac)
         return false;// not a valid STL file
 
+    // a memory mapped file is read in parallel
+    Base::MemoryIStreambuf* mem = dynamic_cast<Base::MemoryIStreambuf*>(buf);
+    if (mem) {
+        const char* data = mem->current();
+        MeshFastBuilder builder(this->_rclMesh);
+        builder.Resize(static_cast<MeshFastBuilder::size_type>(ulCt));
+
+        int threads = std::max(1, QThread::idealThreadCount());
+        MeshCore::parallel_for(ulCt, threads, [&builder, data](uint32_t begin, uint32_t end) {
+            Base::Vector3f clVects[4];
+            for (uint32_t i = begin; i < end; i++) {
+                // read normal, points and overread 2 bytes attribute
+                std::memcpy(&clVects, data + 50 * std::size_t(i), sizeof(clVects));
+                std::swap(clVects[0], clVects[3]);
+                builder.SetFacet(static_cast<MeshFastBuilder::size_type>(i), clVects);
+            }
+        });
+
+        builder.Finish();
+        mem->pubseekoff(50 * std::streamoff(ulCt), std::ios::cur, std::ios::in);
+        return true;
+    }
+
 #if 0
     MeshBuilder builder(this->_rclMesh);
 #else
@@ -2305,7 +2518,7 @@ bool MeshOutput::SaveOBJ (std::ostream &out) const
 
             for (std::vector<Group>::const_iterator gt = _groups.begin(); gt != _groups.end(); ++gt) {
                 out << "g " << Base::Tools::escapedUnicodeFromUtf8(gt->name.c_str()) << '\n';
-                for (std::vector<unsigned long>::const_iterator it = gt->indices.begin(); it != gt->indices.end(); ++it) {
+                for (std::vector<FacetIndex>::const_iterator it = gt->indices.begin(); it != gt->indices.end(); ++it) {
                     const MeshFacet& f = rFacets[*it];
                     if (first || prev != Kd[*it]) {
                         first = false;
@@ -2326,7 +2539,7 @@ bool MeshOutput::SaveOBJ (std::ostream &out) const
         else {
             for (std::vector<Group>::const_iterator gt = _groups.begin(); gt != _groups.end(); ++gt) {
                 out << "g " << Base::Tools::escapedUnicodeFromUtf8(gt->name.c_str()) << '\n';
-                for (std::vector<unsigned long>::const_iterator it = gt->indices.begin(); it != gt->indices.end(); ++it) {
+                for (std::vector<PointIndex>::const_iterator it = gt->indices.begin(); it != gt->indices.end(); ++it) {
                     const MeshFacet& f = rFacets[*it];
                     out << "f " << f._aulPoints[0]+1 << "//" << *it + 1 << " "
                                 << f._aulPoints[1]+1 << "//" << *it + 1 << " "
@@ -3553,12 +3766,12 @@ void MeshCleanup::RemoveInvalidPoints()
                     [flag](const MeshPoint& p) { return flag(p, MeshPoint::INVALID); });
     if (countInvalidPoints > 0) {
         // generate array of decrements
-        std::vector<unsigned long> decrements;
+        std::vector<PointIndex> decrements;
         decrements.resize(pointArray.size());
         unsigned long decr = 0;
 
         MeshPointArray::_TIterator p_end = pointArray.end();
-        std::vector<unsigned long>::iterator decr_it = decrements.begin();
+        std::vector<PointIndex>::iterator decr_it = decrements.begin();
         for (MeshPointArray::_TIterator p_it = pointArray.begin(); p_it != p_end; ++p_it, ++decr_it) {
             *decr_it = decr;
             if (!p_it->IsValid())
@@ -3655,7 +3868,7 @@ void MeshPointFacetAdjacency::SetFacetNeighbourhood()
             }
 
             if (!success) {
-                facet1._aulNeighbours[i] = ULONG_MAX;
+                facet1._aulNeighbours[i] = FACET_INDEX_MAX;
             }
         }
     }
@@ -90,9 +90,9 @@ public:
     unsigned long CountPoints (void) const
     { return static_cast<unsigned long>(_aclPointArray.size()); }
     /// Returns the number of required memory in bytes
-    unsigned int GetMemSize (void) const
-    { return static_cast<unsigned int>(_aclPointArray.size() * sizeof(MeshPoint) +
-                                       _aclFacetArray.size() * sizeof(MeshFacet)); }
+    std::size_t GetMemSize (void) const
+    { return _aclPointArray.size() * sizeof(MeshPoint) +
+             _aclFacetArray.size() * sizeof(MeshFacet); }
     /// Determines the bounding box
     const Base::BoundBox3f& GetBoundBox (void) const
     { return _clBoundBox; }
@@ -106,36 +106,36 @@ public:
      * called occasionally only. For fast access the MeshPointIterator interfsce should
      * be used.
      */
-    inline MeshPoint GetPoint (unsigned long ulIndex) const;
+    inline MeshPoint GetPoint (PointIndex ulIndex) const;
 
     /** Returns an array of the vertex normals of the mesh. A vertex normal gets calculated
      * by summarizing the normals of the associated facets.
      */
     std::vector<Base::Vector3f> CalcVertexNormals() const;
-    std::vector<Base::Vector3f> GetFacetNormals(const std::vector<unsigned long>&) const;
+    std::vector<Base::Vector3f> GetFacetNormals(const std::vector<FacetIndex>&) const;
 
     /** Returns the facet at the given index. This method is rather slow and should be
      * called occasionally only. For fast access the MeshFacetIterator interface should
      * be used.
      */
-    inline MeshGeomFacet GetFacet (unsigned long ulIndex) const;
+    inline MeshGeomFacet GetFacet (FacetIndex ulIndex) const;
     inline MeshGeomFacet GetFacet (const MeshFacet &rclFacet) const;
 
     /** Returns the point indices of the given facet index. */
-    inline void GetFacetPoints (unsigned long ulFaIndex, unsigned long &rclP0, 
-                                unsigned long &rclP1, unsigned long &rclP2) const;
+    inline void GetFacetPoints (FacetIndex ulFaIndex, PointIndex &rclP0, 
+                                PointIndex &rclP1, PointIndex &rclP2) const;
     /** Returns the point indices of the given facet indices. */
-    std::vector<unsigned long> GetFacetPoints(const std::vector<unsigned long>&) const;
+    std::vector<PointIndex> GetFacetPoints(const std::vector<FacetIndex>&) const;
     /** Returns the facet indices that share the given point indices. */
-    std::vector<unsigned long> GetPointFacets(const std::vector<unsigned long>&) const;
+    std::vector<FacetIndex> GetPointFacets(const std::vector<PointIndex>&) const;
     /** Returns the indices of the neighbour facets of the given facet index. */
-    inline void GetFacetNeighbours (unsigned long ulIndex, unsigned long &rulNIdx0, 
-                                    unsigned long &rulNIdx1, unsigned long &rulNIdx2) const;
+    inline void GetFacetNeighbours (FacetIndex ulIndex, FacetIndex &rulNIdx0, 
+                                    FacetIndex &rulNIdx1, FacetIndex &rulNIdx2) const;
 
     /** Determines all facets that are associated to this point. This method is very
      * slow and should be called occasionally only.
      */
-    std::vector<unsigned long> HasFacets (const MeshPointIterator &rclIter) const;
+    std::vector<FacetIndex> HasFacets (const MeshPointIterator &rclIter) const;
 
     /** Returns true if the data structure is valid. */
     bool IsValid (void) const
@@ -146,7 +146,7 @@ public:
     /** Returns an array of points to the given indices. The indices
      * must not be out of range.
      */
-    MeshPointArray GetPoints(const std::vector<unsigned long>&) const;
+    MeshPointArray GetPoints(const std::vector<PointIndex>&) const;
 
     /** Returns a modifier for the point array */
     MeshPointModifier ModifyPoints()
@@ -159,7 +159,7 @@ public:
     /** Returns an array of facets to the given indices. The indices
      * must not be out of range.
      */
-    MeshFacetArray GetFacets(const std::vector<unsigned long>&) const;
+    MeshFacetArray GetFacets(const std::vector<FacetIndex>&) const;
 
     /** Returns a modifier for the facet array */
     MeshFacetModifier ModifyFacets()
@@ -179,7 +179,7 @@ public:
     /** Calculates the surface area of the mesh object. */
     float GetSurface() const;
     /** Calculates the surface area of the segment defined by \a aSegment. */
-    float GetSurface( const std::vector<unsigned long>& aSegment ) const;
+    float GetSurface( const std::vector<FacetIndex>& aSegment ) const;
     /** Calculates the volume of the mesh object. Therefore the mesh must be a solid, if not 0
      * is returned.
      */
@@ -216,12 +216,12 @@ public:
      * \note For the start facet \a ulStartFacet MeshFacetVisitor::Visit() does not get invoked though
      * the facet gets marked as VISIT.
      */
-    unsigned long VisitNeighbourFacets (MeshFacetVisitor &rclFVisitor, unsigned long ulStartFacet) const;
+    unsigned long VisitNeighbourFacets (MeshFacetVisitor &rclFVisitor, FacetIndex ulStartFacet) const;
     /**
      * Does basically the same as the method above unless the facets that share just a common point
      * are regared as neighbours.
      */
-    unsigned long VisitNeighbourFacetsOverCorners (MeshFacetVisitor &rclFVisitor, unsigned long ulStartFacet) const;
+    unsigned long VisitNeighbourFacetsOverCorners (MeshFacetVisitor &rclFVisitor, FacetIndex ulStartFacet) const;
     //@}
 
     /** @name Point visitors
@@ -243,7 +243,7 @@ public:
      * \note For the start facet \a ulStartPoint MeshPointVisitor::Visit() does not get invoked though
      * the point gets marked as VISIT.
      */
-    unsigned long VisitNeighbourPoints (MeshPointVisitor &rclPVisitor, unsigned long ulStartPoint) const; 
+    unsigned long VisitNeighbourPoints (MeshPointVisitor &rclPVisitor, PointIndex ulStartPoint) const; 
     //@}
 
     /** @name Iterators 
@@ -346,14 +346,14 @@ public:
     /**
      * Does basically the same as the method above unless that the index of the facet is given.
      */
-    bool DeleteFacet (unsigned long ulInd);
+    bool DeleteFacet (FacetIndex ulInd);
     /** Removes several facets from the data structure. 
      * @note This method overwrites the free usable property of each mesh point.
      * @note This method also removes points from the structure that are no longer
      * referenced by the facets.
      * @note This method is very slow and should only be called occasionally.
      */
-    void DeleteFacets (const std::vector<unsigned long> &raulFacets);
+    void DeleteFacets (const std::vector<FacetIndex> &raulFacets);
     /** Deletes the point the iterator points to. The deletion of a point requires the following step:
      * \li Find all associated facets to this point.
      * \li Delete these facets.
@@ -366,11 +366,11 @@ public:
     /**
      * Does basically the same as the method above unless that the index of the facet is given.
      */
-    bool DeletePoint (unsigned long ulInd);
+    bool DeletePoint (PointIndex ulInd);
     /** Removes several points from the data structure. 
      * @note This method overwrites the free usable property of each mesh point.
      */
-    void DeletePoints (const std::vector<unsigned long> &raulPoints);
+    void DeletePoints (const std::vector<PointIndex> &raulPoints);
     /** Removes all as INVALID marked points and facets from the structure. */
     void RemoveInvalids ();
     /** Rebuilds the neighbour indices for all facets. */
@@ -404,11 +404,11 @@ public:
      */
     void Transform (const Base::Matrix4D &rclMat);
     /** Moves the point at the given index along the vector \a rclTrans. */
-    inline void MovePoint (unsigned long ulPtIndex, const Base::Vector3f &rclTrans);
+    inline void MovePoint (PointIndex ulPtIndex, const Base::Vector3f &rclTrans);
     /** Sets the point at the given index to the new \a rPoint. */
-    inline void SetPoint (unsigned long ulPtIndex, const Base::Vector3f &rPoint);
+    inline void SetPoint (PointIndex ulPtIndex, const Base::Vector3f &rPoint);
     /** Sets the point at the given index to the new \a rPoint. */
-    inline void SetPoint (unsigned long ulPtIndex, float x, float y, float z);
+    inline void SetPoint (PointIndex ulPtIndex, float x, float y, float z);
     /** Smoothes the mesh kernel. */
     void Smooth(int iterations, float d_max);
     /**
@@ -423,19 +423,19 @@ public:
      * index number in the facet array of the mesh structure.
      */
     void CutFacets (const MeshFacetGrid& rclGrid, const Base::ViewProjMethod* pclP, const Base::Polygon2d& rclPoly,
-                    bool bCutInner, std::vector<unsigned long> &raclCutted);
+                    bool bCutInner, std::vector<FacetIndex> &raclCutted);
     //@}
 
 protected:
     /** Rebuilds the neighbour indices for subset of all facets from index \a index on. */
-    void RebuildNeighbours (unsigned long);
+    void RebuildNeighbours (FacetIndex);
     /** Checks if this point is associated to no other facet and deletes if so.
      * The point indices of the facets get adjusted.
      * \a ulIndex is the index of the point to be deleted. \a ulFacetIndex is the index
      * of the quasi deleted facet and is ignored. If \a bOnlySetInvalid is true the point
      * doesn't get deleted but marked as invalid.
      */
-    void ErasePoint (unsigned long ulIndex, unsigned long ulFacetIndex, bool bOnlySetInvalid = false);
+    void ErasePoint (PointIndex ulIndex, FacetIndex ulFacetIndex, bool bOnlySetInvalid = false);
 
     /** Adjusts the facet's orierntation to the given normal direction. */
     inline void AdjustNormal (MeshFacet &rclFacet, const Base::Vector3f &rclNormal);
@@ -460,13 +460,13 @@ protected:
     friend class MeshTrimming;
 };
 
-inline MeshPoint MeshKernel::GetPoint (unsigned long ulIndex) const
+inline MeshPoint MeshKernel::GetPoint (PointIndex ulIndex) const
 {
     assert(ulIndex < _aclPointArray.size());
     return _aclPointArray[ulIndex];
 }
 
-inline MeshGeomFacet MeshKernel::GetFacet (unsigned long ulIndex) const
+inline MeshGeomFacet MeshKernel::GetFacet (FacetIndex ulIndex) const
 {
     assert(ulIndex < _aclFacetArray.size());
 
@@ -498,8 +498,8 @@ inline MeshGeomFacet MeshKernel::GetFacet (const MeshFacet &rclFacet) const
     return  clFacet;
 }
 
-inline void MeshKernel::GetFacetNeighbours (unsigned long ulIndex, unsigned long &rulNIdx0,
-                                            unsigned long &rulNIdx1, unsigned long &rulNIdx2) const 
+inline void MeshKernel::GetFacetNeighbours (FacetIndex ulIndex, FacetIndex &rulNIdx0,
+                                            FacetIndex &rulNIdx1, FacetIndex &rulNIdx2) const 
 {
     assert(ulIndex < _aclFacetArray.size());
 
@@ -508,17 +508,17 @@ inline void MeshKernel::GetFacetNeighbours (unsigned long ulIndex, unsigned long
     rulNIdx2 = _aclFacetArray[ulIndex]._aulNeighbours[2];
 }
 
-inline void MeshKernel::MovePoint (unsigned long ulPtIndex, const Base::Vector3f &rclTrans)
+inline void MeshKernel::MovePoint (PointIndex ulPtIndex, const Base::Vector3f &rclTrans)
 {
     _aclPointArray[ulPtIndex] += rclTrans;
 }
 
-inline void MeshKernel::SetPoint (unsigned long ulPtIndex, const Base::Vector3f &rPoint)
+inline void MeshKernel::SetPoint (PointIndex ulPtIndex, const Base::Vector3f &rPoint)
 {
     _aclPointArray[ulPtIndex] = rPoint;
 }
 
-inline void MeshKernel::SetPoint (unsigned long ulPtIndex, float x, float y, float z)
+inline void MeshKernel::SetPoint (PointIndex ulPtIndex, float x, float y, float z)
 {
     _aclPointArray[ulPtIndex].Set(x,y,z);
 }
@@ -550,8 +550,8 @@ inline Base::Vector3f MeshKernel::GetGravityPoint (const MeshFacet &rclFacet) co
                           (p0.z+p1.z+p2.z)/3.0f);
 }
 
-inline void MeshKernel::GetFacetPoints (unsigned long ulFaIndex, unsigned long &rclP0,
-                                        unsigned long &rclP1, unsigned long &rclP2) const
+inline void MeshKernel::GetFacetPoints (FacetIndex ulFaIndex, PointIndex &rclP0,
+                                        PointIndex &rclP1, PointIndex &rclP2) const
 {
     assert(ulFaIndex < _aclFacetArray.size());
     const MeshFacet& rclFacet = _aclFacetArray[ulFaIndex];
@@ -27,6 +27,7 @@
 #include <vector>
 #include <Base/BoundBox.h>
 #include <Base/Vector3D.h>
+#include "Definitions.h"
 
 using Base::Vector3f;
 
@@ -48,8 +49,8 @@ public:
     MeshProjection(const MeshKernel&);
     ~MeshProjection();
 
-    bool projectLineOnMesh(const MeshFacetGrid& grid, const Base::Vector3f& p1, unsigned long f1,
-        const Base::Vector3f& p2, unsigned long f2, const Base::Vector3f& view,
+    bool projectLineOnMesh(const MeshFacetGrid& grid, const Base::Vector3f& p1, FacetIndex f1,
+        const Base::Vector3f& p2, FacetIndex f2, const Base::Vector3f& view,
         std::vector<Base::Vector3f>& polyline);
 protected:
     bool bboxInsideRectangle (const Base::BoundBox3f& bbox, const Base::Vector3f& p1, const Base::Vector3f& p2, const Base::Vector3f& view) const;
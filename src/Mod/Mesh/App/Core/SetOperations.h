@@ -116,7 +116,7 @@ private:
     public:
       int               fcounter[2];           // counter of facets attacted to the edge
       MeshGeomFacet     facets[2][2];          // Geom-Facets attached to the edge
-      unsigned long     facet[2];              // underlying Facet-Index
+      FacetIndex     facet[2];              // underlying Facet-Index
 
       EdgeInfo ()
       {
@@ -130,7 +130,7 @@ private:
   //class CollectFacetVisitor : public MeshFacetVisitor
   //{
   //  public:
-  //    std::vector<unsigned long> &_facets;
+  //    std::vector<FacetIndex> &_facets;
   //    MeshKernel                 &_mesh;
   //    std::map<Edge, EdgeInfo>   &_edges;
   //    int                         _side;
@@ -138,15 +138,15 @@ private:
   //    int                         _addFacets; // 0: add facets to the result 1: do not add facets to the result
   //    Base::Builder3D& _builder;
 
-  //    CollectFacetVisitor (MeshKernel& mesh, std::vector<unsigned long>& facets, std::map<Edge, EdgeInfo>& edges, int side, float mult, Base::Builder3D& builder);
-  //    bool Visit (MeshFacet &rclFacet, const MeshFacet &rclFrom, unsigned long ulFInd, unsigned long ulLevel);
-  //    bool AllowVisit (MeshFacet& rclFacet, MeshFacet& rclFrom, unsigned long ulFInd, unsigned long ulLevel, unsigned short neighbourIndex);
+  //    CollectFacetVisitor (MeshKernel& mesh, std::vector<FacetIndex>& facets, std::map<Edge, EdgeInfo>& edges, int side, float mult, Base::Builder3D& builder);
+  //    bool Visit (MeshFacet &rclFacet, const MeshFacet &rclFrom, FacetIndex ulFInd, unsigned long ulLevel);
+  //    bool AllowVisit (MeshFacet& rclFacet, MeshFacet& rclFrom, FacetIndex ulFInd, unsigned long ulLevel, unsigned short neighbourIndex);
   //};
 
   class CollectFacetVisitor : public MeshFacetVisitor
   {
     public:
-      std::vector<unsigned long> &_facets;
+      std::vector<FacetIndex> &_facets;
       const MeshKernel           &_mesh;
       std::map<Edge, EdgeInfo>   &_edges;
       int                         _side;
@@ -154,9 +154,9 @@ private:
       int                         _addFacets; // 0: add facets to the result 1: do not add facets to the result
       Base::Builder3D& _builder;
 
-      CollectFacetVisitor (const MeshKernel& mesh, std::vector<unsigned long>& facets, std::map<Edge, EdgeInfo>& edges, int side, float mult, Base::Builder3D& builder);
-      bool Visit (const MeshFacet &rclFacet, const MeshFacet &rclFrom, unsigned long ulFInd, unsigned long ulLevel);
-      bool AllowVisit (const MeshFacet& rclFacet, const MeshFacet& rclFrom, unsigned long ulFInd, unsigned long ulLevel, unsigned short neighbourIndex);
+      CollectFacetVisitor (const MeshKernel& mesh, std::vector<FacetIndex>& facets, std::map<Edge, EdgeInfo>& edges, int side, float mult, Base::Builder3D& builder);
+      bool Visit (const MeshFacet &rclFacet, const MeshFacet &rclFrom, FacetIndex ulFInd, unsigned long ulLevel);
+      bool AllowVisit (const MeshFacet& rclFacet, const MeshFacet& rclFrom, FacetIndex ulFInd, unsigned long ulLevel, unsigned short neighbourIndex);
   };
 
   /** all points from cut */
@@ -171,7 +171,7 @@ private:
   std::vector<MeshGeomFacet> _newMeshFacets[2];
 
   /** Cut mesh 1 with mesh 2 */
-  void Cut (std::set<unsigned long>& facetsNotCuttingEdge0, std::set<unsigned long>& facetsCuttingEdge1);
+  void Cut (std::set<FacetIndex>& facetsNotCuttingEdge0, std::set<FacetIndex>& facetsCuttingEdge1);
   /** Trianglute each facets cut with its cutting points */
   void TriangulateMesh (const MeshKernel &cutMesh, int side);
   /** search facets for adding (with region growing) */
@@ -23,6 +23,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
 #endif
 
 #include "Smoothing.h"
@@ -31,10 +32,125 @@
 #include "Elements.h"
 #include "Iterator.h"
 #include "Approximation.h"
+#include "Functional.h"
 
 
 using namespace MeshCore;
 
+namespace MeshCore {
+
+/**
+ * The SmoothingEngine keeps the point neighbourhoods of a mesh and the points in
+ * two buffers. A smoothing step reads the points of the current buffer and writes
+ * the other one (Jacobi iteration) so that all points of a step can be computed in
+ * parallel. Only the selected points are moved, all other
+ * points are kept fixed.
+ */
+class SmoothingEngine
+{
+public:
+    SmoothingEngine(const MeshKernel& kernel)
+      : all(true)
+      , neighbours(kernel)
+    {
+        Initialize(kernel);
+    }
+    SmoothingEngine(const MeshKernel& kernel, const std::vector<PointIndex>& indices)
+      : all(false)
+      , active(indices)
+      , neighbours(kernel)
+    {
+        std::sort(active.begin(), active.end());
+        active.erase(std::unique(active.begin(), active.end()), active.end());
+        active.erase(std::lower_bound(active.begin(), active.end(),
+                     static_cast<PointIndex>(kernel.CountPoints())), active.end());
+        Initialize(kernel);
+    }
+
+    /// Returns the position of the point \a p of the current step.
+    const Base::Vector3f& operator[] (PointIndex p) const
+    {
+        return source[p];
+    }
+    /// Returns the neighbour points of the point \a p.
+    MeshIndexRange Neighbours(PointIndex p) const
+    {
+        return neighbours[p];
+    }
+    /// Checks whether \a p is a point of an open edge.
+    bool IsBorder(PointIndex p) const
+    {
+        return border[p] != 0;
+    }
+
+    /**
+     * Performs one smoothing step. For every selected point \a p the new position is
+     * given by \a func(p) that may only read the points of the current step.
+     */
+    template <class Func>
+    void Step(Func func)
+    {
+        int threads = QThread::idealThreadCount();
+        if (all) {
+            parallel_for(source.size(), threads, [this, &func](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                    target[i] = func(static_cast<PointIndex>(i));
+            });
+        }
+        else {
+            parallel_for(active.size(), threads, [this, &func](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                    target[active[i]] = func(active[i]);
+            });
+        }
+
+        // points that are not selected are equal in both buffers
+        source.swap(target);
+    }
+
+    /// Writes the points of the last step back to the mesh.
+    void Apply(MeshKernel& kernel) const
+    {
+        parallel_for(source.size(), QThread::idealThreadCount(), [this, &kernel](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                kernel.SetPoint(static_cast<PointIndex>(i), source[i]);
+        });
+    }
+
+private:
+    void Initialize(const MeshKernel& kernel)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        source.assign(points.begin(), points.end());
+        target = source;
+
+        BuildNeighbours(kernel);
+    }
+
+    /// A point whose number of neighbour points differs from its number of facets lies on a boundary.
+    void BuildNeighbours(const MeshKernel& kernel)
+    {
+        MeshCsrPointToFacets vf_it(kernel);
+        std::size_t numPoints = source.size();
+        border.resize(numPoints);
+        parallel_for(numPoints, QThread::idealThreadCount(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                PointIndex pos = static_cast<PointIndex>(i);
+                border[i] = neighbours[pos].size() != vf_it[pos].size() ? 1 : 0;
+            }
+        });
+    }
+
+private:
+    bool all;
+    std::vector<PointIndex> active;
+    std::vector<Base::Vector3f> source;
+    std::vector<Base::Vector3f> target;
+    MeshCsrPointToPoints neighbours;
+    std::vector<char> border;
+};
+
+}
 
 AbstractSmoothing::AbstractSmoothing(MeshKernel& m)
   : kernel(m)
@@ -65,109 +181,61 @@ PlaneFitSmoothing::~PlaneFitSmoothing()
 
 void PlaneFitSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
-
+    SmoothingEngine engine(kernel);
     for (unsigned int i=0; i<iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<unsigned long>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3)
-                continue;
-
-            std::set<unsigned long>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0f/(static_cast<float>(cv.size())+1.0f);
-            center.Scale(scale,scale,scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
-
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N*L < 0.0f)
-                N.Scale(-1.0, -1.0, -1.0);
-
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(fabs(this->tolerance),fabs(N*L));
-            N.Scale(d,d,d);
-
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
-
-        // assign values without affecting iterators
-        unsigned long count = kernel.CountPoints();
-        for (unsigned long idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+        Fit(engine);
     }
+
+    engine.Apply(kernel);
 }
 
-void PlaneFitSmoothing::SmoothPoints(unsigned int iterations, const std::vector<unsigned long>& point_indices)
+void PlaneFitSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
-
+    SmoothingEngine engine(kernel, point_indices);
     for (unsigned int i=0; i<iterations; i++) {
-        Base::Vector3f N, L;
-        for (std::vector<unsigned long>::const_iterator it = point_indices.begin(); it != point_indices.end(); ++it) {
-            v_it.Set(*it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<unsigned long>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3)
-                continue;
-
-            std::set<unsigned long>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+        Fit(engine);
+    }
 
-            float scale = 1.0f/(static_cast<float>(cv.size())+1.0f);
-            center.Scale(scale,scale,scale);
+    engine.Apply(kernel);
+}
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+void PlaneFitSmoothing::Fit(SmoothingEngine& engine) const
+{
+    float tol = fabs(this->tolerance);
+    engine.Step([&engine, tol](PointIndex pos) {
+        const Base::Vector3f& v = engine[pos];
+        MeshIndexRange cv = engine.Neighbours(pos);
+        std::size_t n_count = cv.size();
+        if (n_count < 3)
+            return v;
+
+        MeshCore::PlaneFit pf;
+        pf.AddPoint(v);
+        Base::Vector3f center = v;
+        for (MeshIndexRange::const_iterator cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
+            pf.AddPoint(engine[*cv_it]);
+            center += engine[*cv_it];
+        }
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N*L < 0.0f)
-                N.Scale(-1.0, -1.0, -1.0);
+        float scale = 1.0f/(static_cast<float>(n_count)+1.0f);
+        center.Scale(scale,scale,scale);
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(fabs(this->tolerance),fabs(N*L));
-            N.Scale(d,d,d);
+        // get the mean plane of the current vertex with the surrounding vertices
+        pf.Fit();
+        Base::Vector3f N = pf.GetNormal();
+        N.Normalize();
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+        // look in which direction we should move the vertex
+        Base::Vector3f L = v - center;
+        if (N*L < 0.0f)
+            N.Scale(-1.0, -1.0, -1.0);
 
-        // assign values without affecting iterators
-        unsigned long count = kernel.CountPoints();
-        for (unsigned long idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
-    }
+        // maximum value to move is distance to mean plane
+        float d = std::min<float>(tol,fabs(N*L));
+        N.Scale(d,d,d);
+
+        return v - N;
+    });
 }
 
 LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
@@ -179,95 +247,54 @@ LaplaceSmoothing::~LaplaceSmoothing()
 {
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it, double stepsize)
+void LaplaceSmoothing::Umbrella(SmoothingEngine& engine, double stepsize) const
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it,
-    v_beg = points.begin(), v_end = points.end();
-
-    unsigned long pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it,++pos) {
-        const std::set<unsigned long>& cv = vv_it[pos];
-        if (cv.size() < 3)
-            continue;
-        if (cv.size() != vf_it[pos].size()) {
+    engine.Step([&engine, stepsize](PointIndex pos) {
+        const Base::Vector3f& v = engine[pos];
+        MeshIndexRange cv = engine.Neighbours(pos);
+        std::size_t n_count = cv.size();
+        if (n_count < 3)
+            return v;
+        if (engine.IsBorder(pos)) {
             // do nothing for border points
-            continue;
+            return v;
         }
 
-        size_t n_count = cv.size();
-        double w;
-        w=1.0/double(n_count);
-
+        // sum up the differences in plain loops and scale once
         double delx=0.0,dely=0.0,delz=0.0;
-        std::set<unsigned long>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-            delx += w*static_cast<double>((v_beg[*cv_it]).x-v_it->x);
-            dely += w*static_cast<double>((v_beg[*cv_it]).y-v_it->y);
-            delz += w*static_cast<double>((v_beg[*cv_it]).z-v_it->z);
+        for (MeshIndexRange::const_iterator cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
+            const Base::Vector3f& w = engine[*cv_it];
+            delx += static_cast<double>(w.x-v.x);
+            dely += static_cast<double>(w.y-v.y);
+            delz += static_cast<double>(w.z-v.z);
         }
 
-        float x = static_cast<float>(static_cast<double>(v_it->x)+stepsize*delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y)+stepsize*dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z)+stepsize*delz);
-        kernel.SetPoint(pos,x,y,z);
-    }
-}
-
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it, double stepsize,
-                                const std::vector<unsigned long>& point_indices)
-{
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (std::vector<unsigned long>::const_iterator pos = point_indices.begin(); pos != point_indices.end(); ++pos) {
-        const std::set<unsigned long>& cv = vv_it[*pos];
-        if (cv.size() < 3)
-            continue;
-        if (cv.size() != vf_it[*pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w;
-        w=1.0/double(n_count);
-
-        double delx=0.0,dely=0.0,delz=0.0;
-        std::set<unsigned long>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-            delx += w*static_cast<double>((v_beg[*cv_it]).x-(v_beg[*pos]).x);
-            dely += w*static_cast<double>((v_beg[*cv_it]).y-(v_beg[*pos]).y);
-            delz += w*static_cast<double>((v_beg[*cv_it]).z-(v_beg[*pos]).z);
-        }
-
-        float x = static_cast<float>(static_cast<double>((v_beg[*pos]).x)+stepsize*delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[*pos]).y)+stepsize*dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[*pos]).z)+stepsize*delz);
-        kernel.SetPoint(*pos,x,y,z);
-    }
+        double scale = stepsize/double(n_count);
+        float x = static_cast<float>(static_cast<double>(v.x)+scale*delx);
+        float y = static_cast<float>(static_cast<double>(v.y)+scale*dely);
+        float z = static_cast<float>(static_cast<double>(v.z)+scale*delz);
+        return Base::Vector3f(x,y,z);
+    });
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
+    SmoothingEngine engine(kernel);
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(engine, lambda);
     }
+
+    engine.Apply(kernel);
 }
 
-void LaplaceSmoothing::SmoothPoints(unsigned int iterations, const std::vector<unsigned long>& point_indices)
+void LaplaceSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
+    SmoothingEngine engine(kernel, point_indices);
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(engine, lambda);
     }
+
+    engine.Apply(kernel);
 }
 
 TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
@@ -281,26 +308,28 @@ TaubinSmoothing::~TaubinSmoothing()
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    SmoothingEngine engine(kernel);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations+1)/2; // two steps per iteration
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
-        Umbrella(vv_it, vf_it, -(lambda+micro));
+        Umbrella(engine, lambda);
+        Umbrella(engine, -(lambda+micro));
     }
+
+    engine.Apply(kernel);
 }
 
-void TaubinSmoothing::SmoothPoints(unsigned int iterations, const std::vector<unsigned long>& point_indices)
+void TaubinSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    SmoothingEngine engine(kernel, point_indices);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations+1)/2; // two steps per iteration
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
-        Umbrella(vv_it, vf_it, -(lambda+micro), point_indices);
+        Umbrella(engine, lambda);
+        Umbrella(engine, -(lambda+micro));
     }
+
+    engine.Apply(kernel);
 }
@@ -25,12 +25,12 @@
 #define MESH_SMOOTHING_H
 
 #include <vector>
+#include "Definitions.h"
 
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
-class MeshRefPointToFacets;
+class SmoothingEngine;
 
 /** Base class for smoothing algorithms. */
 class MeshExport AbstractSmoothing
@@ -54,7 +54,7 @@ public:
 
     /** Smooth the triangle mesh. */
     virtual void Smooth(unsigned int) = 0;
-    virtual void SmoothPoints(unsigned int, const std::vector<unsigned long>&) = 0;
+    virtual void SmoothPoints(unsigned int, const std::vector<PointIndex>&) = 0;
 
 protected:
     MeshKernel& kernel;
@@ -70,7 +70,10 @@ public:
     PlaneFitSmoothing(MeshKernel&);
     virtual ~PlaneFitSmoothing();
     void Smooth(unsigned int);
-    void SmoothPoints(unsigned int, const std::vector<unsigned long>&);
+    void SmoothPoints(unsigned int, const std::vector<PointIndex>&);
+
+protected:
+    void Fit(SmoothingEngine&) const;
 };
 
 class MeshExport LaplaceSmoothing : public AbstractSmoothing
@@ -79,15 +82,11 @@ public:
     LaplaceSmoothing(MeshKernel&);
     virtual ~LaplaceSmoothing();
     void Smooth(unsigned int);
-    void SmoothPoints(unsigned int, const std::vector<unsigned long>&);
+    void SmoothPoints(unsigned int, const std::vector<PointIndex>&);
     void SetLambda(double l) { lambda = l;}
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&, double,
-                  const std::vector<unsigned long>&);
+    void Umbrella(SmoothingEngine&, double) const;
 
 protected:
     double lambda;
@@ -99,7 +98,7 @@ public:
     TaubinSmoothing(MeshKernel&);
     virtual ~TaubinSmoothing();
     void Smooth(unsigned int);
-    void SmoothPoints(unsigned int, const std::vector<unsigned long>&);
+    void SmoothPoints(unsigned int, const std::vector<PointIndex>&);
     void SetMicro(double m) { micro = m;}
 
 protected:
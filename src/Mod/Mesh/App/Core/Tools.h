@@ -51,18 +51,18 @@ public:
    * inside a sphere of radius \a fDistance, center \a center of the original facet. This method uses the 
    * MARKED flags.
    */
-  unsigned long  NeighboursFromFacet (unsigned long ulFacetIdx, float fDistance, unsigned long ulMinPoints, std::vector<Base::Vector3f> &raclResultPoints);
+  unsigned long  NeighboursFromFacet (FacetIndex ulFacetIdx, float fDistance, unsigned long ulMinPoints, std::vector<Base::Vector3f> &raclResultPoints);
   /** Searches for facets from the start facet, sample the neighbour facets and accumulates the points. */
-  unsigned long  NeighboursFromSampledFacets (unsigned long ulFacetIdx, float fDistance, std::vector<Base::Vector3f> &raclResultPoints);
+  unsigned long  NeighboursFromSampledFacets (FacetIndex ulFacetIdx, float fDistance, std::vector<Base::Vector3f> &raclResultPoints);
   /** Searches for facets from the start facet. */
-  unsigned long  NeighboursFacetFromFacet (unsigned long ulFacetIdx, float fDistance, std::vector<Base::Vector3f> &raclResultPoints,
-                                           std::vector<unsigned long> &raclResultFacets);
+  unsigned long  NeighboursFacetFromFacet (FacetIndex ulFacetIdx, float fDistance, std::vector<Base::Vector3f> &raclResultPoints,
+                                           std::vector<FacetIndex> &raclResultFacets);
 
 protected:
   /** Subsamples the mesh. */
   void SampleAllFacets (void);
   inline bool CheckDistToFacet (const MeshFacet &rclF);     // check distance to facet, add points inner radius
-  bool AccumulateNeighbours (const MeshFacet &rclF, unsigned long ulFIdx); // accumulate the sample neighbours facet
+  bool AccumulateNeighbours (const MeshFacet &rclF, FacetIndex ulFIdx); // accumulate the sample neighbours facet
   inline bool InnerPoint (const Base::Vector3f &rclPt) const;
   inline bool TriangleCutsSphere (const MeshFacet &rclF) const;
   bool ExpandRadius (unsigned long ulMinPoints);
@@ -78,11 +78,11 @@ protected:
   const MeshKernel  &_rclMesh;
   const MeshFacetArray &_rclFAry;
   const MeshPointArray &_rclPAry;
-  MeshRefPointToFacets _clPt2Fa;
+  MeshCsrPointToFacets _clPt2Fa;
   float _fMaxDistanceP2;   // square distance 
   Base::Vector3f _clCenter;         // center points of start facet
-  std::set<unsigned long> _aclResult;        // result container (point indices)
-  std::set<unsigned long> _aclOuter;         // next searching points
+  std::set<PointIndex> _aclResult;        // result container (point indices)
+  std::set<PointIndex> _aclOuter;         // next searching points
   std::vector<Base::Vector3f> _aclPointsResult;  // result as vertex
   std::vector<std::vector<Base::Vector3f> > _aclSampledFacets; // sample points from each facet
   float _fSampleDistance;  // distance between two sampled points
@@ -100,7 +100,7 @@ inline bool MeshSearchNeighbours::CheckDistToFacet (const MeshFacet &rclF)
 
   for (int i = 0; i < 3; i++)
   {
-    unsigned long ulPIdx = rclF._aulPoints[i];
+    PointIndex ulPIdx = rclF._aulPoints[i];
     if (_rclPAry[ulPIdx].IsFlag(MeshPoint::MARKED) == false)
     {
       if (Base::DistanceP2(_clCenter, _rclPAry[ulPIdx]) < _fMaxDistanceP2)
@@ -146,7 +146,7 @@ class MeshFaceIterator
 public:
     MeshFaceIterator(const MeshKernel& mesh)
         : it(mesh) {}
-    Base::Vector3f operator() (unsigned long index)
+    Base::Vector3f operator() (FacetIndex index)
     {
         it.Set(index);
         return it->GetGravityPoint();
@@ -161,7 +161,7 @@ class MeshVertexIterator
 public:
     MeshVertexIterator(const MeshKernel& mesh)
         : it(mesh) {}
-    Base::Vector3f operator() (unsigned long index)
+    Base::Vector3f operator() (PointIndex index)
     {
         it.Set(index);
         return *it;
@@ -176,8 +176,8 @@ class MeshNearestIndexToPlane
 {
 public:
     MeshNearestIndexToPlane(const MeshKernel& mesh, const Base::Vector3f& b, const Base::Vector3f& n)
-        : nearest_index(ULONG_MAX),nearest_dist(FLOAT_MAX), it(mesh), base(b), normal(n) {}
-    void operator() (unsigned long index)
+        : nearest_index(ELEMENT_INDEX_MAX),nearest_dist(FLOAT_MAX), it(mesh), base(b), normal(n) {}
+    void operator() (ElementIndex index)
     {
         float dist = (float)fabs(it(index).DistanceToPlane(base, normal));
         if (dist < nearest_dist) {
@@ -186,7 +186,7 @@ public:
         }
     }
 
-    unsigned long nearest_index;
+    ElementIndex nearest_index;
     float nearest_dist;
 
 private:
@@ -292,7 +292,7 @@ bool EarClippingTriangulator::Triangulate()
     _triangles.clear();
 
     std::vector<Base::Vector3f> pts = ProjectToFitPlane();
-    std::vector<unsigned long> result;
+    std::vector<FacetIndex> result;
 
     //  Invoke the triangulator to triangulate this polygon.
     Triangulate::Process(pts,result);
@@ -398,7 +398,7 @@ bool EarClippingTriangulator::Triangulate::Snip(const std::vector<Base::Vector3f
 bool EarClippingTriangulator::Triangulate::_invert = false;
 
 bool EarClippingTriangulator::Triangulate::Process(const std::vector<Base::Vector3f> &contour,
-                                                   std::vector<unsigned long> &result)
+                                                   std::vector<PointIndex> &result)
 {
     /* allocate and initialize list of Vertices in polygon */
 
@@ -483,11 +483,11 @@ bool QuasiDelaunayTriangulator::Triangulate()
 
     // For each internal edge get the adjacent facets. When doing an edge swap we must update
     // this structure.
-    std::map<std::pair<unsigned long, unsigned long>, std::vector<unsigned long> > aEdge2Face;
+    std::map<std::pair<unsigned long, unsigned long>, std::vector<FacetIndex> > aEdge2Face;
     for (std::vector<MeshFacet>::iterator pI = _facets.begin(); pI != _facets.end(); ++pI) {
         for (int i = 0; i < 3; i++) {
-            unsigned long ulPt0 = std::min<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
-            unsigned long ulPt1 = std::max<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+            PointIndex ulPt0 = std::min<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
+            PointIndex ulPt1 = std::max<unsigned long>(pI->_aulPoints[i],  pI->_aulPoints[(i+1)%3]);
             // ignore borderlines of the polygon
             if ((ulPt1-ulPt0)%(_points.size()-1) > 1)
                 aEdge2Face[std::pair<unsigned long, unsigned long>(ulPt0, ulPt1)].push_back(pI - _facets.begin());
@@ -496,7 +496,7 @@ bool QuasiDelaunayTriangulator::Triangulate()
 
     // fill up this list with all internal edges and perform swap edges until this list is empty
     std::list<std::pair<unsigned long, unsigned long> > aEdgeList;
-    std::map<std::pair<unsigned long, unsigned long>, std::vector<unsigned long> >::iterator pE;
+    std::map<std::pair<unsigned long, unsigned long>, std::vector<FacetIndex> >::iterator pE;
     for (pE = aEdge2Face.begin(); pE != aEdge2Face.end(); ++pE)
         aEdgeList.push_back(pE->first);
 
@@ -556,10 +556,10 @@ bool QuasiDelaunayTriangulator::Triangulate()
 
             // adjust the edge list
             for (int i=0; i<3; i++) {
-                std::map<std::pair<unsigned long, unsigned long>, std::vector<unsigned long> >::iterator it;
+                std::map<std::pair<unsigned long, unsigned long>, std::vector<PointIndex> >::iterator it;
                 // first facet
-                unsigned long ulPt0 = std::min<unsigned long>(rF1._aulPoints[i],  rF1._aulPoints[(i+1)%3]);
-                unsigned long ulPt1 = std::max<unsigned long>(rF1._aulPoints[i],  rF1._aulPoints[(i+1)%3]);
+                PointIndex ulPt0 = std::min<unsigned long>(rF1._aulPoints[i],  rF1._aulPoints[(i+1)%3]);
+                PointIndex ulPt1 = std::max<unsigned long>(rF1._aulPoints[i],  rF1._aulPoints[(i+1)%3]);
                 it = aEdge2Face.find( std::make_pair(ulPt0, ulPt1) );
                 if (it != aEdge2Face.end()) {
                     if (it->second[0] == pE->second[1])
@@ -583,8 +583,8 @@ bool QuasiDelaunayTriangulator::Triangulate()
             }
 
             // Now we must remove the edge and replace it through the new edge
-            unsigned long ulPt0 = std::min<unsigned long>(rF1._aulPoints[(side1+1)%3], rF2._aulPoints[(side2+1)%3]);
-            unsigned long ulPt1 = std::max<unsigned long>(rF1._aulPoints[(side1+1)%3], rF2._aulPoints[(side2+1)%3]);
+            PointIndex ulPt0 = std::min<unsigned long>(rF1._aulPoints[(side1+1)%3], rF2._aulPoints[(side2+1)%3]);
+            PointIndex ulPt1 = std::max<unsigned long>(rF1._aulPoints[(side1+1)%3], rF2._aulPoints[(side2+1)%3]);
             std::pair<unsigned long, unsigned long> aNewEdge = std::make_pair(ulPt0, ulPt1);
             aEdge2Face[aNewEdge] = pE->second;
             aEdge2Face.erase(pE);
@@ -63,7 +63,7 @@ public:
 
     /** Sets the polygon to be triangulated. */
     void SetPolygon(const std::vector<Base::Vector3f>& raclPoints);
-    void SetIndices(const std::vector<unsigned long>& d) {_indices = d;}
+    void SetIndices(const std::vector<PointIndex>& d) {_indices = d;}
     /** Set a verifier object that checks if the generated triangulation
      * can be accepted and added to the mesh kernel.
      * The triangulator takes ownership of the passed verifier.
@@ -132,7 +132,7 @@ protected:
 protected:
     bool                        _discard;
     Base::Matrix4D              _inverse;
-    std::vector<unsigned long>  _indices;
+    std::vector<PointIndex>  _indices;
     std::vector<Base::Vector3f> _points;
     std::vector<Base::Vector3f> _newpoints;
     std::vector<MeshGeomFacet>  _triangles;
@@ -170,7 +170,7 @@ private:
         // triangulate a contour/polygon, places results in STL vector
         // as series of triangles.indicating the points
         static bool Process(const std::vector<Base::Vector3f> &contour,
-            std::vector<unsigned long> &result);
+            std::vector<PointIndex> &result);
 
         // compute area of a contour/polygon
         static float Area(const std::vector<Base::Vector3f> &contour);
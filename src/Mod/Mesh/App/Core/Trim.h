@@ -46,12 +46,12 @@ public:
     /**
      * Checks all facets for intersection with the polygon and writes all touched facets into the vector
      */
-    void CheckFacets(const MeshFacetGrid& rclGrid, std::vector<unsigned long>& raulFacets) const;
+    void CheckFacets(const MeshFacetGrid& rclGrid, std::vector<FacetIndex>& raulFacets) const;
 
     /**
      * The facets from raulFacets will be trimmed or deleted and aclNewFacets gives the new generated facets
      */
-    void TrimFacets(const std::vector<unsigned long>& raulFacets, std::vector<MeshGeomFacet>& aclNewFacets);
+    void TrimFacets(const std::vector<FacetIndex>& raulFacets, std::vector<MeshGeomFacet>& aclNewFacets);
 
     /**
      * Setter: Trimm INNER or OUTER
@@ -67,18 +67,18 @@ private:
     /**
      * Checks if a facet lies totally within a polygon
      */
-    bool PolygonContainsCompleteFacet(bool bInner, unsigned long ulIndex) const;
+    bool PolygonContainsCompleteFacet(bool bInner, FacetIndex ulIndex) const;
 
     /**
      * Creates new facets from edge points of the facet
      */
-    bool CreateFacets(unsigned long ulFacetPos, int iSide, const std::vector<Base::Vector3f>& raclPoints,
+    bool CreateFacets(FacetIndex ulFacetPos, int iSide, const std::vector<Base::Vector3f>& raclPoints,
         std::vector<MeshGeomFacet>& aclNewFacets);
 
     /**
      * Creates new facets from edge points of the facet and a point inside the facet
      */
-    bool CreateFacets(unsigned long ulFacetPos, int iSide, const std::vector<Base::Vector3f>& raclPoints,
+    bool CreateFacets(FacetIndex ulFacetPos, int iSide, const std::vector<Base::Vector3f>& raclPoints,
         Base::Vector3f& clP3, std::vector<MeshGeomFacet>& aclNewFacets);
 
     /**
@@ -43,12 +43,12 @@ public:
      * Checks all facets for intersection with the plane and writes all touched facets into the vector
      */
     void CheckFacets(const MeshFacetGrid& rclGrid, const Base::Vector3f& base, const Base::Vector3f& normal,
-                     std::vector<unsigned long>& trimFacets, std::vector<unsigned long>& removeFacets) const;
+                     std::vector<FacetIndex>& trimFacets, std::vector<FacetIndex>& removeFacets) const;
 
     /**
      * The facets from \a trimFacets will be trimmed or deleted and \a trimmedFacets holds the newly generated facets
      */
-    void TrimFacets(const std::vector<unsigned long>& trimFacets, const Base::Vector3f& base,
+    void TrimFacets(const std::vector<FacetIndex>& trimFacets, const Base::Vector3f& base,
                     const Base::Vector3f& normal, std::vector<MeshGeomFacet>& trimmedFacets);
 
 private:
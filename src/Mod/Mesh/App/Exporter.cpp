@@ -180,9 +180,9 @@ bool MergeExporter::addMesh(const char *name, const MeshObject & mesh)
         for (unsigned long i=0; i<numSegm; i++) {
             const Segment& segm = mesh.getSegment(i);
             if (segm.isSaved()) {
-                std::vector<unsigned long> indices = segm.getIndices();
+                std::vector<FacetIndex> indices = segm.getIndices();
                 std::for_each( indices.begin(), indices.end(),
-                               [countFacets] (unsigned long &v) {
+                               [countFacets] (FacetIndex &v) {
                                    v += countFacets;
                                } );
                 Segment new_segm(&mergingMesh, indices, true);
@@ -192,9 +192,9 @@ bool MergeExporter::addMesh(const char *name, const MeshObject & mesh)
         }
     } else {
         // now create a segment for the added mesh
-        std::vector<unsigned long> indices;
+        std::vector<FacetIndex> indices;
         indices.resize(mergingMesh.countFacets() - countFacets);
-        std::generate(indices.begin(), indices.end(), Base::iotaGen<unsigned long>(countFacets));
+        std::generate(indices.begin(), indices.end(), Base::iotaGen<FacetIndex>(countFacets));
         Segment segm(&mergingMesh, indices, true);
         segm.setName(name);
         mergingMesh.addSegment(segm);
@@ -292,7 +292,7 @@ bool AmfExporter::addMesh(const char *name, const MeshObject & mesh)
     auto vertexCount(0UL);
 
     // {facet1A, facet1B, facet1C, facet2A, ..., facetNC}
-    std::vector<unsigned long> facets;
+    std::vector<FacetIndex> facets;
 
     // For each facet in mesh
     for(clIter.Begin(), clEnd.End(); clIter < clEnd; ++clIter) {
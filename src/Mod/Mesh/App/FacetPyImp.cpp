@@ -73,7 +73,7 @@ PyObject*  FacetPy::unbound(PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
-    getFacetPtr()->Index = ULONG_MAX;
+    getFacetPtr()->Index = MeshCore::FACET_INDEX_MAX;
     getFacetPtr()->Mesh = 0;
     Py_Return;
 }
@@ -190,7 +190,7 @@ Py::Tuple FacetPy::getPointIndices(void) const
 
     Py::Tuple idxTuple(3);
     for (int i=0; i<3; i++) {
-        idxTuple.setItem(i, Py::Long(face->PIndex[i]));
+        idxTuple.setItem(i, Py::Long((unsigned long)face->PIndex[i]));
     }
     return idxTuple;
 }
@@ -204,7 +204,7 @@ Py::Tuple FacetPy::getNeighbourIndices(void) const
 
     Py::Tuple idxTuple(3);
     for (int i=0; i<3; i++) {
-        idxTuple.setItem(i, Py::Long(face->NIndex[i]));
+        idxTuple.setItem(i, Py::Long((unsigned long)face->NIndex[i]));
     }
     return idxTuple;
 }
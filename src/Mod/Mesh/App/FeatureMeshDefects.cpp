@@ -29,6 +29,7 @@
 
 #include "FeatureMeshDefects.h"
 #include "Core/Degeneration.h"
+#include "Core/Evaluation.h"
 #include "Core/TopoAlgorithm.h"
 #include "Core/Triangulation.h"
 #include <Base/Tools.h>
@@ -46,6 +47,10 @@ FixDefects::FixDefects()
 {
   ADD_PROPERTY(Source  ,(0));
   ADD_PROPERTY(Epsilon  ,(0));
+  ADD_PROPERTY_TYPE(Analyze, (false), "Analysis", App::Prop_None,
+                    "Check the resulting mesh for remaining defects");
+  ADD_PROPERTY_TYPE(Defects, (), "Analysis", App::PropertyType(App::Prop_Output|App::Prop_ReadOnly),
+                    "Number of remaining defects of the resulting mesh");
 }
 
 FixDefects::~FixDefects()
@@ -64,6 +69,35 @@ App::DocumentObjectExecReturn *FixDefects::execute(void)
   return App::DocumentObject::StdReturn;
 }
 
+void FixDefects::onChanged(const App::Property* prop)
+{
+  if ((prop == &Mesh || prop == &Analyze || prop == &Epsilon) && !isRestoring()) {
+    std::map<std::string, std::string> defects;
+    if (Analyze.getValue()) {
+      // check with the tolerance of the fix if one is set, so that the report matches what it repairs
+      float fEpsilon = static_cast<float>(Epsilon.getValue());
+      if (fEpsilon <= 0.0f)
+        fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
+      MeshCore::MeshDefectReport report = Mesh.getValue().analyzeDefects(fEpsilon);
+      defects["InvalidPoints"] = std::to_string(report.invalidPoints.size());
+      defects["DuplicatedPoints"] = std::to_string(report.duplicatedPoints.size());
+      defects["PointsOutOfRange"] = std::to_string(report.pointsOutOfRange.size());
+      defects["FacetsOutOfRange"] = std::to_string(report.facetsOutOfRange.size());
+      defects["CorruptedFacets"] = std::to_string(report.corruptedFacets.size());
+      defects["DegeneratedFacets"] = std::to_string(report.degeneratedFacets.size());
+      defects["DuplicatedFacets"] = std::to_string(report.duplicatedFacets.size());
+      defects["FoldsOnSurface"] = std::to_string(report.foldsOnSurface.size());
+      defects["NonManifolds"] = std::to_string(report.nonManifolds.size());
+      defects["InvalidNeighbourhood"] = std::to_string(report.invalidNeighbourhood.size());
+      defects["NonUniformOrientedFacets"] = std::to_string(report.nonUniformOrientedFacets.size());
+      defects["SelfIntersections"] = std::to_string(report.selfIntersections.size());
+    }
+    Defects.setValues(defects);
+  }
+
+  Mesh::Feature::onChanged(prop);
+}
+
 // ----------------------------------------------------------------------
 
 PROPERTY_SOURCE(Mesh::HarmonizeNormals, Mesh::FixDefects)
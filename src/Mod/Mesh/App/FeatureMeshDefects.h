@@ -48,6 +48,8 @@ public:
   //@{
   App::PropertyLink   Source;
   App::PropertyFloat  Epsilon;
+  App::PropertyBool   Analyze;
+  App::PropertyMap    Defects;
   //@}
 
   /** @name methods override Feature */
@@ -57,6 +59,10 @@ public:
   short mustExecute() const;
   //@}
 
+protected:
+  /// updates the list of remaining defects of the resulting mesh
+  virtual void onChanged(const App::Property* prop);
+
   /// returns the type name of the ViewProvider
 //  virtual const char* getViewProviderName(void) const {return "MeshGui::ViewProviderDefects";}
 };
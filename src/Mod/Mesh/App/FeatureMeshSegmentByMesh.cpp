@@ -106,7 +106,7 @@ App::DocumentObjectExecReturn *SegmentByMesh::execute(void)
         return new App::DocumentObjectExecReturn("Toolmesh is not solid.\n");
     }
 
-    std::vector<unsigned long> faces;
+    std::vector<FacetIndex> faces;
     std::vector<MeshGeomFacet> aFaces;
 
     MeshAlgorithm cAlg(rMeshKernel);
@@ -121,11 +121,11 @@ App::DocumentObjectExecReturn *SegmentByMesh::execute(void)
         // so we need the nearest facet to the front clipping plane
         //
         float fDist = FLOAT_MAX;
-        unsigned long uIdx=ULONG_MAX;
+        FacetIndex uIdx=FACET_INDEX_MAX;
         MeshFacetIterator cFIt(rMeshKernel);
 
         // get the nearest facet to the user (front clipping plane)
-        for ( std::vector<unsigned long>::iterator it = faces.begin(); it != faces.end(); ++it ) {
+        for ( std::vector<FacetIndex>::iterator it = faces.begin(); it != faces.end(); ++it ) {
             cFIt.Set(*it);
             float dist = (float)fabs(cFIt->GetGravityPoint().DistanceToPlane( cBase, cNormal ));
             if ( dist < fDist ) {
@@ -135,7 +135,7 @@ App::DocumentObjectExecReturn *SegmentByMesh::execute(void)
         }
 
         // succeeded
-        if ( uIdx != ULONG_MAX ) {
+        if ( uIdx != FACET_INDEX_MAX ) {
             // set VISIT-Flag to all outer facets
             cAlg.SetFacetFlag( MeshFacet::VISIT );
             cAlg.ResetFacetsFlag(faces, MeshFacet::VISIT);
@@ -149,7 +149,7 @@ App::DocumentObjectExecReturn *SegmentByMesh::execute(void)
         }
     }
 
-    for ( std::vector<unsigned long>::iterator it = faces.begin(); it != faces.end(); ++it )
+    for ( std::vector<FacetIndex>::iterator it = faces.begin(); it != faces.end(); ++it )
         aFaces.push_back( rMeshKernel.GetFacet(*it) );
 
     std::unique_ptr<MeshObject> pcKernel(new MeshObject);
@@ -241,7 +241,7 @@ GtsSurface* GTSAlgos::createGTSSurface(const Mesh::MeshObject& Mesh)
                                       gts_edge_class (),
                                       gts_vertex_class () );
 
-  unsigned long p1,p2,p3;
+  PointIndex p1,p2,p3;
   Base::Vector3f Vertex;
 
 
@@ -53,6 +53,7 @@
 #include "Core/TrimByPlane.h"
 #include "Core/Visitor.h"
 #include "Core/Decimation.h"
+#include "Core/KDTree.h"
 
 #include "Mesh.h"
 #include "MeshPy.h"
@@ -139,6 +140,7 @@ void MeshObject::transformGeometry(const Base::Matrix4D &rclMat)
 
 void MeshObject::setTransform(const Base::Matrix4D& rclTrf)
 {
+    invalidateSearch();
     _Mtrx = rclTrf;
 }
 
@@ -147,6 +149,22 @@ Base::Matrix4D MeshObject::getTransform(void) const
     return _Mtrx;
 }
 
+void MeshObject::invalidateSearch()
+{
+    _searchTree.reset();
+}
+
+std::shared_ptr<const MeshCore::MeshKDTree> MeshObject::getSearchTree() const
+{
+    std::lock_guard<std::mutex> lock(_searchMutex);
+    if (!_searchTree) {
+        MeshCore::MeshPointArray points = _kernel.GetPoints();
+        points.Transform(_Mtrx);
+        _searchTree = std::make_shared<MeshCore::MeshKDTree>(points);
+    }
+    return _searchTree;
+}
+
 Base::BoundBox3d MeshObject::getBoundBox(void)const
 {
     const_cast<MeshCore::MeshKernel&>(_kernel).RecalcBoundBox();
@@ -183,6 +201,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 
 void MeshObject::operator = (const MeshObject& mesh)
 {
+    invalidateSearch();
     if (this != &mesh) {
         // copy the mesh structure
         setTransform(mesh._Mtrx);
@@ -193,12 +212,14 @@ void MeshObject::operator = (const MeshObject& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
+    invalidateSearch();
     this->_kernel = m;
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
+    invalidateSearch();
     this->_kernel.Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
@@ -207,6 +228,8 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
+    invalidateSearch();
+    mesh.invalidateSearch();
     this->_kernel.Swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp=this->_Mtrx;
@@ -266,7 +289,7 @@ double MeshObject::getVolume() const
     return _kernel.GetVolume();
 }
 
-MeshPoint MeshObject::getPoint(unsigned long index) const
+MeshPoint MeshObject::getPoint(MeshCore::PointIndex index) const
 {
     Base::Vector3f vertf = _kernel.GetPoint(index);
     Base::Vector3d vertd(vertf.x, vertf.y, vertf.z);
@@ -304,7 +327,7 @@ void MeshObject::getPoints(std::vector<Base::Vector3d> &Points,
     }
 }
 
-Mesh::Facet MeshObject::getFacet(unsigned long index) const
+Mesh::Facet MeshObject::getFacet(MeshCore::FacetIndex index) const
 {
     Mesh::Facet face(_kernel.GetFacets()[index], const_cast<MeshObject*>(this), index);
     return face;
@@ -333,7 +356,7 @@ void MeshObject::getFaces(std::vector<Base::Vector3d> &Points,std::vector<Facet>
 
 unsigned int MeshObject::getMemSize (void) const
 {
-    return _kernel.GetMemSize();
+    return static_cast<unsigned int>(_kernel.GetMemSize());
 }
 
 void MeshObject::Save (Base::Writer &/*writer*/) const
@@ -463,6 +486,7 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel,
                             const std::vector<std::string>& g)
 {
+    invalidateSearch();
     _kernel.Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
@@ -470,10 +494,10 @@ void MeshObject::swapKernel(MeshCore::MeshKernel& kernel,
     this->_segments.clear();
     const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
     MeshCore::MeshFacetArray::_TConstIterator it;
-    std::vector<unsigned long> segment;
+    std::vector<MeshCore::FacetIndex> segment;
     segment.reserve(faces.size());
     unsigned long prop = 0;
-    unsigned long index = 0;
+    MeshCore::FacetIndex index = 0;
     for (it = faces.begin(); it != faces.end(); ++it) {
         if (prop < it->_ulProp) {
             prop = it->_ulProp;
@@ -528,43 +552,57 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
-    _kernel.Read(in);
+    invalidateSearch();
+    std::string warnings = readKernel(in, _kernel);
     this->_segments.clear();
+    if (!warnings.empty())
+        Base::Console().Warning("%s", warnings.c_str());
+}
+
+std::string MeshObject::readKernel(std::istream& in, MeshCore::MeshKernel& kernel)
+{
+    std::string warnings;
+    kernel.Read(in);
 
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
+        MeshCore::MeshEvalNeighbourhood nb(kernel);
         if (!nb.Evaluate()) {
-            Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
-            Base::Console().Warning("fixed\n");
+            warnings += "Errors in neighbourhood of mesh found...";
+            kernel.RebuildNeighbours();
+            warnings += "fixed\n";
         }
 
-        MeshCore::MeshEvalTopology eval(_kernel);
+        MeshCore::MeshEvalTopology eval(kernel);
         if (!eval.Evaluate()) {
-            Base::Console().Warning("The mesh data structure has some defects\n");
+            warnings += "The mesh data structure has some defects\n";
         }
     }
     catch (const Base::MemoryException&) {
         // ignore memory exceptions and continue
-        Base::Console().Log("Check for defects in mesh data structure failed\n");
+        warnings += "Check for defects in mesh data structure failed\n";
     }
 #endif
+
+    return warnings;
 }
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
+    invalidateSearch();
     _kernel.AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateSearch();
     _kernel.AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet> &facets,
                            bool checkManifolds)
 {
+    invalidateSearch();
     _kernel.AddFacets(facets, checkManifolds);
 }
 
@@ -572,6 +610,7 @@ void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet> &facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
+    invalidateSearch();
     _kernel.AddFacets(facets, points, checkManifolds);
 }
 
@@ -579,6 +618,7 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet> &facet
                            const std::vector<Base::Vector3d>& points,
                            bool checkManifolds)
 {
+    invalidateSearch();
     std::vector<MeshCore::MeshFacet> facet_v;
     facet_v.reserve(facets.size());
     for (std::vector<Data::ComplexGeoData::Facet>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
@@ -601,12 +641,14 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet> &facet
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateSearch();
     _kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet> &facets,
                            const std::vector<Base::Vector3d>& points)
 {
+    invalidateSearch();
     MeshCore::MeshFacetArray facet_v;
     facet_v.reserve(facets.size());
     for (std::vector<Data::ComplexGeoData::Facet>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
@@ -629,45 +671,49 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet> &facet
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
+    invalidateSearch();
     _kernel.Merge(mesh._kernel);
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
+    invalidateSearch();
     _kernel.Merge(kernel);
 }
 
-void MeshObject::deleteFacets(const std::vector<unsigned long>& removeIndices)
+void MeshObject::deleteFacets(const std::vector<MeshCore::FacetIndex>& removeIndices)
 {
+    invalidateSearch();
     if (removeIndices.empty())
         return;
     _kernel.DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
-void MeshObject::deletePoints(const std::vector<unsigned long>& removeIndices)
+void MeshObject::deletePoints(const std::vector<MeshCore::PointIndex>& removeIndices)
 {
+    invalidateSearch();
     if (removeIndices.empty())
         return;
     _kernel.DeletePoints(removeIndices);
     this->_segments.clear();
 }
 
-void MeshObject::deletedFacets(const std::vector<unsigned long>& remFacets)
+void MeshObject::deletedFacets(const std::vector<MeshCore::FacetIndex>& remFacets)
 {
     if (remFacets.empty())
         return; // nothing has changed
     if (this->_segments.empty())
         return; // nothing to do
-    // set an array with the original indices and mark the removed as ULONG_MAX
-    std::vector<unsigned long> f_indices(_kernel.CountFacets()+remFacets.size());
-    for (std::vector<unsigned long>::const_iterator it = remFacets.begin();
+    // set an array with the original indices and mark the removed as MeshCore::FACET_INDEX_MAX
+    std::vector<MeshCore::FacetIndex> f_indices(_kernel.CountFacets()+remFacets.size());
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = remFacets.begin();
         it != remFacets.end(); ++it) {
-        f_indices[*it] = ULONG_MAX;
+        f_indices[*it] = MeshCore::FACET_INDEX_MAX;
     }
 
-    unsigned long index = 0;
-    for (std::vector<unsigned long>::iterator it = f_indices.begin();
+    MeshCore::FacetIndex index = 0;
+    for (std::vector<MeshCore::FacetIndex>::iterator it = f_indices.begin();
         it != f_indices.end(); ++it) {
             if (*it == 0)
                 *it = index++;
@@ -676,17 +722,17 @@ void MeshObject::deletedFacets(const std::vector<unsigned long>& remFacets)
     // the array serves now as LUT to set the new indices in the segments
     for (std::vector<Segment>::iterator it = this->_segments.begin();
         it != this->_segments.end(); ++it) {
-            std::vector<unsigned long> segm = it->_indices;
-            for (std::vector<unsigned long>::iterator jt = segm.begin();
+            std::vector<MeshCore::FacetIndex> segm = it->_indices;
+            for (std::vector<MeshCore::FacetIndex>::iterator jt = segm.begin();
                 jt != segm.end(); ++jt) {
                     *jt = f_indices[*jt];
             }
 
             // remove the invalid indices
             std::sort(segm.begin(), segm.end());
-            std::vector<unsigned long>::iterator ft = std::find_if
-                (segm.begin(), segm.end(), [](unsigned long v) {
-                    return v == ULONG_MAX;
+            std::vector<MeshCore::FacetIndex>::iterator ft = std::find_if
+                (segm.begin(), segm.end(), [](MeshCore::FacetIndex v) {
+                    return v == MeshCore::FACET_INDEX_MAX;
                 });
             if (ft != segm.end())
                 segm.erase(ft, segm.end());
@@ -696,14 +742,14 @@ void MeshObject::deletedFacets(const std::vector<unsigned long>& remFacets)
 
 void MeshObject::deleteSelectedFacets()
 {
-    std::vector<unsigned long> facets;
+    std::vector<MeshCore::FacetIndex> facets;
     MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
     deleteFacets(facets);
 }
 
 void MeshObject::deleteSelectedPoints()
 {
-    std::vector<unsigned long> points;
+    std::vector<MeshCore::PointIndex> points;
     MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
     deletePoints(points);
 }
@@ -718,32 +764,32 @@ void MeshObject::clearPointSelection() const
     MeshCore::MeshAlgorithm(this->_kernel).ResetPointFlag(MeshCore::MeshPoint::SELECTED);
 }
 
-void MeshObject::addFacetsToSelection(const std::vector<unsigned long>& inds) const
+void MeshObject::addFacetsToSelection(const std::vector<MeshCore::FacetIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).SetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
-void MeshObject::addPointsToSelection(const std::vector<unsigned long>& inds) const
+void MeshObject::addPointsToSelection(const std::vector<MeshCore::PointIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).SetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
-void MeshObject::removeFacetsFromSelection(const std::vector<unsigned long>& inds) const
+void MeshObject::removeFacetsFromSelection(const std::vector<MeshCore::FacetIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).ResetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
-void MeshObject::removePointsFromSelection(const std::vector<unsigned long>& inds) const
+void MeshObject::removePointsFromSelection(const std::vector<MeshCore::PointIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).ResetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
-void MeshObject::getFacetsFromSelection(std::vector<unsigned long>& inds) const
+void MeshObject::getFacetsFromSelection(std::vector<MeshCore::FacetIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
-void MeshObject::getPointsFromSelection(std::vector<unsigned long>& inds) const
+void MeshObject::getPointsFromSelection(std::vector<MeshCore::PointIndex>& inds) const
 {
     MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
@@ -768,14 +814,14 @@ bool MeshObject::hasSelectedPoints() const
     return (countSelectedPoints() > 0);
 }
 
-std::vector<unsigned long> MeshObject::getPointsFromFacets(const std::vector<unsigned long>& facets) const
+std::vector<MeshCore::PointIndex> MeshObject::getPointsFromFacets(const std::vector<MeshCore::FacetIndex>& facets) const
 {
     return _kernel.GetFacetPoints(facets);
 }
 
-void MeshObject::updateMesh(const std::vector<unsigned long>& facets)
+void MeshObject::updateMesh(const std::vector<MeshCore::FacetIndex>& facets)
 {
-    std::vector<unsigned long> points;
+    std::vector<MeshCore::PointIndex> points;
     points = _kernel.GetFacetPoints(facets);
 
     MeshCore::MeshAlgorithm alg(_kernel);
@@ -790,16 +836,16 @@ void MeshObject::updateMesh()
     alg.ResetPointFlag(MeshCore::MeshPoint::SEGMENT);
     for (std::vector<Segment>::iterator it = this->_segments.begin();
         it != this->_segments.end(); ++it) {
-            std::vector<unsigned long> points;
+            std::vector<MeshCore::PointIndex> points;
             points = _kernel.GetFacetPoints(it->getIndices());
             alg.SetFacetsFlag(it->getIndices(), MeshCore::MeshFacet::SEGMENT);
             alg.SetPointsFlag(points, MeshCore::MeshPoint::SEGMENT);
     }
 }
 
-std::vector<std::vector<unsigned long> > MeshObject::getComponents() const
+std::vector<std::vector<MeshCore::FacetIndex> > MeshObject::getComponents() const
 {
-    std::vector<std::vector<unsigned long> > segments;
+    std::vector<std::vector<MeshCore::FacetIndex> > segments;
     MeshCore::MeshComponents comp(_kernel);
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge,segments);
     return segments;
@@ -807,7 +853,7 @@ std::vector<std::vector<unsigned long> > MeshObject::getComponents() const
 
 unsigned long MeshObject::countComponents() const
 {
-    std::vector<std::vector<unsigned long> > segments;
+    std::vector<std::vector<MeshCore::FacetIndex> > segments;
     MeshCore::MeshComponents comp(_kernel);
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge,segments);
     return segments.size();
@@ -815,13 +861,14 @@ unsigned long MeshObject::countComponents() const
 
 void MeshObject::removeComponents(unsigned long count)
 {
-    std::vector<unsigned long> removeIndices;
+    invalidateSearch();
+    std::vector<MeshCore::FacetIndex> removeIndices;
     MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
     _kernel.DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
-unsigned long MeshObject::getPointDegree(const std::vector<unsigned long>& indices,
+unsigned long MeshObject::getPointDegree(const std::vector<MeshCore::FacetIndex>& indices,
                                          std::vector<unsigned long>& point_degree) const
 {
     const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
@@ -833,7 +880,7 @@ unsigned long MeshObject::getPointDegree(const std::vector<unsigned long>& indic
         pointDeg[it->_aulPoints[2]]++;
     }
 
-    for (std::vector<unsigned long>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
         const MeshCore::MeshFacet& face = faces[*it];
         pointDeg[face._aulPoints[0]]--;
         pointDeg[face._aulPoints[1]]--;
@@ -851,13 +898,15 @@ unsigned long MeshObject::getPointDegree(const std::vector<unsigned long>& indic
 void MeshObject::fillupHoles(unsigned long length, int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
-    std::list<std::vector<unsigned long> > aFailed;
+    invalidateSearch();
+    std::list<std::vector<MeshCore::PointIndex> > aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
 }
 
 void MeshObject::offset(float fSize)
 {
+    invalidateSearch();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -870,10 +919,11 @@ void MeshObject::offset(float fSize)
 
 void MeshObject::offsetSpecial2(float fSize)
 {
+    invalidateSearch();
     Base::Builder3D builder;  
     std::vector<Base::Vector3f> PointNormals= _kernel.CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
-    std::set<unsigned long> fliped;
+    std::set<MeshCore::FacetIndex> fliped;
 
     MeshCore::MeshFacetIterator it(_kernel);
     for (it.Init(); it.More(); it.Next())
@@ -908,7 +958,7 @@ void MeshObject::offsetSpecial2(float fSize)
         if (fliped.size() == 0)
             break;
       
-        for( std::set<unsigned long>::iterator It= fliped.begin();It!=fliped.end();++It)
+        for( std::set<MeshCore::FacetIndex>::iterator It= fliped.begin();It!=fliped.end();++It)
             alg.CollapseFacet(*It);
         fliped.clear();
     }
@@ -917,13 +967,14 @@ void MeshObject::offsetSpecial2(float fSize)
 
     // search for intersected facets
     MeshCore::MeshEvalSelfIntersection eval(_kernel);
-    std::vector<std::pair<unsigned long, unsigned long> > faces;
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > faces;
     eval.GetIntersections(faces);
     builder.saveToLog();
 }
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
+    invalidateSearch();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -964,8 +1015,9 @@ Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
     return cMeshEval.Transform();
 }
 
-void MeshObject::movePoint(unsigned long index, const Base::Vector3d& v)
+void MeshObject::movePoint(MeshCore::PointIndex index, const Base::Vector3d& v)
 {
+    invalidateSearch();
     // v is a vector, hence we must not apply the translation part
     // of the transformation to the vector
     Base::Vector3d vec(v);
@@ -975,29 +1027,33 @@ void MeshObject::movePoint(unsigned long index, const Base::Vector3d& v)
     _kernel.MovePoint(index,transformToInside(vec));
 }
 
-void MeshObject::setPoint(unsigned long index, const Base::Vector3d& p)
+void MeshObject::setPoint(MeshCore::PointIndex index, const Base::Vector3d& p)
 {
+    invalidateSearch();
     _kernel.SetPoint(index,transformToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    invalidateSearch();
     _kernel.Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
+    invalidateSearch();
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
+    invalidateSearch();
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(targetSize);
 }
 
-Base::Vector3d MeshObject::getPointNormal(unsigned long index) const
+Base::Vector3d MeshObject::getPointNormal(MeshCore::PointIndex index) const
 {
     std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
     Base::Vector3d normal = transformToOutside(temp[index]);
@@ -1049,8 +1105,9 @@ void MeshObject::crossSections(const std::vector<MeshObject::TPlane>& planes, st
 void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj, MeshObject::CutType type)
 {
+    invalidateSearch();
     MeshCore::MeshAlgorithm meshAlg(this->_kernel);
-    std::vector<unsigned long> check;
+    std::vector<MeshCore::FacetIndex> check;
 
     bool inner;
     switch (type) {
@@ -1074,8 +1131,9 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
 void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj, MeshObject::CutType type)
 {
+    invalidateSearch();
     MeshCore::MeshTrimming trim(this->_kernel, &proj, polygon2d);
-    std::vector<unsigned long> check;
+    std::vector<MeshCore::FacetIndex> check;
     std::vector<MeshCore::MeshGeomFacet> triangle;
 
     switch (type) {
@@ -1098,8 +1156,9 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
 
 void MeshObject::trim(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
+    invalidateSearch();
     MeshCore::MeshTrimByPlane trim(this->_kernel);
-    std::vector<unsigned long> trimFacets, removeFacets;
+    std::vector<MeshCore::FacetIndex> trimFacets, removeFacets;
     std::vector<MeshCore::MeshGeomFacet> triangle;
 
     MeshCore::MeshFacetGrid meshGrid(this->_kernel);
@@ -1178,6 +1237,7 @@ MeshObject* MeshObject::outer(const MeshObject& mesh) const
 
 void MeshObject::refine()
 {
+    invalidateSearch();
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1196,6 +1256,7 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshRemoveNeedles eval(_kernel, length);
     eval.Fixup();
@@ -1205,12 +1266,14 @@ void MeshObject::removeNeedles(float length)
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
+    invalidateSearch();
     MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0f)
         topalg.OptimizeTopology(fMaxAngle);
@@ -1224,19 +1287,21 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
-    std::vector<std::pair<unsigned long, unsigned long> > adjacentFacet;
+    invalidateSearch();
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > adjacentFacet;
     MeshCore::MeshAlgorithm alg(_kernel);
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
     const MeshCore::MeshFacetArray& rFacets = _kernel.GetFacets();
     for (MeshCore::MeshFacetArray::_TConstIterator pF = rFacets.begin(); pF != rFacets.end(); ++pF) {
         int id=2;
-        if (pF->_aulNeighbours[id] != ULONG_MAX) {
+        if (pF->_aulNeighbours[id] != MeshCore::FACET_INDEX_MAX) {
             const MeshCore::MeshFacet& rFace = rFacets[pF->_aulNeighbours[id]];
             if (!pF->IsFlag(MeshCore::MeshFacet::VISIT) && !rFace.IsFlag(MeshCore::MeshFacet::VISIT)) {
                 pF->SetFlag(MeshCore::MeshFacet::VISIT);
@@ -1248,7 +1313,7 @@ void MeshObject::splitEdges()
 
     MeshCore::MeshFacetIterator cIter(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
-    for (std::vector<std::pair<unsigned long, unsigned long> >::iterator it = adjacentFacet.begin(); it != adjacentFacet.end(); ++it) {
+    for (std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> >::iterator it = adjacentFacet.begin(); it != adjacentFacet.end(); ++it) {
         cIter.Set(it->first);
         Base::Vector3f mid = 0.5f*(cIter->_aclPoints[0]+cIter->_aclPoints[2]);
         topalg.SplitEdge(it->first, it->second, mid);
@@ -1259,63 +1324,70 @@ void MeshObject::splitEdges()
     this->_segments.clear();
 }
 
-void MeshObject::splitEdge(unsigned long facet, unsigned long neighbour, const Base::Vector3f& v)
+void MeshObject::splitEdge(MeshCore::FacetIndex facet, MeshCore::FacetIndex neighbour, const Base::Vector3f& v)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitEdge(facet, neighbour, v);
 }
 
-void MeshObject::splitFacet(unsigned long facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
+void MeshObject::splitFacet(MeshCore::FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitFacet(facet, v1, v2);
 }
 
-void MeshObject::swapEdge(unsigned long facet, unsigned long neighbour)
+void MeshObject::swapEdge(MeshCore::FacetIndex facet, MeshCore::FacetIndex neighbour)
 {
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SwapEdge(facet, neighbour);
 }
 
-void MeshObject::collapseEdge(unsigned long facet, unsigned long neighbour)
+void MeshObject::collapseEdge(MeshCore::FacetIndex facet, MeshCore::FacetIndex neighbour)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseEdge(facet, neighbour);
 
-    std::vector<unsigned long> remFacets;
+    std::vector<MeshCore::FacetIndex> remFacets;
     remFacets.push_back(facet);
     remFacets.push_back(neighbour);
     deletedFacets(remFacets);
 }
 
-void MeshObject::collapseFacet(unsigned long facet)
+void MeshObject::collapseFacet(MeshCore::FacetIndex facet)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseFacet(facet);
 
-    std::vector<unsigned long> remFacets;
+    std::vector<MeshCore::FacetIndex> remFacets;
     remFacets.push_back(facet);
     deletedFacets(remFacets);
 }
 
-void MeshObject::collapseFacets(const std::vector<unsigned long>& facets)
+void MeshObject::collapseFacets(const std::vector<MeshCore::FacetIndex>& facets)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
-    for (std::vector<unsigned long>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
         alg.CollapseFacet(*it);
     }
 
     deletedFacets(facets);
 }
 
-void MeshObject::insertVertex(unsigned long facet, const Base::Vector3f& v)
+void MeshObject::insertVertex(MeshCore::FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.InsertVertex(facet, v);
 }
 
-void MeshObject::snapVertex(unsigned long facet, const Base::Vector3f& v)
+void MeshObject::snapVertex(MeshCore::FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateSearch();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SnapVertex(facet, v);
 }
@@ -1323,7 +1395,7 @@ void MeshObject::snapVertex(unsigned long facet, const Base::Vector3f& v)
 unsigned long MeshObject::countNonUniformOrientedFacets() const
 {
     MeshCore::MeshEvalOrientation cMeshEval(_kernel);
-    std::vector<unsigned long> inds = cMeshEval.GetIndices();
+    std::vector<MeshCore::FacetIndex> inds = cMeshEval.GetIndices();
     return inds.size();
 }
 
@@ -1347,6 +1419,7 @@ bool MeshObject::hasNonManifolds() const
 
 void MeshObject::removeNonManifolds()
 {
+    invalidateSearch();
     MeshCore::MeshEvalTopology f_eval(_kernel);
     if (!f_eval.Evaluate()) {
         MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
@@ -1357,9 +1430,10 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
+    invalidateSearch();
     MeshCore::MeshEvalPointManifolds p_eval(_kernel);
     if (!p_eval.Evaluate()) {
-        std::vector<unsigned long> faces;
+        std::vector<MeshCore::FacetIndex> faces;
         p_eval.GetFacetIndices(faces);
         deleteFacets(faces);
     }
@@ -1373,7 +1447,8 @@ bool MeshObject::hasSelfIntersections() const
 
 void MeshObject::removeSelfIntersections()
 {
-    std::vector<std::pair<unsigned long, unsigned long> > selfIntersections;
+    invalidateSearch();
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > selfIntersections;
     MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
     cMeshEval.GetIntersections(selfIntersections);
 
@@ -1383,19 +1458,20 @@ void MeshObject::removeSelfIntersections()
     }
 }
 
-void MeshObject::removeSelfIntersections(const std::vector<unsigned long>& indices)
+void MeshObject::removeSelfIntersections(const std::vector<MeshCore::FacetIndex>& indices)
 {
+    invalidateSearch();
     // make sure that the number of indices is even and are in range
     if (indices.size() % 2 != 0)
         return;
     unsigned long cntfacets = _kernel.CountFacets();
     if (std::find_if(indices.begin(), indices.end(), [cntfacets](unsigned long v) { return v >= cntfacets; }) < indices.end())
         return;
-    std::vector<std::pair<unsigned long, unsigned long> > selfIntersections;
-    std::vector<unsigned long>::const_iterator it;
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > selfIntersections;
+    std::vector<MeshCore::FacetIndex>::const_iterator it;
     for (it = indices.begin(); it != indices.end(); ) {
-        unsigned long id1 = *it; ++it;
-        unsigned long id2 = *it; ++it;
+        MeshCore::FacetIndex id1 = *it; ++it;
+        MeshCore::FacetIndex id2 = *it; ++it;
         selfIntersections.emplace_back(id1,id2);
     }
 
@@ -1408,15 +1484,16 @@ void MeshObject::removeSelfIntersections(const std::vector<unsigned long>& indic
 
 void MeshObject::removeFoldsOnSurface()
 {
-    std::vector<unsigned long> indices;
+    invalidateSearch();
+    std::vector<MeshCore::FacetIndex> indices;
     MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
     MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
 
     f_eval.Evaluate();
-    std::vector<unsigned long> inds  = f_eval.GetIndices();
+    std::vector<MeshCore::FacetIndex> inds  = f_eval.GetIndices();
 
     s_eval.Evaluate();
-    std::vector<unsigned long> inds1 = s_eval.GetIndices();
+    std::vector<MeshCore::FacetIndex> inds1 = s_eval.GetIndices();
 
     // remove duplicates
     inds.insert(inds.end(), inds1.begin(), inds1.end());
@@ -1439,7 +1516,8 @@ void MeshObject::removeFoldsOnSurface()
 
 void MeshObject::removeFullBoundaryFacets()
 {
-    std::vector<unsigned long> facets;
+    invalidateSearch();
+    std::vector<MeshCore::FacetIndex> facets;
     if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
         deleteFacets(facets);
     }
@@ -1453,12 +1531,21 @@ bool MeshObject::hasInvalidPoints() const
 
 void MeshObject::removeInvalidPoints()
 {
+    invalidateSearch();
     MeshCore::MeshEvalNaNPoints nan(_kernel);
     deletePoints(nan.GetIndices());
 }
 
+MeshCore::MeshDefectReport MeshObject::analyzeDefects(float fEps) const
+{
+    MeshCore::MeshEvalDefects eval(_kernel, fEps);
+    eval.Evaluate();
+    return eval.GetReport();
+}
+
 void MeshObject::mergeFacets()
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixMergeFacets merge(_kernel);
     merge.Fixup();
@@ -1468,6 +1555,7 @@ void MeshObject::mergeFacets()
 
 void MeshObject::validateIndices()
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
 
     // for invalid neighbour indices we don't need to check first
@@ -1523,6 +1611,7 @@ bool MeshObject::hasCorruptedFacets() const
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDeformedFacets eval(_kernel,
                                          Base::toRadians(15.0f),
@@ -1535,6 +1624,7 @@ void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 
 void MeshObject::validateDegenerations(float fEps)
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
     eval.Fixup();
@@ -1544,6 +1634,7 @@ void MeshObject::validateDegenerations(float fEps)
 
 void MeshObject::removeDuplicatedPoints()
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicatePoints eval(_kernel);
     eval.Fixup();
@@ -1553,6 +1644,7 @@ void MeshObject::removeDuplicatedPoints()
 
 void MeshObject::removeDuplicatedFacets()
 {
+    invalidateSearch();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicateFacets eval(_kernel);
     eval.Fixup();
@@ -1791,10 +1883,10 @@ void MeshObject::addSegment(const Segment& s)
     this->_segments.back()._modifykernel = s._modifykernel;
 }
 
-void MeshObject::addSegment(const std::vector<unsigned long>& inds)
+void MeshObject::addSegment(const std::vector<MeshCore::FacetIndex>& inds)
 {
     unsigned long maxIndex = _kernel.CountFacets();
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         if (*it >= maxIndex)
             throw Base::IndexError("Index out of range");
     }
@@ -1812,13 +1904,13 @@ Segment& MeshObject::getSegment(unsigned long index)
     return this->_segments[index];
 }
 
-MeshObject* MeshObject::meshFromSegment(const std::vector<unsigned long>& indices) const
+MeshObject* MeshObject::meshFromSegment(const std::vector<MeshCore::FacetIndex>& indices) const
 {
     MeshCore::MeshFacetArray facets;
     facets.reserve(indices.size());
     const MeshCore::MeshPointArray& kernel_p = _kernel.GetPoints();
     const MeshCore::MeshFacetArray& kernel_f = _kernel.GetFacets();
-    for (std::vector<unsigned long>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
         facets.push_back(kernel_f[*it]);
     }
 
@@ -1871,7 +1963,7 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
 
 // ----------------------------------------------------------------------------
 
-MeshObject::const_point_iterator::const_point_iterator(const MeshObject* mesh, unsigned long index)
+MeshObject::const_point_iterator::const_point_iterator(const MeshObject* mesh, MeshCore::PointIndex index)
   : _mesh(mesh), _p_it(mesh->getKernel())
 {
     this->_p_it.Set(index);
@@ -1940,7 +2032,7 @@ MeshObject::const_point_iterator& MeshObject::const_point_iterator::operator--()
 
 // ----------------------------------------------------------------------------
 
-MeshObject::const_facet_iterator::const_facet_iterator(const MeshObject* mesh, unsigned long index)
+MeshObject::const_facet_iterator::const_facet_iterator(const MeshObject* mesh, MeshCore::FacetIndex index)
   : _mesh(mesh), _f_it(mesh->getKernel())
 {
     this->_f_it.Set(index);
@@ -29,6 +29,8 @@
 #include <set>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include <Base/Matrix.h>
 #include <Base/Vector3D.h>
@@ -56,6 +58,8 @@ namespace Base {
 
 namespace MeshCore {
 class AbstractPolygonTriangulator;
+class MeshKDTree;
+struct MeshDefectReport;
 }
 
 namespace Mesh
@@ -123,8 +127,8 @@ public:
     unsigned long countEdges () const;
     unsigned long countSegments() const;
     bool isSolid() const;
-    MeshPoint getPoint(unsigned long) const;
-    Mesh::Facet getFacet(unsigned long) const;
+    MeshPoint getPoint(MeshCore::PointIndex) const;
+    Mesh::Facet getFacet(MeshCore::FacetIndex) const;
     double getSurface() const;
     double getVolume() const;
     /** Get points from object with given accuracy */
@@ -133,16 +137,21 @@ public:
         float Accuracy, uint16_t flags=0) const;
     virtual void getFaces(std::vector<Base::Vector3d> &Points,std::vector<Facet> &Topo,
         float Accuracy, uint16_t flags=0) const;
-    std::vector<unsigned long> getPointsFromFacets(const std::vector<unsigned long>& facets) const;
+    std::vector<MeshCore::PointIndex> getPointsFromFacets(const std::vector<MeshCore::FacetIndex>& facets) const;
     //@}
 
     void setKernel(const MeshCore::MeshKernel& m);
+    /// The kernel may be modified through the returned reference, so the search tree is dropped
     MeshCore::MeshKernel& getKernel(void)
-    { return _kernel; }
+    { invalidateSearch(); return _kernel; }
     const MeshCore::MeshKernel& getKernel(void) const
     { return _kernel; }
 
     virtual Base::BoundBox3d getBoundBox(void)const;
+    /** Returns a kd-tree of the transformed points for the batched searches. The tree is
+     * kept until the points or the transformation are changed.
+     */
+    std::shared_ptr<const MeshCore::MeshKDTree> getSearchTree() const;
 
     /** @name I/O */
     //@{
@@ -163,6 +172,10 @@ public:
     // Save and load in internal format
     void save(std::ostream&) const;
     void load(std::istream&);
+    /** Reads a kernel in internal format and checks its data structure. The warnings
+     * are returned instead of printed, so that this can be used in a worker thread.
+     */
+    static std::string readKernel(std::istream&, MeshCore::MeshKernel&);
     //@}
 
     /** @name Manipulation */
@@ -192,9 +205,9 @@ public:
      * this mesh object.
      */
     void addMesh(const MeshCore::MeshKernel&);
-    void deleteFacets(const std::vector<unsigned long>& removeIndices);
-    void deletePoints(const std::vector<unsigned long>& removeIndices);
-    std::vector<std::vector<unsigned long> > getComponents() const;
+    void deleteFacets(const std::vector<MeshCore::FacetIndex>& removeIndices);
+    void deletePoints(const std::vector<MeshCore::PointIndex>& removeIndices);
+    std::vector<std::vector<MeshCore::FacetIndex> > getComponents() const;
     unsigned long countComponents() const;
     void removeComponents(unsigned long);
     /**
@@ -203,7 +216,7 @@ public:
      * The point degree information is stored in \a point_degree. The return value
      * gives the number of points which will have a degree of zero.
      */
-    unsigned long getPointDegree(const std::vector<unsigned long>& facets,
+    unsigned long getPointDegree(const std::vector<MeshCore::FacetIndex>& facets,
         std::vector<unsigned long>& point_degree) const;
     void fillupHoles(unsigned long, int, MeshCore::AbstractPolygonTriangulator&);
     void offset(float fSize);
@@ -213,12 +226,12 @@ public:
     void clear(void);
     void transformToEigenSystem();
     Base::Matrix4D getEigenSystem(Base::Vector3d& v) const;
-    void movePoint(unsigned long, const Base::Vector3d& v);
-    void setPoint(unsigned long, const Base::Vector3d& v);
+    void movePoint(MeshCore::PointIndex, const Base::Vector3d& v);
+    void setPoint(MeshCore::PointIndex, const Base::Vector3d& v);
     void smooth(int iterations, float d_max);
     void decimate(float fTolerance, float fReduction);
     void decimate(int targetSize);
-    Base::Vector3d getPointNormal(unsigned long) const;
+    Base::Vector3d getPointNormal(MeshCore::PointIndex) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(const std::vector<TPlane>&, std::vector<TPolylines> &sections,
                        float fMinEps = 1.0e-2f, bool bConnectPolygons = false) const;
@@ -231,16 +244,16 @@ public:
     //@{
     void deleteSelectedFacets();
     void deleteSelectedPoints();
-    void addFacetsToSelection(const std::vector<unsigned long>&) const;
-    void addPointsToSelection(const std::vector<unsigned long>&) const;
-    void removeFacetsFromSelection(const std::vector<unsigned long>&) const;
-    void removePointsFromSelection(const std::vector<unsigned long>&) const;
+    void addFacetsToSelection(const std::vector<MeshCore::FacetIndex>&) const;
+    void addPointsToSelection(const std::vector<MeshCore::PointIndex>&) const;
+    void removeFacetsFromSelection(const std::vector<MeshCore::FacetIndex>&) const;
+    void removePointsFromSelection(const std::vector<MeshCore::PointIndex>&) const;
     unsigned long countSelectedFacets() const;
     bool hasSelectedFacets() const;
     unsigned long countSelectedPoints() const;
     bool hasSelectedPoints() const;
-    void getFacetsFromSelection(std::vector<unsigned long>&) const;
-    void getPointsFromSelection(std::vector<unsigned long>&) const;
+    void getFacetsFromSelection(std::vector<MeshCore::FacetIndex>&) const;
+    void getPointsFromSelection(std::vector<MeshCore::PointIndex>&) const;
     void clearFacetSelection() const;
     void clearPointSelection() const;
     //@}
@@ -261,14 +274,14 @@ public:
     void optimizeTopology(float);
     void optimizeEdges();
     void splitEdges();
-    void splitEdge(unsigned long, unsigned long, const Base::Vector3f&);
-    void splitFacet(unsigned long, const Base::Vector3f&, const Base::Vector3f&);
-    void swapEdge(unsigned long, unsigned long);
-    void collapseEdge(unsigned long, unsigned long);
-    void collapseFacet(unsigned long);
-    void collapseFacets(const std::vector<unsigned long>&);
-    void insertVertex(unsigned long, const Base::Vector3f& v);
-    void snapVertex(unsigned long, const Base::Vector3f& v);
+    void splitEdge(MeshCore::FacetIndex, MeshCore::FacetIndex, const Base::Vector3f&);
+    void splitFacet(MeshCore::FacetIndex, const Base::Vector3f&, const Base::Vector3f&);
+    void swapEdge(MeshCore::FacetIndex, MeshCore::FacetIndex);
+    void collapseEdge(MeshCore::FacetIndex, MeshCore::FacetIndex);
+    void collapseFacet(MeshCore::FacetIndex);
+    void collapseFacets(const std::vector<MeshCore::FacetIndex>&);
+    void insertVertex(MeshCore::FacetIndex, const Base::Vector3f& v);
+    void snapVertex(MeshCore::FacetIndex, const Base::Vector3f& v);
     //@}
 
     /** @name Mesh validation */
@@ -291,21 +304,23 @@ public:
     void removeNonManifoldPoints();
     bool hasSelfIntersections() const;
     void removeSelfIntersections();
-    void removeSelfIntersections(const std::vector<unsigned long>&);
+    void removeSelfIntersections(const std::vector<MeshCore::FacetIndex>&);
     void removeFoldsOnSurface();
     void removeFullBoundaryFacets();
     bool hasInvalidPoints() const;
     void removeInvalidPoints();
     void mergeFacets();
+    /// Runs all read-only checks in parallel and returns the found defects
+    MeshCore::MeshDefectReport analyzeDefects(float fEps) const;
     //@}
 
     /** @name Mesh segments */
     //@{
     void addSegment(const Segment&);
-    void addSegment(const std::vector<unsigned long>&);
+    void addSegment(const std::vector<MeshCore::FacetIndex>&);
     const Segment& getSegment(unsigned long) const;
     Segment& getSegment(unsigned long);
-    MeshObject* meshFromSegment(const std::vector<unsigned long>&) const;
+    MeshObject* meshFromSegment(const std::vector<MeshCore::FacetIndex>&) const;
     std::vector<Segment> getSegmentsOfType(GeometryType, float dev, unsigned long minFacets) const;
     //@}
 
@@ -325,7 +340,7 @@ public:
     class MeshExport const_point_iterator
     {
     public:
-        const_point_iterator(const MeshObject*, unsigned long index);
+        const_point_iterator(const MeshObject*, MeshCore::PointIndex index);
         const_point_iterator(const const_point_iterator& pi);
         ~const_point_iterator();
 
@@ -346,7 +361,7 @@ public:
     class MeshExport const_facet_iterator
     {
     public:
-        const_facet_iterator(const MeshObject*, unsigned long index);
+        const_facet_iterator(const MeshObject*, MeshCore::FacetIndex index);
         const_facet_iterator(const const_facet_iterator& fi);
         ~const_facet_iterator();
 
@@ -387,17 +402,21 @@ public:
     friend class Segment;
 
 private:
-    void deletedFacets(const std::vector<unsigned long>& remFacets);
-    void updateMesh(const std::vector<unsigned long>&);
+    void deletedFacets(const std::vector<MeshCore::FacetIndex>& remFacets);
+    void updateMesh(const std::vector<MeshCore::FacetIndex>&);
     void updateMesh();
     void swapKernel(MeshCore::MeshKernel& m, const std::vector<std::string>& g);
     void copySegments(const MeshObject&);
     void swapSegments(MeshObject&);
+    /// Drops the search tree, must be called whenever the points or the transformation change
+    void invalidateSearch();
 
 private:
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    mutable std::mutex _searchMutex;
+    mutable std::shared_ptr<MeshCore::MeshKDTree> _searchTree;
     static float Epsilon;
 };
 
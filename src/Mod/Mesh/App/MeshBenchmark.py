@@ -0,0 +1,110 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Measures the memory and build time of the mesh kernel on tessellated spheres.
+
+    import MeshBenchmark
+    MeshBenchmark.run()
+
+prints for every sampling of the sphere the number of facets, the bytes of
+points and facets per triangle and the time to build the kernel and its
+topology from point and facet indices. Running it on a build with
+FREECAD_USE_MESH_COMPACT_INDICES and on one without shows what the 32-bit
+indices save.
+
+    MeshBenchmark.runTransform()
+
+times the transformation of the sphere points, to compare builds before and
+after a change of the transformation code.
+
+    MeshBenchmark.runAdjacency()
+
+prints the build time and the memory of the adjacency structures in
+compressed row storage next to the set based ones.
+"""
+
+import time
+import FreeCAD, Mesh
+
+App = FreeCAD
+
+def measureSphere(sampling):
+    """Return the number of facets, the bytes per facet and the time of
+    rebuilding the kernel of a sphere with the given sampling."""
+    sphere = Mesh.createSphere(10.0, sampling)
+    points, facets = sphere.Topology
+
+    start = time.time()
+    mesh = Mesh.Mesh((points, facets))
+    build = time.time() - start
+
+    count = mesh.CountFacets
+    return count, float(mesh.MemSize) / max(1, count), build
+
+def run(samplings=(50, 100, 200, 500, 1000)):
+    """Print the memory per triangle and the build time for the given samplings"""
+    App.Console.PrintMessage("%12s %18s %12s\n" % ("facets", "bytes per facet", "build [s]"))
+    for sampling in samplings:
+        count, size, build = measureSphere(sampling)
+        App.Console.PrintMessage("%12d %18.1f %12.3f\n" % (count, size, build))
+
+def measureTransform(sampling, repeat):
+    """Return the number of points and the average time of transforming the
+    points of a sphere with the given sampling."""
+    mesh = Mesh.createSphere(10.0, sampling)
+    mat = App.Matrix()
+    mat.rotateX(0.3)
+    mat.rotateZ(1.1)
+    mat.move(App.Vector(1.0, 2.0, 3.0))
+
+    start = time.time()
+    for i in range(repeat):
+        mesh.transform(mat)
+    elapsed = time.time() - start
+    return mesh.CountPoints, elapsed / repeat
+
+def runTransform(samplings=(200, 500, 1000, 2000), repeat=10):
+    """Print the time of transforming the points of spheres with the given samplings"""
+    App.Console.PrintMessage("%12s %14s %16s\n" % ("points", "transform [s]", "Mpoints/s"))
+    for sampling in samplings:
+        count, elapsed = measureTransform(sampling, repeat)
+        App.Console.PrintMessage("%12d %14.4f %16.1f\n" % (count, elapsed, count / max(elapsed, 1e-9) / 1.0e6))
+
+def measureAdjacency(mesh, kind, compressed):
+    """Return the time of building the adjacency structure of the given kind
+    and the number of bytes it uses."""
+    start = time.time()
+    size = mesh.getAdjacencyMemSize(kind, compressed)
+    return time.time() - start, size
+
+def runAdjacency(samplings=(200, 500, 1000)):
+    """Print the build time and memory of the compressed and the set based
+    adjacency structures for spheres with the given samplings"""
+    App.Console.PrintMessage("%12s %14s %12s %12s %14s %14s\n" %
+        ("facets", "type", "csr [s]", "set [s]", "csr [bytes]", "set [bytes]"))
+    for sampling in samplings:
+        mesh = Mesh.createSphere(10.0, sampling)
+        for kind in ("PointToFacets", "PointToPoints", "FacetToFacets"):
+            csrTime, csrSize = measureAdjacency(mesh, kind, True)
+            setTime, setSize = measureAdjacency(mesh, kind, False)
+            App.Console.PrintMessage("%12d %14s %12.3f %12.3f %14d %14d\n" %
+                (mesh.CountFacets, kind, csrTime, setTime, csrSize, setSize))
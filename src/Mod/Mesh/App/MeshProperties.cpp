@@ -29,6 +29,7 @@
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
+#include <Base/Parallel.h>
 #include <Base/Writer.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
@@ -218,9 +219,9 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D &mat)
     aboutToSetValue();
 
     // Rotate the normal vectors
-    for (int ii=0; ii<getSize(); ii++) {
-        set1Value(ii, rot * operator[](ii));
-    }
+    Base::parallel_for<std::size_t>(_lValueList.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        rot.multVec(_lValueList.data() + begin, end - begin);
+    });
 
     hasSetValue();
 }
@@ -325,13 +326,11 @@ void PropertyCurvatureList::transformGeometry(const Base::Matrix4D &mat)
     aboutToSetValue();
 
     // Rotate the principal directions
-    for (int ii=0; ii<getSize(); ii++)
-    {
-        CurvatureInfo ci = operator[](ii);
-        ci.cMaxCurvDir = rot * ci.cMaxCurvDir;
-        ci.cMinCurvDir = rot * ci.cMinCurvDir;
-        _lValueList[ii] = ci;
-    }
+    Base::parallel_for<std::size_t>(_lValueList.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        CurvatureInfo* ci = _lValueList.data() + begin;
+        rot.multVec(&ci->cMaxCurvDir, end - begin, sizeof(CurvatureInfo));
+        rot.multVec(&ci->cMinCurvDir, end - begin, sizeof(CurvatureInfo));
+    });
 
     hasSetValue();
 }
@@ -624,6 +623,32 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader &reader)
     hasSetValue();
 }
 
+bool PropertyMeshKernel::isSaveDocFileConcurrent() const
+{
+    return true;
+}
+
+bool PropertyMeshKernel::isRestoreDocFileConcurrent() const
+{
+    return true;
+}
+
+std::function<void()> PropertyMeshKernel::RestoreDocFileConcurrent(Base::Reader &reader)
+{
+    // The kernel is read and checked in a worker thread, but it's set and
+    // the warnings are printed in the main thread
+    std::shared_ptr<MeshCore::MeshKernel> kernel = std::make_shared<MeshCore::MeshKernel>();
+    std::string warnings = MeshObject::readKernel(reader, *kernel);
+
+    return [this, kernel, warnings]() {
+        if (!warnings.empty())
+            Base::Console().Warning("%s", warnings.c_str());
+        aboutToSetValue();
+        _meshObject->swap(*kernel);
+        hasSetValue();
+    };
+}
+
 App::Property *PropertyMeshKernel::Copy(void) const
 {
     // Note: Copy the content, do NOT reference the same mesh object
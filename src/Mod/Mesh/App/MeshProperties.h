@@ -244,6 +244,9 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const;
     void RestoreDocFile(Base::Reader &reader);
+    bool isSaveDocFileConcurrent() const;
+    bool isRestoreDocFileConcurrent() const;
+    std::function<void()> RestoreDocFileConcurrent(Base::Reader &reader);
 
     App::Property *Copy(void) const;
     void Paste(const App::Property &from);
@@ -28,6 +28,7 @@
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 #include <Base/Tools.h>
 
@@ -47,6 +48,7 @@
 #include "Core/Segmentation.h"
 #include "Core/Smoothing.h"
 #include "Core/Curvature.h"
+#include "Core/KDTree.h"
 
 #include <boost/algorithm/string.hpp>
 
@@ -752,7 +754,7 @@ PyObject* MeshPy::removeFacets(PyObject *args)
     if (!PyArg_ParseTuple(args, "O", &list))
         return 0;
 
-    std::vector<unsigned long> indices;
+    std::vector<MeshCore::FacetIndex> indices;
     Py::Sequence ary(list);
     for (Py::Sequence::iterator it = ary.begin(); it != ary.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
@@ -776,11 +778,11 @@ PyObject* MeshPy::getInternalFacets(PyObject *args)
     MeshCore::MeshEvalInternalFacets eval(kernel);
     eval.Evaluate();
 
-    const std::vector<unsigned long>& indices = eval.GetIndices();
+    const std::vector<MeshCore::FacetIndex>& indices = eval.GetIndices();
     Py::List ary(indices.size());
     Py::List::size_type pos=0;
-    for (std::vector<unsigned long>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
-        ary[pos++] = Py::Long(*it);
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
+        ary[pos++] = Py::Long((unsigned long)*it);
     }
 
     return Py::new_reference_to(ary);
@@ -811,7 +813,7 @@ PyObject*  MeshPy::addMesh(PyObject *args)
 
 PyObject*  MeshPy::setPoint(PyObject *args)
 {
-    unsigned long index;
+    MeshCore::PointIndex index;
     PyObject* pnt;
     if (!PyArg_ParseTuple(args, "kO!",&index, &(Base::VectorPy::Type), &pnt))
         return NULL;
@@ -850,7 +852,7 @@ PyObject* MeshPy::countSegments(PyObject *args)
 
 PyObject* MeshPy::getSegment(PyObject *args)
 {
-    unsigned long index;
+    MeshCore::FacetIndex index;
     if (!PyArg_ParseTuple(args, "k", &index))
         return 0;
 
@@ -861,8 +863,8 @@ PyObject* MeshPy::getSegment(PyObject *args)
     }
 
     Py::List ary;
-    const std::vector<unsigned long>& segm = getMeshObjectPtr()->getSegment(index).getIndices();
-    for (std::vector<unsigned long>::const_iterator it = segm.begin(); it != segm.end(); ++it) {
+    const std::vector<MeshCore::FacetIndex>& segm = getMeshObjectPtr()->getSegment(index).getIndices();
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = segm.begin(); it != segm.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
         ary.append(Py::Long((int)*it));
 #else
@@ -879,7 +881,7 @@ PyObject* MeshPy::getSeparateComponents(PyObject *args)
         return NULL;
 
     Py::List meshesList;
-    std::vector<std::vector<unsigned long> > segs;
+    std::vector<std::vector<MeshCore::FacetIndex> > segs;
     segs = getMeshObjectPtr()->getComponents();
     for (unsigned int i=0; i<segs.size(); i++) {
         MeshObject* mesh = getMeshObjectPtr()->meshFromSegment(segs[i]);
@@ -894,9 +896,9 @@ PyObject* MeshPy::getFacetSelection(PyObject *args)
         return 0;
 
     Py::List ary;
-    std::vector<unsigned long> facets;
+    std::vector<MeshCore::FacetIndex> facets;
     getMeshObjectPtr()->getFacetsFromSelection(facets);
-    for (std::vector<unsigned long>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
         ary.append(Py::Long((int)*it));
 #else
@@ -913,9 +915,9 @@ PyObject* MeshPy::getPointSelection(PyObject *args)
         return 0;
 
     Py::List ary;
-    std::vector<unsigned long> points;
+    std::vector<MeshCore::PointIndex> points;
     getMeshObjectPtr()->getPointsFromSelection(points);
-    for (std::vector<unsigned long>::const_iterator it = points.begin(); it != points.end(); ++it) {
+    for (std::vector<MeshCore::PointIndex>::const_iterator it = points.begin(); it != points.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
         ary.append(Py::Long((int)*it));
 #else
@@ -932,7 +934,7 @@ PyObject* MeshPy::meshFromSegment(PyObject *args)
     if (!PyArg_ParseTuple(args, "O", &list))
         return 0;
 
-    std::vector<unsigned long> segment;
+    std::vector<MeshCore::FacetIndex> segment;
     Py::Sequence ary(list);
     for (Py::Sequence::iterator it = ary.begin(); it != ary.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
@@ -1033,7 +1035,7 @@ PyObject*  MeshPy::getSelfIntersections(PyObject *args)
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
 
-    std::vector<std::pair<unsigned long, unsigned long> > selfIndices;
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > selfIndices;
     std::vector<std::pair<Base::Vector3f, Base::Vector3f> > selfPoints;
     MeshCore::MeshEvalSelfIntersection eval(getMeshObjectPtr()->getKernel());
     eval.GetIntersections(selfIndices);
@@ -1043,8 +1045,8 @@ PyObject*  MeshPy::getSelfIntersections(PyObject *args)
     if (selfIndices.size() == selfPoints.size()) {
         for (std::size_t i=0; i<selfIndices.size(); i++) {
             Py::Tuple item(4);
-            item.setItem(0, Py::Long(selfIndices[i].first));
-            item.setItem(1, Py::Long(selfIndices[i].second));
+            item.setItem(0, Py::Long((unsigned long)selfIndices[i].first));
+            item.setItem(1, Py::Long((unsigned long)selfIndices[i].second));
             item.setItem(2, Py::Vector(selfPoints[i].first));
             item.setItem(3, Py::Vector(selfPoints[i].second));
             tuple.setItem(i, item);
@@ -1054,6 +1056,52 @@ PyObject*  MeshPy::getSelfIntersections(PyObject *args)
     return Py::new_reference_to(tuple);
 }
 
+namespace {
+template <class T>
+Py::List toIndexList(const std::vector<T>& indices)
+{
+    Py::List list;
+    for (typename std::vector<T>::const_iterator it = indices.begin(); it != indices.end(); ++it)
+        list.append(Py::Long(static_cast<unsigned long>(*it)));
+    return list;
+}
+}
+
+PyObject*  MeshPy::analyzeDefects(PyObject *args)
+{
+    float fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
+    if (!PyArg_ParseTuple(args, "|f", &fEpsilon))
+        return NULL;
+
+    PY_TRY {
+        MeshCore::MeshDefectReport report = getMeshObjectPtr()->analyzeDefects(fEpsilon);
+
+        Py::List selfIntersections;
+        for (std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> >::const_iterator
+            it = report.selfIntersections.begin(); it != report.selfIntersections.end(); ++it) {
+            Py::Tuple item(2);
+            item.setItem(0, Py::Long(static_cast<unsigned long>(it->first)));
+            item.setItem(1, Py::Long(static_cast<unsigned long>(it->second)));
+            selfIntersections.append(item);
+        }
+
+        Py::Dict dict;
+        dict.setItem("InvalidPoints", toIndexList(report.invalidPoints));
+        dict.setItem("DuplicatedPoints", toIndexList(report.duplicatedPoints));
+        dict.setItem("PointsOutOfRange", toIndexList(report.pointsOutOfRange));
+        dict.setItem("FacetsOutOfRange", toIndexList(report.facetsOutOfRange));
+        dict.setItem("CorruptedFacets", toIndexList(report.corruptedFacets));
+        dict.setItem("DegeneratedFacets", toIndexList(report.degeneratedFacets));
+        dict.setItem("DuplicatedFacets", toIndexList(report.duplicatedFacets));
+        dict.setItem("FoldsOnSurface", toIndexList(report.foldsOnSurface));
+        dict.setItem("NonManifolds", toIndexList(report.nonManifolds));
+        dict.setItem("InvalidNeighbourhood", toIndexList(report.invalidNeighbourhood));
+        dict.setItem("NonUniformOrientedFacets", toIndexList(report.nonUniformOrientedFacets));
+        dict.setItem("SelfIntersections", selfIntersections);
+        return Py::new_reference_to(dict);
+    } PY_CATCH;
+}
+
 PyObject*  MeshPy::fixSelfIntersections(PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
@@ -1140,10 +1188,10 @@ PyObject*  MeshPy::getNonUniformOrientedFacets(PyObject *args)
 
     const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
     MeshCore::MeshEvalOrientation cMeshEval(kernel);
-    std::vector<unsigned long> inds = cMeshEval.GetIndices();
+    std::vector<MeshCore::FacetIndex> inds = cMeshEval.GetIndices();
     Py::Tuple tuple(inds.size());
     for (std::size_t i=0; i<inds.size(); i++) {
-        tuple.setItem(i, Py::Long(inds[i]));
+        tuple.setItem(i, Py::Long((unsigned long)inds[i]));
     }
 
     return Py::new_reference_to(tuple);
@@ -1383,7 +1431,7 @@ PyObject*  MeshPy::splitEdges(PyObject *args)
 
 PyObject*  MeshPy::splitEdge(PyObject *args)
 {
-    unsigned long facet, neighbour;
+    MeshCore::FacetIndex facet, neighbour;
     PyObject* vertex;
     if (!PyArg_ParseTuple(args, "kkO!", &facet, &neighbour, &Base::VectorPy::Type, &vertex))
         return NULL;
@@ -1418,7 +1466,7 @@ PyObject*  MeshPy::splitEdge(PyObject *args)
 
 PyObject*  MeshPy::splitFacet(PyObject *args)
 {
-    unsigned long facet;
+    MeshCore::FacetIndex facet;
     PyObject* vertex1;
     PyObject* vertex2;
     if (!PyArg_ParseTuple(args, "kO!O!", &facet, &Base::VectorPy::Type, &vertex1, 
@@ -1448,7 +1496,7 @@ PyObject*  MeshPy::splitFacet(PyObject *args)
 
 PyObject*  MeshPy::swapEdge(PyObject *args)
 {
-    unsigned long facet, neighbour;
+    MeshCore::FacetIndex facet, neighbour;
     if (!PyArg_ParseTuple(args, "kk", &facet, &neighbour))
         return NULL;
 
@@ -1478,7 +1526,7 @@ PyObject*  MeshPy::swapEdge(PyObject *args)
 
 PyObject*  MeshPy::collapseEdge(PyObject *args)
 {
-    unsigned long facet, neighbour;
+    MeshCore::FacetIndex facet, neighbour;
     if (!PyArg_ParseTuple(args, "kk", &facet, &neighbour))
         return NULL;
 
@@ -1508,7 +1556,7 @@ PyObject*  MeshPy::collapseEdge(PyObject *args)
 
 PyObject*  MeshPy::collapseFacet(PyObject *args)
 {
-    unsigned long facet;
+    MeshCore::FacetIndex facet;
     if (!PyArg_ParseTuple(args, "k", &facet))
         return NULL;
 
@@ -1526,7 +1574,7 @@ PyObject*  MeshPy::collapseFacet(PyObject *args)
 
 PyObject*  MeshPy::insertVertex(PyObject *args)
 {
-    unsigned long facet;
+    MeshCore::FacetIndex facet;
     PyObject* vertex;
     if (!PyArg_ParseTuple(args, "kO!", &facet, &Base::VectorPy::Type, &vertex))
         return NULL;
@@ -1549,7 +1597,7 @@ PyObject*  MeshPy::insertVertex(PyObject *args)
 
 PyObject*  MeshPy::snapVertex(PyObject *args)
 {
-    unsigned long facet;
+    MeshCore::FacetIndex facet;
     PyObject* vertex;
     if (!PyArg_ParseTuple(args, "kO!", &facet, &Base::VectorPy::Type, &vertex))
         return NULL;
@@ -1586,15 +1634,15 @@ PyObject*  MeshPy::collapseFacets(PyObject *args)
     // if no mesh is given
     try {
         Py::Sequence list(pcObj);
-        std::vector<unsigned long> facets;
+        std::vector<MeshCore::FacetIndex> facets;
         for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
 #if PY_MAJOR_VERSION >= 3
             Py::Long idx(*it);
-            unsigned long iIdx = static_cast<unsigned long>(idx);
+            MeshCore::FacetIndex iIdx = static_cast<unsigned long>(idx);
             facets.push_back(iIdx);
 #else
             Py::Int idx(*it);
-            unsigned long iIdx = static_cast<unsigned long>(idx);
+            MeshCore::FacetIndex iIdx = static_cast<unsigned long>(idx);
             facets.push_back(iIdx);
 #endif
         }
@@ -1784,6 +1832,174 @@ PyObject*  MeshPy::decimate(PyObject *args)
     return nullptr;
 }
 
+namespace {
+std::vector<Base::Vector3f> toFloatVectors(const std::vector<Base::Vector3d>& pnts)
+{
+    std::vector<Base::Vector3f> vec;
+    vec.reserve(pnts.size());
+    for (const auto& it : pnts)
+        vec.push_back(Base::convertTo<Base::Vector3f>(it));
+    return vec;
+}
+}
+
+PyObject* MeshPy::nearestPoints(PyObject *args)
+{
+    PyObject* obj;
+    int k = 1;
+    if (!PyArg_ParseTuple(args, "O|i", &obj, &k))
+        return NULL;
+    if (k < 1) {
+        PyErr_SetString(PyExc_ValueError, "k must be positive");
+        return NULL;
+    }
+
+    try {
+        std::vector<Base::Vector3f> queries = toFloatVectors(Base::getVectorsFromPyObject(obj));
+        std::size_t num = static_cast<std::size_t>(k);
+
+        std::vector<MeshCore::PointIndex> indices(queries.size() * num);
+        std::vector<float> distances(queries.size() * num);
+        {
+            Base::PyGILStateRelease release;
+            std::shared_ptr<const MeshCore::MeshKDTree> tree = getMeshObjectPtr()->getSearchTree();
+            tree->FindNearest(queries.data(), queries.size(), num, indices.data(), distances.data());
+        }
+
+        void* data;
+        Py::Object pyIndices(Base::createBufferView("q", sizeof(int64_t), queries.size(), num, data));
+        int64_t* ind = static_cast<int64_t*>(data);
+        for (std::size_t i=0; i<indices.size(); i++)
+            ind[i] = indices[i] == MeshCore::POINT_INDEX_MAX ? -1 : static_cast<int64_t>(indices[i]);
+
+        Py::Object pyDistances(Base::createBufferView("f", sizeof(float), queries.size(), num, data));
+        std::copy(distances.begin(), distances.end(), static_cast<float*>(data));
+
+        return Py::new_reference_to(Py::TupleN(pyIndices, pyDistances));
+    }
+    catch (const Py::Exception&) {
+        return NULL;
+    }
+}
+
+PyObject* MeshPy::pointsInRange(PyObject *args)
+{
+    PyObject* obj;
+    double range;
+    int maxCount;
+    if (!PyArg_ParseTuple(args, "Odi", &obj, &range, &maxCount))
+        return NULL;
+    if (maxCount < 1) {
+        PyErr_SetString(PyExc_ValueError, "maxCount must be positive");
+        return NULL;
+    }
+
+    try {
+        std::vector<Base::Vector3f> queries = toFloatVectors(Base::getVectorsFromPyObject(obj));
+        std::size_t num = static_cast<std::size_t>(maxCount);
+
+        std::vector<MeshCore::PointIndex> indices(queries.size() * num);
+        std::vector<std::size_t> counts(queries.size());
+        {
+            Base::PyGILStateRelease release;
+            std::shared_ptr<const MeshCore::MeshKDTree> tree = getMeshObjectPtr()->getSearchTree();
+            tree->FindInRange(queries.data(), queries.size(), static_cast<float>(range),
+                              num, indices.data(), counts.data());
+        }
+
+        void* data;
+        Py::Object pyIndices(Base::createBufferView("q", sizeof(int64_t), queries.size(), num, data));
+        int64_t* ind = static_cast<int64_t*>(data);
+        for (std::size_t i=0; i<queries.size(); i++) {
+            for (std::size_t j=0; j<num; j++)
+                ind[i*num+j] = j < counts[i] ? static_cast<int64_t>(indices[i*num+j]) : -1;
+        }
+
+        Py::Object pyCounts(Base::createBufferView("q", sizeof(int64_t), queries.size(), 0, data));
+        std::copy(counts.begin(), counts.end(), static_cast<int64_t*>(data));
+
+        return Py::new_reference_to(Py::TupleN(pyIndices, pyCounts));
+    }
+    catch (const Py::Exception&) {
+        return NULL;
+    }
+}
+
+namespace {
+template <class Map>
+Py::Object adjacencyRows(const Map& map, std::size_t count)
+{
+    Py::List rows(count);
+    for (std::size_t i=0; i<count; i++) {
+        const auto& row = map[static_cast<MeshCore::ElementIndex>(i)];
+        Py::Tuple tuple(row.size());
+        std::size_t j = 0;
+        for (auto it : row)
+            tuple.setItem(j++, Py::Long(static_cast<unsigned long>(it)));
+        rows.setItem(i, tuple);
+    }
+    return rows;
+}
+
+template <class Map>
+Py::Object adjacency(const MeshCore::MeshKernel& kernel, std::size_t count, bool rows)
+{
+    Map map(kernel);
+    if (rows)
+        return adjacencyRows(map, count);
+    return Py::Long(static_cast<unsigned long>(map.MemSize()));
+}
+
+Py::Object adjacency(const MeshCore::MeshKernel& kernel, const std::string& type, bool compressed, bool rows)
+{
+    if (type == "PointToFacets") {
+        if (compressed)
+            return adjacency<MeshCore::MeshCsrPointToFacets>(kernel, kernel.CountPoints(), rows);
+        return adjacency<MeshCore::MeshRefPointToFacets>(kernel, kernel.CountPoints(), rows);
+    }
+    else if (type == "PointToPoints") {
+        if (compressed)
+            return adjacency<MeshCore::MeshCsrPointToPoints>(kernel, kernel.CountPoints(), rows);
+        return adjacency<MeshCore::MeshRefPointToPoints>(kernel, kernel.CountPoints(), rows);
+    }
+    else if (type == "FacetToFacets") {
+        if (compressed)
+            return adjacency<MeshCore::MeshCsrFacetToFacets>(kernel, kernel.CountFacets(), rows);
+        return adjacency<MeshCore::MeshRefFacetToFacets>(kernel, kernel.CountFacets(), rows);
+    }
+
+    throw Py::ValueError("Type must be PointToFacets, PointToPoints or FacetToFacets");
+}
+}
+
+PyObject* MeshPy::getAdjacency(PyObject *args)
+{
+    char* type;
+    PyObject* compressed = Py_True;
+    if (!PyArg_ParseTuple(args, "s|O!", &type, &PyBool_Type, &compressed))
+        return NULL;
+
+    PY_TRY {
+        Py::Object rows = adjacency(getMeshObjectPtr()->getKernel(), type,
+                                    PyObject_IsTrue(compressed) ? true : false, true);
+        return Py::new_reference_to(rows);
+    } PY_CATCH;
+}
+
+PyObject* MeshPy::getAdjacencyMemSize(PyObject *args)
+{
+    char* type;
+    PyObject* compressed = Py_True;
+    if (!PyArg_ParseTuple(args, "s|O!", &type, &PyBool_Type, &compressed))
+        return NULL;
+
+    PY_TRY {
+        Py::Object size = adjacency(getMeshObjectPtr()->getKernel(), type,
+                                    PyObject_IsTrue(compressed) ? true : false, false);
+        return Py::new_reference_to(size);
+    } PY_CATCH;
+}
+
 PyObject* MeshPy::nearestFacetOnRay(PyObject *args)
 {
     PyObject* pnt_p;
@@ -1802,7 +2018,7 @@ PyObject* MeshPy::nearestFacetOnRay(PyObject *args)
                            (float)Py::Float(dir_t.getItem(1)),
                            (float)Py::Float(dir_t.getItem(2)));
 
-        unsigned long index = 0;
+        MeshCore::FacetIndex index = 0;
         Base::Vector3f res;
         MeshCore::MeshAlgorithm alg(getMeshObjectPtr()->getKernel());
 
@@ -1864,9 +2080,9 @@ PyObject*  MeshPy::getPlanarSegments(PyObject *args)
 
     Py::List s;
     for (std::vector<Mesh::Segment>::iterator it = segments.begin(); it != segments.end(); ++it) {
-        const std::vector<unsigned long>& segm = it->getIndices();
+        const std::vector<MeshCore::FacetIndex>& segm = it->getIndices();
         Py::List ary;
-        for (std::vector<unsigned long>::const_iterator jt = segm.begin(); jt != segm.end(); ++jt) {
+        for (std::vector<MeshCore::FacetIndex>::const_iterator jt = segm.begin(); jt != segm.end(); ++jt) {
 #if PY_MAJOR_VERSION >= 3
             ary.append(Py::Long((int)*jt));
 #else
@@ -1908,9 +2124,9 @@ PyObject*  MeshPy::getSegmentsOfType(PyObject *args)
 
     Py::List s;
     for (std::vector<Mesh::Segment>::iterator it = segments.begin(); it != segments.end(); ++it) {
-        const std::vector<unsigned long>& segm = it->getIndices();
+        const std::vector<MeshCore::FacetIndex>& segm = it->getIndices();
         Py::List ary;
-        for (std::vector<unsigned long>::const_iterator jt = segm.begin(); jt != segm.end(); ++jt) {
+        for (std::vector<MeshCore::FacetIndex>::const_iterator jt = segm.begin(); jt != segm.end(); ++jt) {
 #if PY_MAJOR_VERSION >= 3
             ary.append(Py::Long((int)*jt));
 #else
@@ -2028,6 +2244,11 @@ Py::Float MeshPy::getVolume(void) const
     return Py::Float(getMeshObjectPtr()->getVolume());
 }
 
+Py::Long MeshPy::getMemSize(void) const
+{
+    return Py::Long(static_cast<unsigned long>(getMeshObjectPtr()->getKernel().GetMemSize()));
+}
+
 PyObject *MeshPy::getCustomAttributes(const char* /*attr*/) const
 {
     return 0;
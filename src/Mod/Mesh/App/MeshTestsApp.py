@@ -150,6 +150,108 @@ class MeshSplitTestCases(unittest.TestCase):
         self.assertFalse(self.mesh.hasCorruptedFacets())
         self.assertTrue(self.mesh.isSolid())
 
+class MeshDefectsTestCases(unittest.TestCase):
+    def testValidMesh(self):
+        mesh = Mesh.createBox(1.0, 1.0, 1.0)
+        defects = mesh.analyzeDefects()
+        for key, value in defects.items():
+            self.assertEqual(len(value), 0, "Unexpected defects: %s" % key)
+
+    def testDuplicatedFacet(self):
+        points, facets = Mesh.createBox(1.0, 1.0, 1.0).Topology
+        facets.append(facets[0])
+        mesh = Mesh.Mesh((points, facets))
+        defects = mesh.analyzeDefects()
+        self.assertEqual(defects["DuplicatedFacets"], [len(facets) - 1])
+        self.assertIn(0, defects["NonManifolds"])
+
+    def testSelfIntersection(self):
+        mesh = Mesh.Mesh([[0.0, 0.0, 0.0], [2.0, 0.0, 0.0], [0.0, 2.0, 0.0],
+                          [0.5, 0.5,-1.0], [0.5, 0.5, 1.0], [1.0, 0.5, 0.0]])
+        defects = mesh.analyzeDefects()
+        self.assertEqual(defects["SelfIntersections"], [(0, 1)])
+        self.assertEqual(len(defects["DegeneratedFacets"]), 0)
+
+class MeshSmoothingTestCases(unittest.TestCase):
+    def setUp(self):
+        # a planar 3x3 grid whose inner point is lifted
+        points = [[x, y, 0.0] for y in range(3) for x in range(3)]
+        points[4][2] = 1.0
+        facets = []
+        for y in range(2):
+            for x in range(2):
+                a = 3 * y + x
+                facets.append([a, a + 1, a + 4])
+                facets.append([a, a + 4, a + 3])
+        self.mesh = Mesh.Mesh((points, facets))
+
+    def checkBorder(self):
+        for index, point in enumerate(self.mesh.Points):
+            if index != 4:
+                self.assertEqual(point.z, 0.0)
+
+    def testLaplace(self):
+        self.mesh.smooth(Method="Laplace", Iteration=1, Lambda=0.5)
+        self.assertAlmostEqual(self.mesh.Points[4].z, 0.5, 5)
+        self.checkBorder()
+
+    def testTaubin(self):
+        self.mesh.smooth(Method="Taubin", Iteration=4)
+        self.assertLess(abs(self.mesh.Points[4].z), 1.0)
+        self.checkBorder()
+
+class MeshSearchTestCases(unittest.TestCase):
+    def setUp(self):
+        # a planar 3x3 grid of points with unit spacing
+        points = [[x, y, 0.0] for y in range(3) for x in range(3)]
+        facets = []
+        for y in range(2):
+            for x in range(2):
+                a = 3 * y + x
+                facets.append([a, a + 1, a + 4])
+                facets.append([a, a + 4, a + 3])
+        self.mesh = Mesh.Mesh((points, facets))
+
+    def testNearestPoints(self):
+        indices, distances = self.mesh.nearestPoints([FreeCAD.Vector(0.1, 0.1, 0), (2.1, 2.0, 0.5)], 2)
+        self.assertEqual(indices.shape, (2, 2))
+        self.assertEqual(indices[0, 0], 0)
+        self.assertEqual(indices[1, 0], 8)
+        self.assertAlmostEqual(distances[1, 0], math.sqrt(0.26), 5)
+        self.assertLessEqual(distances[0, 0], distances[0, 1])
+
+    def testNearestPointsTooMany(self):
+        indices, distances = self.mesh.nearestPoints([(1, 1, 0)], 10)
+        self.assertEqual(indices[0, 0], 4)
+        self.assertEqual(indices[0, 9], -1)
+        self.assertEqual(distances[0, 9], -1)
+
+    def testPointsInRange(self):
+        indices, counts = self.mesh.pointsInRange([(1, 1, 0), (5, 5, 5)], 1.01, 3)
+        self.assertEqual(counts.tolist(), [5, 0])
+        self.assertEqual(indices.shape, (2, 3))
+        self.assertEqual(indices.tolist()[1], [-1, -1, -1])
+
+    def testNoQueries(self):
+        indices, distances = self.mesh.nearestPoints([], 2)
+        self.assertEqual(indices.shape, (0, 2))
+        self.assertEqual(distances.shape, (0, 2))
+        indices, counts = self.mesh.pointsInRange([], 1.0, 3)
+        self.assertEqual(indices.shape, (0, 3))
+        self.assertEqual(counts.shape, (0,))
+        self.assertRaises(ValueError, self.mesh.pointsInRange, [(1, 1, 0)], 1.0, 0)
+
+    def testModifiedMesh(self):
+        # the kd-tree is kept between the searches but not after a change
+        self.assertEqual(self.mesh.nearestPoints([(1.9, 1.8, 0)])[0][0, 0], 8)
+        self.mesh.setPoint(8, FreeCAD.Vector(5, 5, 0))
+        self.assertEqual(self.mesh.nearestPoints([(1.9, 1.8, 0)])[0][0, 0], 5)
+        self.mesh.translate(10, 0, 0)
+        self.assertEqual(self.mesh.nearestPoints([(10, 0, 0)])[0][0, 0], 0)
+        self.mesh.Placement = FreeCAD.Placement(FreeCAD.Vector(0, 10, 0), FreeCAD.Rotation())
+        self.assertEqual(self.mesh.nearestPoints([(10, 10, 0)])[0][0, 0], 0)
+        self.assertEqual(self.mesh.pointsInRange([(10, 0, 0)], 0.5, 1)[1].tolist(), [0])
+
 class MeshGeoTestCases(unittest.TestCase):
     def setUp(self):
         # set up a planar face with 2 triangles
@@ -184,6 +286,137 @@ class MeshGeoTestCases(unittest.TestCase):
         res=f1.intersect(f2)
         self.failUnless(len(res) == 0)
 
+class MeshIOTestCases(unittest.TestCase):
+    def setUp(self):
+        # the memory mapped readers decode large files in parallel chunks
+        self.mesh = Mesh.createSphere(10.0, 100)
+        self.mesh.addMesh(Mesh.createBox(5.0, 6.0, 7.0))
+
+    def facetPoints(self, mesh):
+        points, facets = mesh.Topology
+        return [tuple((points[i].x, points[i].y, points[i].z) for i in f) for f in facets]
+
+    def readBack(self, fmt, suffix):
+        """Write the mesh, read it from the mapped file and from a stream"""
+        name = tempfile.gettempdir() + os.sep + "readback." + suffix
+        self.mesh.write(name, fmt)
+        mapped = Mesh.Mesh()
+        mapped.read(name)
+        streamed = Mesh.Mesh()
+        with open(name, "rb") as f:
+            streamed.read(Stream=f, Format=fmt)
+        os.remove(name)
+        return mapped, streamed
+
+    def testBinarySTL(self):
+        mapped, streamed = self.readBack("STL", "stl")
+        self.assertEqual(mapped.CountFacets, self.mesh.CountFacets)
+        self.assertEqual(mapped.CountPoints, streamed.CountPoints)
+        # the readers may number the merged points differently
+        self.assertEqual(self.facetPoints(mapped), self.facetPoints(streamed))
+
+    def testBinaryPLY(self):
+        mapped, streamed = self.readBack("PLY", "ply")
+        self.assertEqual(mapped.CountFacets, self.mesh.CountFacets)
+        self.assertEqual(mapped.Topology, streamed.Topology)
+
+    def testSmallSTL(self):
+        self.mesh = Mesh.createBox(1.0, 2.0, 3.0)
+        mapped, streamed = self.readBack("STL", "stl")
+        self.assertEqual(mapped.CountPoints, 8)
+        self.assertEqual(self.facetPoints(mapped), self.facetPoints(streamed))
+
+class MeshDocumentTestCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("MeshDocumentTest")
+        self.name = tempfile.gettempdir() + os.sep + "MeshDocumentTest.FCStd"
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+        os.remove(self.name)
+
+    def testSaveRestore(self):
+        # with more than one core the mesh files are decoded by worker threads
+        # and applied to the features in the order of the files
+        meshes = [Mesh.createSphere(10.0, 20 + 10 * i) for i in range(6)]
+        meshes.append(Mesh.Mesh())
+        for i, mesh in enumerate(meshes):
+            self.doc.addObject("Mesh::Feature", "Mesh%d" % i).Mesh = mesh
+        self.doc.recompute()
+        self.doc.saveAs(self.name)
+
+        FreeCAD.closeDocument(self.doc.Name)
+        self.doc = FreeCAD.openDocument(self.name)
+        for i, mesh in enumerate(meshes):
+            restored = self.doc.getObject("Mesh%d" % i).Mesh
+            self.assertEqual(restored.CountFacets, mesh.CountFacets)
+            self.assertEqual(restored.Topology, mesh.Topology)
+
+class MeshGridTestCases(unittest.TestCase):
+    def setUp(self):
+        # large enough to build the facet grid in parallel chunks
+        self.mesh = Mesh.createSphere(10.0, 100)
+
+    def sectionLength(self, base, normal):
+        """Sum up the intersections of all facets with the plane"""
+        length = 0.0
+        for facet in self.mesh.Facets:
+            points = [FreeCAD.Vector(p) for p in facet.Points]
+            dist = [(p - base).dot(normal) for p in points]
+            cuts = []
+            for i in range(3):
+                j = (i + 1) % 3
+                if (dist[i] < 0) != (dist[j] < 0):
+                    t = dist[i] / (dist[i] - dist[j])
+                    cuts.append(points[i] + (points[j] - points[i]) * t)
+            if len(cuts) == 2:
+                length += (cuts[1] - cuts[0]).Length
+        return length
+
+    def testCrossSections(self):
+        planes = [(FreeCAD.Vector(0.0, 0.0, 1.234), FreeCAD.Vector(0, 0, 1)),
+                  (FreeCAD.Vector(0.5, -2.0, 3.0), FreeCAD.Vector(1, 2, 3).normalize())]
+        sections = self.mesh.crossSections(planes, 1e-4)
+        for (base, normal), section in zip(planes, sections):
+            # the section only sees the facets the grid returns for the plane
+            length = sum((b - a).Length for polyline in section for a, b in zip(polyline, polyline[1:]))
+            self.assertAlmostEqual(length, self.sectionLength(base, normal), delta=length * 1e-4)
+
+class MeshAdjacencyTestCases(unittest.TestCase):
+    def setUp(self):
+        # large enough to build the compressed rows in parallel
+        self.mesh = Mesh.createSphere(10.0, 100)
+        self.mesh.addMesh(Mesh.createTorus(8.0, 2.0, 50))
+
+    def testPointToFacets(self):
+        rows = self.mesh.getAdjacency("PointToFacets")
+        self.assertEqual(rows, self.mesh.getAdjacency("PointToFacets", False))
+        facets = self.mesh.Topology[1]
+        reference = [set() for i in range(self.mesh.CountPoints)]
+        for index, facet in enumerate(facets):
+            for point in facet:
+                reference[point].add(index)
+        self.assertEqual(rows, [tuple(sorted(row)) for row in reference])
+
+    def testPointToPoints(self):
+        rows = self.mesh.getAdjacency("PointToPoints")
+        self.assertEqual(len(rows), self.mesh.CountPoints)
+        self.assertEqual(rows, self.mesh.getAdjacency("PointToPoints", False))
+
+    def testFacetToFacets(self):
+        rows = self.mesh.getAdjacency("FacetToFacets")
+        self.assertEqual(len(rows), self.mesh.CountFacets)
+        self.assertEqual(rows, self.mesh.getAdjacency("FacetToFacets", False))
+
+    def testMemSize(self):
+        for kind in ("PointToFacets", "PointToPoints", "FacetToFacets"):
+            self.assertLess(self.mesh.getAdjacencyMemSize(kind),
+                            self.mesh.getAdjacencyMemSize(kind, False))
+
+    def testInvalidType(self):
+        with self.assertRaises(ValueError):
+            self.mesh.getAdjacency("EdgeToFacets")
+
 class PivyTestCases(unittest.TestCase):
     def setUp(self):
         # set up a planar face with 2 triangles
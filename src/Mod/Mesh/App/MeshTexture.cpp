@@ -42,7 +42,7 @@ MeshTexture::MeshTexture(const Mesh::MeshObject& mesh, const MeshCore::Material
     else if (material.binding == MeshCore::MeshIO::PER_FACE && material.diffuseColor.size() == countFacets) {
         binding = MeshCore::MeshIO::PER_FACE;
         kdTree.reset(new MeshCore::MeshKDTree(mesh.getKernel().GetPoints()));
-        refPnt2Fac.reset(new MeshCore::MeshRefPointToFacets(mesh.getKernel()));
+        refPnt2Fac.reset(new MeshCore::MeshCsrPointToFacets(mesh.getKernel()));
     }
 }
 
@@ -85,7 +85,7 @@ void MeshTexture::apply(const Mesh::MeshObject& mesh, bool addDefaultColor, cons
         if (binding == MeshCore::MeshIO::PER_VERTEX) {
             diffuseColor.reserve(points.size());
             for (size_t index=0; index<points.size(); index++) {
-                unsigned long pos = findIndex(points[index], max_dist);
+                MeshCore::PointIndex pos = findIndex(points[index], max_dist);
                 if (pos < countPointsRefMesh) {
                     diffuseColor.push_back(textureColor[pos]);
                 }
@@ -101,15 +101,15 @@ void MeshTexture::apply(const Mesh::MeshObject& mesh, bool addDefaultColor, cons
         }
         else if (binding == MeshCore::MeshIO::PER_FACE) {
             // the values of the map give the point indices of the original mesh
-            std::vector<unsigned long> pointMap;
+            std::vector<MeshCore::PointIndex> pointMap;
             pointMap.reserve(points.size());
             for (size_t index=0; index<points.size(); index++) {
-                unsigned long pos = findIndex(points[index], max_dist);
+                MeshCore::PointIndex pos = findIndex(points[index], max_dist);
                 if (pos < countPointsRefMesh) {
                     pointMap.push_back(pos);
                 }
                 else if (addDefaultColor) {
-                    pointMap.push_back(ULONG_MAX);
+                    pointMap.push_back(MeshCore::POINT_INDEX_MAX);
                 }
             }
 
@@ -117,11 +117,11 @@ void MeshTexture::apply(const Mesh::MeshObject& mesh, bool addDefaultColor, cons
             if (pointMap.size() == points.size()) {
                 diffuseColor.reserve(facets.size());
                 for (auto it : facets) {
-                    unsigned long index1 = pointMap[it._aulPoints[0]];
-                    unsigned long index2 = pointMap[it._aulPoints[1]];
-                    unsigned long index3 = pointMap[it._aulPoints[2]];
-                    if (index1 != ULONG_MAX && index2 != ULONG_MAX && index3 != ULONG_MAX) {
-                        std::vector<unsigned long> found = refPnt2Fac->GetIndices(index1, index2, index3);
+                    MeshCore::PointIndex index1 = pointMap[it._aulPoints[0]];
+                    MeshCore::PointIndex index2 = pointMap[it._aulPoints[1]];
+                    MeshCore::PointIndex index3 = pointMap[it._aulPoints[2]];
+                    if (index1 != MeshCore::POINT_INDEX_MAX && index2 != MeshCore::POINT_INDEX_MAX && index3 != MeshCore::POINT_INDEX_MAX) {
+                        std::vector<MeshCore::PointIndex> found = refPnt2Fac->GetIndices(index1, index2, index3);
                         if (found.size() == 1) {
                             diffuseColor.push_back(textureColor[found.front()]);
                         }
@@ -74,7 +74,7 @@ public:
 
 private:
     void apply(const Mesh::MeshObject& mesh, bool addDefaultColor, const App::Color& defaultColor, float max_dist, MeshCore::Material &material);
-    unsigned long findIndex(const Base::Vector3f& p, float max_dist) const {
+    MeshCore::PointIndex findIndex(const Base::Vector3f& p, float max_dist) const {
         if (max_dist < 0.0f) {
             return kdTree->FindExact(p);
         }
@@ -89,7 +89,7 @@ private:
     const MeshCore::Material &materialRefMesh;
     unsigned long countPointsRefMesh;
     std::unique_ptr<MeshCore::MeshKDTree> kdTree;
-    std::unique_ptr<MeshCore::MeshRefPointToFacets> refPnt2Fac;
+    std::unique_ptr<MeshCore::MeshCsrPointToFacets> refPnt2Fac;
     MeshCore::MeshIO::Binding binding = MeshCore::MeshIO::OVERALL;
 };
 
@@ -38,10 +38,10 @@ class MeshExport Segment
 {
 public:
     Segment(MeshObject*, bool mod);
-    Segment(MeshObject*, const std::vector<unsigned long>& inds, bool mod);
-    void addIndices(const std::vector<unsigned long>& inds);
-    void removeIndices(const std::vector<unsigned long>& inds);
-    const std::vector<unsigned long>& getIndices() const;
+    Segment(MeshObject*, const std::vector<MeshCore::FacetIndex>& inds, bool mod);
+    void addIndices(const std::vector<MeshCore::FacetIndex>& inds);
+    void removeIndices(const std::vector<MeshCore::FacetIndex>& inds);
+    const std::vector<MeshCore::FacetIndex>& getIndices() const;
     bool isEmpty() const { return _indices.empty(); }
 
     Segment(const Segment&);
@@ -62,7 +62,7 @@ public:
 
 private:
     MeshObject* _mesh;
-    std::vector<unsigned long> _indices;
+    std::vector<MeshCore::FacetIndex> _indices;
     std::string _name;
     std::string _color;
     bool _save;
@@ -72,7 +72,7 @@ public:
     class MeshExport const_facet_iterator
     {
     public:
-        const_facet_iterator(const Segment*, std::vector<unsigned long>::const_iterator);
+        const_facet_iterator(const Segment*, std::vector<MeshCore::FacetIndex>::const_iterator);
         const_facet_iterator(const const_facet_iterator& fi);
         ~const_facet_iterator();
 
@@ -88,7 +88,7 @@ public:
         const Segment* _segment;
         Facet _facet;
         MeshCore::MeshFacetIterator _f_it;
-        std::vector<unsigned long>::const_iterator _it;
+        std::vector<MeshCore::FacetIndex>::const_iterator _it;
     };
 
     const_facet_iterator facets_begin() const
@@ -97,7 +97,7 @@ public:
     std::map<std::string, ViewProviderMeshDefects*> vp;
     Mesh::Feature* meshFeature;
     QPointer<Gui::View3DInventor> view;
-    std::vector<unsigned long> self_intersections;
+    std::vector<FacetIndex> self_intersections;
     bool enableFoldsCheck;
     bool checkNonManfoldPoints;
     bool strictlyDegenerated;
@@ -276,7 +276,7 @@ void DlgEvaluateMeshImp::setMesh(Mesh::Feature* m)
     }
 }
 
-void DlgEvaluateMeshImp::addViewProvider(const char* name, const std::vector<unsigned long>& indices)
+void DlgEvaluateMeshImp::addViewProvider(const char* name, const std::vector<ElementIndex>& indices)
 {
     removeViewProvider(name);
 
@@ -440,7 +440,7 @@ void DlgEvaluateMeshImp::on_analyzeOrientationButton_clicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalOrientation eval(rMesh);
-        std::vector<unsigned long> inds = eval.GetIndices();
+        std::vector<FacetIndex> inds = eval.GetIndices();
 #if 0
         if (inds.empty() && !eval.Evaluate()) {
             d->ui.checkOrientationButton->setText(tr("Flipped normals found"));
@@ -532,7 +532,7 @@ void DlgEvaluateMeshImp::on_analyzeNonmanifoldsButton_clicked()
         MeshEvalTopology f_eval(rMesh);
         bool ok1 = f_eval.Evaluate();
         bool ok2 = true;
-        std::vector<unsigned long> point_indices;
+        std::vector<PointIndex> point_indices;
 
         if (d->checkNonManfoldPoints) {
             MeshEvalPointManifolds p_eval(rMesh);
@@ -555,10 +555,10 @@ void DlgEvaluateMeshImp::on_analyzeNonmanifoldsButton_clicked()
             d->ui.repairAllTogether->setEnabled(true);
 
             if (!ok1) {
-                const std::vector<std::pair<unsigned long, unsigned long> >& inds = f_eval.GetIndices();
-                std::vector<unsigned long> indices;
+                const std::vector<std::pair<PointIndex, PointIndex> >& inds = f_eval.GetIndices();
+                std::vector<PointIndex> indices;
                 indices.reserve(2*inds.size());
-                std::vector<std::pair<unsigned long, unsigned long> >::const_iterator it;
+                std::vector<std::pair<PointIndex, PointIndex> >::const_iterator it;
                 for (it = inds.begin(); it != inds.end(); ++it) {
                     indices.push_back(it->first);
                     indices.push_back(it->second);
@@ -721,7 +721,7 @@ void DlgEvaluateMeshImp::on_analyzeDegeneratedButton_clicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDegeneratedFacets eval(rMesh, d->epsilonDegenerated);
-        std::vector<unsigned long> degen = eval.GetIndices();
+        std::vector<FacetIndex> degen = eval.GetIndices();
         
         if (degen.empty()) {
             d->ui.checkDegenerationButton->setText(tr("No degenerations"));
@@ -787,7 +787,7 @@ void DlgEvaluateMeshImp::on_analyzeDuplicatedFacesButton_clicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDuplicateFacets eval(rMesh);
-        std::vector<unsigned long> dupl = eval.GetIndices();
+        std::vector<FacetIndex> dupl = eval.GetIndices();
     
         if (dupl.empty()) {
             d->ui.checkDuplicatedFacesButton->setText(tr("No duplicated faces"));
@@ -919,7 +919,7 @@ void DlgEvaluateMeshImp::on_analyzeSelfIntersectionButton_clicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalSelfIntersection eval(rMesh);
-        std::vector<std::pair<unsigned long, unsigned long> > intersection;
+        std::vector<std::pair<FacetIndex, FacetIndex> > intersection;
         try {
             eval.GetIntersections(intersection);
         }
@@ -939,9 +939,9 @@ void DlgEvaluateMeshImp::on_analyzeSelfIntersectionButton_clicked()
             d->ui.repairSelfIntersectionButton->setEnabled(true);
             d->ui.repairAllTogether->setEnabled(true);
 
-            std::vector<unsigned long> indices;
+            std::vector<FacetIndex> indices;
             indices.reserve(2*intersection.size());
-            std::vector<std::pair<unsigned long, unsigned long> >::iterator it;
+            std::vector<std::pair<FacetIndex, FacetIndex> >::iterator it;
             for (it = intersection.begin(); it != intersection.end(); ++it) {
                 indices.push_back(it->first);
                 indices.push_back(it->second);
@@ -1022,9 +1022,9 @@ void DlgEvaluateMeshImp::on_analyzeFoldsButton_clicked()
             removeViewProvider("MeshGui::ViewProviderMeshFolds");
         }
         else {
-            std::vector<unsigned long> inds  = f_eval.GetIndices();
-            std::vector<unsigned long> inds1 = s_eval.GetIndices();
-            std::vector<unsigned long> inds2 = b_eval.GetIndices();
+            std::vector<FacetIndex> inds  = f_eval.GetIndices();
+            std::vector<FacetIndex> inds1 = s_eval.GetIndices();
+            std::vector<FacetIndex> inds2 = b_eval.GetIndices();
             inds.insert(inds.end(), inds1.begin(), inds1.end());
             inds.insert(inds.end(), inds2.begin(), inds2.end());
 
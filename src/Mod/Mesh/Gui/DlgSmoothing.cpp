@@ -180,7 +180,7 @@ bool TaskSmoothing::accept()
     bool hasSelection = false;
     for (std::vector<App::DocumentObject*>::const_iterator it = meshes.begin(); it != meshes.end(); ++it) {
         Mesh::Feature* mesh = static_cast<Mesh::Feature*>(*it);
-        std::vector<unsigned long> selection;
+        std::vector<MeshCore::FacetIndex> selection;
         if (widget->smoothSelection()) {
             // clear the selection before editing the mesh to avoid
             // to have coloured triangles when doing an 'undo'
@@ -314,8 +314,8 @@ void MeshFaceAddition::showMarker(SoPickedPoint* pp)
                 int index = (int)f._aulPoints[i];
                 if (std::find(faceView->index.begin(), faceView->index.end(), index) != faceView->index.end())
                     continue; // already inside
-                if (f._aulNeighbours[i] == ULONG_MAX ||
-                    f._aulNeighbours[(i+2)%3] == ULONG_MAX) {
+                if (f._aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ||
+                    f._aulNeighbours[(i+2)%3] == MeshCore::FACET_INDEX_MAX) {
                     pnt = points[index];
                     float len = Base::DistanceP2(pnt, Base::Vector3f(vec[0],vec[1],vec[2]));
                     if (len < distance) {
@@ -418,8 +418,8 @@ namespace MeshGui {
     // for sorting of elements
     struct NofFacetsCompare
     {
-        bool operator () (const std::vector<unsigned long> &rclC1, 
-                          const std::vector<unsigned long> &rclC2)
+        bool operator () (const std::vector<MeshCore::FacetIndex> &rclC1, 
+                          const std::vector<MeshCore::FacetIndex> &rclC2)
         {
             return rclC1.size() < rclC2.size();
         }
@@ -566,7 +566,7 @@ void MeshFillHole::createPolygons()
     const MeshCore::MeshKernel & rMesh = this->myMesh->Mesh.getValue().getKernel();
 
     // get the mesh boundaries as an array of point indices
-    std::list<std::vector<unsigned long> > borders;
+    std::list<std::vector<MeshCore::PointIndex> > borders;
     MeshCore::MeshAlgorithm cAlgo(rMesh);
     MeshCore::MeshPointIterator p_iter(rMesh);
     cAlgo.GetMeshBorders(borders);
@@ -576,7 +576,7 @@ void MeshFillHole::createPolygons()
     borders.sort(NofFacetsCompare());
 
     int32_t count=0;
-    for (std::list<std::vector<unsigned long> >::iterator it = 
+    for (std::list<std::vector<MeshCore::PointIndex> >::iterator it = 
         borders.begin(); it != borders.end(); ++it) {
         if (it->front() == it->back())
             it->pop_back();
@@ -589,14 +589,14 @@ void MeshFillHole::createPolygons()
 
     coords->point.setNum(count);
     int32_t index = 0;
-    for (std::list<std::vector<unsigned long> >::iterator it = 
+    for (std::list<std::vector<MeshCore::PointIndex> >::iterator it = 
         borders.begin(); it != borders.end(); ++it) {
         SoPolygon* polygon = new SoPolygon();
         polygon->startIndex = index;
         polygon->numVertices = it->size();
         myBoundariesGroup->addChild(polygon);
         myPolygons[polygon] = *it;
-        for (std::vector<unsigned long>::iterator jt = it->begin();
+        for (std::vector<MeshCore::PointIndex>::iterator jt = it->begin();
             jt != it->end(); ++jt) {
             p_iter.Set(*jt);
             coords->point.set1Value(index++,p_iter->x,p_iter->y,p_iter->z);
@@ -627,11 +627,11 @@ SoNode* MeshFillHole::getPickedPolygon(const SoRayPickAction& action/*SoNode* ro
 }
 
 float MeshFillHole::findClosestPoint(const SbLine& ray, const TBoundary& polygon,
-                                     unsigned long& vertex_index, SbVec3f& closestPoint) const
+                                     MeshCore::PointIndex& vertex_index, SbVec3f& closestPoint) const
 {
     // now check which vertex of the polygon is closest to the ray
     float minDist = FLT_MAX;
-    vertex_index = ULONG_MAX;
+    vertex_index = MeshCore::POINT_INDEX_MAX;
 
     const MeshCore::MeshKernel & rMesh = myMesh->Mesh.getValue().getKernel();
     const MeshCore::MeshPointArray& pts = rMesh.GetPoints();
@@ -671,7 +671,7 @@ void MeshFillHole::fileHoleCallback(void * ud, SoEventCallback * n)
             std::map<SoNode*, TBoundary>::iterator it = self->myPolygons.find(node);
             if (it != self->myPolygons.end()) {
                 // now check which vertex of the polygon is closest to the ray
-                unsigned long vertex_index;
+                MeshCore::PointIndex vertex_index;
                 SbVec3f closestPoint;
                 float minDist = self->findClosestPoint(rp.getLine(), it->second, vertex_index, closestPoint);
                 if (minDist < 1.0f) {
@@ -701,7 +701,7 @@ void MeshFillHole::fileHoleCallback(void * ud, SoEventCallback * n)
                 std::map<SoNode*, TBoundary>::iterator it = self->myPolygons.find(node);
                 if (it != self->myPolygons.end()) {
                     // now check which vertex of the polygon is closest to the ray
-                    unsigned long vertex_index;
+                    MeshCore::PointIndex vertex_index;
                     SbVec3f closestPoint;
                     float minDist = self->findClosestPoint(rp.getLine(), it->second, vertex_index, closestPoint);
                     if (minDist < 1.0f) {
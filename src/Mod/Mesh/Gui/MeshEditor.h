@@ -110,8 +110,8 @@ public:
     virtual ~MeshHoleFiller()
     {
     }
-    virtual bool fillHoles(Mesh::MeshObject&, const std::list<std::vector<unsigned long> >&,
-                           unsigned long, unsigned long)
+    virtual bool fillHoles(Mesh::MeshObject&, const std::list<std::vector<MeshCore::PointIndex> >&,
+                           MeshCore::PointIndex, MeshCore::PointIndex)
     {
         return false;
     }
@@ -138,14 +138,14 @@ private Q_SLOTS:
     void closeBridge();
 
 private:
-    typedef std::vector<unsigned long> TBoundary;
+    typedef std::vector<MeshCore::PointIndex> TBoundary;
     typedef boost::signals2::connection Connection;
 
     static void fileHoleCallback(void * ud, SoEventCallback * n);
     void createPolygons();
     SoNode* getPickedPolygon(const SoRayPickAction& action) const;
     float findClosestPoint(const SbLine& ray, const TBoundary& polygon,
-                           unsigned long&, SbVec3f&) const;
+                           MeshCore::PointIndex&, SbVec3f&) const;
     void slotChangedObject(const App::DocumentObject& Obj, const App::Property& Prop);
 
 private:
@@ -157,8 +157,8 @@ private:
     std::map<SoNode*, TBoundary> myPolygons;
     Mesh::Feature* myMesh;
     int myNumPoints;
-    unsigned long myVertex1;
-    unsigned long myVertex2;
+    MeshCore::PointIndex myVertex1;
+    MeshCore::PointIndex myVertex2;
     TBoundary myPolygon;
     MeshHoleFiller& myHoleFiller;
     Connection myConnection;
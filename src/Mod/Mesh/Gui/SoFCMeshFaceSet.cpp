@@ -189,7 +189,7 @@ SbBool SoSFMeshFacetArray::readBinaryValues(SoInput * in, unsigned long numarg)
   return TRUE;
 }
 
-SbBool SoSFMeshFacetArray::read1Value(SoInput * in, unsigned long idx)
+SbBool SoSFMeshFacetArray::read1Value(SoInput * in, MeshCore::FacetIndex idx)
 {
   assert(idx < value->size());
   MeshCore::MeshFacet& v = (*value)[idx];
@@ -251,7 +251,7 @@ void SoSFMeshFacetArray::writeBinaryValues(SoOutput * out) const
   for (unsigned int i=0; i < count; i++) this->write1Value(out, i);
 }
 
-void SoSFMeshFacetArray::write1Value(SoOutput * out, unsigned long idx) const
+void SoSFMeshFacetArray::write1Value(SoOutput * out, MeshCore::FacetIndex idx) const
 {
   const MeshCore::MeshFacet& v = (*value)[idx];
   out->write((int32_t)(v._aulPoints[0]));
@@ -1115,7 +1115,7 @@ void SoFCMeshOpenEdgeSet::drawLines(const MeshCore::MeshPointArray * rPoints,
   glBegin(GL_LINES);
   for ( MeshCore::MeshFacetArray::_TConstIterator it = rFacets->begin(); it != rFacets->end(); ++it ) {
     for ( int i=0; i<3; i++ ) {
-      if ( it->_aulNeighbours[i] == ULONG_MAX ) {
+      if ( it->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
         glVertex((*rPoints)[it->_aulPoints[i]]);
         glVertex((*rPoints)[it->_aulPoints[(i+1)%3]]);
       }
@@ -1143,7 +1143,7 @@ void SoFCMeshOpenEdgeSet::generatePrimitives(SoAction* action)
   for ( MeshCore::MeshFacetArray::_TConstIterator it = rFacets->begin(); it != rFacets->end(); ++it )
   {
     for ( int i=0; i<3; i++ ) {
-      if ( it->_aulNeighbours[i] == ULONG_MAX ) {
+      if ( it->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
         const MeshCore::MeshPoint& v0 = (*rPoints)[it->_aulPoints[i]];
         const MeshCore::MeshPoint& v1 = (*rPoints)[it->_aulPoints[(i+1)%3]];
 
@@ -1201,7 +1201,7 @@ void SoFCMeshOpenEdgeSet::getPrimitiveCount(SoGetPrimitiveCountAction * action)
   int ctEdges=0;
   for ( MeshCore::MeshFacetArray::_TConstIterator jt = rFaces->begin(); jt != rFaces->end(); ++jt ) {
     for ( int i=0; i<3; i++ ) {
-      if ( jt->_aulNeighbours[i] == ULONG_MAX ) {
+      if ( jt->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
         ctEdges++;
       }
     }
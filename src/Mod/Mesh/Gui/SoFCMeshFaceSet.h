@@ -53,9 +53,9 @@ public:
 
 protected:
   SbBool readBinaryValues(SoInput * in, unsigned long numarg);
-  SbBool read1Value(SoInput * in, unsigned long idx);
+  SbBool read1Value(SoInput * in, MeshCore::FacetIndex idx);
   void writeBinaryValues(SoOutput * out) const;
-  void write1Value(SoOutput * out, unsigned long idx) const;
+  void write1Value(SoOutput * out, MeshCore::FacetIndex idx) const;
   int getNumValuesPerLine() const;
 };
 
@@ -705,7 +705,7 @@ void SoFCMeshOpenEdge::drawLines() const
   glBegin(GL_LINES);
   for ( MeshCore::MeshFacetArray::_TConstIterator it = rFacets.begin(); it != rFacets.end(); ++it ) {
     for ( int i=0; i<3; i++ ) {
-      if ( it->_aulNeighbours[i] == ULONG_MAX ) {
+      if ( it->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
         glVertex(rPoints[it->_aulPoints[i]]);
         glVertex(rPoints[it->_aulPoints[(i+1)%3]]);
       }
@@ -752,7 +752,7 @@ void SoFCMeshOpenEdge::getPrimitiveCount(SoGetPrimitiveCountAction * action)
   const MeshCore::MeshFacetArray& rFaces = _mesh->getKernel().GetFacets();
   for ( MeshCore::MeshFacetArray::_TConstIterator jt = rFaces.begin(); jt != rFaces.end(); ++jt ) {
     for ( int i=0; i<3; i++ ) {
-      if ( jt->_aulNeighbours[i] == ULONG_MAX ) {
+      if ( jt->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
         ctEdges++;
       }
     }
@@ -158,7 +158,7 @@ SbBool SoSFMeshPointArray::readBinaryValues(SoInput * in, unsigned long numarg)
   return TRUE;
 }
 
-SbBool SoSFMeshPointArray::read1Value(SoInput * in, unsigned long idx)
+SbBool SoSFMeshPointArray::read1Value(SoInput * in, MeshCore::PointIndex idx)
 {
   assert(idx < value->size());
   MeshCore::MeshPoint& v = (*value)[idx];
@@ -212,7 +212,7 @@ void SoSFMeshPointArray::writeBinaryValues(SoOutput * out) const
   for (unsigned int i=0; i < count; i++) this->write1Value(out, i);
 }
 
-void SoSFMeshPointArray::write1Value(SoOutput * out, unsigned long idx) const
+void SoSFMeshPointArray::write1Value(SoOutput * out, MeshCore::PointIndex idx) const
 {
   const MeshCore::MeshPoint& v = (*value)[idx];
   out->write(v.x);
@@ -42,9 +42,9 @@ public:
 
 protected:
   SbBool readBinaryValues(SoInput * in, unsigned long numarg);
-  SbBool read1Value(SoInput * in, unsigned long idx);
+  SbBool read1Value(SoInput * in, MeshCore::PointIndex idx);
   void writeBinaryValues(SoOutput * out) const;
-  void write1Value(SoOutput * out, unsigned long idx) const;
+  void write1Value(SoOutput * out, MeshCore::PointIndex idx) const;
   int getNumValuesPerLine() const;
 };
 
@@ -142,27 +142,27 @@ public:
     /** @name Editing */
     //@{
     bool doubleClicked(void){ return false; }
-    bool isFacetSelected(unsigned long facet);
-    void selectComponent(unsigned long facet);
-    void deselectComponent(unsigned long facet);
-    void selectFacet(unsigned long facet);
-    void deselectFacet(unsigned long facet);
-    void setSelection(const std::vector<unsigned long>&);
-    void addSelection(const std::vector<unsigned long>&);
-    void removeSelection(const std::vector<unsigned long>&);
+    bool isFacetSelected(MeshCore::FacetIndex facet);
+    void selectComponent(MeshCore::FacetIndex facet);
+    void deselectComponent(MeshCore::FacetIndex facet);
+    void selectFacet(MeshCore::FacetIndex facet);
+    void deselectFacet(MeshCore::FacetIndex facet);
+    void setSelection(const std::vector<MeshCore::FacetIndex>&);
+    void addSelection(const std::vector<MeshCore::FacetIndex>&);
+    void removeSelection(const std::vector<MeshCore::FacetIndex>&);
     void invertSelection();
     void clearSelection();
     void deleteSelection();
     bool hasSelection() const;
     void getFacetsFromPolygon(const std::vector<SbVec2f>& picked,
                               const Base::ViewProjMethod& proj, SbBool inner,
-                              std::vector<unsigned long>& indices) const;
-    std::vector<unsigned long> getFacetsOfRegion(const SbViewportRegion&, const SbViewportRegion&, SoCamera*) const;
-    std::vector<unsigned long> getVisibleFacetsAfterZoom(const SbBox2s&, const SbViewportRegion&, SoCamera*) const;
-    std::vector<unsigned long> getVisibleFacets(const SbViewportRegion&, SoCamera*) const;
+                              std::vector<MeshCore::FacetIndex>& indices) const;
+    std::vector<MeshCore::FacetIndex> getFacetsOfRegion(const SbViewportRegion&, const SbViewportRegion&, SoCamera*) const;
+    std::vector<MeshCore::FacetIndex> getVisibleFacetsAfterZoom(const SbBox2s&, const SbViewportRegion&, SoCamera*) const;
+    std::vector<MeshCore::FacetIndex> getVisibleFacets(const SbViewportRegion&, SoCamera*) const;
     virtual void cutMesh(const std::vector<SbVec2f>& picked, const Base::ViewProjMethod& proj, SbBool inner);
     virtual void trimMesh(const std::vector<SbVec2f>& picked, const Base::ViewProjMethod& proj, SbBool inner);
-    virtual void removeFacets(const std::vector<unsigned long>&);
+    virtual void removeFacets(const std::vector<MeshCore::FacetIndex>&);
     /*! The size of the array must be equal to the number of facets. */
     void setFacetTransparency(const std::vector<float>&);
     void resetFacetTransparency();
@@ -180,8 +180,8 @@ protected:
     void setOpenEdgeColorFrom(const App::Color& col);
     virtual void splitMesh(const MeshCore::MeshKernel& toolMesh, const Base::Vector3f& normal, SbBool inner);
     virtual void segmentMesh(const MeshCore::MeshKernel& toolMesh, const Base::Vector3f& normal, SbBool inner);
-    virtual void faceInfo(unsigned long facet);
-    virtual void fillHole(unsigned long facet);
+    virtual void faceInfo(MeshCore::FacetIndex facet);
+    virtual void fillHole(MeshCore::FacetIndex facet);
     virtual void selectArea(short, short, short, short, const SbViewportRegion&, SoCamera*);
     virtual void highlightSelection();
     virtual void unhighlightSelection();
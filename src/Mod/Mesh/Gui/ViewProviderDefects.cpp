@@ -149,7 +149,7 @@ void ViewProviderMeshOrientation::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcFaceRoot, "Face");
 }
 
-void ViewProviderMeshOrientation::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshOrientation::showDefects(const std::vector<MeshCore::FacetIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -159,7 +159,7 @@ void ViewProviderMeshOrientation::showDefects(const std::vector<unsigned long>&
     MeshCore::MeshFacetIterator cF(rMesh);
     unsigned long i=0;
     unsigned long j=0;
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         cF.Set(*it);
         for (int k=0; k<3; k++) {
             Base::Vector3f cP = cF->_aclPoints[k];
@@ -214,7 +214,7 @@ void ViewProviderMeshNonManifolds::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcLineRoot, "Line");
 }
 
-void ViewProviderMeshNonManifolds::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshNonManifolds::showDefects(const std::vector<MeshCore::PointIndex>& inds)
 {
     if ((inds.size() % 2) != 0)
         return;
@@ -226,7 +226,7 @@ void ViewProviderMeshNonManifolds::showDefects(const std::vector<unsigned long>&
     MeshCore::MeshPointIterator cP(rMesh);
     unsigned long i=0;
     unsigned long j=0;
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::PointIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         cP.Set(*it);
         pcCoords->point.set1Value(i++,cP->x,cP->y,cP->z);
         ++it; // go to end point
@@ -279,7 +279,7 @@ void ViewProviderMeshNonManifoldPoints::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcPointRoot, "Point");
 }
 
-void ViewProviderMeshNonManifoldPoints::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshNonManifoldPoints::showDefects(const std::vector<MeshCore::PointIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -287,7 +287,7 @@ void ViewProviderMeshNonManifoldPoints::showDefects(const std::vector<unsigned l
     pcCoords->point.setNum(inds.size());
     MeshCore::MeshPointIterator cP(rMesh);
     unsigned long i = 0;
-    for ( std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it ) {
+    for ( std::vector<MeshCore::PointIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it ) {
         cP.Set(*it);
         pcCoords->point.set1Value(i++,cP->x,cP->y,cP->z);
     }
@@ -343,7 +343,7 @@ void ViewProviderMeshDuplicatedFaces::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcFaceRoot, "Face");
 }
 
-void ViewProviderMeshDuplicatedFaces::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshDuplicatedFaces::showDefects(const std::vector<MeshCore::FacetIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -353,7 +353,7 @@ void ViewProviderMeshDuplicatedFaces::showDefects(const std::vector<unsigned lon
     MeshCore::MeshFacetIterator cF(rMesh);
     unsigned long i=0;
     unsigned long j=0;
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         cF.Set(*it);
         for (int k=0; k<3; k++) {
             Base::Vector3f cP = cF->_aclPoints[k];
@@ -408,7 +408,7 @@ void ViewProviderMeshDuplicatedPoints::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcPointRoot, "Point");
 }
 
-void ViewProviderMeshDuplicatedPoints::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshDuplicatedPoints::showDefects(const std::vector<MeshCore::PointIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -416,7 +416,7 @@ void ViewProviderMeshDuplicatedPoints::showDefects(const std::vector<unsigned lo
     pcCoords->point.setNum(inds.size());
     MeshCore::MeshPointIterator cP(rMesh);
     unsigned long i = 0;
-    for ( std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it ) {
+    for ( std::vector<MeshCore::PointIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it ) {
         cP.Set(*it);
         pcCoords->point.set1Value(i++,cP->x,cP->y,cP->z);
     }
@@ -465,7 +465,7 @@ void ViewProviderMeshDegenerations::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcLineRoot, "Line");
 }
 
-void ViewProviderMeshDegenerations::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshDegenerations::showDefects(const std::vector<MeshCore::FacetIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -475,7 +475,7 @@ void ViewProviderMeshDegenerations::showDefects(const std::vector<unsigned long>
     MeshCore::MeshFacetIterator cF(rMesh);
     unsigned long i=0;
     unsigned long j=0;
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         cF.Set(*it);
         const MeshCore::MeshPoint& rE0 = cF->_aclPoints[0]; 
         const MeshCore::MeshPoint& rE1 = cF->_aclPoints[1];
@@ -571,7 +571,7 @@ void ViewProviderMeshIndices::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcFaceRoot, "Face");
 }
 
-void ViewProviderMeshIndices::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshIndices::showDefects(const std::vector<MeshCore::FacetIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -582,7 +582,7 @@ void ViewProviderMeshIndices::showDefects(const std::vector<unsigned long>& inds
         MeshCore::MeshFacetIterator cF(rMesh);
         unsigned long i=0;
         unsigned long j=0;
-        for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+        for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
             cF.Set(*it);
             for (int k=0; k<3; k++) {
                 Base::Vector3f cP = cF->_aclPoints[k];
@@ -638,7 +638,7 @@ void ViewProviderMeshSelfIntersections::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcLineRoot, "Line");
 }
 
-void ViewProviderMeshSelfIntersections::showDefects(const std::vector<unsigned long>& indices)
+void ViewProviderMeshSelfIntersections::showDefects(const std::vector<MeshCore::FacetIndex>& indices)
 {
     if (indices.size() % 2 != 0)
         return;
@@ -646,11 +646,11 @@ void ViewProviderMeshSelfIntersections::showDefects(const std::vector<unsigned l
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
     MeshCore::MeshEvalSelfIntersection eval(rMesh);
   
-    std::vector<std::pair<unsigned long, unsigned long> > intersection;
-    std::vector<unsigned long>::const_iterator it;
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex> > intersection;
+    std::vector<MeshCore::FacetIndex>::const_iterator it;
     for (it = indices.begin(); it != indices.end(); ) {
-        unsigned long id1 = *it; ++it;
-        unsigned long id2 = *it; ++it;
+        MeshCore::FacetIndex id1 = *it; ++it;
+        MeshCore::FacetIndex id2 = *it; ++it;
         intersection.emplace_back(id1,id2);
     }
 
@@ -718,7 +718,7 @@ void ViewProviderMeshFolds::attach(App::DocumentObject* pcFeat)
     addDisplayMaskMode(pcFaceRoot, "Face");
 }
 
-void ViewProviderMeshFolds::showDefects(const std::vector<unsigned long>& inds)
+void ViewProviderMeshFolds::showDefects(const std::vector<MeshCore::FacetIndex>& inds)
 {
     Mesh::Feature* f = static_cast<Mesh::Feature*>(pcObject);
     const MeshCore::MeshKernel & rMesh = f->Mesh.getValue().getKernel();
@@ -728,7 +728,7 @@ void ViewProviderMeshFolds::showDefects(const std::vector<unsigned long>& inds)
     MeshCore::MeshFacetIterator cF(rMesh);
     unsigned long i=0;
     unsigned long j=0;
-    for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
+    for (std::vector<MeshCore::FacetIndex>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         cF.Set(*it);
         for (int k=0; k<3; k++) {
             Base::Vector3f cP = cF->_aclPoints[k];
@@ -99,7 +99,7 @@ ViewProviderMeshNode::ViewProviderMeshNode() : pcOpenEdge(0), m_bEdit(false)
   // read the correct shape color from the preferences
   Base::Reference<ParameterGrp> hGrp = Gui::WindowParameter::getDefaultParameter()->GetGroup("Mod/Mesh");
   App::Color color = ShapeColor.getValue();
-  unsigned long current = color.getPackedValue();
+  MeshCore::PointIndex current = color.getPackedValue();
   unsigned long setting = hGrp->GetUnsigned("MeshColor", current);
   if ( current != setting )
   {
@@ -299,7 +299,7 @@ bool ViewProviderMeshNode::handleEvent(const SoEvent * const ev,Gui::View3DInven
     Mesh::PropertyMeshKernel& meshProp = ((Mesh::Feature*)pcObject)->Mesh;
 
     // Get the facet indices inside the tool mesh
-    std::vector<unsigned long> indices;
+    std::vector<MeshCore::FacetIndex> indices;
     MeshCore::MeshKernel cToolMesh;
     cToolMesh = aFaces;
     MeshCore::MeshFacetGrid cGrid(meshProp.getValue().getKernel());
@@ -365,7 +365,7 @@ void ViewProviderMeshNode::showOpenEdges(bool show)
     int ctEdges=0;
     for ( MeshCore::MeshFacetArray::_TConstIterator jt = rFaces.begin(); jt != rFaces.end(); ++jt ) {
       for ( int i=0; i<3; i++ ) {
-        if ( jt->_aulNeighbours[i] == ULONG_MAX ) {
+        if ( jt->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
           ctEdges++;
         }
       }
@@ -379,7 +379,7 @@ void ViewProviderMeshNode::showOpenEdges(bool show)
     lines->numVertices.setNum(ctEdges);
     for ( MeshCore::MeshFacetArray::_TConstIterator it = rFaces.begin(); it != rFaces.end(); ++it ) {
       for ( int i=0; i<3; i++ ) {
-        if ( it->_aulNeighbours[i] == ULONG_MAX ) {
+        if ( it->_aulNeighbours[i] == MeshCore::FACET_INDEX_MAX ) {
           const MeshCore::MeshPoint& cP0 = rPoint[it->_aulPoints[i]];
           const MeshCore::MeshPoint& cP1 = rPoint[it->_aulPoints[(i+1)%3]];
           points->point.set1Value(index++, cP0.x, cP0.y, cP0.z);
@@ -419,7 +419,7 @@ private:
 
         Py::List list(o);
         Mesh::MeshObject* mesh = static_cast<Mesh::MeshPy*>(m)->getMeshObjectPtr();
-        std::vector<unsigned long> segm;
+        std::vector<MeshCore::FacetIndex> segm;
         segm.reserve(list.size());
         for (Py_ssize_t i=0; i<list.size(); i++) {
             segm.push_back((long)Py::Long(list[i]));
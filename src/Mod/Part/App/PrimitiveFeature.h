@@ -44,6 +44,10 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn *execute(void) override;
     short mustExecute() const override;
+    /// the primitives only build their own shape
+    bool canRecomputeConcurrently() const override {
+        return true;
+    }
     PyObject* getPyObject() override;
     //@}
 
@@ -75,6 +75,7 @@ using namespace Part;
 TYPESYSTEM_SOURCE(Part::PropertyPartShape , App::PropertyComplexGeoData)
 
 PropertyPartShape::PropertyPartShape()
+  : _BinaryVersion(0)
 {
 }
 
@@ -208,8 +209,11 @@ void PropertyPartShape::Save (Base::Writer &writer) const
     if(!writer.isForceXML()) {
         //See SaveDocFile(), RestoreDocFile()
         if (writer.getMode("BinaryBrep")) {
+            // The binary format depends on the OCC version, so tag the file with
+            // the version that wrote it. Older versions ignore the attribute.
             writer.Stream() << writer.ind() << "<Part file=\""
                             << writer.addFile("PartShape.bin", this)
+                            << "\" version=\"" << OCC_VERSION_HEX
                             << "\"/>" << std::endl;
         }
         else {
@@ -224,6 +228,9 @@ void PropertyPartShape::Restore(Base::XMLReader &reader)
 {
     reader.readElement("Part");
     std::string file (reader.getAttribute("file") );
+    _BinaryVersion = 0;
+    if (reader.hasAttribute("version"))
+        _BinaryVersion = reader.getAttributeAsUnsigned("version");
 
     if (!file.empty()) {
         // initiate a file read
@@ -349,7 +356,9 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     Base::FileInfo brep(reader.getFileName());
     if (brep.hasExtension("bin")) {
         TopoShape shape;
-        shape.importBinary(reader);
+        std::string error = importBinary(shape, reader);
+        if (!error.empty())
+            Base::Console().Error("%s\n", error.c_str());
         setValue(shape);
     }
     else {
@@ -405,6 +414,79 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     }
 }
 
+std::string PropertyPartShape::importBinary(TopoShape& shape, Base::Reader &reader) const
+{
+    // Note: Do NOT throw an exception here but continue reading the next files
+    // from the stream, as it's done for the BRep files. The error is returned
+    // instead of printed because this may run in a worker thread.
+    std::string name = "shape";
+    App::PropertyContainer* father = this->getContainer();
+    if (father && father->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
+        name = "shape of '";
+        name += static_cast<App::DocumentObject*>(father)->Label.getValue();
+        name += "'";
+    }
+
+    std::stringstream str;
+    try {
+        shape.importBinary(reader);
+    }
+    catch (const Standard_Failure& e) {
+        if (_BinaryVersion > OCC_VERSION_HEX) {
+            str << "Cannot read binary " << name << ", it was saved with OCC "
+                << (_BinaryVersion >> 16) << "." << ((_BinaryVersion >> 8) & 0xff)
+                << "." << (_BinaryVersion & 0xff);
+        }
+        else {
+            str << "Cannot read binary " << name << ": " << e.GetMessageString();
+        }
+        shape.setShape(TopoDS_Shape());
+    }
+    catch (const Base::Exception& e) {
+        str << e.what();
+        shape.setShape(TopoDS_Shape());
+    }
+    return str.str();
+}
+
+bool PropertyPartShape::isSaveDocFileConcurrent() const
+{
+    // Without direct access a temporary file is used, so save it the usual way
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+}
+
+bool PropertyPartShape::isRestoreDocFileConcurrent() const
+{
+    // Without direct access a temporary file is used, so restore it the usual way
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+}
+
+std::function<void()> PropertyPartShape::RestoreDocFileConcurrent(Base::Reader &reader)
+{
+    // The shape is read in a worker thread, but it's set and errors are reported
+    // in the main thread
+    Base::FileInfo brep(reader.getFileName());
+    TopoShape shape;
+    std::string error;
+    if (brep.hasExtension("bin")) {
+        error = importBinary(shape, reader);
+    }
+    else {
+        BRep_Builder builder;
+        TopoDS_Shape sh;
+        BRepTools::Read(sh, reader, builder);
+        shape.setShape(sh);
+    }
+
+    return [this, shape, error]() {
+        if (!error.empty())
+            Base::Console().Error("%s\n", error.c_str());
+        setValue(shape);
+    };
+}
+
 // -------------------------------------------------------------------------
 
 TYPESYSTEM_SOURCE(Part::PropertyShapeHistory , App::PropertyLists)
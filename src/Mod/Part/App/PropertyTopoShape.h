@@ -82,6 +82,9 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const;
     void RestoreDocFile(Base::Reader &reader);
+    bool isSaveDocFileConcurrent() const;
+    bool isRestoreDocFileConcurrent() const;
+    std::function<void()> RestoreDocFileConcurrent(Base::Reader &reader);
 
     App::Property *Copy(void) const;
     void Paste(const App::Property &from);
@@ -91,8 +94,13 @@ public:
     /// Get valid paths for this property; used by auto completer
     virtual void getPaths(std::vector<App::ObjectIdentifier> & paths) const;
 
+private:
+    std::string importBinary(TopoShape&, Base::Reader &reader) const;
+
 private:
     TopoShape _Shape;
+    /// OCC version that wrote the binary shape file being restored, 0 if unknown
+    unsigned long _BinaryVersion;
 };
 
 struct PartExport ShapeHistory {
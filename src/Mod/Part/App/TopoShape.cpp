@@ -26,8 +26,11 @@
 #ifndef _PreComp_
 # include <algorithm>
 # include <array>
+# include <atomic>
 # include <cmath>
 # include <cstdlib>
+# include <map>
+# include <mutex>
 # include <sstream>
 # include <QString>
 
@@ -306,6 +309,64 @@ std::string ShapeSegment::getName() const
 
 TYPESYSTEM_SOURCE(Part::TopoShape , Data::ComplexGeoData)
 
+namespace Part {
+// incremented by TopoShape::shapeModified(), a cache of an older generation is outdated
+static std::atomic<unsigned long> cacheGeneration(0);
+
+/**
+ * The indexed maps of the sub-shapes of a shape. Every map is built on first use,
+ * so that looking up a sub-shape by its index or the index of a sub-shape does not
+ * need to traverse the whole shape each time.
+ */
+class TopoShapeCache
+{
+public:
+    explicit TopoShapeCache(const TopoDS_Shape& s)
+        : shape(s)
+        , generation(cacheGeneration.load())
+    {
+    }
+
+    bool isValid(const TopoDS_Shape& s) const
+    {
+        return generation == cacheGeneration.load() && shape.IsEqual(s);
+    }
+
+    const TopTools_IndexedMapOfShape& getMap(TopAbs_ShapeEnum type)
+    {
+        std::call_once(flags[type], [this, type]() {
+            TopExp::MapShapes(shape, type, maps[type]);
+        });
+        return maps[type];
+    }
+
+    const TopTools_IndexedDataMapOfShapeListOfShape& getAncestors(TopAbs_ShapeEnum type,
+                                                                  TopAbs_ShapeEnum ancestor)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape>& entry =
+            ancestors[std::make_pair(type, ancestor)];
+        if (!entry) {
+            std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> map
+                (new TopTools_IndexedDataMapOfShapeListOfShape);
+            TopExp::MapShapesAndAncestors(shape, type, ancestor, *map);
+            entry = std::move(map);
+        }
+        return *entry;
+    }
+
+    const TopoDS_Shape shape;
+    const unsigned long generation;
+
+private:
+    std::once_flag flags[TopAbs_SHAPE];
+    TopTools_IndexedMapOfShape maps[TopAbs_SHAPE];
+    std::mutex mutex;
+    std::map<std::pair<TopAbs_ShapeEnum, TopAbs_ShapeEnum>,
+             std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> > ancestors;
+};
+}
+
 TopoShape::TopoShape()
 {
 }
@@ -323,6 +384,59 @@ TopoShape::TopoShape(const TopoShape& shape)
   : _Shape(shape._Shape)
 {
     Tag = shape.Tag;
+    copyCache(shape);
+}
+
+std::shared_ptr<TopoShapeCache> TopoShape::getCache() const
+{
+    std::shared_ptr<TopoShapeCache> cache = std::atomic_load(&_Cache);
+    // _Shape may have been changed without setShape(), so check the identity of the shape
+    if (cache && cache->isValid(_Shape))
+        return cache;
+
+    std::shared_ptr<TopoShapeCache> newCache = std::make_shared<TopoShapeCache>(_Shape);
+    // if another thread was faster use its cache
+    if (std::atomic_compare_exchange_strong(&_Cache, &cache, newCache))
+        return newCache;
+    return cache;
+}
+
+void TopoShape::resetCache()
+{
+    std::atomic_store(&_Cache, std::shared_ptr<TopoShapeCache>());
+}
+
+void TopoShape::shapeModified()
+{
+    ++cacheGeneration;
+}
+
+void TopoShape::copyCache(const TopoShape& shape)
+{
+    // share the cache of the other shape if it has one, but don't create it just for copying
+    std::shared_ptr<TopoShapeCache> cache = std::atomic_load(&shape._Cache);
+    if (cache && !_Shape.IsNull() && cache->isValid(_Shape))
+        std::atomic_store(&_Cache, cache);
+    else
+        resetCache();
+}
+
+const TopTools_IndexedMapOfShape& TopoShape::getSubShapeMap(TopAbs_ShapeEnum type) const
+{
+    return getCache()->getMap(type);
+}
+
+const TopTools_IndexedDataMapOfShapeListOfShape&
+TopoShape::getAncestorMap(TopAbs_ShapeEnum type, TopAbs_ShapeEnum ancestor) const
+{
+    return getCache()->getAncestors(type, ancestor);
+}
+
+int TopoShape::findSubShapeIndex(const TopoDS_Shape& subshape) const
+{
+    if (subshape.IsNull() || subshape.ShapeType() == TopAbs_SHAPE)
+        return 0;
+    return getSubShapeMap(subshape.ShapeType()).FindIndex(subshape);
 }
 
 std::vector<const char*> TopoShape::getElementTypes(void) const
@@ -372,8 +486,7 @@ TopoDS_Shape TopoShape::getSubShape(TopAbs_ShapeEnum type, int index, bool silen
                     return it.Value();
             }
         } else {
-            TopTools_IndexedMapOfShape anIndices;
-            TopExp::MapShapes(this->_Shape, type, anIndices);
+            const TopTools_IndexedMapOfShape& anIndices = getSubShapeMap(type);
             if(index <= anIndices.Extent())
                 return anIndices.FindKey(index);
         }
@@ -406,9 +519,7 @@ unsigned long TopoShape::countSubShapes(TopAbs_ShapeEnum Type) const
             ++count;
         return count;
     }
-    TopTools_IndexedMapOfShape anIndices;
-    TopExp::MapShapes(this->_Shape, Type, anIndices);
-    return anIndices.Extent();
+    return getSubShapeMap(Type).Extent();
 }
 
 bool TopoShape::hasSubShape(TopAbs_ShapeEnum type) const {
@@ -426,19 +537,18 @@ bool TopoShape::hasSubShape(const char *Type) const {
 }
 
 template<class T>
-static inline std::vector<T> _getSubShapes(const TopoDS_Shape &s, TopAbs_ShapeEnum type) {
+static inline std::vector<T> _getSubShapes(const TopoShape &s, TopAbs_ShapeEnum type) {
     std::vector<T> shapes;
-    if(s.IsNull())
+    if(s.isNull())
         return shapes;
 
     if(type == TopAbs_SHAPE) {
-        for(TopoDS_Iterator it(s);it.More();it.Next())
+        for(TopoDS_Iterator it(s.getShape());it.More();it.Next())
             shapes.emplace_back(it.Value());
         return shapes;
     }
 
-    TopTools_IndexedMapOfShape anIndices;
-    TopExp::MapShapes(s, type, anIndices);
+    const TopTools_IndexedMapOfShape& anIndices = s.getSubShapeMap(type);
     int count = anIndices.Extent();
     shapes.reserve(count);
     for(int i=1;i<=count;++i)
@@ -447,11 +557,11 @@ static inline std::vector<T> _getSubShapes(const TopoDS_Shape &s, TopAbs_ShapeEn
 }
 
 std::vector<TopoShape> TopoShape::getSubTopoShapes(TopAbs_ShapeEnum type) const {
-    return _getSubShapes<TopoShape>(_Shape,type);
+    return _getSubShapes<TopoShape>(*this,type);
 }
 
 std::vector<TopoDS_Shape> TopoShape::getSubShapes(TopAbs_ShapeEnum type) const {
-    return _getSubShapes<TopoDS_Shape>(_Shape,type);
+    return _getSubShapes<TopoDS_Shape>(*this,type);
 }
 
 static std::array<std::string,TopAbs_SHAPE> _ShapeNames;
@@ -612,6 +722,7 @@ void TopoShape::operator = (const TopoShape& sh)
     if (this != &sh) {
         this->Tag = sh.Tag;
         this->_Shape = sh._Shape;
+        copyCache(sh);
     }
 }
 
@@ -1176,12 +1287,10 @@ void TopoShape::exportLineSet(std::ostream& str) const
 {
     Base::InventorBuilder builder(str);
     // get a indexed map of edges
-    TopTools_IndexedMapOfShape M;
-    TopExp::MapShapes(this->_Shape, TopAbs_EDGE, M);
+    const TopTools_IndexedMapOfShape& M = getSubShapeMap(TopAbs_EDGE);
 
     // build up map edge->face
-    TopTools_IndexedDataMapOfShapeListOfShape edge2Face;
-    TopExp::MapShapesAndAncestors(this->_Shape, TopAbs_EDGE, TopAbs_FACE, edge2Face);
+    const TopTools_IndexedDataMapOfShapeListOfShape& edge2Face = getAncestorMap(TopAbs_EDGE, TopAbs_FACE);
     for (int i=0; i<M.Extent(); i++)
     {
         const TopoDS_Edge& aEdge = TopoDS::Edge(M(i+1));
@@ -3804,8 +3913,7 @@ void TopoShape::getLinesFromSubelement(const Data::Segment* element,
         }
 
         // build up map edge->face
-        TopTools_IndexedDataMapOfShapeListOfShape edge2Face;
-        TopExp::MapShapesAndAncestors(this->_Shape, TopAbs_EDGE, TopAbs_FACE, edge2Face);
+        const TopTools_IndexedDataMapOfShapeListOfShape& edge2Face = getAncestorMap(TopAbs_EDGE, TopAbs_FACE);
 
         for(TopExp_Explorer exp(shape,TopAbs_EDGE);exp.More();exp.Next()) {
 
@@ -4101,8 +4209,7 @@ TopoShape &TopoShape::makEWires(const TopoShape &shape, const char *op, bool fix
     std::list<TopoShape> edge_list;
     std::vector<TopoShape> wires;
 
-    TopTools_IndexedMapOfShape anIndices;
-    TopExp::MapShapes(shape.getShape(), TopAbs_EDGE, anIndices);
+    const TopTools_IndexedMapOfShape& anIndices = shape.getSubShapeMap(TopAbs_EDGE);
     for(int i=1;i<=anIndices.Extent();++i)
         edge_list.push_back(anIndices.FindKey(i));
 
@@ -25,8 +25,11 @@
 #define PART_TOPOSHAPE_H
 
 #include <iosfwd>
+#include <memory>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Wire.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <App/ComplexGeoData.h>
 #include <Base/Exception.h>
@@ -81,6 +84,7 @@ public:
     TopoDS_Shape Shape;
 };
 
+class TopoShapeCache;
 
 
 /** The representation for a CAD Shape
@@ -97,6 +101,7 @@ public:
 
     inline void setShape(const TopoDS_Shape& shape) {
         this->_Shape = shape;
+        resetCache();
     }
 
     inline const TopoDS_Shape& getShape() const {
@@ -157,6 +162,26 @@ public:
     bool hasSubShape(TopAbs_ShapeEnum type) const;
     /// get the Topo"sub"Shape with the given name
     PyObject * getPySubShape(const char* Type, bool silent=false) const;
+
+    /** @name Sub-shape index maps
+     * The maps are built on first use and kept as long as the shape is not changed.
+     * Copies of a TopoShape with the same shape share them, and they may be accessed
+     * from several threads. The returned references become invalid when the shape
+     * is changed.
+     */
+    //@{
+    /// Returns the indexed map of the sub-shapes of the given type, as TopExp::MapShapes
+    const TopTools_IndexedMapOfShape& getSubShapeMap(TopAbs_ShapeEnum type) const;
+    /// Returns the map of the sub-shapes of \a type to their ancestors of type \a ancestor
+    const TopTools_IndexedDataMapOfShapeListOfShape& getAncestorMap(TopAbs_ShapeEnum type,
+                                                                    TopAbs_ShapeEnum ancestor) const;
+    /// Returns the one-based index of a sub-shape or 0 if it is not a sub-shape
+    int findSubShapeIndex(const TopoDS_Shape& subshape) const;
+    /** Must be called after a shape was modified in place, e.g. with BRep_Builder::Add.
+     * Other TopoShapes may share the modified shape, so the maps of all shapes are dropped.
+     */
+    static void shapeModified();
+    //@}
     PyObject * getPyObject();
     void setPyObject(PyObject*);
 
@@ -368,8 +393,14 @@ public:
     static const std::string &shapeName(TopAbs_ShapeEnum type,bool silent=false);
     const std::string &shapeName(bool silent=false) const;
     static std::pair<TopAbs_ShapeEnum,int> shapeTypeAndIndex(const char *name);
+private:
+    std::shared_ptr<TopoShapeCache> getCache() const;
+    void resetCache();
+    void copyCache(const TopoShape&);
+
 private:
     TopoDS_Shape _Shape;
+    mutable std::shared_ptr<TopoShapeCache> _Cache;
 };
 
 } //namespace Part
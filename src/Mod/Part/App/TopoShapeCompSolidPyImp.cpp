@@ -103,8 +103,11 @@ PyObject*  TopoShapeCompSolidPy::add(PyObject *args)
     try {
         const TopoDS_Shape& sh = static_cast<TopoShapePy*>(obj)->
             getTopoShapePtr()->getShape();
-        if (!sh.IsNull())
+        if (!sh.IsNull()) {
             builder.Add(comp, sh);
+            // the compound solid is modified in place and may be shared by other shapes
+            TopoShape::shapeModified();
+        }
         else
             Standard_Failure::Raise("Cannot empty shape to compound solid");
     }
@@ -106,8 +106,11 @@ PyObject*  TopoShapeCompoundPy::add(PyObject *args)
     try {
         const TopoDS_Shape& sh = static_cast<TopoShapePy*>(obj)->
             getTopoShapePtr()->getShape();
-        if (!sh.IsNull())
+        if (!sh.IsNull()) {
             builder.Add(comp, sh);
+            // the compound is modified in place and may be shared by other shapes
+            TopoShape::shapeModified();
+        }
     }
     catch (Standard_Failure& e) {
 
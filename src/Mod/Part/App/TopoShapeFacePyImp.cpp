@@ -416,6 +416,8 @@ PyObject* TopoShapeFacePy::addWire(PyObject *args)
     TopoDS_Face face = TopoDS::Face(getTopoShapePtr()->getShape());
     const TopoDS_Shape& shape = static_cast<TopoShapeWirePy*>(wire)->getTopoShapePtr()->getShape();
     aBuilder.Add(face, shape);
+    // the face is modified in place and may be shared by other shapes
+    TopoShape::shapeModified();
     getTopoShapePtr()->setShape(face);
     Py_Return;
 }
@@ -1312,8 +1312,8 @@ PyObject*  TopoShapePy::ancestorsOfType(PyObject *args)
             }
         }
 
-        TopTools_IndexedDataMapOfShapeListOfShape mapOfShapeShape;
-        TopExp::MapShapesAndAncestors(model, shape.ShapeType(), shapetype, mapOfShapeShape);
+        const TopTools_IndexedDataMapOfShapeListOfShape& mapOfShapeShape =
+                getTopoShapePtr()->getAncestorMap(shape.ShapeType(), shapetype);
         const TopTools_ListOfShape& ancestors = mapOfShapeShape.FindFromKey(shape);
 
         Py::List list;
@@ -1604,10 +1604,8 @@ PyObject* TopoShapePy::makeChamfer(PyObject *args)
         try {
             const TopoDS_Shape& shape = this->getTopoShapePtr()->getShape();
             BRepFilletAPI_MakeChamfer mkChamfer(shape);
-            TopTools_IndexedMapOfShape mapOfEdges;
-            TopTools_IndexedDataMapOfShapeListOfShape mapEdgeFace;
-            TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, mapEdgeFace);
-            TopExp::MapShapes(shape, TopAbs_EDGE, mapOfEdges);
+            const TopTools_IndexedDataMapOfShapeListOfShape& mapEdgeFace =
+                    this->getTopoShapePtr()->getAncestorMap(TopAbs_EDGE, TopAbs_FACE);
             Py::Sequence list(obj);
             for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
                 if (PyObject_TypeCheck((*it).ptr(), &(Part::TopoShapePy::Type))) {
@@ -1635,10 +1633,8 @@ PyObject* TopoShapePy::makeChamfer(PyObject *args)
         try {
             const TopoDS_Shape& shape = this->getTopoShapePtr()->getShape();
             BRepFilletAPI_MakeChamfer mkChamfer(shape);
-            TopTools_IndexedMapOfShape mapOfEdges;
-            TopTools_IndexedDataMapOfShapeListOfShape mapEdgeFace;
-            TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, mapEdgeFace);
-            TopExp::MapShapes(shape, TopAbs_EDGE, mapOfEdges);
+            const TopTools_IndexedDataMapOfShapeListOfShape& mapEdgeFace =
+                    this->getTopoShapePtr()->getAncestorMap(TopAbs_EDGE, TopAbs_FACE);
             Py::Sequence list(obj);
             for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
                 if (PyObject_TypeCheck((*it).ptr(), &(Part::TopoShapePy::Type))) {
@@ -141,6 +141,8 @@ PyObject*  TopoShapeShellPy::add(PyObject *args)
             getTopoShapePtr()->getShape();
         if (!sh.IsNull()) {
             builder.Add(shell, sh);
+            // the shell is modified in place and may be shared by other shapes
+            TopoShape::shapeModified();
             BRepCheck_Analyzer check(shell);
             if (!check.IsValid()) {
                 ShapeUpgrade_ShellSewing sewShell;
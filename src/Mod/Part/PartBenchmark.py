@@ -0,0 +1,110 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Compares the text and the binary BRep format for saving and loading shapes.
+
+    import PartBenchmark
+    PartBenchmark.run()
+
+saves a corpus of sample shapes to a document twice, once for each value of
+the SaveBinaryBrep document preference, and prints the file size and the
+times to save the document and to load it again for each format.
+"""
+
+import os
+import tempfile
+import time
+import FreeCAD, Part
+
+App = FreeCAD
+
+def makeCorpus(count=10):
+    """Return a list of (name, shape) of sample shapes. The shapes are
+    repeated count times in a grid to get documents of a useful size."""
+    box = Part.makeBox(10, 10, 10)
+    cyl = Part.makeCylinder(2, 20, App.Vector(5, 5, -5))
+    fillet = box.makeFillet(1.0, box.Edges)
+    cut = box.cut(cyl)
+
+    holes = box.copy()
+    for i in range(4):
+        for j in range(4):
+            holes = holes.cut(Part.makeCylinder(0.8, 20, App.Vector(1.5 + 2.3 * i, 1.5 + 2.3 * j, -5)))
+
+    points = [[App.Vector(i, j, ((i - 3) * (j - 4)) * 0.1) for j in range(8)] for i in range(8)]
+    surface = Part.BSplineSurface()
+    surface.interpolate(points)
+    bspline = surface.toShape()
+
+    spheres = Part.makeCompound([Part.makeSphere(1, App.Vector(3 * i, 0, 0)) for i in range(20)])
+
+    samples = [("Box", box), ("Fillet", fillet), ("Cut", cut), ("Holes", holes),
+               ("BSpline", bspline), ("Spheres", spheres)]
+
+    corpus = []
+    for n in range(count):
+        offset = App.Vector(30 * n, 0, 0)
+        for name, shape in samples:
+            shape = shape.copy()
+            shape.translate(offset)
+            corpus.append(("%s%d" % (name, n), shape))
+    return corpus
+
+def measure(corpus, binary, filename):
+    """Return the file size and the time of saving and loading a document
+    with the shapes of the corpus."""
+    hGrp = App.ParamGet("User parameter:BaseApp/Preferences/Document")
+    oldValue = hGrp.GetBool("SaveBinaryBrep", False)
+    hGrp.SetBool("SaveBinaryBrep", binary)
+    try:
+        doc = App.newDocument("PartBenchmark")
+        for name, shape in corpus:
+            doc.addObject("Part::Feature", name).Shape = shape
+
+        start = time.time()
+        doc.saveAs(filename)
+        save = time.time() - start
+        App.closeDocument(doc.Name)
+
+        start = time.time()
+        doc = App.openDocument(filename)
+        load = time.time() - start
+        App.closeDocument(doc.Name)
+    finally:
+        hGrp.SetBool("SaveBinaryBrep", oldValue)
+
+    return os.path.getsize(filename), save, load
+
+def run(count=10):
+    """Print the file size and the save and load time of the corpus in the
+    text and binary format"""
+    corpus = makeCorpus(count)
+    directory = tempfile.mkdtemp()
+    App.Console.PrintMessage("%d shapes\n" % len(corpus))
+    App.Console.PrintMessage("%8s %12s %10s %10s\n" % ("format", "size [kB]", "save [s]", "load [s]"))
+    for binary in (False, True):
+        filename = os.path.join(directory, "binary.FCStd" if binary else "text.FCStd")
+        size, save, load = measure(corpus, binary, filename)
+        os.remove(filename)
+        App.Console.PrintMessage("%8s %12.1f %10.3f %10.3f\n" %
+                                 ("binary" if binary else "text", size / 1024.0, save, load))
+    os.rmdir(directory)
@@ -21,6 +21,9 @@
 
 import FreeCAD, unittest, Part
 import copy 
+import os
+import tempfile
+import zipfile
 from FreeCAD import Units
 App = FreeCAD
 
@@ -54,6 +57,91 @@ class PartTestCases(unittest.TestCase):
         #self.Doc.addObject("Part::Feature","Face").Shape = result
         #self.assertTrue(isinstance(result.Surface, Part.BSplineSurface))
 
+    def testSaveRestoreBrep(self):
+        box = Part.makeBox(10, 10, 10)
+        shape = box.cut(Part.makeCylinder(2, 20, App.Vector(5, 5, -5)))
+        shape.Placement = App.Placement(App.Vector(1, 2, 3), App.Rotation())
+        self.Doc.addObject("Part::Feature", "Shape").Shape = shape
+        self.Doc.addObject("Part::Feature", "Empty")
+
+        fileName = os.path.join(tempfile.gettempdir(), "PartSaveRestoreBrep.FCStd")
+        hGrp = App.ParamGet("User parameter:BaseApp/Preferences/Document")
+        binary = hGrp.GetBool("SaveBinaryBrep", False)
+        try:
+            for value in (False, True):
+                hGrp.SetBool("SaveBinaryBrep", value)
+                self.Doc.saveCopy(fileName)
+                # the shape files are written and compressed by worker threads
+                with zipfile.ZipFile(fileName) as archive:
+                    self.assertIsNone(archive.testzip())
+                doc = App.openDocument(fileName)
+                restored = doc.getObject("Shape").Shape
+                self.assertTrue(doc.getObject("Empty").Shape.isNull())
+                self.assertEqual(len(restored.Faces), len(shape.Faces))
+                self.assertAlmostEqual(restored.Volume, shape.Volume, 6)
+                self.assertEqual(restored.Placement.Base, shape.Placement.Base)
+                App.closeDocument(doc.Name)
+        finally:
+            hGrp.SetBool("SaveBinaryBrep", binary)
+            os.remove(fileName)
+
+    def testSubShapeCacheSetShape(self):
+        box = Part.makeBox(1, 2, 3)
+        self.assertEqual(len(box.Faces), 6)
+        face = box.getElement("Face2")
+        self.assertAlmostEqual(face.BoundBox.XMin, 1.0)
+        edge = box.getElement("Edge1")
+        self.assertEqual(len(box.ancestorsOfType(edge, Part.Face)), 2)
+
+        # the sub-shapes must follow the new shape
+        box.translate(App.Vector(10, 0, 0))
+        self.assertAlmostEqual(box.getElement("Face2").BoundBox.XMin, 11.0)
+        box.importBrepFromString(Part.makeCylinder(1, 2).exportBrepToString())
+        self.assertEqual(len(box.Faces), 3)
+        self.assertEqual(len(box.Edges), 3)
+        self.assertTrue(box.getElement("Face1").isSame(box.Faces[0]))
+        self.assertEqual(len(box.ancestorsOfType(box.Faces[1], Part.Solid)), 1)
+
+    def testSubShapeCacheCopy(self):
+        box = Part.makeBox(1, 2, 3)
+        self.assertEqual(len(box.Faces), 6)
+        copy = Part.Shape(box)
+        self.assertTrue(copy.getElement("Face3").isSame(box.getElement("Face3")))
+        edge = copy.getElement("Edge4")
+        self.assertEqual(len(copy.ancestorsOfType(edge, Part.Face)), 2)
+        self.assertEqual(len(box.ancestorsOfType(edge, Part.Face)), 2)
+
+        # changing the copy must not change the sub-shapes of the original
+        copy.translate(App.Vector(0, 0, 5))
+        self.assertAlmostEqual(copy.getElement("Face3").BoundBox.ZMin, 5.0)
+        self.assertAlmostEqual(box.getElement("Face3").BoundBox.ZMin, 0.0)
+        self.assertEqual(len(box.ancestorsOfType(edge, Part.Face)), 2)
+        faces = copy.ancestorsOfType(copy.getElement("Edge4"), Part.Face)
+        self.assertEqual(len(faces), 2)
+        self.assertFalse(faces[0].isSame(box.Faces[0]))
+        self.assertGreaterEqual(faces[0].BoundBox.ZMin, 5.0)
+
+        # the shape property copies the shape on assignment and access
+        feature = self.Doc.addObject("Part::Feature", "Box")
+        feature.Shape = box
+        self.assertTrue(feature.Shape.getElement("Edge4").isSame(edge))
+        feature.Shape = Part.makeSphere(1)
+        self.assertEqual(len(feature.Shape.Faces), 1)
+        self.assertEqual(len(feature.Shape.ancestorsOfType(feature.Shape.Edges[0], Part.Face)), 1)
+        self.assertEqual(len(box.Faces), 6)
+
+    def testSubShapeCacheAdd(self):
+        # Compound.add modifies the compound in place, so a copy sees the new sub-shapes
+        comp = Part.Compound([Part.makeBox(1, 1, 1)])
+        copy = Part.Shape(comp)
+        other = Part.Shape(comp)
+        self.assertTrue(copy.getElement("Face6").isSame(comp.getElement("Face6")))
+        self.assertTrue(other.getElement("Face6").isSame(comp.getElement("Face6")))
+        comp.add(Part.makeBox(1, 1, 1, App.Vector(2, 0, 0)))
+        self.assertAlmostEqual(comp.getElement("Face12").BoundBox.XMin, 2.0)
+        self.assertAlmostEqual(copy.getElement("Face12").BoundBox.XMin, 2.0)
+        self.assertEqual(len(other.ancestorsOfType(other.getElement("Face12"), Part.Solid)), 1)
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartTest")
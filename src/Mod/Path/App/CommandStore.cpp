@@ -0,0 +1,341 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <bitset>
+# include <istream>
+# include <ostream>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+
+#include "CommandStore.h"
+
+using namespace Path;
+
+namespace {
+
+const uint32_t storeMagic = 0x48544150; // "PATH"
+const uint32_t storeVersion = 1;
+
+void writeString(Base::OutputStream& str, std::ostream& out, const std::string& s)
+{
+    str << static_cast<uint32_t>(s.size());
+    out.write(s.data(), s.size());
+}
+
+void readString(Base::InputStream& str, std::istream& in, std::string& s)
+{
+    uint32_t len = 0;
+    str >> len;
+    if (!in)
+        throw Base::BadFormatError("Truncated path file");
+    s.resize(len);
+    if (len > 0)
+        in.read(&s[0], len);
+}
+
+void checkStream(std::istream& in)
+{
+    if (!in)
+        throw Base::BadFormatError("Truncated path file");
+}
+
+std::size_t countSlots(uint16_t mask)
+{
+    return std::bitset<16>(mask).count();
+}
+
+}
+
+CommandStore::CommandStore()
+    : valueOffsets(1, 0)
+    , extraOffsets(1, 0)
+{
+}
+
+CommandStore::~CommandStore()
+{
+}
+
+void CommandStore::clear()
+{
+    names.clear();
+    keys.clear();
+    nameIds.clear();
+    keyIds.clear();
+    opcodes.clear();
+    masks.clear();
+    valueOffsets.assign(1, 0);
+    extraOffsets.assign(1, 0);
+    values.clear();
+    extraKeys.clear();
+    extraValues.clear();
+}
+
+void CommandStore::reserve(std::size_t count)
+{
+    opcodes.reserve(count);
+    masks.reserve(count);
+    valueOffsets.reserve(count + 1);
+    extraOffsets.reserve(count + 1);
+    values.reserve(count * 3);
+}
+
+CommandStore::Slot CommandStore::toSlot(const std::string& name)
+{
+    if (name.size() != 1)
+        return SlotCount;
+    switch (name[0]) {
+    case 'X': return X;
+    case 'Y': return Y;
+    case 'Z': return Z;
+    case 'A': return A;
+    case 'B': return B;
+    case 'C': return C;
+    case 'I': return I;
+    case 'J': return J;
+    case 'K': return K;
+    case 'F': return F;
+    case 'R': return R;
+    case 'P': return P;
+    case 'Q': return Q;
+    default:  return SlotCount;
+    }
+}
+
+const std::string& CommandStore::slotName(Slot slot)
+{
+    static const std::string slotNames[SlotCount + 1] = {
+        "X", "Y", "Z", "A", "B", "C", "I", "J", "K", "F", "R", "P", "Q", ""
+    };
+    return slotNames[slot];
+}
+
+uint32_t CommandStore::nameId(const std::string& name)
+{
+    auto it = nameIds.find(name);
+    if (it != nameIds.end())
+        return it->second;
+    uint32_t id = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    nameIds.emplace(name, id);
+    return id;
+}
+
+uint32_t CommandStore::keyId(const std::string& key)
+{
+    auto it = keyIds.find(key);
+    if (it != keyIds.end())
+        return it->second;
+    uint32_t id = static_cast<uint32_t>(keys.size());
+    keys.push_back(key);
+    keyIds.emplace(key, id);
+    return id;
+}
+
+void CommandStore::append(const Command& cmd)
+{
+    double slots[SlotCount] = {};
+    uint16_t mask = 0;
+    for (const auto& it : cmd.Parameters) {
+        Slot slot = toSlot(it.first);
+        if (slot != SlotCount) {
+            slots[slot] = it.second;
+            mask |= static_cast<uint16_t>(1u << slot);
+        }
+        else {
+            extraKeys.push_back(keyId(it.first));
+            extraValues.push_back(it.second);
+        }
+    }
+
+    // the values are packed in slot order
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (mask & (1u << slot))
+            values.push_back(slots[slot]);
+    }
+
+    opcodes.push_back(nameId(cmd.Name));
+    masks.push_back(mask);
+    valueOffsets.push_back(static_cast<uint32_t>(values.size()));
+    extraOffsets.push_back(static_cast<uint32_t>(extraKeys.size()));
+}
+
+void CommandStore::setCommands(const std::vector<Command*>& commands)
+{
+    clear();
+    reserve(commands.size());
+    for (auto it : commands)
+        append(*it);
+}
+
+double CommandStore::getValue(std::size_t index, Slot slot, double fallback) const
+{
+    uint16_t mask = masks[index];
+    if (!(mask & (1u << slot)))
+        return fallback;
+    uint16_t below = static_cast<uint16_t>(mask & ((1u << slot) - 1));
+    return values[valueOffsets[index] + countSlots(below)];
+}
+
+Command CommandStore::getCommand(std::size_t index) const
+{
+    Command cmd;
+    cmd.Name = names[opcodes[index]];
+
+    uint16_t mask = masks[index];
+    uint32_t pos = valueOffsets[index];
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (mask & (1u << slot))
+            cmd.Parameters[slotName(static_cast<Slot>(slot))] = values[pos++];
+    }
+    for (uint32_t i = extraOffsets[index]; i < extraOffsets[index + 1]; ++i)
+        cmd.Parameters[keys[extraKeys[i]]] = extraValues[i];
+    return cmd;
+}
+
+void CommandStore::getCommands(std::vector<Command*>& commands) const
+{
+    commands.reserve(commands.size() + size());
+    for (std::size_t i = 0; i < size(); ++i)
+        commands.push_back(new Command(getCommand(i)));
+}
+
+std::size_t CommandStore::getMemSize() const
+{
+    std::size_t size = 0;
+    for (const auto& name : names)
+        size += name.size();
+    for (const auto& key : keys)
+        size += key.size();
+    size += opcodes.size() * sizeof(uint32_t);
+    size += masks.size() * sizeof(uint16_t);
+    size += valueOffsets.size() * sizeof(uint32_t);
+    size += extraOffsets.size() * sizeof(uint32_t);
+    size += values.size() * sizeof(double);
+    size += extraKeys.size() * sizeof(uint32_t);
+    size += extraValues.size() * sizeof(double);
+    return size;
+}
+
+void CommandStore::write(std::ostream& out) const
+{
+    Base::OutputStream str(out);
+    str << storeMagic << storeVersion;
+
+    str << static_cast<uint32_t>(names.size());
+    for (const auto& name : names)
+        writeString(str, out, name);
+    str << static_cast<uint32_t>(keys.size());
+    for (const auto& key : keys)
+        writeString(str, out, key);
+
+    // the offsets are not written, they follow from the masks and the extra counts
+    str << static_cast<uint32_t>(size());
+    for (auto opcode : opcodes)
+        str << opcode;
+    for (auto mask : masks)
+        str << mask;
+    for (std::size_t i = 0; i < size(); ++i)
+        str << (extraOffsets[i + 1] - extraOffsets[i]);
+
+    for (auto value : values)
+        str << value;
+    for (auto key : extraKeys)
+        str << key;
+    for (auto value : extraValues)
+        str << value;
+}
+
+void CommandStore::read(std::istream& in)
+{
+    clear();
+
+    Base::InputStream str(in);
+    uint32_t magic = 0, version = 0;
+    str >> magic >> version;
+    checkStream(in);
+    if (magic != storeMagic)
+        throw Base::BadFormatError("Not a binary path file");
+    if (version > storeVersion)
+        throw Base::BadFormatError("Binary path file was written by a newer version");
+
+    uint32_t count = 0;
+    str >> count;
+    checkStream(in);
+    names.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        readString(str, in, names[i]);
+        nameIds.emplace(names[i], i);
+    }
+    str >> count;
+    checkStream(in);
+    keys.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        readString(str, in, keys[i]);
+        keyIds.emplace(keys[i], i);
+    }
+    checkStream(in);
+
+    str >> count;
+    checkStream(in);
+    opcodes.resize(count);
+    masks.resize(count);
+    valueOffsets.resize(count + 1);
+    extraOffsets.resize(count + 1);
+    for (auto& opcode : opcodes) {
+        str >> opcode;
+        if (opcode >= names.size())
+            throw Base::BadFormatError("Invalid command in path file");
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        str >> masks[i];
+        if (masks[i] >> SlotCount)
+            throw Base::BadFormatError("Invalid parameters in path file");
+        valueOffsets[i + 1] = valueOffsets[i] + static_cast<uint32_t>(countSlots(masks[i]));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        uint32_t extras = 0;
+        str >> extras;
+        extraOffsets[i + 1] = extraOffsets[i] + extras;
+    }
+    checkStream(in);
+
+    values.resize(valueOffsets.back());
+    for (auto& value : values)
+        str >> value;
+    extraKeys.resize(extraOffsets.back());
+    for (auto& key : extraKeys) {
+        str >> key;
+        if (key >= keys.size())
+            throw Base::BadFormatError("Invalid parameter in path file");
+    }
+    extraValues.resize(extraOffsets.back());
+    for (auto& value : extraValues)
+        str >> value;
+    checkStream(in);
+}
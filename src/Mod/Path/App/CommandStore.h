@@ -0,0 +1,118 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef PATH_COMMANDSTORE_H
+#define PATH_COMMANDSTORE_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Command.h"
+
+namespace Path
+{
+    /** A compact columnar store of cnc commands.
+     *
+     * Every command is an opcode, i.e. an index into a table of command names, and a
+     * mask of the fixed axis slots it uses. The values of the used slots of all commands
+     * are packed into one array. Parameters that have no slot are kept as sparse extras
+     * with an index into a table of parameter names.
+     *
+     * The store is the binary file format of a Toolpath in a document. It is written
+     * instead of G-code unless Mod/Path/SavePathAsGCode is set. A restored Toolpath
+     * keeps the store and only creates its Command objects when they are accessed,
+     * single entries can be read with getName(), has() and getValue().
+     */
+    class PathExport CommandStore
+    {
+    public:
+        /// The fixed parameter slots
+        enum Slot { X, Y, Z, A, B, C, I, J, K, F, R, P, Q, SlotCount };
+
+        CommandStore();
+        ~CommandStore();
+
+        void clear();
+        void reserve(std::size_t count);
+        /// Appends a command
+        void append(const Command&);
+        /// Replaces the content with the given commands
+        void setCommands(const std::vector<Command*>&);
+
+        std::size_t size() const
+        { return opcodes.size(); }
+        /// Returns the name of the command at \a index
+        const std::string& getName(std::size_t index) const
+        { return names[opcodes[index]]; }
+        /// Returns true if the command at \a index uses the given slot
+        bool has(std::size_t index, Slot slot) const
+        { return (masks[index] & (1u << slot)) != 0; }
+        /// Returns the value of the given slot or \a fallback if the command does not use it
+        double getValue(std::size_t index, Slot slot, double fallback = 0.0) const;
+        /// Creates the command at \a index
+        Command getCommand(std::size_t index) const;
+        /// Appends new commands for all entries to \a commands
+        void getCommands(std::vector<Command*>& commands) const;
+        /// Returns the memory used by the store
+        std::size_t getMemSize() const;
+
+        /** @name Binary format */
+        //@{
+        /// Writes the store to a binary stream
+        void write(std::ostream&) const;
+        /// Reads the store from a binary stream, throws Base::BadFormatError for invalid data
+        void read(std::istream&);
+        //@}
+
+        /// Returns the slot of a parameter name or SlotCount if it has no fixed slot
+        static Slot toSlot(const std::string& name);
+        /// Returns the parameter name of a slot
+        static const std::string& slotName(Slot);
+
+    private:
+        uint32_t nameId(const std::string&);
+        uint32_t keyId(const std::string&);
+
+    private:
+        // command and parameter names
+        std::vector<std::string> names;
+        std::vector<std::string> keys;
+        std::unordered_map<std::string, uint32_t> nameIds;
+        std::unordered_map<std::string, uint32_t> keyIds;
+        // one entry per command
+        std::vector<uint32_t> opcodes;
+        std::vector<uint16_t> masks;
+        std::vector<uint32_t> valueOffsets;
+        std::vector<uint32_t> extraOffsets;
+        // packed slot values and sparse extras
+        std::vector<double> values;
+        std::vector<uint32_t> extraKeys;
+        std::vector<double> extraValues;
+    };
+
+} //namespace Path
+
+#endif // PATH_COMMANDSTORE_H
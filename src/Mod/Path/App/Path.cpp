@@ -24,6 +24,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <iterator>
+# include <boost/algorithm/string/predicate.hpp>
 # include <boost/regex.hpp>
 #endif
 
@@ -42,6 +44,7 @@
 //#include "Mod/Robot/App/kdl_cp/utilities/error.h"
 
 #include "Path.h"
+#include "CommandStore.h"
 #include <Mod/Path/App/PathSegmentWalker.h>
 
 using namespace Path;
@@ -72,10 +75,21 @@ Toolpath &Toolpath::operator=(const Toolpath& otherPath)
         return *this;
 
     clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it=otherPath.vpcCommands.begin();it!=otherPath.vpcCommands.end();++it,i++) {
-        vpcCommands[i] = new Command(**it);
+    std::shared_ptr<const CommandStore> otherStore;
+    {
+        std::lock_guard<std::mutex> lock(otherPath.storeMutex);
+        otherStore = otherPath.store;
+    }
+    if (otherStore) {
+        // the store is never modified, so it can be shared
+        store = otherStore;
+    }
+    else {
+        vpcCommands.resize(otherPath.vpcCommands.size());
+        int i = 0;
+        for (std::vector<Command*>::const_iterator it=otherPath.vpcCommands.begin();it!=otherPath.vpcCommands.end();++it,i++) {
+            vpcCommands[i] = new Command(**it);
+        }
     }
     center = otherPath.center;
     recalculate();
@@ -87,11 +101,28 @@ void Toolpath::clear(void)
     for(std::vector<Command*>::iterator it = vpcCommands.begin();it!=vpcCommands.end();++it)
         delete ( *it );
     vpcCommands.clear();
+    store.reset();
     recalculate();
 }
 
+unsigned int Toolpath::getSize(void) const
+{
+    std::lock_guard<std::mutex> lock(storeMutex);
+    return store ? store->size() : vpcCommands.size();
+}
+
+void Toolpath::materialize(void) const
+{
+    std::lock_guard<std::mutex> lock(storeMutex);
+    if (store) {
+        store->getCommands(vpcCommands);
+        store.reset();
+    }
+}
+
 void Toolpath::addCommand(const Command &Cmd)
 {
+    materialize();
     Command *tmp = new Command(Cmd);
     vpcCommands.push_back(tmp);
     recalculate();
@@ -99,6 +130,7 @@ void Toolpath::addCommand(const Command &Cmd)
 
 void Toolpath::insertCommand(const Command &Cmd, int pos)
 {
+    materialize();
     if (pos == -1) {
         addCommand(Cmd);
     } else if (pos <= static_cast<int>(vpcCommands.size())) {
@@ -112,6 +144,7 @@ void Toolpath::insertCommand(const Command &Cmd, int pos)
 
 void Toolpath::deleteCommand(int pos)
 {
+    materialize();
     if (pos == -1) {
         //delete(*vpcCommands.rbegin()); // causes crash
         vpcCommands.pop_back();
@@ -125,6 +158,7 @@ void Toolpath::deleteCommand(int pos)
 
 double Toolpath::getLength()
 {
+    materialize();
     if(vpcCommands.size()==0)
         return 0;
     double l = 0;
@@ -168,6 +202,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
+    materialize();
     if (vpcCommands.size() == 0) {
         return 0;
     }
@@ -359,6 +394,7 @@ void Toolpath::setFromGCode(const std::string instr)
 
 std::string Toolpath::toGCode(void) const
 {
+    materialize();
     std::string result;
     for (std::vector<Command*>::const_iterator it=vpcCommands.begin();it!=vpcCommands.end();++it) {
         result += (*it)->toGCode();
@@ -434,6 +470,11 @@ void Toolpath::recalculate(void) // recalculates the path cache
 
 unsigned int Toolpath::getMemSize (void) const
 {
+    {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        if (store)
+            return static_cast<unsigned int>(store->getMemSize());
+    }
     return toGCode().size();
 }
 
@@ -443,6 +484,15 @@ void Toolpath::setCenter(const Base::Vector3d &c)
     recalculate();
 }
 
+// The commands are saved in the binary CommandStore format by default. It keeps
+// the values exactly and restores faster. G-code files can be written for older
+// versions instead.
+static bool saveAsGCode()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Path");
+    return hGrp->GetBool("SavePathAsGCode", false);
+}
+
 static void saveCenter(Writer &writer, const Base::Vector3d &center)
 {
     writer.Stream() << writer.ind() << "<Center x=\"" << center.x << "\" y=\"" << center.y << "\" z=\"" << center.z << "\"/>" << std::endl;
@@ -451,6 +501,7 @@ static void saveCenter(Writer &writer, const Base::Vector3d &center)
 void Toolpath::Save (Writer &writer) const
 {
     if (writer.isForceXML()) {
+        materialize();
         writer.Stream() << writer.ind() << "<Path count=\"" <<  getSize() << "\" version=\"" << SchemaVersion << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
@@ -458,27 +509,60 @@ void Toolpath::Save (Writer &writer) const
             vpcCommands[i]->Save(writer);
         }
         writer.decInd();
-    } else {
+    } else if (saveAsGCode()) {
         writer.Stream() << writer.ind()
             << "<Path file=\"" << writer.addFile((writer.ObjectName+".nc").c_str(), this) << "\" version=\"" << SchemaVersion << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
         writer.decInd();
+    } else {
+        // Older versions read the file of the 'file' attribute as G-code and
+        // ignore the 'binary' attribute, so they restore an empty path instead
+        // of misreading the binary file.
+        writer.Stream() << writer.ind()
+            << "<Path file=\"\" binary=\"" << writer.addFile((writer.ObjectName+".bin").c_str(), this) << "\" version=\"" << SchemaVersion << "\">" << std::endl;
+        writer.incInd();
+        saveCenter(writer, center);
+        writer.decInd();
     }
     writer.Stream() << writer.ind() << "</Path>" << std::endl;
 }
 
 void Toolpath::SaveDocFile (Base::Writer &writer) const
 {
-    if (toGCode().empty())
+    if (getSize() == 0)
         return;
-    writer.Stream() << toGCode();
+    if (saveAsGCode()) {
+        writer.Stream() << toGCode();
+        return;
+    }
+
+    std::shared_ptr<const CommandStore> restored;
+    {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        restored = store;
+    }
+    if (restored) {
+        restored->write(writer.Stream());
+    }
+    else {
+        CommandStore commands;
+        commands.setCommands(vpcCommands);
+        commands.write(writer.Stream());
+    }
+}
+
+std::string Toolpath::getFileName(Base::XMLReader &reader)
+{
+    if (reader.hasAttribute("binary"))
+        return reader.getAttribute("binary");
+    return reader.getAttribute("file");
 }
 
 void Toolpath::Restore(XMLReader &reader)
 {
     reader.readElement("Path");
-    std::string file (reader.getAttribute("file") );
+    std::string file (getFileName(reader));
 
     if (!file.empty()) {
         // initiate a file read
@@ -488,14 +572,22 @@ void Toolpath::Restore(XMLReader &reader)
 
 void Toolpath::RestoreDocFile(Base::Reader &reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
+    // G-code files, as written by older versions or if SavePathAsGCode is set
+    if (boost::algorithm::ends_with(reader.getFileName(), ".nc")) {
+        std::string gcode((std::istreambuf_iterator<char>(reader)), std::istreambuf_iterator<char>());
+        setFromGCode(gcode);
+        return;
     }
-    setFromGCode(gcode);
 
+    clear();
+    if (reader.peek() == std::char_traits<char>::eof())
+        return;
+
+    // the commands are created when they are accessed
+    std::shared_ptr<CommandStore> restored = std::make_shared<CommandStore>();
+    restored->read(reader);
+    store = restored;
+    recalculate();
 }
 
 
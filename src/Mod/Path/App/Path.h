@@ -24,6 +24,8 @@
 #ifndef PATH_Path_H
 #define PATH_Path_H
 
+#include <memory>
+#include <mutex>
 #include "Command.h"
 //#include "Mod/Robot/App/kdl_cp/path_composite.hpp"
 //#include "Mod/Robot/App/kdl_cp/frames_io.hpp"
@@ -33,8 +35,14 @@
 
 namespace Path
 {
+    class CommandStore;
 
-    /** The representation of a CNC Toolpath */
+    /** The representation of a CNC Toolpath
+     *
+     * A restored toolpath keeps the CommandStore of its file and creates the
+     * Command objects only when they are accessed. Copying or saving such a
+     * toolpath shares or writes the store as it is.
+     */
     
     class PathExport Toolpath : public Base::Persistence
     {
@@ -53,6 +61,8 @@ namespace Path
             virtual void Restore(Base::XMLReader &/*reader*/);
             void SaveDocFile (Base::Writer &writer) const;
             void RestoreDocFile(Base::Reader &reader);
+            /// returns the name of the command file of a Path element
+            static std::string getFileName(Base::XMLReader &reader);
         
             // interface
             void clear(void); // clears the internal data
@@ -67,18 +77,24 @@ namespace Path
             Base::BoundBox3d getBoundBox(void) const;
             
             // shortcut functions
-            unsigned int getSize(void) const { return vpcCommands.size(); }
-            const std::vector<Command*> &getCommands(void) const { return vpcCommands; }
-            const Command &getCommand(unsigned int pos)    const { return *vpcCommands[pos]; }
+            unsigned int getSize(void) const;
+            const std::vector<Command*> &getCommands(void) const { materialize(); return vpcCommands; }
+            const Command &getCommand(unsigned int pos)    const { materialize(); return *vpcCommands[pos]; }
         
             // support for rotation
             const Base::Vector3d& getCenter() const { return center; }
             void setCenter(const Base::Vector3d &c);
 
-            static const int SchemaVersion = 2;
+            static const int SchemaVersion = 3;
 
         protected:
-            std::vector<Command*> vpcCommands;
+            /// creates the commands of a restored store
+            void materialize(void) const;
+
+        protected:
+            mutable std::vector<Command*> vpcCommands;
+            mutable std::shared_ptr<const CommandStore> store;
+            mutable std::mutex storeMutex;
             Base::Vector3d center;
             //KDL::Path_Composite *pcPath;
             
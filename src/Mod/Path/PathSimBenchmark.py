@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2021 FreeCAD Developers                                 *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+"""Simulates finishing paths on the demo parts to time PathSimulator.
+
+    import PathSimBenchmark
+    PathSimBenchmark.run()
+
+The demo parts have no jobs, so a path is generated for each of them:
+waterline contours every stepDown, then a zig-zag raster over the top. It
+is simulated on a box stock around the part with a flat and a ball end
+mill. The result mesh is fetched once at the end, and then again every
+meshEvery moves as the simulator dialog does while it animates the tool,
+which shows the cost of tessellating the stock over and over.
+"""
+
+import glob
+import os
+import time
+import FreeCAD, Part, Path, PathSimulator
+
+App = FreeCAD
+
+def demoParts():
+    """Return the file names of the demo parts"""
+    return sorted(glob.glob(os.path.join(os.path.dirname(__file__), "DemoParts", "*.fcstd")))
+
+def partShape(doc):
+    """Return the largest solid of the objects of doc"""
+    solids = []
+    for obj in doc.Objects:
+        if hasattr(obj, "Shape"):
+            solids.extend(obj.Shape.Solids)
+    return max(solids, key=lambda s: s.Volume)
+
+def makeTool(radius, ball):
+    """Return the shape of a flat or ball end mill"""
+    if not ball:
+        return Part.makeCylinder(radius, 20)
+    shank = Part.makeCylinder(radius, 20, App.Vector(0, 0, radius))
+    return shank.fuse(Part.makeSphere(radius, App.Vector(0, 0, radius))).removeSplitter()
+
+def finishingPath(shape, stepDown=0.5, stepOver=0.3, deflection=0.05):
+    """Return the commands of the waterline contours and the top raster of shape"""
+    bb = shape.BoundBox
+    safe = bb.ZMax + 5
+    commands = []
+
+    z = bb.ZMax - stepDown
+    while z > bb.ZMin:
+        for wire in shape.slice(App.Vector(0, 0, 1), z):
+            points = wire.discretize(Deflection=deflection)
+            commands.append(Path.Command("G0", {"Z": safe}))
+            commands.append(Path.Command("G0", {"X": points[0].x, "Y": points[0].y}))
+            commands.append(Path.Command("G1", {"Z": z}))
+            for p in points[1:]:
+                commands.append(Path.Command("G1", {"X": p.x, "Y": p.y}))
+        z -= stepDown
+
+    commands.append(Path.Command("G0", {"Z": safe}))
+    commands.append(Path.Command("G0", {"X": bb.XMin, "Y": bb.YMin}))
+    commands.append(Path.Command("G1", {"Z": bb.ZMax}))
+    y = bb.YMin
+    forward = True
+    while y <= bb.YMax:
+        commands.append(Path.Command("G1", {"X": bb.XMax if forward else bb.XMin, "Y": y}))
+        y += stepOver
+        commands.append(Path.Command("G1", {"Y": y}))
+        forward = not forward
+    return commands
+
+def simulate(shape, commands, tool, resolution, meshEvery=0):
+    """Simulate commands on a box stock around shape, return the time of the
+    simulation, the part of it spent for the result meshes and their facet count"""
+    bb = shape.BoundBox
+    stock = Part.makeBox(bb.XLength + 10, bb.YLength + 10, bb.ZLength + 1,
+                         App.Vector(bb.XMin - 5, bb.YMin - 5, bb.ZMin - 1))
+    sim = PathSimulator.PathSim()
+    sim.BeginSimulation(stock, resolution)
+    sim.SetToolShape(tool, resolution)
+
+    pos = App.Placement(App.Vector(bb.XMin, bb.YMin, bb.ZMax + 5), App.Rotation())
+    mesh = 0.0
+    start = time.time()
+    for i, cmd in enumerate(commands):
+        pos = sim.ApplyCommand(pos, cmd)
+        if meshEvery and i % meshEvery == 0:
+            t = time.time()
+            sim.GetResultMesh()
+            mesh += time.time() - t
+    t = time.time()
+    outer, inner = sim.GetResultMesh()
+    mesh += time.time() - t
+    return time.time() - start, mesh, outer.CountFacets + inner.CountFacets
+
+def run(resolution=0.1, meshEvery=25, radius=1.5):
+    """Print the time to simulate a finishing path on each demo part"""
+    App.Console.PrintMessage("%24s %8s %6s %8s %10s %10s %9s\n" %
+                             ("part", "moves", "tool", "meshes", "time [s]", "mesh [s]", "facets"))
+    for filename in demoParts():
+        doc = App.openDocument(filename, hidden=True)
+        try:
+            shape = partShape(doc)
+        finally:
+            App.closeDocument(doc.Name)
+        commands = finishingPath(shape)
+        name = os.path.splitext(os.path.basename(filename))[0]
+        for ball in (False, True):
+            tool = makeTool(radius, ball)
+            for every in (0, meshEvery):
+                elapsed, mesh, facets = simulate(shape, commands, tool, resolution, every)
+                App.Console.PrintMessage("%24s %8d %6s %8s %10.3f %10.3f %9d\n" %
+                                         (name, len(commands), "ball" if ball else "flat",
+                                          "every %d" % every if every else "end",
+                                          elapsed, mesh, facets))
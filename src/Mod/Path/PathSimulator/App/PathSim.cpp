@@ -55,11 +55,19 @@ PathSim::~PathSim()
 void PathSim::BeginSimulation(Part::TopoShape * stock, float resolution)
 {
 	Base::BoundBox3d bbox = stock->getBoundBox();
+	if (m_stock != nullptr)
+		delete m_stock;
 	m_stock = new cStock(bbox.MinX, bbox.MinY, bbox.MinZ, bbox.LengthX(), bbox.LengthY(), bbox.LengthZ(), resolution);
 }
 
 void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
 {
+	// the stock may still reference the profile of the current tool
+	if (m_stock != nullptr)
+		m_stock->Flush();
+	if (m_tool != nullptr)
+		delete m_tool;
+	m_tool = nullptr;	// in case the new tool is invalid
 	m_tool = new cSimTool(toolShape, resolution);
 }
 
@@ -104,6 +104,31 @@ PyObject* PathSimPy::GetResultMesh(PyObject * args)
 	return tuple;
 }
 
+PyObject* PathSimPy::GetHeightMap(PyObject * args)
+{
+	if (!PyArg_ParseTuple(args, ""))
+		return 0;
+	cStock *stock = getPathSimPtr()->m_stock;
+	if (stock == NULL)
+	{
+		PyErr_SetString(PyExc_RuntimeError, "Simulation has no stock object");
+		return 0;
+	}
+
+	std::vector<float> heights;
+	int xsize, ysize;
+	stock->GetHeights(heights, xsize, ysize);
+	Py::Tuple columns(xsize);
+	for (int x = 0; x < xsize; x++)
+	{
+		Py::Tuple column(ysize);
+		for (int y = 0; y < ysize; y++)
+			column.setItem(y, Py::Float(heights[x * ysize + y]));
+		columns.setItem(x, column);
+	}
+	return Py::new_reference_to(columns);
+}
+
 
 PyObject* PathSimPy::ApplyCommand(PyObject * args, PyObject * kwds)
 {
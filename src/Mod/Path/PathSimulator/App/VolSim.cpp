@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
@@ -29,6 +30,13 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <cmath>
+# include <limits>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define FC_VOLSIM_SSE2
 #endif
 
 #include "VolSim.h"
@@ -50,6 +58,22 @@ cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float
 			m_stock[x][y] = m_plane;
 			m_attr[x][y] = 0;
 		}
+
+	// split the stock into tiles, all of them need to be tessellated
+	m_tx = (m_x + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+	m_ty = (m_y + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+	m_tiles.resize(m_tx * m_ty);
+	m_tileMoves.resize(m_tx * m_ty);
+	for (int ty = 0; ty < m_ty; ty++)
+		for (int tx = 0; tx < m_tx; tx++)
+		{
+			cStockTile & tile = m_tiles[ty * m_tx + tx];
+			tile.x0 = tx * SIM_TILE_SIZE;
+			tile.y0 = ty * SIM_TILE_SIZE;
+			tile.x1 = std::min(m_x, tile.x0 + SIM_TILE_SIZE);
+			tile.y1 = std::min(m_y, tile.y0 + SIM_TILE_SIZE);
+			tile.dirty = true;
+		}
 }
 
 cStock::~cStock()
@@ -57,7 +81,7 @@ cStock::~cStock()
 }
 
 
-float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz)
+float cStock::FindRectTop(cStockTile & tile, int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz)
 {
 	float z = m_stock[xp][yp];
 	bool xr_ok = true;
@@ -71,7 +95,7 @@ float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool s
 		if (xr_ok)
 		{
 			int tx = xp + x_size;
-			if (tx >= m_x)
+			if (tx >= tile.x1)
 				xr_ok = false;
 			else
 			{
@@ -92,7 +116,7 @@ float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool s
 		if (xl_ok)
 		{
 			int tx = xp - 1;
-			if (tx < 0)
+			if (tx < tile.x0)
 				xl_ok = false;
 			else
 			{
@@ -116,7 +140,7 @@ float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool s
 		if (yu_ok)
 		{
 			int ty = yp + y_size;
-			if (ty >= m_y)
+			if (ty >= tile.y1)
 				yu_ok = false;
 			else
 			{
@@ -137,7 +161,7 @@ float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool s
 		if (yd_ok)
 		{
 			int ty = yp - 1;
-			if (ty < 0)
+			if (ty < tile.y0)
 				yd_ok = false;
 			else
 			{
@@ -160,23 +184,23 @@ float cStock::FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool s
 	return z;
 }
 
-int cStock::TesselTop(int xp, int yp)
+int cStock::TesselTop(cStockTile & tile, int xp, int yp)
 {
 	int x_size, y_size;
-	float z = FindRectTop(xp, yp, x_size, y_size, true);
+	float z = FindRectTop(tile, xp, yp, x_size, y_size, true);
 	bool farRect = false;
 	while (y_size / x_size > 5)
 	{
 		farRect = true;
 		yp += x_size * 5;
-		z = FindRectTop(xp, yp, x_size, y_size, true);
+		z = FindRectTop(tile, xp, yp, x_size, y_size, true);
 	}
 
 	while (x_size / y_size > 5)
 	{
 		farRect = true;
 		xp += y_size * 5;
-		z = FindRectTop(xp, yp, x_size, y_size, false);
+		z = FindRectTop(tile, xp, yp, x_size, y_size, false);
 	}
 
 	// mark all points inside
@@ -192,9 +216,9 @@ int cStock::TesselTop(int xp, int yp)
 		Point3D ptl(xp, yp + y_size, z);
 		Point3D ptr(xp + x_size, yp + y_size, z);
 		if (fabs(m_pz + m_lz - z) < SIM_EPSILON)
-			AddQuad(pbl, pbr, ptr, ptl, facetsOuter);
+			AddQuad(pbl, pbr, ptr, ptl, tile.facetsOuter);
 		else
-			AddQuad(pbl, pbr, ptr, ptl, facetsInner);
+			AddQuad(pbl, pbr, ptr, ptl, tile.facetsInner);
 	}
 
 	if (farRect)
@@ -204,7 +228,7 @@ int cStock::TesselTop(int xp, int yp)
 }
 
 
-void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz)
+void cStock::FindRectBot(cStockTile & tile, int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz)
 {
 	bool xr_ok = true;
 	bool xl_ok = scanHoriz;
@@ -217,7 +241,7 @@ void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool sc
 		if (xr_ok)
 		{
 			int tx = xp + x_size;
-			if (tx >= m_x)
+			if (tx >= tile.x1)
 				xr_ok = false;
 			else
 			{
@@ -238,7 +262,7 @@ void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool sc
 		if (xl_ok)
 		{
 			int tx = xp - 1;
-			if (tx < 0)
+			if (tx < tile.x0)
 				xl_ok = false;
 			else
 			{
@@ -262,7 +286,7 @@ void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool sc
 		if (yu_ok)
 		{
 			int ty = yp + y_size;
-			if (ty >= m_y)
+			if (ty >= tile.y1)
 				yu_ok = false;
 			else
 			{
@@ -283,7 +307,7 @@ void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool sc
 		if (yd_ok)
 		{
 			int ty = yp - 1;
-			if (ty < 0)
+			if (ty < tile.y0)
 				yd_ok = false;
 			else
 			{
@@ -306,23 +330,23 @@ void cStock::FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool sc
 }
 
 
-int cStock::TesselBot(int xp, int yp)
+int cStock::TesselBot(cStockTile & tile, int xp, int yp)
 {
 	int x_size, y_size;
-	FindRectBot(xp, yp, x_size, y_size, true);
+	FindRectBot(tile, xp, yp, x_size, y_size, true);
 	bool farRect = false;
 	while (y_size / x_size > 5)
 	{
 		farRect = true;
 		yp += x_size * 5;
-		FindRectTop(xp, yp, x_size, y_size, true);
+		FindRectBot(tile, xp, yp, x_size, y_size, true);
 	}
 
 	while (x_size / y_size > 5)
 	{
 		farRect = true;
 		xp += y_size * 5;
-		FindRectTop(xp, yp, x_size, y_size, false);
+		FindRectBot(tile, xp, yp, x_size, y_size, false);
 	}
 
 	// mark all points inside
@@ -335,7 +359,7 @@ int cStock::TesselBot(int xp, int yp)
 	Point3D pbr(xp + x_size, yp, m_pz);
 	Point3D ptl(xp, yp + y_size, m_pz);
 	Point3D ptr(xp + x_size, yp + y_size, m_pz);
-	AddQuad(pbl, ptl, ptr, pbr, facetsOuter);
+	AddQuad(pbl, ptl, ptr, pbr, tile.facetsOuter);
 
 	if (farRect)
 		return -1;
@@ -344,28 +368,29 @@ int cStock::TesselBot(int xp, int yp)
 }
 
 
-int cStock::TesselSidesX(int yp)
+// walls along the line yp between the pixels of the rows yp - 1 and yp, they end at the tile border
+int cStock::TesselSidesX(cStockTile & tile, int yp)
 {
 	float lastz1 = m_pz;
 	if (yp < m_y)
-		lastz1 = std::max(m_stock[0][yp], m_pz);
+		lastz1 = std::max(m_stock[tile.x0][yp], m_pz);
 	float lastz2 = m_pz;
 	if (yp > 0)
-		lastz2 = std::max(m_stock[0][yp - 1], m_pz);
+		lastz2 = std::max(m_stock[tile.x0][yp - 1], m_pz);
 
-	std::vector<MeshCore::MeshGeomFacet> *facets = &facetsInner;
+	std::vector<MeshCore::MeshGeomFacet> *facets = &tile.facetsInner;
 	if (yp == 0 || yp == m_y)
-		facets = &facetsOuter;
+		facets = &tile.facetsOuter;
 
 	//bool lastzclip = (lastz - m_pz) < m_res;
-	int lastpoint = 0;
-	for (int x = 1; x <= m_x; x++)
+	int lastpoint = tile.x0;
+	for (int x = tile.x0 + 1; x <= tile.x1; x++)
 	{
 		float newz1 = m_pz;
-		if (yp < m_y && x < m_x)
+		if (yp < m_y && x < tile.x1)
 			newz1 = std::max(m_stock[x][yp], m_pz);
 		float newz2 = m_pz;
-		if (yp > 0 && x < m_x)
+		if (yp > 0 && x < tile.x1)
 			newz2 = std::max(m_stock[x][yp - 1], m_pz);
 
 		if (fabs(lastz1 - lastz2) > m_res)
@@ -385,28 +410,29 @@ int cStock::TesselSidesX(int yp)
 	return 0;
 }
 
-int cStock::TesselSidesY(int xp)
+// walls along the line xp between the pixels of the columns xp - 1 and xp, they end at the tile border
+int cStock::TesselSidesY(cStockTile & tile, int xp)
 {
 	float lastz1 = m_pz;
 	if (xp < m_x)
-		lastz1 = std::max(m_stock[xp][0], m_pz);
+		lastz1 = std::max(m_stock[xp][tile.y0], m_pz);
 	float lastz2 = m_pz;
 	if (xp > 0)
-		lastz2 = std::max(m_stock[xp - 1][0], m_pz);
+		lastz2 = std::max(m_stock[xp - 1][tile.y0], m_pz);
 
-	std::vector<MeshCore::MeshGeomFacet> *facets = &facetsInner;
+	std::vector<MeshCore::MeshGeomFacet> *facets = &tile.facetsInner;
 	if (xp == 0 || xp == m_x)
-		facets = &facetsOuter;
+		facets = &tile.facetsOuter;
 
 	//bool lastzclip = (lastz - m_pz) < m_res;
-	int lastpoint = 0;
-	for (int y = 1; y <= m_y; y++)
+	int lastpoint = tile.y0;
+	for (int y = tile.y0 + 1; y <= tile.y1; y++)
 	{
 		float newz1 = m_pz;
-		if (xp < m_x && y < m_y)
+		if (xp < m_x && y < tile.y1)
 			newz1 = std::max(m_stock[xp][y], m_pz);
 		float newz2 = m_pz;
-		if (xp > 0 && y < m_y)
+		if (xp > 0 && y < tile.y1)
 			newz2 = std::max(m_stock[xp - 1][y], m_pz);
 
 		if (fabs(lastz1 - lastz2) > m_res)
@@ -449,43 +475,96 @@ void cStock::AddQuad(Point3D & p1, Point3D & p2, Point3D & p3, Point3D & p4, std
 	facets.push_back(facet);
 }
 
-void cStock::Tessellate(Mesh::MeshObject & meshOuter, Mesh::MeshObject & meshInner)
+void cStock::TesselTile(cStockTile & tile)
 {
 	// reset attribs
-	for (int y = 0; y < m_y; y++)
-	for (int x = 0; x < m_x; x++)
-		m_attr[x][y] = 0;
+	for (int x = tile.x0; x < tile.x1; x++)
+		for (int y = tile.y0; y < tile.y1; y++)
+			m_attr[x][y] = 0;
 
-	facetsOuter.clear();
-	facetsInner.clear();
+	tile.facetsOuter.clear();
+	tile.facetsInner.clear();
 
-	for (int y = 0; y < m_y; y++)
+	for (int y = tile.y0; y < tile.y1; y++)
 	{
-		for (int x = 0; x < m_x; x++)
+		for (int x = tile.x0; x < tile.x1; x++)
 		{
 			int attr = m_attr[x][y];
 			if ((attr & SIM_TESSEL_TOP) == 0)
-				x += TesselTop(x, y);
+				x += TesselTop(tile, x, y);
 		}
 	}
-	for (int y = 0; y < m_y; y++)
+	for (int y = tile.y0; y < tile.y1; y++)
 	{
-		for (int x = 0; x < m_x; x++)
+		for (int x = tile.x0; x < tile.x1; x++)
 		{
 			if ((m_stock[x][y] - m_pz) < m_res)
 				m_attr[x][y] |= SIM_TESSEL_BOT;
 			if ((m_attr[x][y] & SIM_TESSEL_BOT) == 0)
-				x += TesselBot(x, y);
+				x += TesselBot(tile, x, y);
 		}
 	}
-	for (int y = 0; y <= m_y; y++)
-		TesselSidesX(y);
-	for (int x = 0; x <= m_x; x++)
-		TesselSidesY(x);
+
+	// a tile owns the walls on its lower borders, the last tiles also the outer ones
+	int ye = tile.y1 == m_y ? m_y : tile.y1 - 1;
+	for (int y = tile.y0; y <= ye; y++)
+		TesselSidesX(tile, y);
+	int xe = tile.x1 == m_x ? m_x : tile.x1 - 1;
+	for (int x = tile.x0; x <= xe; x++)
+		TesselSidesY(tile, x);
+}
+
+void cStock::Tessellate(Mesh::MeshObject & meshOuter, Mesh::MeshObject & meshInner)
+{
+	Flush();
+
+	// the walls on the lower borders of a tile depend on the pixels of the neighbours
+	std::vector<int> update;
+	for (int ty = 0; ty < m_ty; ty++)
+	{
+		for (int tx = 0; tx < m_tx; tx++)
+		{
+			int t = ty * m_tx + tx;
+			if (m_tiles[t].dirty || (tx > 0 && m_tiles[t - 1].dirty) || (ty > 0 && m_tiles[t - m_tx].dirty))
+				update.push_back(t);
+		}
+	}
+
+	// the tiles only write their own attributes and facets
+	Base::parallel_for<std::size_t>(update.size(), 1, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; i++)
+			TesselTile(m_tiles[update[i]]);
+	});
+
+	std::size_t countOuter = 0;
+	std::size_t countInner = 0;
+	for (auto & tile : m_tiles)
+	{
+		tile.dirty = false;
+		countOuter += tile.facetsOuter.size();
+		countInner += tile.facetsInner.size();
+	}
+
+	std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+	std::vector<MeshCore::MeshGeomFacet> facetsInner;
+	facetsOuter.reserve(countOuter);
+	facetsInner.reserve(countInner);
+	for (auto & tile : m_tiles)
+	{
+		facetsOuter.insert(facetsOuter.end(), tile.facetsOuter.begin(), tile.facetsOuter.end());
+		facetsInner.insert(facetsInner.end(), tile.facetsInner.begin(), tile.facetsInner.end());
+	}
 	meshOuter.addFacets(facetsOuter);
 	meshInner.addFacets(facetsInner);
-	facetsOuter.clear();
-	facetsInner.clear();
+}
+
+void cStock::SetDirty(int xs, int ys, int xe, int ye)
+{
+	if (xs >= xe || ys >= ye)
+		return;
+	for (int ty = ys / SIM_TILE_SIZE; ty <= (ye - 1) / SIM_TILE_SIZE; ty++)
+		for (int tx = xs / SIM_TILE_SIZE; tx <= (xe - 1) / SIM_TILE_SIZE; tx++)
+			m_tiles[ty * m_tx + tx].dirty = true;
 }
 
 
@@ -496,7 +575,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
 	int rad = (int)(radf / m_res);
 	int drad = rad * rad;
 	int ys = std::max(0, cy - rad);
-	int ye = std::min(m_x, cy + rad);
+	int ye = std::min(m_y, cy + rad);
 	int xs = std::max(0, cx - rad);
 	int xe = std::min(m_x, cx + rad);
 	for (int y = ys; y < ye; y++)
@@ -507,6 +586,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
 				if (m_stock[x][y] > height) m_stock[x][y] = height;
 		}
 	}
+	SetDirty(xs, ys, xe, ye);
 }
 
 void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
@@ -514,155 +594,250 @@ void cStock::ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool & tool)
 	// translate coordinates
 	Point3D pi1 = ToInner(p1);
 	Point3D pi2 = ToInner(p2);
-	float rad = tool.radius;
-	rad /= m_res;
-	float cupAngle = 180;
-
-	// strait motion
-	float perpDirX = 1;
-	float perpDirY = 0;
-	cLineSegment path(pi1, pi2);
-	if (path.lenXY > SIM_EPSILON) // only if moving along xy
+
+	cToolMove move;
+	move.profile = &tool.GetProfile(m_res);
+	move.isArc = false;
+	move.x1 = pi1.x;
+	move.y1 = pi1.y;
+	move.z1 = pi1.z;
+	move.x2 = pi2.x;
+	move.y2 = pi2.y;
+	move.z2 = pi2.z;
+	move.cx = move.cy = move.crad = 0;
+	move.sang = move.ang = 0;
+	move.isCCW = false;
+
+	float rad = move.profile->rad;
+	move.xs = (int)floor(std::min(pi1.x, pi2.x) - rad);
+	move.ys = (int)floor(std::min(pi1.y, pi2.y) - rad);
+	move.xe = (int)ceil(std::max(pi1.x, pi2.x) + rad) + 1;
+	move.ye = (int)ceil(std::max(pi1.y, pi2.y) + rad) + 1;
+	QueueMove(move);
+}
+
+void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool & tool, bool isCCW)
+{
+	// translate coordinates
+	Point3D pi1 = ToInner(p1);
+	Point3D pi2 = ToInner(p2);
+	Point3D centi(cent.x / m_res, cent.y / m_res, cent.z);
+
+	cToolMove move;
+	move.profile = &tool.GetProfile(m_res);
+	move.isArc = true;
+	move.x1 = pi1.x;
+	move.y1 = pi1.y;
+	move.z1 = pi1.z;
+	move.x2 = pi2.x;
+	move.y2 = pi2.y;
+	move.z2 = pi2.z;
+	move.isCCW = isCCW;
+
+	// the center is relative to the start point
+	move.cx = pi1.x + centi.x;
+	move.cy = pi1.y + centi.y;
+	move.crad = sqrt(centi.x * centi.x + centi.y * centi.y);
+	move.sang = atan2(-centi.y, -centi.x);
+	double eang = atan2(pi2.y - move.cy, pi2.x - move.cx);
+
+	double ang = isCCW ? eang - move.sang : move.sang - eang;
+	if (ang < 0)
+		ang += 2 * D_PI;
+	if (ang < SIM_EPSILON)
+		ang = 2 * D_PI;	// full circle
+	move.ang = (float)ang;
+
+	float rad = move.profile->rad + move.crad;
+	move.xs = (int)floor(move.cx - rad);
+	move.ys = (int)floor(move.cy - rad);
+	move.xe = (int)ceil(move.cx + rad) + 1;
+	move.ye = (int)ceil(move.cy + rad) + 1;
+	QueueMove(move);
+}
+
+void cStock::QueueMove(cToolMove & move)
+{
+	move.xs = std::max(0, move.xs);
+	move.ys = std::max(0, move.ys);
+	move.xe = std::min(m_x, move.xe);
+	move.ye = std::min(m_y, move.ye);
+	if (move.xs >= move.xe || move.ys >= move.ye)
+		return;
+
+	m_moves.push_back(move);
+	if (m_moves.size() >= SIM_MAX_MOVES)
+		Flush();
+}
+
+void cStock::Flush()
+{
+	if (m_moves.empty())
+		return;
+
+	// assign the moves to the tiles they touch
+	std::vector<int> active;
+	for (int i = 0; i < (int)m_moves.size(); i++)
 	{
-		perpDirX = -path.pDirXY.y;
-		perpDirY = path.pDirXY.x;
-		Point3D start(perpDirX * rad + pi1.x, perpDirY * rad + pi1.y, pi1.z);
-		Point3D mainWay = path.pDir * SIM_WALK_RES;
-		Point3D sideWay(-perpDirX * SIM_WALK_RES, -perpDirY * SIM_WALK_RES, 0);
-		int lenSteps = (int)(path.len / SIM_WALK_RES) + 1;
-		int radSteps = (int)(rad * 2 / SIM_WALK_RES) + 1;
-		float zstep = (pi2.z - pi1.z) / radSteps;
-		float tstep = 2.0 / radSteps;
-		float t = -1;
-		for (int j = 0; j < radSteps; j++)
+		const cToolMove & move = m_moves[i];
+		for (int ty = move.ys / SIM_TILE_SIZE; ty <= (move.ye - 1) / SIM_TILE_SIZE; ty++)
 		{
-			float z = pi1.z + tool.GetToolProfileAt(t);
-			Point3D p = start;
-			for (int i = 0; i < lenSteps; i++)
+			for (int tx = move.xs / SIM_TILE_SIZE; tx <= (move.xe - 1) / SIM_TILE_SIZE; tx++)
 			{
-				int x = (int)p.x;
-				int y = (int)p.y;
-				if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-				{
-					if (m_stock[x][y] > z)
-						m_stock[x][y] = z;
-				}
-				p.Add(mainWay);
-				z += zstep;
+				std::vector<int> & moves = m_tileMoves[ty * m_tx + tx];
+				if (moves.empty())
+					active.push_back(ty * m_tx + tx);
+				moves.push_back(i);
 			}
-			t += tstep;
-			start.Add(sideWay);
 		}
 	}
-	else
-		cupAngle = 360;
 
-	// end cup
-	for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES)
+	// lowering the heights commutes, so the tiles can be processed independently
+	Base::parallel_for<std::size_t>(active.size(), 1, [&](std::size_t begin, std::size_t end) {
+		std::vector<float> row(SIM_TILE_SIZE);
+		for (std::size_t i = begin; i < end; i++)
+			ApplyMoves(m_tiles[active[i]], m_tileMoves[active[i]], row);
+	});
+
+	for (int t : active)
+		m_tileMoves[t].clear();
+	m_moves.clear();
+}
+
+void cStock::GetHeights(std::vector<float> & heights, int & xsize, int & ysize)
+{
+	Flush();
+	xsize = m_x;
+	ysize = m_y;
+	heights.resize(m_x * m_y);
+	for (int x = 0; x < m_x; x++)
+		std::copy(m_stock[x], m_stock[x] + m_y, heights.begin() + x * m_y);
+}
+
+// lowers the heights to the tool heights, returns true if a height changed
+static bool LowerRow(float * heights, const float * tool, int count)
+{
+	bool changed = false;
+	int i = 0;
+#if defined(FC_VOLSIM_SSE2)
+	__m128 lower = _mm_setzero_ps();
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 h = _mm_loadu_ps(heights + i);
+		__m128 t = _mm_loadu_ps(tool + i);
+		lower = _mm_or_ps(lower, _mm_cmplt_ps(t, h));
+		_mm_storeu_ps(heights + i, _mm_min_ps(h, t));
+	}
+	changed = _mm_movemask_ps(lower) != 0;
+#endif
+	for (; i < count; i++)
 	{
-		Point3D cupCirc(perpDirX * r, perpDirY * r, pi2.z);
-		float rotang = 180 * SIM_WALK_RES / (3.1415926535 * r);
-		cupCirc.SetRotationAngle(-rotang);
-		float z = pi2.z + tool.GetToolProfileAt(r / rad);
-		for (float a = 0; a < cupAngle; a += rotang)
+		if (tool[i] < heights[i])
 		{
-			int x = (int)(pi2.x + cupCirc.x);
-			int y = (int)(pi2.y + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
-			cupCirc.Rotate();
+			heights[i] = tool[i];
+			changed = true;
 		}
 	}
+	return changed;
 }
 
-void cStock::ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool & tool, bool isCCW)
+void cStock::ApplyMoves(cStockTile & tile, const std::vector<int> & moves, std::vector<float> & row)
 {
-	// translate coordinates
-	Point3D pi1 = ToInner(p1);
-	Point3D pi2 = ToInner(p2);
-	Point3D centi(cent.x / m_res, cent.y / m_res, cent.z);
-	float rad = tool.radius;
-	rad /= m_res;
-	float cpx = centi.x;
-	float cpy = centi.y;
-
-	Point3D xynorm = unit(Point3D(-cpx, -cpy, 0));
-	float crad = sqrt(cpx * cpx + cpy * cpy);
-	//bool shortRad = (crad - rad) < 0.0001;
-	//if (shortRad)
-	//	rad = crad;
-	float crad1 = std::max((float)0.5, crad - rad);
-	float crad2 = crad + rad;
-
-	float sang = atan2(-cpy, -cpx); // start angle
-
-	cpx += pi1.x;
-	cpy += pi1.y;
-	double eang = atan2(pi2.y - cpy, pi2.x - cpx); // end angle
-
-	double ang = eang - sang;
-	if (!isCCW && ang > 0)
-		ang -= 2 * 3.1415926;
-	if (isCCW && ang < 0)
-		ang += 2 * 3.1415926;
-	ang = fabs(ang);
-
-	// apply path
-	Point3D cupCirc;
-	float tstep = (float)SIM_WALK_RES / rad;
-	float t = -1;
-	for (float r = crad1; r <= crad2; r += (float)SIM_WALK_RES)
+	for (int i : moves)
 	{
-		cupCirc.x = xynorm.x * r;
-		cupCirc.y = xynorm.y * r;
-		float rotang = (float)SIM_WALK_RES / r;
-		int ndivs = (int)(ang / rotang) + 1;
-		if (!isCCW)
-			rotang = -rotang;
-		cupCirc.SetRotationAngleRad(rotang);
-		float z = pi1.z + tool.GetToolProfileAt(t);
-		float zstep = (pi2.z - pi1.z) / ndivs;
-		for (int i = 0; i< ndivs; i++)
+		const cToolMove & move = m_moves[i];
+		int xs = std::max(tile.x0, move.xs);
+		int xe = std::min(tile.x1, move.xe);
+		int ys = std::max(tile.y0, move.ys);
+		int ye = std::min(tile.y1, move.ye);
+		for (int x = xs; x < xe; x++)
 		{
-			int x = (int)(cpx + cupCirc.x);
-			int y = (int)(cpy + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
-			z += zstep;
-			cupCirc.Rotate();
+			if (move.isArc)
+				RasterArc(move, x, ys, ye, row.data());
+			else
+				RasterLine(move, x, ys, ye, row.data());
+			if (LowerRow(m_stock[x] + ys, row.data(), ye - ys))
+				tile.dirty = true;
 		}
-		t += tstep;
 	}
+}
 
-	// apply end cup
-	xynorm.SetRotationAngleRad(ang);
-	xynorm.Rotate();
-	for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES)
+// heights of the tool bottom at the pixels [ys, ye) of column x, infinity where the tool does not reach
+void cStock::RasterLine(const cToolMove & move, int x, int ys, int ye, float * row)
+{
+	const cToolProfile & profile = *move.profile;
+	const float inf = std::numeric_limits<float>::infinity();
+	float dx = move.x2 - move.x1;
+	float dy = move.y2 - move.y1;
+	float dz = move.z2 - move.z1;
+	float len2 = dx * dx + dy * dy;
+	float px = x + 0.5f - move.x1;
+
+	// the tool only plunges or retracts, the end position counts
+	if (len2 < SIM_EPSILON)
 	{
-		Point3D cupCirc(xynorm.x * r, xynorm.y * r, 0);
-		float rotang = (float)SIM_WALK_RES / r;
-		int ndivs = (int)(3.1415926535 / rotang) + 1;
-		if (!isCCW)
-			rotang = -rotang;
-		cupCirc.SetRotationAngleRad(rotang);
-		float z = pi2.z + tool.GetToolProfileAt(r / rad);
-		for (int i = 0; i < ndivs; i++)
+		float ex = px - dx;
+		for (int y = ys; y < ye; y++)
 		{
-			int x = (int)(pi2.x + cupCirc.x);
-			int y = (int)(pi2.y + cupCirc.y);
-			if (x >= 0 && y >= 0 && x < m_x && y < m_y)
-			{
-				if (m_stock[x][y] > z)
-					m_stock[x][y] = z;
-			}
-			cupCirc.Rotate();
+			float ey = y + 0.5f - move.y2;
+			float dist2 = ex * ex + ey * ey;
+			row[y - ys] = dist2 <= profile.rad2 ? move.z2 + profile.HeightAt(dist2) : inf;
+		}
+		return;
+	}
+
+	// the tool tip is at the point of the path closest to the pixel
+	float inv = 1.0f / len2;
+	for (int y = ys; y < ye; y++)
+	{
+		float py = y + 0.5f - move.y1;
+		float u = std::min(1.0f, std::max(0.0f, (px * dx + py * dy) * inv));
+		float ex = px - u * dx;
+		float ey = py - u * dy;
+		float dist2 = ex * ex + ey * ey;
+		row[y - ys] = dist2 <= profile.rad2 ? move.z1 + u * dz + profile.HeightAt(dist2) : inf;
+	}
+}
+
+void cStock::RasterArc(const cToolMove & move, int x, int ys, int ye, float * row)
+{
+	const cToolProfile & profile = *move.profile;
+	const float inf = std::numeric_limits<float>::infinity();
+	float px = x + 0.5f - move.cx;
+	float ex1 = x + 0.5f - move.x1;
+	float ex2 = x + 0.5f - move.x2;
+	for (int y = ys; y < ye; y++)
+	{
+		float py = y + 0.5f - move.cy;
+		float z = inf;
+
+		// along the arc, if the angle of the pixel is within the sweep
+		float r = sqrt(px * px + py * py);
+		float dr = r - move.crad;
+		if (dr * dr <= profile.rad2)
+		{
+			float off = atan2(py, px) - move.sang;
+			if (!move.isCCW)
+				off = -off;
+			if (off < 0)
+				off += 2 * F_PI;
+			if (off >= 2 * F_PI)
+				off -= 2 * F_PI;
+			if (off <= move.ang)
+				z = move.z1 + (move.z2 - move.z1) * off / move.ang + profile.HeightAt(dr * dr);
 		}
+
+		// around the end points
+		float ey1 = y + 0.5f - move.y1;
+		float dist2 = ex1 * ex1 + ey1 * ey1;
+		if (dist2 <= profile.rad2)
+			z = std::min(z, move.z1 + profile.HeightAt(dist2));
+		float ey2 = y + 0.5f - move.y2;
+		dist2 = ex2 * ex2 + ey2 * ey2;
+		if (dist2 <= profile.rad2)
+			z = std::min(z, move.z2 + profile.HeightAt(dist2));
+
+		row[y - ys] = z;
 	}
 }
 
@@ -787,12 +962,34 @@ float cSimTool::GetToolProfileAt(float pos)  // pos is -1..1 location along the
 		float radPos = std::abs(pos) * radius;
 		toolShapePoint test; test.radiusPos = radPos;
 		auto it = std::lower_bound(m_toolShape.begin(), m_toolShape.end(), test, toolShapePoint::less_than());
+		if (it == m_toolShape.end())
+			return m_toolShape.empty() ? 0 : m_toolShape.back().heightPos;
 		return it->heightPos;
 	}catch(...){
 		return 0;
 	}
 }
 
+const cToolProfile & cSimTool::GetProfile(float res)
+{
+	if (m_profile.res == res)
+		return m_profile;
+
+	// sample by the squared distance so that the stock does not need a square root per pixel
+	m_profile.res = res;
+	m_profile.rad = std::max(0.5f, radius / res);
+	m_profile.rad2 = m_profile.rad * m_profile.rad;
+	int count = std::min(65536, (int)ceil(m_profile.rad2 * 4));
+	m_profile.scale = count / m_profile.rad2;
+	m_profile.heights.resize(count + 2);
+	for (int i = 0; i < (int)m_profile.heights.size(); i++)
+	{
+		float dist = sqrt(std::min((float)i / m_profile.scale, m_profile.rad2));
+		m_profile.heights[i] = GetToolProfileAt(dist / m_profile.rad);
+	}
+	return m_profile;
+}
+
 bool cSimTool::isInside(const TopoDS_Shape& toolShape, Base::Vector3d pnt, float res)
 {
     bool checkFace = true;
@@ -34,6 +34,8 @@
 #define SIM_TESSEL_TOP		1
 #define SIM_TESSEL_BOT		2
 #define SIM_WALK_RES		0.6   // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_TILE_SIZE		64    // size of the stock tiles in pixels
+#define SIM_MAX_MOVES		1024  // number of queued tool moves that are applied at once
 
 struct toolShapePoint {
   float radiusPos;
@@ -97,6 +99,19 @@ struct cLineSegment
 	float lenXY;
 };
 
+// tool profile sampled by the squared distance from the tool axis in pixel units
+struct cToolProfile
+{
+	cToolProfile() : res(0), rad(0), rad2(0), scale(0) {}
+	inline float HeightAt(float dist2) const { return heights[(int)(dist2 * scale)]; }
+
+	std::vector<float> heights;
+	float res;		// stock resolution the profile was made for
+	float rad;		// tool radius in pixels
+	float rad2;		// squared tool radius in pixels
+	float scale;	// table entries per squared pixel
+};
+
 class cSimTool
 {
 public:
@@ -104,11 +119,15 @@ public:
 	~cSimTool() {}
 
 	float GetToolProfileAt(float pos);
+	const cToolProfile & GetProfile(float res);
 	bool isInside(const TopoDS_Shape& toolShape, Base::Vector3d pnt, float res);
 
 	std::vector< toolShapePoint > m_toolShape;
 	float radius;
 	float length;
+
+private:
+	cToolProfile m_profile;
 };
 
 template <class T>
@@ -136,6 +155,28 @@ private:
 	int height;
 };
 
+// square part of the stock with its own mesh, only changed tiles are tessellated again
+struct cStockTile
+{
+	int x0, y0, x1, y1;		// pixel range [x0, x1) x [y0, y1)
+	bool dirty;				// heights changed since the last tessellation
+	std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+	std::vector<MeshCore::MeshGeomFacet> facetsInner;
+};
+
+// queued tool move in pixel units, z is in stock units
+struct cToolMove
+{
+	const cToolProfile *profile;
+	bool isArc;
+	float x1, y1, z1;		// start point
+	float x2, y2, z2;		// end point
+	float cx, cy, crad;		// arc center and radius
+	float sang, ang;		// arc start angle and sweep, counter clockwise if isCCW
+	bool isCCW;
+	int xs, ys, xe, ye;		// affected pixels [xs, xe) x [ys, ye)
+};
+
 class cStock
 {
 public:
@@ -145,19 +186,27 @@ public:
     void CreatePocket(float x, float y, float rad, float height);
     void ApplyLinearTool(Point3D & p1, Point3D & p2, cSimTool &tool);
     void ApplyCircularTool(Point3D & p1, Point3D & p2, Point3D & cent, cSimTool &tool, bool isCCW);
+	void Flush();	// applies the queued tool moves, must be called before a tool is deleted
+	void GetHeights(std::vector<float> & heights, int & xsize, int & ysize);	// column by column, applies the queued moves
     inline Point3D ToInner(Point3D & p) {
 		return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
 	}
 
 private:
-	float FindRectTop(int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz);
-	void FindRectBot(int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz);
+	float FindRectTop(cStockTile & tile, int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz);
+	void FindRectBot(cStockTile & tile, int & xp, int & yp, int & x_size, int & y_size, bool scanHoriz);
 	void SetFacetPoints(MeshCore::MeshGeomFacet & facet, Point3D & p1, Point3D & p2, Point3D & p3);
 	void AddQuad(Point3D & p1, Point3D & p2, Point3D & p3, Point3D & p4, std::vector<MeshCore::MeshGeomFacet> & facets);
-	int TesselTop(int x, int y);
-	int TesselBot(int x, int y);
-	int TesselSidesX(int yp);
-	int TesselSidesY(int xp);
+	int TesselTop(cStockTile & tile, int x, int y);
+	int TesselBot(cStockTile & tile, int x, int y);
+	int TesselSidesX(cStockTile & tile, int yp);
+	int TesselSidesY(cStockTile & tile, int xp);
+	void TesselTile(cStockTile & tile);
+	void QueueMove(cToolMove & move);
+	void ApplyMoves(cStockTile & tile, const std::vector<int> & moves, std::vector<float> & row);
+	void RasterLine(const cToolMove & move, int x, int ys, int ye, float * row);
+	void RasterArc(const cToolMove & move, int x, int ys, int ye, float * row);
+	void SetDirty(int xs, int ys, int xe, int ye);
 	Array2D<float>  m_stock;
 	Array2D<char> m_attr;
 	float m_px, m_py, m_pz;  // stock zero position
@@ -165,8 +214,10 @@ private:
 	float m_res;        // resoulution
 	float m_plane;		// stock plane height
 	int m_x, m_y;            // stock array size
-	std::vector<MeshCore::MeshGeomFacet> facetsOuter;
-	std::vector<MeshCore::MeshGeomFacet> facetsInner;
+	int m_tx, m_ty;			// number of tiles
+	std::vector<cStockTile> m_tiles;
+	std::vector<cToolMove> m_moves;
+	std::vector< std::vector<int> > m_tileMoves;
 };
 
 class cVolSim
@@ -164,3 +164,49 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def test60(self):
+        """Test saving and restoring a Path in a document"""
+        import os
+        import tempfile
+        import zipfile
+
+        commands = []
+        commands.append(Path.Command("(start)"))
+        commands.append(Path.Command("G0", {"X": 1.0 / 3.0, "Y": -2.5, "Z": 10, "S": 3000}))
+        commands.append(Path.Command("G2", {"X": 2, "Y": 1, "I": 0.5, "J": -0.25, "F": 150}))
+        commands.append(Path.Command("G83", {"Z": -5, "R": 1, "Q": 0.5, "P": 2, "L": 3}))
+        commands.append(Path.Command("M05"))
+        path = Path.Path(commands)
+
+        hGrp = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Path")
+        saveAsGCode = hGrp.GetBool("SavePathAsGCode", False)
+        filename = os.path.join(tempfile.gettempdir(), "TestPathCoreSave.FCStd")
+        try:
+            for gcode in (True, False):
+                hGrp.SetBool("SavePathAsGCode", gcode)
+                doc = FreeCAD.newDocument("TestPathCoreSave")
+                obj = doc.addObject("Path::Feature", "Path")
+                obj.Path = path
+                doc.saveAs(filename)
+                FreeCAD.closeDocument(doc.Name)
+                # binary files are the default, older versions only see an empty file name
+                with zipfile.ZipFile(filename) as archive:
+                    self.assertIn("Path.nc" if gcode else "Path.bin", archive.namelist())
+                    xml = archive.read("Document.xml").decode("utf-8")
+                    self.assertEqual('binary="Path.bin"' in xml, not gcode)
+
+                doc = FreeCAD.openDocument(filename)
+                restored = doc.getObject("Path").Path
+                self.assertEqual(len(restored.Commands), len(commands))
+                for c1, c2 in zip(restored.Commands, commands):
+                    self.assertEqual(c1.Name, c2.Name)
+                    if gcode:
+                        self.assertEqual(c1.toGCode(), c2.toGCode())
+                    else:
+                        self.assertEqual(c1.Parameters, c2.Parameters)
+                FreeCAD.closeDocument(doc.Name)
+        finally:
+            hGrp.SetBool("SavePathAsGCode", saveAsGCode)
+            if os.path.exists(filename):
+                os.remove(filename)
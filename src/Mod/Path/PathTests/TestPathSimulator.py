@@ -0,0 +1,196 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2021 FreeCAD Developers                                 *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import math
+import FreeCAD
+import Part
+import Path
+import PathSimulator
+
+from PathTests.PathTestUtils import PathTestBase
+
+Resolution = 0.1
+ToolRadius = 1.5
+StockTop = 10.0
+WalkRes = 0.6
+
+# The reference functions below walk a move in steps of WalkRes pixels and
+# lower every pixel they pass, which is how the simulator cut the stock before
+# it rasterized the moves per tile. They only handle flat end mills. The walk
+# left the start of a move to the end cup of the previous move, so the
+# reference cuts the full tool disc at the start point.
+
+def lower(heights, x, y, z):
+    if 0 <= x < len(heights) and 0 <= y < len(heights[0]) and heights[x][y] > z:
+        heights[x][y] = z
+
+def walkCup(heights, cx, cy, z, dirx, diry, rad, angle, ccw):
+    '''Lower the pixels of the part of the tool disc at (cx, cy) starting at direction dir'''
+    r = 0.5
+    while r <= rad:
+        step = WalkRes / r
+        px, py = dirx * r, diry * r
+        for _ in range(int(angle / step) + 1):
+            lower(heights, int(cx + px), int(cy + py), z)
+            s = step if ccw else -step
+            px, py = px * math.cos(s) - py * math.sin(s), px * math.sin(s) + py * math.cos(s)
+        r += WalkRes
+
+def walkLine(heights, p1, p2, rad):
+    dx, dy, dz = p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]
+    length = math.sqrt(dx * dx + dy * dy + dz * dz)
+    lenXY = math.sqrt(dx * dx + dy * dy)
+    perpx, perpy = 1, 0
+    walkCup(heights, p1[0], p1[1], p1[2], perpx, perpy, rad, 2 * math.pi, True)
+    if lenXY > 1e-5:
+        perpx, perpy = -dy / lenXY, dx / lenXY
+        lenSteps = int(length / WalkRes) + 1
+        radSteps = int(rad * 2 / WalkRes) + 1
+        for j in range(radSteps):
+            side = rad - j * WalkRes
+            for i in range(lenSteps):
+                t = i * WalkRes / length
+                lower(heights, int(p1[0] + perpx * side + dx * t), int(p1[1] + perpy * side + dy * t),
+                      p1[2] + dz * i / lenSteps)
+        walkCup(heights, p2[0], p2[1], p2[2], perpx, perpy, rad, math.pi, False)
+    else:
+        walkCup(heights, p2[0], p2[1], p2[2], perpx, perpy, rad, 2 * math.pi, False)
+
+def arcSweep(p1, p2, cent, ccw):
+    sang = math.atan2(-cent[1], -cent[0])
+    eang = math.atan2(p2[1] - p1[1] - cent[1], p2[0] - p1[0] - cent[0])
+    ang = eang - sang if ccw else sang - eang
+    if ang < 0:
+        ang += 2 * math.pi
+    if ang < 1e-5:
+        ang = 2 * math.pi
+    return sang, ang
+
+def walkArc(heights, p1, p2, cent, rad, ccw):
+    cx, cy = p1[0] + cent[0], p1[1] + cent[1]
+    crad = math.hypot(cent[0], cent[1])
+    sang, ang = arcSweep(p1, p2, cent, ccw)
+    walkCup(heights, p1[0], p1[1], p1[2], 1, 0, rad, 2 * math.pi, True)
+    r = max(0.5, crad - rad)
+    while r <= crad + rad:
+        step = WalkRes / r
+        ndivs = int(ang / step) + 1
+        for i in range(ndivs):
+            a = sang + (i * step if ccw else -i * step)
+            lower(heights, int(cx + r * math.cos(a)), int(cy + r * math.sin(a)),
+                  p1[2] + (p2[2] - p1[2]) * i / ndivs)
+        r += WalkRes
+    # the walk only cut the half of the end cup in front of the tool, but
+    # on a helix the last ring steps behind it are higher than the end point
+    walkCup(heights, p2[0], p2[1], p2[2], 1, 0, rad, 2 * math.pi, ccw)
+
+def lineDistance(x, y, p1, p2):
+    dx, dy = p2[0] - p1[0], p2[1] - p1[1]
+    len2 = dx * dx + dy * dy
+    u = 0 if len2 < 1e-10 else min(1, max(0, ((x - p1[0]) * dx + (y - p1[1]) * dy) / len2))
+    return math.hypot(x - p1[0] - u * dx, y - p1[1] - u * dy)
+
+def arcDistance(x, y, p1, p2, cent, ccw):
+    cx, cy = p1[0] + cent[0], p1[1] + cent[1]
+    sang, ang = arcSweep(p1, p2, cent, ccw)
+    off = math.atan2(y - cy, x - cx) - sang
+    off = (off if ccw else -off) % (2 * math.pi)
+    dist = min(math.hypot(x - p1[0], y - p1[1]), math.hypot(x - p2[0], y - p2[1]))
+    if off <= ang:
+        dist = min(dist, abs(math.hypot(x - cx, y - cy) - math.hypot(cent[0], cent[1])))
+    return dist
+
+
+class TestPathSimulator(PathTestBase):
+    '''Compares the height map of single moves with the walked reference.'''
+
+    def simulate(self, start, command):
+        stock = Part.makeBox(12, 12, StockTop)
+        sim = PathSimulator.PathSim()
+        sim.BeginSimulation(stock, Resolution)
+        sim.SetToolShape(Part.makeCylinder(ToolRadius, 10), Resolution)
+        sim.ApplyCommand(FreeCAD.Placement(FreeCAD.Vector(*start), FreeCAD.Rotation()), command)
+        return [list(column) for column in sim.GetHeightMap()]
+
+    def compare(self, heights, reference, distance, tolerance):
+        '''Pixels well inside the tool path must be cut to the reference
+        depth, pixels well outside must be uncut. The pixels within one and
+        a half pixels of the tool border are sampled differently.'''
+        rad = ToolRadius / Resolution
+        cut = 0
+        self.assertEqual(len(heights), len(reference))
+        for x in range(len(heights)):
+            for y in range(len(heights[x])):
+                d = distance(x + 0.5, y + 0.5)
+                if d <= rad - 1.5:
+                    self.assertLess(heights[x][y], StockTop)
+                    self.assertRoughly(heights[x][y], reference[x][y], tolerance)
+                    cut += 1
+                elif d >= rad + 1.5:
+                    self.assertEqual(heights[x][y], StockTop)
+                    self.assertEqual(reference[x][y], StockTop)
+        self.assertGreater(cut, 0)
+
+    def checkLine(self, p1, p2):
+        heights = self.simulate(p1, Path.Command('G1', {'X': p2[0], 'Y': p2[1], 'Z': p2[2]}))
+        reference = [[StockTop] * len(heights[0]) for _ in heights]
+        q1 = (p1[0] / Resolution, p1[1] / Resolution, p1[2])
+        q2 = (p2[0] / Resolution, p2[1] / Resolution, p2[2])
+        walkLine(reference, q1, q2, ToolRadius / Resolution)
+        lenXY = max(1, math.hypot(q2[0] - q1[0], q2[1] - q1[1]))
+        tolerance = 1e-4 + 1.5 * abs(q2[2] - q1[2]) / lenXY
+        self.compare(heights, reference, lambda x, y: lineDistance(x, y, q1, q2), tolerance)
+
+    def checkArc(self, p1, p2, cent, ccw):
+        heights = self.simulate(p1, Path.Command('G3' if ccw else 'G2',
+            {'X': p2[0], 'Y': p2[1], 'Z': p2[2], 'I': cent[0], 'J': cent[1]}))
+        reference = [[StockTop] * len(heights[0]) for _ in heights]
+        q1 = (p1[0] / Resolution, p1[1] / Resolution, p1[2])
+        q2 = (p2[0] / Resolution, p2[1] / Resolution, p2[2])
+        c = (cent[0] / Resolution, cent[1] / Resolution)
+        rad = ToolRadius / Resolution
+        walkArc(reference, q1, q2, c, rad, ccw)
+        # the reference steps the depth per ring, the inner ring is the shortest
+        ang = arcSweep(q1, q2, c, ccw)[1]
+        inner = max(1, ang * (math.hypot(c[0], c[1]) - rad))
+        tolerance = 1e-4 + 1.5 * abs(q2[2] - q1[2]) / inner
+
+        def distance(x, y):
+            # on a helix the depth steps at the border of the end disc as well
+            if q1[2] != q2[2] and abs(math.hypot(x - q2[0], y - q2[1]) - rad) < 1.5:
+                return rad
+            return arcDistance(x, y, q1, q2, c, ccw)
+        self.compare(heights, reference, distance, tolerance)
+
+    def test00(self):
+        '''Verify straight, diagonal and ramped lines and plunges.'''
+        self.checkLine((2, 3, 8), (10, 3, 8))
+        self.checkLine((2, 2, 8), (9, 10, 8))
+        self.checkLine((2, 6, 9), (10, 6, 6))
+        self.checkLine((6, 6, 9), (6, 6, 7))
+
+    def test10(self):
+        '''Verify arcs, a full circle and a helical arc.'''
+        self.checkArc((9, 6, 8), (6, 9, 8), (-3, 0), True)
+        self.checkArc((9, 6, 8), (3, 6, 8), (-3, 0), False)
+        self.checkArc((9, 6, 8), (9, 6, 8), (-3, 0), True)
+        self.checkArc((9, 6, 8), (6, 9, 7), (-3, 0), True)
@@ -54,6 +54,7 @@ PyMOD_INIT_FUNC(Points)
     Points::PropertyNormalList    ::init();
     Points::PropertyCurvatureList ::init();
     Points::PropertyPointKernel   ::init();
+    Points::PropertyPointOctree   ::init();
 
     // add data types
     Points::Feature               ::init();
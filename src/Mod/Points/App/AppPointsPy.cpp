@@ -84,7 +84,7 @@ private:
                 throw Py::RuntimeError("No file extension");
 
             std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
+            if (file.hasExtension("asc") || file.hasExtension("xyz")) {
                 reader.reset(new AscReader);
             }
             else if (file.hasExtension("ply")) {
@@ -196,7 +196,7 @@ private:
                 throw Py::RuntimeError("No file extension");
 
             std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
+            if (file.hasExtension("asc") || file.hasExtension("xyz")) {
                 reader.reset(new AscReader);
             }
             else if (file.hasExtension("ply")) {
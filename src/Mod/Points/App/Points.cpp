@@ -25,25 +25,23 @@
 #ifndef _PreComp_
 # include <cmath>
 # include <iostream>
+# include <mutex>
 #endif
 
 #include <boost/math/special_functions/fpclassify.hpp>
-#include <QtConcurrentMap>
 
 #include <Base/Exception.h>
 #include <Base/Matrix.h>
+#include <Base/Parallel.h>
 #include <Base/Persistence.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "Points.h"
 #include "PointsAlgos.h"
+#include "PointsGrid.h"
 #include "PointsPy.h"
 
-#ifdef _WIN32
-# include <ppl.h>
-#endif
-
 using namespace Points;
 using namespace std;
 
@@ -85,49 +83,43 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 void PointKernel::transformGeometry(const Base::Matrix4D &rclMat)
 {
     std::vector<value_type>& kernel = getBasicPoints();
-#ifdef _WIN32
-    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we cannot use QtConcurrent
-    // We could also rewrite Points to leverage SIMD instructions
-    // Other option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
+    Base::parallel_for<std::size_t>(kernel.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        rclMat.multVec(kernel.data() + begin, end - begin);
     });
-#else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) {
-        rclMat.multVec(value, value);
-    });
-#endif
 }
 
 Base::BoundBox3d PointKernel::getBoundBox(void)const
 {
     Base::BoundBox3d bnd;
-
-#ifdef _WIN32
-    // Thread-local bounding boxes
-    Concurrency::combinable<Base::BoundBox3d> bbs;
-    // Cannot use a const_point_iterator here as it is *not* a proper iterator (fails the for_each template)
-    Concurrency::parallel_for_each(_Points.begin(), _Points.end(), [this, &bbs](const value_type& value) {
-        Base::Vector3d vertd(value.x, value.y, value.z);
-        bbs.local().Add(this->_Mtrx * vertd);
-    });
-    // Combine each thread-local bounding box in the final bounding box
-    bbs.combine_each([&bnd](const Base::BoundBox3d& lbb) {
-        bnd.Add(lbb);
+    std::mutex mutex;
+    Base::parallel_for<std::size_t>(_Points.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        Base::BoundBox3d box;
+        for (std::size_t i = begin; i < end; i++) {
+            const value_type& value = _Points[i];
+            Base::Vector3d vertd(value.x, value.y, value.z);
+            box.Add(this->_Mtrx * vertd);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        bnd.Add(box);
     });
-#else
-    for (const_point_iterator it = begin(); it != end(); ++it)
-        bnd.Add(*it);
-#endif
     return bnd;
 }
 
+std::shared_ptr<const PointsGrid> PointKernel::getSearchGrid() const
+{
+    std::lock_guard<std::mutex> lock(_searchMutex);
+    if (!_searchGrid)
+        _searchGrid = std::make_shared<PointsGrid>(*this);
+    return _searchGrid;
+}
+
 void PointKernel::operator = (const PointKernel& Kernel)
 {
     if (this != &Kernel) {
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
         this->_Points = Kernel._Points;
+        invalidateSearch();
     }
 }
 
@@ -184,6 +176,11 @@ void PointKernel::SaveDocFile (Base::Writer &writer) const
     }
 }
 
+bool PointKernel::isSaveDocFileConcurrent() const
+{
+    return true;
+}
+
 void PointKernel::Restore(Base::XMLReader &reader)
 {
     clear();
@@ -198,6 +195,7 @@ void PointKernel::Restore(Base::XMLReader &reader)
     if (reader.DocumentSchema > 3) {
         std::string Matrix (reader.getAttribute("mtrx") );
         _Mtrx.fromString(Matrix);
+        invalidateSearch();
     }
 }
 
@@ -206,6 +204,7 @@ void PointKernel::RestoreDocFile(Base::Reader &reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    invalidateSearch();
     _Points.resize(uCt);
     for (unsigned long i=0; i < uCt; i++) {
         float x, y, z;
@@ -26,6 +26,8 @@
 
 #include <vector>
 #include <iterator>
+#include <memory>
+#include <mutex>
 
 #include <Base/Vector3D.h>
 #include <Base/Matrix.h>
@@ -37,6 +39,7 @@
 
 namespace Points
 {
+class PointsGrid;
 
 
 /** Point kernel
@@ -77,22 +80,28 @@ public:
     virtual Data::Segment* getSubElement(const char* Type, unsigned long) const;
     //@}
 
-    inline void setTransform(const Base::Matrix4D& rclTrf){_Mtrx = rclTrf;}
+    inline void setTransform(const Base::Matrix4D& rclTrf){_Mtrx = rclTrf; invalidateSearch();}
     inline Base::Matrix4D getTransform(void) const{return _Mtrx;}
+    /// The points may be modified through the returned reference, so the search grid is dropped
     std::vector<value_type>& getBasicPoints()
-    { return this->_Points; }
+    { invalidateSearch(); return this->_Points; }
     const std::vector<value_type>& getBasicPoints() const
     { return this->_Points; }
     void setBasicPoints(const std::vector<value_type>& pts)
-    { this->_Points = pts; }
+    { this->_Points = pts; invalidateSearch(); }
     void swap(std::vector<value_type>& pts)
-    { this->_Points.swap(pts); }
+    { this->_Points.swap(pts); invalidateSearch(); }
 
     virtual void getPoints(std::vector<Base::Vector3d> &Points,
         std::vector<Base::Vector3d> &Normals,
         float Accuracy, uint16_t flags=0) const;
     virtual void transformGeometry(const Base::Matrix4D &rclMat);
     virtual Base::BoundBox3d getBoundBox(void)const;
+    /** Returns a grid of the points for the batched searches. The grid is kept until the
+     * points or the transformation are changed. It must not be used after the kernel is
+     * modified or destroyed.
+     */
+    std::shared_ptr<const PointsGrid> getSearchGrid() const;
 
     /** @name I/O */
     //@{
@@ -100,6 +109,7 @@ public:
     unsigned int getMemSize (void) const;
     void Save (Base::Writer &writer) const;
     void SaveDocFile (Base::Writer &writer) const;
+    bool isSaveDocFileConcurrent() const;
     void Restore(Base::XMLReader &reader);
     void RestoreDocFile(Base::Reader &reader);
     void save(const char* file) const;
@@ -108,22 +118,30 @@ public:
     void load(std::istream&);
     //@}
 
+private:
+    /// Drops the search grid, must be called whenever the points or the transformation change
+    void invalidateSearch()
+    { _searchGrid.reset(); }
+
 private:
     Base::Matrix4D _Mtrx;
     std::vector<value_type> _Points;
+    mutable std::mutex _searchMutex;
+    mutable std::shared_ptr<PointsGrid> _searchGrid;
 
 public:
     /// number of points stored 
     size_type size(void) const {return this->_Points.size();}
     size_type countValid(void) const;
     std::vector<value_type> getValidPoints() const;
-    void resize(size_type n){_Points.resize(n);}
+    void resize(size_type n){_Points.resize(n); invalidateSearch();}
     void reserve(size_type n){_Points.reserve(n);}
     inline void erase(size_type first, size_type last) {
         _Points.erase(_Points.begin()+first,_Points.begin()+last);
+        invalidateSearch();
     }
 
-    void clear(void){_Points.clear();}
+    void clear(void){_Points.clear(); invalidateSearch();}
 
 
     /// get the points
@@ -133,10 +151,12 @@ public:
     /// set the points
     inline void setPoint(const int idx,const Base::Vector3d& point) {
         _Points[idx] = transformToInside(point);
+        invalidateSearch();
     }
     /// insert the points
     inline void push_back(const Base::Vector3d& point) {
         _Points.push_back(transformToInside(point));
+        invalidateSearch();
     }
 
     class PointsExport const_point_iterator
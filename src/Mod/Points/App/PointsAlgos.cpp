@@ -26,6 +26,10 @@
 #ifdef FC_OS_LINUX
 # include <unistd.h>
 #endif
+# include <algorithm>
+# include <cmath>
+# include <cstring>
+# include <iterator>
 # include <sstream>
 #endif
 
@@ -37,6 +41,7 @@
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
@@ -45,9 +50,317 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <QFile>
 
 using namespace Points;
 
+// ----------------------------------------------------------------------------
+
+namespace Points {
+
+/**
+ * The content of a file. The file is memory mapped if possible, otherwise it is
+ * read into a buffer.
+ */
+class FileBuffer
+{
+public:
+    explicit FileBuffer(const char* filename)
+      : file(QString::fromUtf8(filename))
+      , data(nullptr)
+      , length(0)
+    {
+        Base::FileInfo fi(filename);
+        if (!fi.isReadable())
+            throw Base::FileException("File to load not existing or not readable", filename);
+
+        if (file.open(QIODevice::ReadOnly) && file.size() > 0) {
+            length = static_cast<std::size_t>(file.size());
+            data = file.map(0, file.size());
+        }
+
+        if (!data) {
+            Base::ifstream str(fi, std::ios::in | std::ios::binary);
+            buffer.assign(std::istreambuf_iterator<char>(str), std::istreambuf_iterator<char>());
+            length = buffer.size();
+        }
+    }
+
+    const char* begin() const
+    {
+        return data ? reinterpret_cast<const char*>(data) : buffer.data();
+    }
+    const char* end() const
+    {
+        return begin() + length;
+    }
+    std::size_t size() const
+    {
+        return length;
+    }
+
+private:
+    QFile file;
+    uchar* data;
+    std::size_t length;
+    std::vector<char> buffer;
+};
+
+/// A range of lines or rows that is handled by one thread.
+struct Chunk
+{
+    const char* begin;
+    const char* end;
+    std::size_t first;
+    std::size_t count;
+    bool failed;
+    std::vector<Base::Vector3f> points;
+};
+
+/**
+ * Splits the range [begin, end) into chunks at line ends, one for each thread.
+ */
+static std::vector<Chunk> splitLines(const char* begin, const char* end)
+{
+    const std::size_t minSize = 1 << 20;
+    std::size_t size = static_cast<std::size_t>(end - begin);
+    std::size_t parts = std::min<std::size_t>(Base::parallelThreadCount(), size / minSize + 1);
+    std::size_t step = size / parts + 1;
+
+    std::vector<Chunk> chunks;
+    while (begin < end) {
+        const char* last = begin + std::min<std::size_t>(step, end - begin);
+        last = std::find(last, end, '\n');
+        if (last != end)
+            ++last;
+        Chunk chunk = { begin, last, 0, 0, false, {} };
+        chunks.push_back(chunk);
+        begin = last;
+    }
+
+    return chunks;
+}
+
+/// Splits the rows [0, count) into chunks, one for each thread.
+static std::vector<Chunk> splitRows(std::size_t count)
+{
+    std::size_t parts = Base::parallelThreadCount();
+    std::size_t step = count / parts + 1;
+
+    std::vector<Chunk> chunks;
+    for (std::size_t first = 0; first < count; first += step) {
+        Chunk chunk = { nullptr, nullptr, first, std::min(step, count - first), false, {} };
+        chunks.push_back(chunk);
+    }
+
+    return chunks;
+}
+
+/// Calls \a func for every chunk, the chunks are distributed over the threads.
+template <class Func>
+static void forEachChunk(std::vector<Chunk>& chunks, Func func)
+{
+    Base::parallel_for<std::size_t>(chunks.size(), 1, [&chunks, &func](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++)
+            func(chunks[i]);
+    });
+}
+
+static inline const char* lineEnd(const char* it, const char* end)
+{
+    const char* eol = static_cast<const char*>(std::memchr(it, '\n', end - it));
+    return eol ? eol : end;
+}
+
+static inline const char* skipSpaces(const char* it, const char* end)
+{
+    while (it != end && (*it == ' ' || *it == '\t' || *it == '\r'))
+        ++it;
+    return it;
+}
+
+/**
+ * Parses a decimal number of the form [+-]ddd[.ddd][(e|E)[+-]ddd] independent of the
+ * locale. On success \a it points behind the number.
+ */
+static bool parseNumber(const char*& it, const char* end, double& value)
+{
+    static const double powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* p = it;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    // up to 19 significant digits fit into the mantissa
+    std::uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    for (; p != end && *p >= '0' && *p <= '9'; ++p) {
+        hasDigits = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0)
+                digits++;
+        }
+        else {
+            exponent++;
+        }
+    }
+    if (p != end && *p == '.') {
+        for (++p; p != end && *p >= '0' && *p <= '9'; ++p) {
+            hasDigits = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa != 0)
+                    digits++;
+                exponent--;
+            }
+        }
+    }
+    if (!hasDigits)
+        return false;
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negativeExp = false;
+        if (q != end && (*q == '-' || *q == '+')) {
+            negativeExp = (*q == '-');
+            ++q;
+        }
+        if (q != end && *q >= '0' && *q <= '9') {
+            int exp = 0;
+            for (; q != end && *q >= '0' && *q <= '9'; ++q) {
+                if (exp < 10000)
+                    exp = exp * 10 + (*q - '0');
+            }
+            exponent += negativeExp ? -exp : exp;
+            p = q;
+        }
+    }
+
+    double result = static_cast<double>(mantissa);
+    if (exponent > 0 && exponent <= 22)
+        result *= powers[exponent];
+    else if (exponent < 0 && exponent >= -22)
+        result /= powers[-exponent];
+    else if (exponent != 0)
+        result *= std::pow(10.0, exponent);
+
+    value = negative ? -result : result;
+    it = p;
+    return true;
+}
+
+/**
+ * Parses up to \a count whitespace separated numbers of the line [it, eol).
+ * Returns the number of parsed values, \a it points behind the last one.
+ */
+static int parseLine(const char*& it, const char* eol, double* values, int count)
+{
+    int num = 0;
+    while (num < count) {
+        const char* pos = skipSpaces(it, eol);
+        if (pos == eol || !parseNumber(pos, eol, values[num]))
+            break;
+        // numbers must be separated by whitespace
+        if (pos != eol && *pos != ' ' && *pos != '\t' && *pos != '\r')
+            break;
+        it = pos;
+        num++;
+    }
+
+    return num;
+}
+
+static bool isBlankLine(const char* it, const char* eol)
+{
+    return skipSpaces(it, eol) == eol;
+}
+
+/// The number types of binary PLY files.
+enum BinaryType {
+    Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64
+};
+
+static BinaryType binaryType(const std::string& t, int size)
+{
+    switch (size) {
+    case 1:
+        if (t == "char" || t == "int8")
+            return Int8;
+        else if (t == "uchar" || t == "uint8")
+            return UInt8;
+        break;
+    case 2:
+        if (t == "short" || t == "int16")
+            return Int16;
+        else if (t == "ushort" || t == "uint16")
+            return UInt16;
+        break;
+    case 4:
+        if (t == "int" || t == "int32")
+            return Int32;
+        else if (t == "uint" || t == "uint32")
+            return UInt32;
+        else if (t == "float" || t == "float32")
+            return Float32;
+        break;
+    case 8:
+        if (t == "double" || t == "float64")
+            return Float64;
+        break;
+    default:
+        break;
+    }
+
+    throw Base::BadFormatError("Unexpected type");
+}
+
+template <typename T>
+static inline double readBinaryValue(const char* data, bool swapByteOrder)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, data, sizeof(T));
+    if (swapByteOrder)
+        std::reverse(bytes, bytes + sizeof(T));
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return static_cast<double>(value);
+}
+
+static double readBinaryValue(BinaryType type, const char* data, bool swapByteOrder)
+{
+    switch (type) {
+    case Int8:
+        return readBinaryValue<int8_t>(data, swapByteOrder);
+    case UInt8:
+        return readBinaryValue<uint8_t>(data, swapByteOrder);
+    case Int16:
+        return readBinaryValue<int16_t>(data, swapByteOrder);
+    case UInt16:
+        return readBinaryValue<uint16_t>(data, swapByteOrder);
+    case Int32:
+        return readBinaryValue<int32_t>(data, swapByteOrder);
+    case UInt32:
+        return readBinaryValue<uint32_t>(data, swapByteOrder);
+    case Float32:
+        return readBinaryValue<float>(data, swapByteOrder);
+    case Float64:
+        return readBinaryValue<double>(data, swapByteOrder);
+    }
+
+    return 0.0;
+}
+
+}
+
 void PointsAlgos::Load(PointKernel &points, const char *FileName)
 {
     Base::FileInfo File(FileName);
@@ -56,7 +369,7 @@ void PointsAlgos::Load(PointKernel &points, const char *FileName)
     if (!File.isReadable())
         throw Base::FileException("File to load not existing or not readable", FileName);
 
-    if (File.hasExtension("asc"))
+    if (File.hasExtension("asc") || File.hasExtension("xyz"))
         LoadAscii(points,FileName);
     else
         throw Base::RuntimeError("Unknown ending");
@@ -64,57 +377,45 @@ void PointsAlgos::Load(PointKernel &points, const char *FileName)
 
 void PointsAlgos::LoadAscii(PointKernel &points, const char *FileName)
 {
-    boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                     "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                     "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    //boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    //boost::regex rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt=0;
-    std::string line;
-    Base::FileInfo fi(FileName);
-
-    Base::ifstream tmp_str(fi, std::ios::in);
-
-    // estimating size
-    while (std::getline(tmp_str,line))
-        LineCnt++;
-
-    // resize the PointKernel
-    points.resize(LineCnt);
-
-    Base::SequencerLauncher seq( "Loading points...", LineCnt );
-
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
-
-    try {
-        // read file
-        while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
-
-                points.setPoint(LineCnt,pt);
-                seq.next();
-                LineCnt++;
+    // Every line with exactly three numbers is a point, all other lines are ignored.
+    // The file is split into chunks of lines that are parsed in parallel.
+    FileBuffer file(FileName);
+    std::vector<Chunk> chunks = splitLines(file.begin(), file.end());
+    forEachChunk(chunks, [](Chunk& chunk) {
+        double xyz[3];
+        for (const char* it = chunk.begin; it < chunk.end; ) {
+            const char* eol = lineEnd(it, chunk.end);
+            if (parseLine(it, eol, xyz, 3) == 3 && isBlankLine(it, eol)) {
+                chunk.points.emplace_back(static_cast<float>(xyz[0]),
+                                          static_cast<float>(xyz[1]),
+                                          static_cast<float>(xyz[2]));
             }
+            it = eol + 1;
         }
+    });
+
+    std::size_t numPoints = 0;
+    for (std::vector<Chunk>::iterator it = chunks.begin(); it != chunks.end(); ++it) {
+        it->first = numPoints;
+        numPoints += it->points.size();
     }
-    catch (...) {
-        points.clear();
-        throw Base::BadFormatError("Reading in points failed.");
+
+    std::vector<PointKernel::value_type> kernel(numPoints);
+    forEachChunk(chunks, [&kernel](Chunk& chunk) {
+        std::copy(chunk.points.begin(), chunk.points.end(), kernel.begin() + chunk.first);
+        std::vector<Base::Vector3f>().swap(chunk.points);
+    });
+
+    // the points are given in global coordinates
+    Base::Matrix4D mat = points.getTransform();
+    if (mat != Base::Matrix4D()) {
+        mat.inverse();
+        Base::parallel_for<std::size_t>(kernel.size(), 4096, [&](std::size_t begin, std::size_t end) {
+            mat.multVec(kernel.data() + begin, end - begin);
+        });
     }
 
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size())
-        points.erase(LineCnt, points.size());
+    points.swap(kernel);
 }
 
 // ----------------------------------------------------------------------------
@@ -493,6 +794,58 @@ lzfDecompress (const void *const in_data,  unsigned int in_len,
 }
 }
 
+/**
+ * The columns of the vertex properties of a PLY file. A row of values is written
+ * directly into the point kernel and the arrays of normals, intensities and colors.
+ */
+struct PlyReader::Fields
+{
+    std::size_t x, y, z;
+    std::size_t normal_x, normal_y, normal_z;
+    std::size_t greyvalue;
+    std::size_t red, green, blue, alpha;
+    bool hasNormal, hasIntensity, hasColor;
+    float colorScale;
+
+    std::vector<PointKernel::value_type>* points;
+    std::vector<Base::Vector3f>* normals;
+    std::vector<float>* intensity;
+    std::vector<App::Color>* colors;
+
+    void resize(std::size_t numPoints)
+    {
+        points->resize(numPoints);
+        if (hasNormal)
+            normals->resize(numPoints);
+        if (hasIntensity)
+            intensity->resize(numPoints);
+        if (hasColor)
+            colors->resize(numPoints);
+    }
+
+    void store(std::size_t row, const double* data)
+    {
+        (*points)[row].Set(static_cast<float>(data[x]),
+                           static_cast<float>(data[y]),
+                           static_cast<float>(data[z]));
+        if (hasNormal) {
+            (*normals)[row].Set(static_cast<float>(data[normal_x]),
+                                static_cast<float>(data[normal_y]),
+                                static_cast<float>(data[normal_z]));
+        }
+        if (hasIntensity) {
+            (*intensity)[row] = static_cast<float>(data[greyvalue]);
+        }
+        if (hasColor) {
+            float a = alpha < std::numeric_limits<std::size_t>::max() ? static_cast<float>(data[alpha]) : 1.0f;
+            (*colors)[row].set(static_cast<float>(data[red]) * colorScale,
+                               static_cast<float>(data[green]) * colorScale,
+                               static_cast<float>(data[blue]) * colorScale,
+                               a * colorScale);
+        }
+    }
+};
+
 PlyReader::PlyReader()
 {
 }
@@ -507,8 +860,10 @@ void PlyReader::read(const std::string& filename)
     this->width = 1;
     this->height = 0;
 
-    Base::FileInfo fi(filename);
-    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+    // the header is read from a stream, the data directly from memory
+    FileBuffer file(filename.c_str());
+    Base::MemoryIStreambuf buf(file.begin(), file.size());
+    std::istream inp(&buf);
 
     std::string format;
     std::vector<std::string> fields;
@@ -517,17 +872,6 @@ void PlyReader::read(const std::string& filename)
     std::size_t offset = 0;
     std::size_t numPoints = readHeader(inp, format, offset, fields, types, sizes);
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
     std::vector<std::string>::iterator it;
     std::size_t max_size = std::numeric_limits<std::size_t>::max();
 
@@ -603,53 +947,39 @@ void PlyReader::read(const std::string& filename)
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (std::size_t i=0; i<numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i,x),data(i,y),data(i,z)));
-        }
-    }
+    if (!hasData)
+        return;
+
+    Fields columns;
+    columns.x = x;
+    columns.y = y;
+    columns.z = z;
+    columns.normal_x = normal_x;
+    columns.normal_y = normal_y;
+    columns.normal_z = normal_z;
+    columns.greyvalue = greyvalue;
+    columns.red = red;
+    columns.green = green;
+    columns.blue = blue;
+    columns.alpha = alpha;
+    columns.hasNormal = hasNormal;
+    columns.hasIntensity = hasIntensity;
+    columns.hasColor = hasColor && (types[red] == "uchar" || types[red] == "float");
+    columns.colorScale = (hasColor && types[red] == "uchar") ? 1.0f/255.0f : 1.0f;
+    columns.points = &points.getBasicPoints();
+    columns.normals = &normals;
+    columns.intensity = &intensity;
+    columns.colors = &colors;
+    columns.resize(numPoints);
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (std::size_t i=0; i<numPoints; i++) {
-            normals.emplace_back(data(i,normal_x),data(i,normal_y),data(i,normal_z));
-        }
+    if (format == "ascii") {
+        readAscii(buf.current(), file.end(), offset, numPoints, fields.size(), columns);
     }
-
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (std::size_t i=0; i<numPoints; i++) {
-            intensity.push_back(data(i,greyvalue));
-        }
+    else if (format == "binary_little_endian") {
+        readBinary(false, buf.current(), file.end(), offset, numPoints, types, sizes, columns);
     }
-
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (std::size_t i=0; i<numPoints; i++) {
-                float r = data(i, red);
-                float g = data(i, green);
-                float b = data(i, blue);
-                if (alpha != max_size)
-                    a = data(i, alpha);
-                colors.emplace_back(static_cast<float>(r)/255.0f,
-                                            static_cast<float>(g)/255.0f,
-                                            static_cast<float>(b)/255.0f,
-                                            static_cast<float>(a)/255.0f);
-            }
-        }
-        else if (types[red] == "float") {
-            for (std::size_t i=0; i<numPoints; i++) {
-                float r = data(i, red);
-                float g = data(i, green);
-                float b = data(i, blue);
-                if (alpha != max_size)
-                    a = data(i, alpha);
-                colors.emplace_back(r, g, b, a);
-            }
-        }
+    else if (format == "binary_big_endian") {
+        readBinary(true, buf.current(), file.end(), offset, numPoints, types, sizes, columns);
     }
 }
 
@@ -821,119 +1151,99 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(const char* begin, const char* end, std::size_t offset,
+                          std::size_t numPoints, std::size_t numFields, Fields& columns)
 {
-    std::string line;
-    std::size_t row = 0;
-    std::size_t numPoints = data.rows();
-    std::size_t numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty())
-            continue;
-
-        if (offset > 0) {
+    // skip the lines of the elements before the vertices
+    const char* it = begin;
+    while (offset > 0 && it < end) {
+        const char* eol = lineEnd(it, end);
+        if (!isBlankLine(it, eol))
             offset--;
-            continue;
+        it = eol + 1;
+    }
+    it = std::min(it, end);
+
+    // count the lines of each chunk to get the row of its first line
+    std::vector<Chunk> chunks = splitLines(it, end);
+    forEachChunk(chunks, [](Chunk& chunk) {
+        for (const char* pos = chunk.begin; pos < chunk.end; ) {
+            const char* eol = lineEnd(pos, chunk.end);
+            if (!isBlankLine(pos, eol))
+                chunk.count++;
+            pos = eol + 1;
         }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of ("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        for (std::size_t col = 0; col < list.size() && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
+    });
+
+    std::size_t numRows = 0;
+    for (std::vector<Chunk>::iterator jt = chunks.begin(); jt != chunks.end(); ++jt) {
+        jt->first = numRows;
+        numRows += jt->count;
+    }
+
+    // lines after the vertices belong to other elements
+    forEachChunk(chunks, [numPoints, numFields, &columns](Chunk& chunk) {
+        std::vector<double> values(numFields);
+        std::size_t row = chunk.first;
+        for (const char* pos = chunk.begin; pos < chunk.end && row < numPoints; ) {
+            const char* eol = lineEnd(pos, chunk.end);
+            if (!isBlankLine(pos, eol)) {
+                std::fill(values.begin(), values.end(), 0.0);
+                int num = parseLine(pos, eol, values.data(), static_cast<int>(numFields));
+                if (num < static_cast<int>(numFields) && !isBlankLine(pos, eol)) {
+                    chunk.failed = true;
+                    break;
+                }
+                columns.store(row++, values.data());
+            }
+            pos = eol + 1;
         }
+    });
 
-        ++row;
+    for (std::vector<Chunk>::iterator jt = chunks.begin(); jt != chunks.end(); ++jt) {
+        if (jt->failed)
+            throw Base::BadFormatError("Invalid number in vertex data");
     }
+
+    if (numRows < numPoints)
+        columns.resize(numRows);
 }
 
 void PlyReader::readBinary(bool swapByteOrder,
-                           std::istream& inp,
+                           const char* begin,
+                           const char* end,
                            std::size_t offset,
+                           std::size_t numPoints,
                            const std::vector<std::string>& types,
                            const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+                           Fields& columns)
 {
-    std::size_t numPoints = data.rows();
-    std::size_t numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
+    std::size_t numFields = types.size();
+    std::vector<BinaryType> fieldTypes;
+    std::vector<std::size_t> fieldOffsets;
+    std::size_t rowSize = 0;
     for (std::size_t j=0; j<numFields; j++) {
-        std::string t = types[j];
-        switch (sizes[j]) {
-        case 1:
-            if (t == "char" || t == "int8")
-                converters.push_back(convert_int8);
-            else if (t == "uchar" || t == "uint8")
-                converters.push_back(convert_uint8);
-            else
-                throw Base::BadFormatError("Unexpected type");
-            break;
-        case 2:
-            if (t == "short" || t == "int16")
-                converters.push_back(convert_int16);
-            else if (t == "ushort" || t == "uint16")
-                converters.push_back(convert_uint16);
-            else
-                throw Base::BadFormatError("Unexpected type");
-            break;
-        case 4:
-            if (t == "int" || t == "int32")
-                converters.push_back(convert_int32);
-            else if (t == "uint" || t == "uint32")
-                converters.push_back(convert_uint32);
-            else if (t == "float" || t == "float32")
-                converters.push_back(convert_float32);
-            else
-                throw Base::BadFormatError("Unexpected type");
-            break;
-        case 8:
-            if (t == "double" || t == "float64")
-                converters.push_back(convert_float64);
-            else
-                throw Base::BadFormatError("Unexpected type");
-            break;
-        default:
-            throw Base::BadFormatError("Unexpected type");
+        fieldTypes.push_back(binaryType(types[j], sizes[j]));
+        fieldOffsets.push_back(rowSize);
+        rowSize += sizes[j];
+    }
+
+    // the vertices come after the other elements
+    std::size_t available = static_cast<std::size_t>(end - begin);
+    if (offset > available || numPoints * rowSize > available - offset)
+        throw Base::BadFormatError("File expects too many elements");
+    begin += offset;
+
+    std::vector<Chunk> chunks = splitRows(numPoints);
+    forEachChunk(chunks, [&](Chunk& chunk) {
+        std::vector<double> values(numFields);
+        for (std::size_t row = chunk.first; row < chunk.first + chunk.count; row++) {
+            const char* data = begin + row * rowSize;
+            for (std::size_t j=0; j<numFields; j++)
+                values[j] = readBinaryValue(fieldTypes[j], data + fieldOffsets[j], swapByteOrder);
+            columns.store(row, values.data());
         }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize*static_cast<std::streamoff>(numPoints) > ulSize)
-            throw Base::BadFormatError("File expects too many elements");
-    }
-
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (std::size_t i=0; i<numPoints; i++) {
-        for (std::size_t j=0; j<numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
+    });
 }
 
 // ----------------------------------------------------------------------------
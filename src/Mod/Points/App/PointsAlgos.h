@@ -88,14 +88,17 @@ public:
     void read(const std::string& filename);
 
 private:
+    struct Fields;
     std::size_t readHeader(std::istream&, std::string& format, std::size_t& offset,
         std::vector<std::string>& fields, std::vector<std::string>& types,
         std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
-    void readBinary(bool swapByteOrder, std::istream&, std::size_t offset,
+    void readAscii(const char* begin, const char* end, std::size_t offset,
+        std::size_t numPoints, std::size_t numFields, Fields&);
+    void readBinary(bool swapByteOrder, const char* begin, const char* end,
+        std::size_t offset, std::size_t numPoints,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
-        Eigen::MatrixXd& data);
+        Fields&);
 };
 
 class PcdReader : public Reader
@@ -0,0 +1,100 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Writes random point clouds and measures how fast Points imports them.
+
+    import PointsBenchmark
+    PointsBenchmark.run()
+
+creates ASC, ASCII PLY and binary PLY files in a temporary directory and
+prints the size, the import time and the throughput in MB/s of each file.
+"""
+
+import os
+import random
+import struct
+import tempfile
+import time
+import FreeCAD, Points
+
+App = FreeCAD
+
+def writeAsc(name, points):
+    with open(name, "w") as f:
+        for p in points:
+            f.write("%.6f %.6f %.6f\n" % p)
+
+def writePly(name, points, binary):
+    header = ["ply",
+              "format %s 1.0" % ("binary_little_endian" if binary else "ascii"),
+              "element vertex %d" % len(points),
+              "property float x",
+              "property float y",
+              "property float z",
+              "property float intensity",
+              "end_header"]
+    with open(name, "wb") as f:
+        f.write(("\n".join(header) + "\n").encode("ascii"))
+        if binary:
+            for p in points:
+                f.write(struct.pack("<4f", p[0], p[1], p[2], p[0]))
+        else:
+            for p in points:
+                f.write(("%.6f %.6f %.6f %.6f\n" % (p[0], p[1], p[2], p[0])).encode("ascii"))
+
+def measure(name):
+    """Return the number of points and the time of importing the file"""
+    if name.endswith(".asc"):
+        start = time.time()
+        points = Points.Points()
+        points.read(name)
+        elapsed = time.time() - start
+        return points.CountPoints, elapsed
+
+    doc = App.newDocument()
+    try:
+        start = time.time()
+        Points.insert(name, doc.Name)
+        elapsed = time.time() - start
+        return doc.Objects[0].Points.CountPoints, elapsed
+    finally:
+        App.closeDocument(doc.Name)
+
+def run(count=1000000):
+    """Print the import throughput of a random point cloud with the given number of points"""
+    points = [(random.uniform(-100.0, 100.0),
+               random.uniform(-100.0, 100.0),
+               random.uniform(-100.0, 100.0)) for i in range(count)]
+    directory = tempfile.mkdtemp()
+    files = [(os.path.join(directory, "cloud.asc"), lambda n: writeAsc(n, points)),
+             (os.path.join(directory, "ascii.ply"), lambda n: writePly(n, points, False)),
+             (os.path.join(directory, "binary.ply"), lambda n: writePly(n, points, True))]
+
+    App.Console.PrintMessage("%12s %12s %12s %12s %12s\n" % ("file", "points", "size [MB]", "time [s]", "MB/s"))
+    for name, write in files:
+        write(name)
+        size = os.path.getsize(name) / 1.0e6
+        num, elapsed = measure(name)
+        App.Console.PrintMessage("%12s %12d %12.1f %12.3f %12.1f\n" %
+                                 (os.path.basename(name), num, size, elapsed, size / max(elapsed, 1e-6)))
+        os.remove(name)
+    os.rmdir(directory)
@@ -35,6 +35,7 @@
 
 
 #include "PointsFeature.h"
+#include "PointsOctree.h"
 
 using namespace Points;
 
@@ -48,6 +49,8 @@ PROPERTY_SOURCE(Points::Feature, App::GeoFeature)
 Feature::Feature() 
 {
     ADD_PROPERTY(Points, (PointKernel()));
+    ADD_PROPERTY_TYPE(Octree, (nullptr), "Base", (App::PropertyType)(App::Prop_Hidden|App::Prop_Output),
+                      "The level-of-detail octree of the points");
 }
 
 Feature::~Feature()
@@ -76,6 +79,19 @@ void Feature::RestoreDocFile(Base::Reader &reader)
     Points.RestoreDocFile(reader);
 }
 
+void Feature::onDocumentRestored()
+{
+    GeoFeature::onDocumentRestored();
+
+    // only use the octree if it was built from the restored points
+    Octree.finishRestore(Points.getValue());
+}
+
+std::shared_ptr<const PointsOctree> Feature::getOctree() const
+{
+    return Octree.getValue(Points.getValue());
+}
+
 void Feature::onChanged(const App::Property* prop)
 {
     // if the placement has changed apply the change to the point data as well
@@ -85,6 +101,7 @@ void Feature::onChanged(const App::Property* prop)
     }
     // if the point data has changed check and adjust the transformation as well
     else if (prop == &this->Points) {
+        Octree.setValue(nullptr);
         Base::Placement p;
         p.fromMatrix(this->Points.getValue().getTransform());
         if (p != this->Placement.getValue())
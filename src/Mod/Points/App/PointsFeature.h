@@ -29,7 +29,9 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <App/PropertyGeo.h>
+#include <memory>
 #include "Points.h"
+#include "Properties.h"
 #include "PropertyPointKernel.h"
 
 
@@ -73,12 +75,20 @@ public:
     virtual const App::PropertyComplexGeoData* getPropertyOfGeometry() const {
         return &Points;
     }
+
+    /** Returns the level-of-detail octree of the points. It is built when it is
+     * requested for the first time and dropped when the points change.
+     */
+    std::shared_ptr<const PointsOctree> getOctree() const;
+
 protected:
     void onChanged(const App::Property* prop);
+    void onDocumentRestored();
     //@}
 
 public:
     PropertyPointKernel Points; /**< The point kernel property. */
+    PropertyPointOctree Octree; /**< The octree of the points. */
 };
 
 typedef App::FeatureCustomT<Feature> FeatureCustom;
@@ -25,14 +25,53 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <cfloat>
+# include <climits>
+# include <cmath>
 #endif
 
-
+#include <Base/Parallel.h>
 
 #include "PointsGrid.h"
 
 using namespace Points;
 
+namespace {
+/// The k nearest points found so far, sorted by squared distance
+struct NearestPoints
+{
+  unsigned long* indices;
+  double* distances;
+  std::size_t k;
+  std::size_t count;
+
+  double worst() const
+  {
+    return count < k ? DBL_MAX : distances[count-1];
+  }
+  void insert(unsigned long index, double dist)
+  {
+    if (count == k && dist >= distances[count-1])
+      return;
+    std::size_t pos = count < k ? count++ : count - 1;
+    for (; pos > 0 && distances[pos-1] > dist; pos--)
+    {
+      indices[pos] = indices[pos-1];
+      distances[pos] = distances[pos-1];
+    }
+    indices[pos] = index;
+    distances[pos] = dist;
+  }
+};
+
+/// Splits the queries [0, count) into ranges that are handled by the threads.
+template <class Func>
+void forEachQuery(std::size_t count, Func func)
+{
+  Base::parallel_for<std::size_t>(count, 64, func);
+}
+}
+
 PointsGrid::PointsGrid (const PointKernel &rclM)
 : _pclPoints(&rclM),
   _ulCtElements(0),
@@ -822,3 +861,119 @@ bool PointsGridIterator::NextOnRay (std::vector<unsigned long> &raulElements)
 
   return _bValidRay;
 }
+
+void PointsGrid::SearchNearest (const Base::Vector3d* queries, std::size_t count, std::size_t k,
+                                unsigned long* indices, double* distances) const
+{
+  if (k == 0)
+    return;
+
+  forEachQuery(count, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+    {
+      const Base::Vector3d& rclPt = queries[i];
+      NearestPoints res = { indices + i * k, distances + i * k, k, 0 };
+
+      if (_ulCtGridsX > 0 && _ulCtGridsY > 0 && _ulCtGridsZ > 0)
+      {
+        // search the hulls of growing distance around the grid of the point
+        unsigned long ulX, ulY, ulZ;
+        Position(rclPt, ulX, ulY, ulZ);
+        long nX = long(ulX), nY = long(ulY), nZ = long(ulZ);
+        for (long level = 0; ; level++)
+        {
+          long nX1 = std::max<long>(0, nX - level), nX2 = std::min<long>(long(_ulCtGridsX) - 1, nX + level);
+          long nY1 = std::max<long>(0, nY - level), nY2 = std::min<long>(long(_ulCtGridsY) - 1, nY + level);
+          long nZ1 = std::max<long>(0, nZ - level), nZ2 = std::min<long>(long(_ulCtGridsZ) - 1, nZ + level);
+          for (long x = nX1; x <= nX2; x++)
+          {
+            for (long y = nY1; y <= nY2; y++)
+            {
+              // inside the hull only the grids at the z borders are new
+              bool inner = std::labs(x - nX) < level && std::labs(y - nY) < level;
+              long step = inner ? 2 * level : 1;
+              for (long z = inner ? nZ - level : nZ1; z <= nZ2; z += step)
+              {
+                if (z < nZ1)
+                  continue;
+                const std::set<unsigned long>& rclSet = _aulGrid[x][y][z];
+                for (std::set<unsigned long>::const_iterator it = rclSet.begin(); it != rclSet.end(); ++it)
+                  res.insert(*it, Base::DistanceP2(rclPt, _pclPoints->getPoint(*it)));
+              }
+            }
+          }
+
+          // stop if no unvisited grid can hold a nearer point
+          double fGap = DBL_MAX;
+          if (nX - level > 0)
+            fGap = std::min(fGap, rclPt.x - (_fMinX + double(nX - level) * _fGridLenX));
+          if (nX + level + 1 < long(_ulCtGridsX))
+            fGap = std::min(fGap, (_fMinX + double(nX + level + 1) * _fGridLenX) - rclPt.x);
+          if (nY - level > 0)
+            fGap = std::min(fGap, rclPt.y - (_fMinY + double(nY - level) * _fGridLenY));
+          if (nY + level + 1 < long(_ulCtGridsY))
+            fGap = std::min(fGap, (_fMinY + double(nY + level + 1) * _fGridLenY) - rclPt.y);
+          if (nZ - level > 0)
+            fGap = std::min(fGap, rclPt.z - (_fMinZ + double(nZ - level) * _fGridLenZ));
+          if (nZ + level + 1 < long(_ulCtGridsZ))
+            fGap = std::min(fGap, (_fMinZ + double(nZ + level + 1) * _fGridLenZ) - rclPt.z);
+          if (fGap == DBL_MAX)
+            break;
+          if (res.count == k && fGap > 0.0 && fGap * fGap >= res.worst())
+            break;
+        }
+      }
+
+      for (std::size_t j = 0; j < res.count; j++)
+        res.distances[j] = std::sqrt(res.distances[j]);
+      for (std::size_t j = res.count; j < k; j++)
+      {
+        res.indices[j] = ULONG_MAX;
+        res.distances[j] = -1.0;
+      }
+    }
+  });
+}
+
+void PointsGrid::SearchInRange (const Base::Vector3d* queries, std::size_t count, double range,
+                                std::size_t maxCount, unsigned long* indices, std::size_t* counts) const
+{
+  double fRange2 = range * range;
+  forEachQuery(count, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+    {
+      const Base::Vector3d& rclPt = queries[i];
+      unsigned long* pInd = indices + i * maxCount;
+      std::size_t ulFound = 0;
+
+      Base::BoundBox3d clBB(rclPt, range);
+      if (_ulCtGridsX > 0 && _ulCtGridsY > 0 && _ulCtGridsZ > 0 && (clBB && GetBoundBox()))
+      {
+        unsigned long ulMinX, ulMinY, ulMinZ, ulMaxX, ulMaxY, ulMaxZ;
+        Position(Base::Vector3d(clBB.MinX, clBB.MinY, clBB.MinZ), ulMinX, ulMinY, ulMinZ);
+        Position(Base::Vector3d(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulMaxX, ulMaxY, ulMaxZ);
+        for (unsigned long x = ulMinX; x <= ulMaxX; x++)
+        {
+          for (unsigned long y = ulMinY; y <= ulMaxY; y++)
+          {
+            for (unsigned long z = ulMinZ; z <= ulMaxZ; z++)
+            {
+              const std::set<unsigned long>& rclSet = _aulGrid[x][y][z];
+              for (std::set<unsigned long>::const_iterator it = rclSet.begin(); it != rclSet.end(); ++it)
+              {
+                if (Base::DistanceP2(rclPt, _pclPoints->getPoint(*it)) <= fRange2)
+                {
+                  if (ulFound < maxCount)
+                    pInd[ulFound] = *it;
+                  ulFound++;
+                }
+              }
+            }
+          }
+        }
+      }
+
+      counts[i] = ulFound;
+    }
+  });
+}
@@ -89,6 +89,25 @@ public:
   void SearchNearestFromPoint (const Base::Vector3d &rclPt, std::set<unsigned long> &rclInd) const;
   //@}
 
+  /** @name Batched search
+   * The queries are distributed over several threads and the results are written into
+   * arrays of the caller, so that no memory is allocated per query.
+   */
+  //@{
+  /** For each of the \a count queries finds the \a k nearest points. The indices and distances
+   * of query i are written sorted by distance to \a indices[i*k] and \a distances[i*k]. If there
+   * are less than \a k points the remaining entries are set to ULONG_MAX and -1.
+   */
+  void SearchNearest (const Base::Vector3d* queries, std::size_t count, std::size_t k,
+                      unsigned long* indices, double* distances) const;
+  /** For each of the \a count queries finds the points whose distance is at most \a range.
+   * At most \a maxCount indices of query i are written to \a indices[i*maxCount] in no particular
+   * order. \a counts[i] is set to the number of points within range which may exceed \a maxCount.
+   */
+  void SearchInRange (const Base::Vector3d* queries, std::size_t count, double range,
+                      std::size_t maxCount, unsigned long* indices, std::size_t* counts) const;
+  //@}
+
   /** Returns the lengths of the grid elements in x,y and z direction. */
   virtual void  GetGridLengths (double &rfLenX, double &rfLenY, double &rfLenZ) const
   { rfLenX = _fGridLenX; rfLenY = _fGridLenY; rfLenZ = _fGridLenZ; }
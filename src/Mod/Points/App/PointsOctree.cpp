@@ -0,0 +1,438 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <limits>
+# include <queue>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+
+#include "PointsOctree.h"
+
+using namespace Points;
+
+namespace {
+// "FCPO"
+const uint32_t OctreeMagic = 0x4f504346;
+const uint32_t OctreeVersion = 3;
+// maximum depth, deeper nodes would only separate duplicate points
+const uint32_t OctreeMaxDepth = 20;
+}
+
+bool PointsOctree::Node::isLeaf() const
+{
+    for (int i=0; i<8; i++) {
+        if (children[i] >= 0)
+            return false;
+    }
+    return true;
+}
+
+PointsOctree::PointsOctree(uint32_t leafSize, uint32_t sampleSize)
+  : leafSize(std::max<uint32_t>(leafSize, 1))
+  , sampleSize(std::max<uint32_t>(sampleSize, 1))
+  , numPoints(0)
+  , hash(0)
+{
+}
+
+PointsOctree::~PointsOctree()
+{
+}
+
+void PointsOctree::clear()
+{
+    numPoints = 0;
+    hash = 0;
+    bounds = Base::BoundBox3f();
+    nodes.clear();
+    sampleIndices.clear();
+    sortedIndices.clear();
+}
+
+uint64_t PointsOctree::fingerprint(const value_type* pts, std::size_t count) const
+{
+    // FNV-1a of the number of points and of at most 4096 of them
+    uint64_t value = 14695981039346656037ULL;
+    auto add = [&value](const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i=0; i<size; i++) {
+            value ^= bytes[i];
+            value *= 1099511628211ULL;
+        }
+    };
+
+    uint64_t num = count;
+    add(&num, sizeof(num));
+    std::size_t step = std::max<std::size_t>(count / 4096, 1);
+    for (std::size_t i=0; i<count; i += step) {
+        float xyz[3] = { pts[i].x, pts[i].y, pts[i].z };
+        add(xyz, sizeof(xyz));
+    }
+    return value;
+}
+
+void PointsOctree::build(const PointKernel& kernel)
+{
+    clear();
+
+    const std::vector<value_type>& kernelPoints = kernel.getBasicPoints();
+    if (kernelPoints.size() > std::numeric_limits<uint32_t>::max())
+        throw Base::ValueError("Too many points for octree");
+
+    numPoints = kernelPoints.size();
+    hash = fingerprint(kernelPoints.data(), numPoints);
+    if (numPoints == 0)
+        return;
+
+    for (std::vector<value_type>::const_iterator it = kernelPoints.begin(); it != kernelPoints.end(); ++it) {
+        if (!(std::isnan(it->x) || std::isnan(it->y) || std::isnan(it->z)))
+            bounds.Add(*it);
+    }
+    if (!bounds.IsValid())
+        bounds.Add(value_type());
+
+    // the root is a cube
+    Base::Vector3f center = bounds.GetCenter();
+    float half = 0.5f * std::max(bounds.LengthX(), std::max(bounds.LengthY(), bounds.LengthZ()));
+    half = std::max(half * 1.0001f, std::numeric_limits<float>::min());
+    Base::BoundBox3f root(center.x - half, center.y - half, center.z - half,
+                          center.x + half, center.y + half, center.z + half);
+
+    std::vector<uint32_t> order(numPoints);
+    for (uint32_t i=0; i<static_cast<uint32_t>(numPoints); i++)
+        order[i] = i;
+
+    buildNode(kernelPoints.data(), order, 0, static_cast<uint32_t>(numPoints), root, 0);
+    sortedIndices.swap(order);
+
+    // pick every n-th point of a subtree as its representatives, as the points are
+    // in octree order the samples are spread over all of its children
+    for (std::vector<Node>::iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        if (it->isLeaf())
+            continue;
+        it->sampleFirst = static_cast<uint32_t>(sampleIndices.size());
+        for (uint64_t i=0; i<it->sampleCount; i++) {
+            std::size_t index = it->first + static_cast<std::size_t>(i * it->count / it->sampleCount);
+            sampleIndices.push_back(sortedIndices[index]);
+        }
+    }
+}
+
+int32_t PointsOctree::buildNode(const value_type* pts, std::vector<uint32_t>& order, uint32_t first,
+                                uint32_t count, const Base::BoundBox3f& box, uint32_t depth)
+{
+    int32_t index = static_cast<int32_t>(nodes.size());
+    Node node;
+    node.box = box;
+    std::fill(node.children, node.children + 8, -1);
+    node.first = first;
+    node.count = count;
+    node.depth = depth;
+    nodes.push_back(node);
+
+    float diagonal = box.CalcDiagonalLength();
+    if (count <= leafSize || depth >= OctreeMaxDepth) {
+        nodes[index].sampleFirst = first;
+        nodes[index].sampleCount = count;
+        nodes[index].spacing = diagonal / std::sqrt(static_cast<float>(std::max<uint32_t>(count, 1)));
+        return index;
+    }
+
+    nodes[index].sampleFirst = 0;
+    nodes[index].sampleCount = std::min(count, sampleSize);
+    nodes[index].spacing = diagonal / std::sqrt(static_cast<float>(nodes[index].sampleCount));
+
+    // split the range into the eight octants, first by x, then by y, then by z
+    Base::Vector3f center = box.GetCenter();
+    std::vector<uint32_t>::iterator ranges[9];
+    ranges[0] = order.begin() + first;
+    ranges[8] = order.begin() + first + count;
+    ranges[4] = std::partition(ranges[0], ranges[8], [pts, &center](uint32_t i) {
+        return pts[i].x < center.x;
+    });
+    for (int i=0; i<8; i += 4) {
+        ranges[i+2] = std::partition(ranges[i], ranges[i+4], [pts, &center](uint32_t j) {
+            return pts[j].y < center.y;
+        });
+    }
+    for (int i=0; i<8; i += 2) {
+        ranges[i+1] = std::partition(ranges[i], ranges[i+2], [pts, &center](uint32_t j) {
+            return pts[j].z < center.z;
+        });
+    }
+
+    for (int i=0; i<8; i++) {
+        uint32_t childCount = static_cast<uint32_t>(ranges[i+1] - ranges[i]);
+        if (childCount == 0)
+            continue;
+
+        // segment i has the octant bits x = i>>2, y = (i>>1)&1, z = i&1
+        Base::BoundBox3f child = box;
+        if (i & 4)
+            child.MinX = center.x;
+        else
+            child.MaxX = center.x;
+        if (i & 2)
+            child.MinY = center.y;
+        else
+            child.MaxY = center.y;
+        if (i & 1)
+            child.MinZ = center.z;
+        else
+            child.MaxZ = center.z;
+
+        uint32_t childFirst = static_cast<uint32_t>(ranges[i] - order.begin());
+        int32_t childIndex = buildNode(pts, order, childFirst, childCount, child, depth + 1);
+        nodes[index].children[i] = childIndex;
+    }
+
+    return index;
+}
+
+void PointsOctree::save(std::ostream& str) const
+{
+    Base::OutputStream out(str);
+    out << OctreeMagic << OctreeVersion << leafSize << sampleSize
+        << static_cast<uint64_t>(numPoints) << hash
+        << bounds.MinX << bounds.MinY << bounds.MinZ
+        << bounds.MaxX << bounds.MaxY << bounds.MaxZ
+        << static_cast<uint32_t>(nodes.size()) << static_cast<uint32_t>(sampleIndices.size());
+
+    for (std::vector<Node>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        out << it->box.MinX << it->box.MinY << it->box.MinZ
+            << it->box.MaxX << it->box.MaxY << it->box.MaxZ;
+        for (int i=0; i<8; i++)
+            out << it->children[i];
+        out << it->first << it->count << it->sampleFirst << it->sampleCount
+            << it->depth << it->spacing;
+    }
+
+    // only the indices, the points are saved with the kernel
+    for (std::vector<uint32_t>::const_iterator it = sampleIndices.begin(); it != sampleIndices.end(); ++it)
+        out << *it;
+    for (std::vector<uint32_t>::const_iterator it = sortedIndices.begin(); it != sortedIndices.end(); ++it)
+        out << *it;
+}
+
+void PointsOctree::restore(std::istream& str)
+{
+    clear();
+
+    Base::InputStream in(str);
+    uint32_t magic = 0, version = 0;
+    in >> magic >> version;
+    if (!str || magic != OctreeMagic || version != OctreeVersion)
+        throw Base::BadFormatError("Not a point cloud octree");
+
+    uint64_t count = 0;
+    uint32_t numNodes = 0, numSamples = 0;
+    in >> leafSize >> sampleSize >> count >> hash
+       >> bounds.MinX >> bounds.MinY >> bounds.MinZ
+       >> bounds.MaxX >> bounds.MaxY >> bounds.MaxZ
+       >> numNodes >> numSamples;
+    if (!str || count > std::numeric_limits<uint32_t>::max())
+        throw Base::BadFormatError("Invalid point cloud octree");
+
+    // the sizes are checked against the data actually read, not reserved up front
+    Node node;
+    for (uint32_t n=0; n<numNodes && str; n++) {
+        in >> node.box.MinX >> node.box.MinY >> node.box.MinZ
+           >> node.box.MaxX >> node.box.MaxY >> node.box.MaxZ;
+        for (int i=0; i<8; i++)
+            in >> node.children[i];
+        in >> node.first >> node.count >> node.sampleFirst >> node.sampleCount
+           >> node.depth >> node.spacing;
+        nodes.push_back(node);
+    }
+
+    uint32_t index;
+    bool validIndices = true;
+    for (uint32_t i=0; i<numSamples && str; i++) {
+        in >> index;
+        validIndices = validIndices && index < count;
+        sampleIndices.push_back(index);
+    }
+    for (uint64_t i=0; i<count && str; i++) {
+        in >> index;
+        validIndices = validIndices && index < count;
+        sortedIndices.push_back(index);
+    }
+    if (!str) {
+        clear();
+        throw Base::BadFormatError("Truncated point cloud octree");
+    }
+    if (!validIndices) {
+        clear();
+        throw Base::BadFormatError("Invalid index in point cloud octree");
+    }
+
+    for (std::vector<Node>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        bool leaf = it->isLeaf();
+        uint64_t end = static_cast<uint64_t>(it->sampleFirst) + it->sampleCount;
+        bool valid = static_cast<uint64_t>(it->first) + it->count <= count &&
+                     end <= (leaf ? count : numSamples);
+        for (int i=0; i<8; i++) {
+            if (it->children[i] >= static_cast<int32_t>(numNodes))
+                valid = false;
+        }
+        if (!valid) {
+            clear();
+            throw Base::BadFormatError("Invalid node in point cloud octree");
+        }
+    }
+
+    numPoints = static_cast<std::size_t>(count);
+}
+
+bool PointsOctree::matches(const PointKernel& kernel) const
+{
+    const std::vector<value_type>& kernelPoints = kernel.getBasicPoints();
+    if (kernelPoints.size() != numPoints)
+        return false;
+    return fingerprint(kernelPoints.data(), kernelPoints.size()) == hash;
+}
+
+PointsOctree::NodePoints PointsOctree::getPoints(const Node& node) const
+{
+    NodePoints result;
+    if (node.isLeaf()) {
+        result.indices = sortedIndices.data() + node.first;
+        result.count = node.count;
+    }
+    else {
+        result.indices = sampleIndices.data() + node.sampleFirst;
+        result.count = node.sampleCount;
+    }
+    return result;
+}
+
+PointsOctree::NodePoints PointsOctree::getSubtreePoints(const Node& node) const
+{
+    NodePoints result;
+    result.indices = sortedIndices.data() + node.first;
+    result.count = node.count;
+    return result;
+}
+
+std::vector<std::size_t> PointsOctree::getLevel(uint32_t depth) const
+{
+    std::vector<std::size_t> level;
+    if (nodes.empty())
+        return level;
+
+    std::vector<std::size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        std::size_t index = stack.back();
+        stack.pop_back();
+        const Node& node = nodes[index];
+        if (node.depth >= depth || node.isLeaf()) {
+            level.push_back(index);
+        }
+        else {
+            for (int i=7; i>=0; i--) {
+                if (node.children[i] >= 0)
+                    stack.push_back(node.children[i]);
+            }
+        }
+    }
+
+    return level;
+}
+
+void PointsOctree::forEachPoint(const PointKernel& kernel, uint32_t depth,
+                                const std::function<void(const value_type&, uint32_t)>& func) const
+{
+    const std::vector<value_type>& kernelPoints = kernel.getBasicPoints();
+    if (kernelPoints.size() != numPoints)
+        throw Base::ValueError("Octree doesn't match the points");
+
+    std::vector<std::size_t> level = getLevel(depth);
+    for (std::vector<std::size_t>::iterator it = level.begin(); it != level.end(); ++it) {
+        NodePoints pts = getPoints(nodes[*it]);
+        for (std::size_t i=0; i<pts.count; i++)
+            func(kernelPoints[pts.indices[i]], pts.indices[i]);
+    }
+}
+
+std::vector<std::size_t> PointsOctree::select(const std::function<float(const Node&)>& error,
+                                              float maxError, std::size_t pointBudget) const
+{
+    std::vector<std::size_t> selection;
+    if (nodes.empty())
+        return selection;
+
+    float rootError = error(nodes[0]);
+    if (rootError < 0.0f)
+        return selection;
+
+    // refine the node with the largest error first
+    typedef std::pair<float, std::size_t> Entry;
+    std::priority_queue<Entry> queue;
+    queue.push(Entry(rootError, 0));
+    std::size_t numSelected = nodes[0].sampleCount;
+
+    std::vector<Entry> visible;
+    while (!queue.empty()) {
+        Entry entry = queue.top();
+        queue.pop();
+
+        const Node& node = nodes[entry.second];
+        if (node.isLeaf() || entry.first <= maxError) {
+            selection.push_back(entry.second);
+            continue;
+        }
+
+        visible.clear();
+        std::size_t numChildPoints = 0;
+        for (int i=0; i<8; i++) {
+            if (node.children[i] < 0)
+                continue;
+            const Node& child = nodes[node.children[i]];
+            float childError = error(child);
+            if (childError >= 0.0f) {
+                visible.push_back(Entry(childError, node.children[i]));
+                numChildPoints += child.sampleCount;
+            }
+        }
+
+        if (numSelected - node.sampleCount + numChildPoints > pointBudget) {
+            selection.push_back(entry.second);
+            continue;
+        }
+
+        numSelected = numSelected - node.sampleCount + numChildPoints;
+        for (std::vector<Entry>::iterator it = visible.begin(); it != visible.end(); ++it)
+            queue.push(*it);
+    }
+
+    std::sort(selection.begin(), selection.end());
+    return selection;
+}
@@ -0,0 +1,154 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef POINTS_OCTREE_H
+#define POINTS_OCTREE_H
+
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+#include "Points.h"
+#include <Base/BoundBox.h>
+
+namespace Points {
+
+/**
+ * The PointsOctree is a level-of-detail index of a point cloud.
+ *
+ * The octree doesn't copy the points. It keeps the indices of the points of the
+ * kernel in octree order, so that the points of every node form one contiguous range
+ * of indices. A leaf holds at most a fixed number of points (its chunk). Every inner
+ * node keeps the indices of a subsample of the points of its subtree as representatives,
+ * so that a coarse view of a region only needs the representatives of one node
+ * instead of all its points.
+ *
+ * The octree can be written to a stream, so that it is stored with the document and
+ * doesn't need to be rebuilt when the document is loaded. Only the node table and
+ * the indices are written, the points themselves are saved by the kernel.
+ */
+class PointsExport PointsOctree
+{
+public:
+    typedef PointKernel::value_type value_type;
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        /// Indices of the child nodes, or -1
+        int32_t children[8];
+        /// Range of the sorted points of the subtree
+        uint32_t first, count;
+        /// Range of the representatives, for a leaf this is its chunk
+        uint32_t sampleFirst, sampleCount;
+        uint32_t depth;
+        /// Average distance of the representatives
+        float spacing;
+
+        bool isLeaf() const;
+    };
+
+    /// The points of a node as indices into the point kernel the octree was built from
+    struct NodePoints
+    {
+        const uint32_t* indices;
+        std::size_t count;
+    };
+
+    /** @name Construction */
+    //@{
+    /// Construction
+    PointsOctree(uint32_t leafSize = 4096, uint32_t sampleSize = 1024);
+    /// Destruction
+    ~PointsOctree();
+    /// Builds the octree of the points of the kernel
+    void build(const PointKernel&);
+    //@}
+
+    /** @name Persistence */
+    //@{
+    /// Writes the octree to a binary stream
+    void save(std::ostream&) const;
+    /// Reads the octree from a binary stream
+    void restore(std::istream&);
+    /** Checks if the octree was built from the given kernel. This compares the number
+     * of points, the bounding box and a fingerprint of a subset of the points. */
+    bool matches(const PointKernel&) const;
+    //@}
+
+    /** @name Access */
+    //@{
+    std::size_t countNodes() const
+    { return nodes.size(); }
+    std::size_t countPoints() const
+    { return numPoints; }
+    const Node& getNode(std::size_t index) const
+    { return nodes[index]; }
+    /// Returns the representatives of an inner node or the chunk of a leaf
+    NodePoints getPoints(const Node&) const;
+    /// Returns all points of the subtree of a node
+    NodePoints getSubtreePoints(const Node&) const;
+    //@}
+
+    /** @name Level of detail */
+    //@{
+    /** Returns the nodes of the given depth. Leaves above this depth are included, so the
+     * points of the returned nodes cover the whole cloud. */
+    std::vector<std::size_t> getLevel(uint32_t depth) const;
+    /** Calls \a func with every point of the given level and its index in the point kernel.
+     * This allows algorithms to work on a thinned out cloud. The kernel must match the
+     * octree.
+     */
+    void forEachPoint(const PointKernel&, uint32_t depth,
+                      const std::function<void(const value_type&, uint32_t)>& func) const;
+    /** Selects the nodes to display.
+     * \a error returns the screen-space error of the representatives of a node, or a
+     * negative value if the node is not visible. Starting at the root the node with the
+     * largest error is refined as long as its error exceeds \a maxError and the number of
+     * selected points stays within \a pointBudget.
+     */
+    std::vector<std::size_t> select(const std::function<float(const Node&)>& error,
+                                    float maxError, std::size_t pointBudget) const;
+    //@}
+
+private:
+    int32_t buildNode(const value_type* pts, std::vector<uint32_t>& order, uint32_t first,
+                      uint32_t count, const Base::BoundBox3f& box, uint32_t depth);
+    uint64_t fingerprint(const value_type* pts, std::size_t count) const;
+    void clear();
+
+private:
+    uint32_t leafSize;
+    uint32_t sampleSize;
+    std::size_t numPoints;
+    uint64_t hash;
+    Base::BoundBox3f bounds;
+    std::vector<Node> nodes;
+    // the indices of the representatives and of all points in octree order
+    std::vector<uint32_t> sampleIndices;
+    std::vector<uint32_t> sortedIndices;
+};
+
+} // namespace Points
+
+#endif // POINTS_OCTREE_H
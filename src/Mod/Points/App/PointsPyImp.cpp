@@ -22,11 +22,16 @@
 
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <climits>
+#endif
 
 #include "Mod/Points/App/Points.h"
+#include "Mod/Points/App/PointsGrid.h"
 #include <Base/Builder3D.h>
 #include <Base/VectorPy.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <boost/math/special_functions/fpclassify.hpp>
 
 // inclusion of the generated files (generated out of PointsPy.xml)
@@ -227,6 +232,87 @@ PyObject* PointsPy::fromValid(PyObject * args)
     }
 }
 
+PyObject* PointsPy::nearestPoints(PyObject * args)
+{
+    PyObject* obj;
+    int k = 1;
+    if (!PyArg_ParseTuple(args, "O|i", &obj, &k))
+        return 0;
+    if (k < 1) {
+        PyErr_SetString(PyExc_ValueError, "k must be positive");
+        return 0;
+    }
+
+    try {
+        std::vector<Base::Vector3d> queries = Base::getVectorsFromPyObject(obj);
+        std::size_t num = static_cast<std::size_t>(k);
+
+        std::vector<unsigned long> indices(queries.size() * num);
+        std::vector<double> distances(queries.size() * num);
+        {
+            Base::PyGILStateRelease release;
+            std::shared_ptr<const PointsGrid> grid = getPointKernelPtr()->getSearchGrid();
+            grid->SearchNearest(queries.data(), queries.size(), num, indices.data(), distances.data());
+        }
+
+        void* data;
+        Py::Object pyIndices(Base::createBufferView("q", sizeof(int64_t), queries.size(), num, data));
+        int64_t* ind = static_cast<int64_t*>(data);
+        for (std::size_t i=0; i<indices.size(); i++)
+            ind[i] = indices[i] == ULONG_MAX ? -1 : static_cast<int64_t>(indices[i]);
+
+        Py::Object pyDistances(Base::createBufferView("d", sizeof(double), queries.size(), num, data));
+        std::copy(distances.begin(), distances.end(), static_cast<double*>(data));
+
+        return Py::new_reference_to(Py::TupleN(pyIndices, pyDistances));
+    }
+    catch (const Py::Exception&) {
+        return 0;
+    }
+}
+
+PyObject* PointsPy::pointsInRange(PyObject * args)
+{
+    PyObject* obj;
+    double range;
+    int maxCount;
+    if (!PyArg_ParseTuple(args, "Odi", &obj, &range, &maxCount))
+        return 0;
+    if (maxCount < 1) {
+        PyErr_SetString(PyExc_ValueError, "maxCount must be positive");
+        return 0;
+    }
+
+    try {
+        std::vector<Base::Vector3d> queries = Base::getVectorsFromPyObject(obj);
+        std::size_t num = static_cast<std::size_t>(maxCount);
+
+        std::vector<unsigned long> indices(queries.size() * num);
+        std::vector<std::size_t> counts(queries.size());
+        {
+            Base::PyGILStateRelease release;
+            std::shared_ptr<const PointsGrid> grid = getPointKernelPtr()->getSearchGrid();
+            grid->SearchInRange(queries.data(), queries.size(), range, num, indices.data(), counts.data());
+        }
+
+        void* data;
+        Py::Object pyIndices(Base::createBufferView("q", sizeof(int64_t), queries.size(), num, data));
+        int64_t* ind = static_cast<int64_t*>(data);
+        for (std::size_t i=0; i<queries.size(); i++) {
+            for (std::size_t j=0; j<num; j++)
+                ind[i*num+j] = j < counts[i] ? static_cast<int64_t>(indices[i*num+j]) : -1;
+        }
+
+        Py::Object pyCounts(Base::createBufferView("q", sizeof(int64_t), queries.size(), 0, data));
+        std::copy(counts.begin(), counts.end(), static_cast<int64_t*>(data));
+
+        return Py::new_reference_to(Py::TupleN(pyIndices, pyCounts));
+    }
+    catch (const Py::Exception&) {
+        return 0;
+    }
+}
+
 Py::Long PointsPy::getCountPoints(void) const
 {
     return Py::Long((long)getPointKernelPtr()->size());
@@ -0,0 +1,260 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+import os
+import struct
+import tempfile
+import unittest
+import FreeCAD, Points
+
+App = FreeCAD
+
+# the readers split files larger than this into chunks that are parsed in parallel
+ChunkSize = 1 << 20
+
+def writeFile(name, data):
+    with open(name, "wb") as f:
+        f.write(data.encode("ascii") if isinstance(data, str) else data)
+
+class PointsAsciiTestCases(unittest.TestCase):
+    def setUp(self):
+        self.name = os.path.join(tempfile.gettempdir(), "PointsTest.asc")
+
+    def tearDown(self):
+        if os.path.exists(self.name):
+            os.remove(self.name)
+
+    def read(self, data):
+        writeFile(self.name, data)
+        points = Points.Points()
+        points.read(self.name)
+        return [(p.x, p.y, p.z) for p in points.Points]
+
+    def testComments(self):
+        points = self.read("# ASCII\n1 2 3\n// x y z\n\n4 5 6\n")
+        self.assertEqual(points, [(1, 2, 3), (4, 5, 6)])
+
+    def testInvalidLines(self):
+        # a point needs exactly three whitespace separated numbers
+        points = self.read("1 2 3 4\n1,2,3\n1 2\n7 8 9\n1 2 x\n")
+        self.assertEqual(points, [(7, 8, 9)])
+
+    def testNumberFormats(self):
+        points = self.read("-1.5e2 +.5 3.\n\t2E-1  -0  1e+1 \n")
+        self.assertEqual(len(points), 2)
+        self.assertEqual(points[0], (-150, 0.5, 3))
+        self.assertAlmostEqual(points[1][0], 0.2, 6)
+        self.assertEqual(points[1][1:], (0, 10))
+
+    def testCRLF(self):
+        points = self.read("# ASCII\r\n1 2 3\r\n4.5 5 6\r\n")
+        self.assertEqual(points, [(1, 2, 3), (4.5, 5, 6)])
+
+    def testTruncatedLastLine(self):
+        self.assertEqual(self.read("1 2 3\n4 5 6"), [(1, 2, 3), (4, 5, 6)])
+        self.assertEqual(self.read("1 2 3\r\n4 5"), [(1, 2, 3)])
+
+    def testChunks(self):
+        # CRLF line ends and comments across the chunk borders
+        lines = []
+        for i in range(3 * ChunkSize // 20):
+            if i % 1000 == 0:
+                lines.append("# comment %d" % i)
+            lines.append("%d %d.5 -%d" % (i, i % 7, i % 13))
+        points = self.read("\r\n".join(lines))
+        self.assertEqual(len(points), 3 * ChunkSize // 20)
+        for i, p in enumerate(points):
+            self.assertEqual(p, (i, i % 7 + 0.5, -(i % 13)))
+
+class PointsPlyTestCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = App.newDocument("PointsTest")
+        self.name = os.path.join(tempfile.gettempdir(), "PointsTest.ply")
+        # values that are exact in ASCII and as float
+        self.points = [(i / 8.0, -i / 4.0, (i % 17) / 2.0) for i in range(1000)]
+        self.normals = [(0.0, float(i % 2), float(1 - i % 2)) for i in range(1000)]
+
+    def tearDown(self):
+        App.closeDocument(self.doc.Name)
+        if os.path.exists(self.name):
+            os.remove(self.name)
+
+    def header(self, fmt, count, eol="\n"):
+        return eol.join(["ply",
+                         "format %s 1.0" % fmt,
+                         "comment written by PointsTestsApp",
+                         "element vertex %d" % count,
+                         "property float x",
+                         "property float y",
+                         "property float z",
+                         "property float nx",
+                         "property float ny",
+                         "property float nz",
+                         "property float intensity",
+                         "end_header"]) + eol
+
+    def writePly(self, fmt, eol="\n"):
+        data = self.header(fmt, len(self.points), eol).encode("ascii")
+        rows = [p + n + (p[0],) for p, n in zip(self.points, self.normals)]
+        if fmt == "ascii":
+            data += "".join("%s%s" % (" ".join(repr(v) for v in row), eol) for row in rows).encode("ascii")
+        else:
+            order = "<" if fmt == "binary_little_endian" else ">"
+            data += b"".join(struct.pack(order + "7f", *row) for row in rows)
+        writeFile(self.name, data)
+
+    def read(self):
+        Points.insert(self.name, self.doc.Name)
+        obj = self.doc.Objects[-1]
+        points = [(p.x, p.y, p.z) for p in obj.Points.Points]
+        normals = [(n.x, n.y, n.z) for n in obj.Normal]
+        return points, normals, list(obj.Intensity)
+
+    def check(self, points, normals, intensity):
+        self.assertEqual(points, self.points)
+        self.assertEqual(normals, self.normals)
+        self.assertEqual(intensity, [p[0] for p in self.points])
+
+    def testAsciiAndBinary(self):
+        for fmt in ("ascii", "binary_little_endian", "binary_big_endian"):
+            self.writePly(fmt)
+            self.check(*self.read())
+
+    def testCRLF(self):
+        self.writePly("ascii", "\r\n")
+        self.check(*self.read())
+
+    def testTruncatedAscii(self):
+        # the last row is cut off after two values, the values missing are zero
+        data = self.header("ascii", 3) + "1 2 3 0 0 1 5\n4 5 6 0 0 1 5\n7 8"
+        writeFile(self.name, data)
+        points, normals, intensity = self.read()
+        self.assertEqual(points, [(1, 2, 3), (4, 5, 6), (7, 8, 0)])
+
+    def testMissingRows(self):
+        data = self.header("ascii", 3) + "1 2 3 0 0 1 5\n4 5 6 0 0 1 5\n"
+        writeFile(self.name, data)
+        points, normals, intensity = self.read()
+        self.assertEqual(points, [(1, 2, 3), (4, 5, 6)])
+
+    def testTruncatedBinary(self):
+        data = self.header("binary_little_endian", 3).encode("ascii") + struct.pack("<10f", *range(10))
+        writeFile(self.name, data)
+        self.assertRaises(Exception, Points.insert, self.name, self.doc.Name)
+
+class PointsSearchTestCases(unittest.TestCase):
+    def setUp(self):
+        # a 4x4x4 lattice of points with unit spacing
+        self.points = Points.Points()
+        self.points.addPoints([(x, y, z) for z in range(4) for y in range(4) for x in range(4)])
+
+    def nearest(self, p, k):
+        pts = self.points.Points
+        dist = sorted((pts[i].distanceToPoint(FreeCAD.Vector(p)), i) for i in range(len(pts)))
+        return dist[:k]
+
+    def testNearestPoints(self):
+        queries = [(0.1, 0.2, 0.3), (2.6, 1.4, 3.2), (-1, 5, 2)]
+        indices, distances = self.points.nearestPoints(queries, 3)
+        self.assertEqual(indices.shape, (3, 3))
+        for i, p in enumerate(queries):
+            ref = self.nearest(p, 3)
+            self.assertEqual(indices[i, 0], ref[0][1])
+            for j in range(3):
+                self.assertAlmostEqual(distances[i, j], ref[j][0], 6)
+
+    def testPointsInRange(self):
+        indices, counts = self.points.pointsInRange([(1, 1, 1), (10, 10, 10)], 1.0, 8)
+        self.assertEqual(counts.tolist(), [7, 0])
+        self.assertEqual(sorted(indices.tolist()[0])[1:], [5, 17, 20, 21, 22, 25, 37])
+        self.assertEqual(indices.tolist()[1], [-1] * 8)
+        self.assertRaises(ValueError, self.points.pointsInRange, [(1, 1, 1)], 1.0, 0)
+
+    def testNoQueries(self):
+        indices, distances = self.points.nearestPoints([], 2)
+        self.assertEqual(indices.shape, (0, 2))
+        self.assertEqual(distances.shape, (0, 2))
+        indices, counts = self.points.pointsInRange([], 1.0, 3)
+        self.assertEqual(indices.shape, (0, 3))
+        self.assertEqual(counts.shape, (0,))
+
+    def testModifiedPoints(self):
+        # the grid is kept between the searches but not after a change
+        self.assertEqual(self.points.nearestPoints([(9, 9, 9)])[0][0, 0], 63)
+        self.points.addPoints([(8, 8, 8)])
+        self.assertEqual(self.points.nearestPoints([(9, 9, 9)])[0][0, 0], 64)
+        self.points.Placement = FreeCAD.Placement(FreeCAD.Vector(10, 0, 0), FreeCAD.Rotation())
+        indices, distances = self.points.nearestPoints([(10, 0, 0)])
+        self.assertEqual(indices[0, 0], 0)
+        self.assertAlmostEqual(distances[0, 0], 0, 6)
+
+class PointsDocumentTestCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("PointsDocumentTest")
+        self.dir = tempfile.mkdtemp()
+        self.name = os.path.join(self.dir, "PointsDocumentTest.FCStd")
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+        for f in os.listdir(self.dir):
+            os.remove(os.path.join(self.dir, f))
+        os.rmdir(self.dir)
+
+    def testSaveRestore(self):
+        points = Points.Points()
+        points.addPoints([(i, i * 0.5, -i) for i in range(1000)])
+        feature = self.doc.addObject("Points::Feature", "Cloud")
+        feature.Points = points
+        self.doc.recompute()
+        self.assertEqual(feature.Octree, None)
+
+        self.doc.saveAs(self.name)
+        self.doc.saveCopy(os.path.join(self.dir, "Copy.FCStd"))
+        # the octree is stored in the document, no files are written beside it
+        self.assertEqual(sorted(os.listdir(self.dir)), ["Copy.FCStd", "PointsDocumentTest.FCStd"])
+
+        FreeCAD.closeDocument(self.doc.Name)
+        self.doc = FreeCAD.openDocument(self.name)
+        cloud = self.doc.getObject("Cloud")
+        self.assertEqual(cloud.Points.Points, points.Points)
+        self.assertEqual(cloud.Octree, None)
+
+    def testSaveRestoreMany(self):
+        # with more than one core the point files are decoded by worker threads
+        # and applied to the features in the order of the files
+        clouds = []
+        for i in range(6):
+            points = Points.Points()
+            points.addPoints([(j, i, j * 0.25) for j in range(1000 * (i + 1))])
+            clouds.append(points)
+        clouds.append(Points.Points())
+        for i, points in enumerate(clouds):
+            self.doc.addObject("Points::Feature", "Cloud%d" % i).Points = points
+        self.doc.recompute()
+        self.doc.saveAs(self.name)
+
+        FreeCAD.closeDocument(self.doc.Name)
+        self.doc = FreeCAD.openDocument(self.name)
+        for i, points in enumerate(clouds):
+            restored = self.doc.getObject("Cloud%d" % i).Points
+            self.assertEqual(restored.CountPoints, points.CountPoints)
+            self.assertEqual(restored.Points, points.Points)
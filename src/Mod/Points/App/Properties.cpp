@@ -28,23 +28,22 @@
 # include <algorithm>
 #endif
 
+#include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Matrix.h>
+#include <Base/Parallel.h>
 #include <Base/Persistence.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 #include <Base/VectorPy.h>
+#include <App/Application.h>
 
 #include "Points.h"
+#include "PointsOctree.h"
 #include "Properties.h"
 #include "PointsPy.h"
 
-#include <QtConcurrentMap>
-#ifdef _WIN32
-# include <ppl.h>
-#endif
-
 using namespace Points;
 using namespace std;
 
@@ -52,6 +51,7 @@ TYPESYSTEM_SOURCE(Points::PropertyGreyValue, App::PropertyFloat)
 TYPESYSTEM_SOURCE(Points::PropertyGreyValueList, App::PropertyLists)
 TYPESYSTEM_SOURCE(Points::PropertyNormalList, App::PropertyLists)
 TYPESYSTEM_SOURCE(Points::PropertyCurvatureList , App::PropertyLists)
+TYPESYSTEM_SOURCE(Points::PropertyPointOctree , App::Property)
 
 PropertyGreyValueList::PropertyGreyValueList()
 {
@@ -393,15 +393,9 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D &mat)
     aboutToSetValue();
 
     // Rotate the normal vectors
-#ifdef _WIN32
-    Concurrency::parallel_for_each(_lValueList.begin(), _lValueList.end(), [rot](Base::Vector3f& value) {
-        value = rot * value;
-    });
-#else
-    QtConcurrent::blockingMap(_lValueList, [rot](Base::Vector3f& value) {
-        rot.multVec(value, value);
+    Base::parallel_for<std::size_t>(_lValueList.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        rot.multVec(_lValueList.data() + begin, end - begin);
     });
-#endif
 
     hasSetValue();
 }
@@ -528,12 +522,11 @@ void PropertyCurvatureList::transformGeometry(const Base::Matrix4D &mat)
     aboutToSetValue();
 
     // Rotate the principal directions
-    for (int ii=0; ii<getSize(); ii++) {
-        CurvatureInfo ci = operator[](ii);
-        ci.cMaxCurvDir = rot * ci.cMaxCurvDir;
-        ci.cMinCurvDir = rot * ci.cMinCurvDir;
-        set1Value(ii, ci);
-    }
+    Base::parallel_for<std::size_t>(_lValueList.size(), 4096, [&](std::size_t begin, std::size_t end) {
+        CurvatureInfo* ci = _lValueList.data() + begin;
+        rot.multVec(&ci->cMaxCurvDir, end - begin, sizeof(CurvatureInfo));
+        rot.multVec(&ci->cMinCurvDir, end - begin, sizeof(CurvatureInfo));
+    });
 
     hasSetValue();
 }
@@ -640,3 +633,144 @@ unsigned int PropertyCurvatureList::getMemSize (void) const
 {
     return sizeof(CurvatureInfo) * this->_lValueList.size();
 }
+
+// ----------------------------------------------------------------------------
+
+PropertyPointOctree::PropertyPointOctree()
+{
+}
+
+PropertyPointOctree::~PropertyPointOctree()
+{
+}
+
+void PropertyPointOctree::setValue(const std::shared_ptr<const PointsOctree>& tree)
+{
+    // The octree is derived from the points, so the container isn't notified
+    std::lock_guard<std::mutex> lock(mutex);
+    octree = tree;
+}
+
+std::shared_ptr<const PointsOctree> PropertyPointOctree::getValue() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return octree;
+}
+
+std::shared_ptr<const PointsOctree> PropertyPointOctree::getValue(const PointKernel& kernel) const
+{
+    // Concurrent callers wait for the octree built by the first one
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!octree) {
+        std::shared_ptr<PointsOctree> tree = std::make_shared<PointsOctree>();
+        tree->build(kernel);
+        octree = tree;
+    }
+    return octree;
+}
+
+void PropertyPointOctree::finishRestore(const PointKernel& kernel)
+{
+    std::shared_ptr<const PointsOctree> tree;
+    tree.swap(restored);
+    if (tree && tree->matches(kernel))
+        setValue(tree);
+}
+
+PyObject *PropertyPointOctree::getPyObject(void)
+{
+    Py_Return;
+}
+
+void PropertyPointOctree::setPyObject(PyObject *)
+{
+    throw Base::AttributeError("The octree is built from the points and cannot be set");
+}
+
+void PropertyPointOctree::Save (Base::Writer &writer) const
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Points");
+    if (!writer.isForceXML() && getValue() && hGrp->GetBool("SaveOctree", true)) {
+        writer.Stream() << writer.ind() << "<Octree file=\"" <<
+        writer.addFile(getName(), this) << "\"/>" << std::endl;
+    }
+    else {
+        writer.Stream() << writer.ind() << "<Octree file=\"\"/>" << std::endl;
+    }
+}
+
+void PropertyPointOctree::Restore(Base::XMLReader &reader)
+{
+    reader.readElement("Octree");
+    string file (reader.getAttribute("file") );
+
+    if (!file.empty()) {
+        // initiate a file read
+        reader.addFile(file.c_str(),this);
+    }
+}
+
+void PropertyPointOctree::SaveDocFile (Base::Writer &writer) const
+{
+    std::shared_ptr<const PointsOctree> tree = getValue();
+    if (tree)
+        tree->save(writer.Stream());
+}
+
+void PropertyPointOctree::RestoreDocFile(Base::Reader &reader)
+{
+    RestoreDocFileConcurrent(reader)();
+}
+
+bool PropertyPointOctree::isSaveDocFileConcurrent() const
+{
+    return true;
+}
+
+bool PropertyPointOctree::isRestoreDocFileConcurrent() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointOctree::RestoreDocFileConcurrent(Base::Reader &reader)
+{
+    // A broken octree is not an error, it is rebuilt when needed
+    std::shared_ptr<PointsOctree> tree = std::make_shared<PointsOctree>();
+    try {
+        tree->restore(reader);
+    }
+    catch (const Base::Exception&) {
+        tree.reset();
+    }
+
+    return [this, tree]() {
+        if (!tree && getContainer()) {
+            Base::Console().Warning("Failed to read the octree of %s\n", getFullName().c_str());
+        }
+        restored = tree;
+    };
+}
+
+App::Property *PropertyPointOctree::Copy(void) const
+{
+    PropertyPointOctree* prop = new PropertyPointOctree();
+    prop->octree = getValue();
+    return prop;
+}
+
+void PropertyPointOctree::Paste(const App::Property &from)
+{
+    const PropertyPointOctree& prop = dynamic_cast<const PropertyPointOctree&>(from);
+    setValue(prop.getValue());
+}
+
+unsigned int PropertyPointOctree::getMemSize (void) const
+{
+    std::shared_ptr<const PointsOctree> tree = getValue();
+    if (!tree)
+        return 0;
+    // the octree only keeps indices into the points of the kernel
+    return static_cast<unsigned int>(tree->countNodes() * sizeof(PointsOctree::Node) +
+        tree->countPoints() * sizeof(uint32_t));
+}
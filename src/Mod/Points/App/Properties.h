@@ -24,6 +24,8 @@
 #ifndef POINTS_POINTPROPERTIES_H
 #define POINTS_POINTPROPERTIES_H
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <Base/Vector3D.h>
@@ -38,7 +40,7 @@
 
 namespace Points
 {
-
+class PointsOctree;
 
 /** Greyvalue property.
  */
@@ -236,6 +238,62 @@ private:
     std::vector<CurvatureInfo> _lValueList;
 };
 
+/** The octree property class.
+ * It holds the level-of-detail octree of the points of a feature. The octree is
+ * derived data: it is built on demand, setting it doesn't touch the feature and
+ * it is stored in the document only to avoid rebuilding it when loading.
+ */
+class PointsExport PropertyPointOctree : public App::Property
+{
+    TYPESYSTEM_HEADER();
+
+public:
+    PropertyPointOctree();
+    ~PropertyPointOctree();
+
+    /** @name Getter/setter */
+    //@{
+    /// Sets the octree, or drops it if it is null
+    void setValue(const std::shared_ptr<const PointsOctree>&);
+    /// Returns the current octree, which may be null
+    std::shared_ptr<const PointsOctree> getValue() const;
+    /** Returns the octree of the given points and builds it if needed.
+     * This can be called from several threads. */
+    std::shared_ptr<const PointsOctree> getValue(const PointKernel&) const;
+    /** Takes over the octree read with the document if it was built from the
+     * given points, otherwise it is discarded. */
+    void finishRestore(const PointKernel&);
+    //@}
+
+    virtual PyObject *getPyObject(void);
+    virtual void setPyObject(PyObject *);
+
+    /** @name Save/restore */
+    //@{
+    void Save (Base::Writer &writer) const;
+    void Restore(Base::XMLReader &reader);
+
+    void SaveDocFile (Base::Writer &writer) const;
+    void RestoreDocFile(Base::Reader &reader);
+    bool isSaveDocFileConcurrent() const;
+    bool isRestoreDocFileConcurrent() const;
+    std::function<void()> RestoreDocFileConcurrent(Base::Reader &reader);
+    //@}
+
+    /** @name Undo/Redo */
+    //@{
+    App::Property *Copy(void) const;
+    void Paste(const App::Property &from);
+    unsigned int getMemSize (void) const;
+    //@}
+
+private:
+    mutable std::mutex mutex;
+    mutable std::shared_ptr<const PointsOctree> octree;
+    /// The octree read with the document until it is checked
+    std::shared_ptr<const PointsOctree> restored;
+};
+
 } // namespace Points
 
 
@@ -27,6 +27,7 @@
 # include <cmath>
 # include <iostream>
 # include <algorithm>
+# include <memory>
 #endif
 
 #include <Base/Exception.h>
@@ -132,6 +133,28 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader &reader)
     hasSetValue();
 }
 
+bool PropertyPointKernel::isRestoreDocFileConcurrent() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointKernel::RestoreDocFileConcurrent(Base::Reader &reader)
+{
+    // The points are read in a worker thread but set in the main thread.
+    // Only the points are exchanged, the placement is kept.
+    PointKernel kernel;
+    kernel.RestoreDocFile(reader);
+    std::shared_ptr<std::vector<PointKernel::value_type> > points =
+        std::make_shared<std::vector<PointKernel::value_type> >();
+    kernel.swap(*points);
+
+    return [this, points]() {
+        aboutToSetValue();
+        _cPoints->swap(*points);
+        hasSetValue();
+    };
+}
+
 App::Property *PropertyPointKernel::Copy(void) const 
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
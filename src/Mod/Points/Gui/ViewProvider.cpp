@@ -25,6 +25,12 @@
 
 #ifndef _PreComp_
 # include <Python.h>
+# include <Inventor/SbBox3f.h>
+# include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/elements/SoModelMatrixElement.h>
+# include <Inventor/elements/SoViewportRegionElement.h>
+# include <Inventor/elements/SoViewVolumeElement.h>
+# include <Inventor/nodes/SoCallback.h>
 # include <Inventor/nodes/SoCamera.h>
 # include <Inventor/nodes/SoCoordinate3.h>
 # include <Inventor/nodes/SoDrawStyle.h>
@@ -37,6 +43,8 @@
 # include <Inventor/events/SoMouseButtonEvent.h>
 #endif
 
+#include <Inventor/elements/SoCacheElement.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <limits>
 
@@ -56,6 +64,7 @@
 
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 
 #include "ViewProvider.h"
 #include "../App/Properties.h"
@@ -125,13 +134,14 @@ void ViewProviderPoints::onChanged(const App::Property* prop)
 void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
 {
     const std::vector<App::Color>& val = pcProperty->getValues();
+    std::size_t num = lodIndices.empty() ? val.size() : lodIndices.size();
 
-    pcColorMat->diffuseColor.setNum(val.size());
+    pcColorMat->diffuseColor.setNum(num);
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i=0;
-    for (std::vector<App::Color>::const_iterator it = val.begin(); it != val.end(); ++it) {
-        col[i++].setValue(it->r, it->g, it->b);
+    for (std::size_t i=0; i<num; i++) {
+        const App::Color& c = lodIndices.empty() ? val[i] : val[lodIndices[i]];
+        col[i].setValue(c.r, c.g, c.b);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -140,13 +150,14 @@ void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
 void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* pcProperty)
 {
     const std::vector<float>& val = pcProperty->getValues();
+    std::size_t num = lodIndices.empty() ? val.size() : lodIndices.size();
 
-    pcColorMat->diffuseColor.setNum(val.size());
+    pcColorMat->diffuseColor.setNum(num);
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i=0;
-    for (std::vector<float>::const_iterator it = val.begin(); it != val.end(); ++it) {
-        col[i++].setValue(*it, *it, *it);
+    for (std::size_t i=0; i<num; i++) {
+        float grey = lodIndices.empty() ? val[i] : val[lodIndices[i]];
+        col[i].setValue(grey, grey, grey);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -155,13 +166,14 @@ void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* p
 void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcProperty)
 {
     const std::vector<Base::Vector3f>& val = pcProperty->getValues();
+    std::size_t num = lodIndices.empty() ? val.size() : lodIndices.size();
 
-    pcPointsNormal->vector.setNum(val.size());
+    pcPointsNormal->vector.setNum(num);
     SbVec3f* norm = pcPointsNormal->vector.startEditing();
 
-    std::size_t i=0;
-    for (std::vector<Base::Vector3f>::const_iterator it = val.begin(); it != val.end(); ++it) {
-        norm[i++].setValue(it->x, it->y, it->z);
+    for (std::size_t i=0; i<num; i++) {
+        const Base::Vector3f& n = lodIndices.empty() ? val[i] : val[lodIndices[i]];
+        norm[i].setValue(n.x, n.y, n.z);
     }
 
     pcPointsNormal->vector.finishEditing();
@@ -170,6 +182,9 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
     int numPoints = pcPointsCoord->point.getNum();
+    // with a level of detail the values of the displayed points are picked from all values
+    if (!lodIndices.empty())
+        numPoints = static_cast<int>(static_cast<Points::Feature*>(pcObject)->Points.getValue().size());
 
     if (strcmp("Color",ModeName) == 0) {
         std::map<std::string,App::Property*> Map;
@@ -355,13 +370,22 @@ void ViewProviderPoints::clipPointsCallback(void *, SoEventCallback * n)
 PROPERTY_SOURCE(PointsGui::ViewProviderScattered, PointsGui::ViewProviderPoints)
 
 ViewProviderScattered::ViewProviderScattered()
+  : lodError(2.0f)
+  , lodBudget(0)
 {
     pcPoints = new SoPointSet();
     pcPoints->ref();
+
+    pcLodCallback = new SoCallback();
+    pcLodCallback->ref();
+    pcLodCallback->setCallback(lodCallback, this);
+    lodSensor = new SoOneShotSensor(lodSensorCallback, this);
 }
 
 ViewProviderScattered::~ViewProviderScattered()
 {
+    delete lodSensor;
+    pcLodCallback->unref();
     pcPoints->unref();
 }
 
@@ -375,6 +399,7 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     pcHighlight->subElementName = "Main";
 
     // Highlight for selection
+    pcHighlight->addChild(pcLodCallback);
     pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
 
@@ -415,8 +440,26 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->getTypeId() == Points::PropertyPointKernel::getClassTypeId()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+            ("User parameter:BaseApp/Preferences/Mod/Points");
+        long threshold = hGrp->GetInt("LevelOfDetailThreshold", 2000000);
+        lodError = static_cast<float>(hGrp->GetFloat("LevelOfDetailError", 2.0));
+        lodBudget = static_cast<std::size_t>(std::max<long>(hGrp->GetInt("LevelOfDetailBudget", 3000000), 1));
+
+        const Points::PointKernel& kernel = static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+        Points::Feature* fea = static_cast<Points::Feature*>(pcObject);
+        if (threshold > 0 && kernel.size() > static_cast<std::size_t>(threshold) && prop == &fea->Points) {
+            // start with a coarse level, the first rendering selects the nodes for the view
+            octree = fea->getOctree();
+            setLevelOfDetail(octree->getLevel(3));
+        }
+        else {
+            octree.reset();
+            lodNodes.clear();
+            lodIndices.clear();
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -432,6 +475,83 @@ void ViewProviderScattered::updateData(const App::Property* prop)
     }
 }
 
+void ViewProviderScattered::setLevelOfDetail(const std::vector<std::size_t>& nodes)
+{
+    lodNodes = nodes;
+
+    // the octree only holds indices into the points of the kernel
+    const Points::PointKernel& kernel = static_cast<Points::Feature*>(pcObject)->Points.getValue();
+    const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+    if (points.size() != octree->countPoints())
+        return;
+
+    std::size_t numPoints = 0;
+    for (std::vector<std::size_t>::const_iterator it = nodes.begin(); it != nodes.end(); ++it)
+        numPoints += octree->getPoints(octree->getNode(*it)).count;
+
+    pcPointsCoord->point.setNum(numPoints);
+    SbVec3f* vec = pcPointsCoord->point.startEditing();
+    lodIndices.resize(numPoints);
+
+    std::size_t idx=0;
+    for (std::vector<std::size_t>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        Points::PointsOctree::NodePoints pts = octree->getPoints(octree->getNode(*it));
+        for (std::size_t i=0; i<pts.count; i++, idx++) {
+            const Base::Vector3f& pnt = points[pts.indices[i]];
+            vec[idx].setValue(pnt.x, pnt.y, pnt.z);
+            lodIndices[idx] = pts.indices[i];
+        }
+    }
+
+    pcPoints->numPoints = numPoints;
+    pcPointsCoord->point.finishEditing();
+}
+
+void ViewProviderScattered::lodCallback(void * ud, SoAction * action)
+{
+    ViewProviderScattered* that = static_cast<ViewProviderScattered*>(ud);
+    if (!that->octree || !action->isOfType(SoGLRenderAction::getClassTypeId()))
+        return;
+
+    // the displayed points depend on the camera, so the render caches must not be used
+    SoState* state = action->getState();
+    SoCacheElement::invalidate(state);
+
+    // the octree is in the coordinate system of the points
+    SbViewVolume vv = SoViewVolumeElement::get(state);
+    vv.transform(SoModelMatrixElement::get(state).inverse());
+    float height = SoViewportRegionElement::get(state).getViewportSizePixels()[1];
+
+    std::vector<std::size_t> nodes = that->octree->select([&vv, height](const Points::PointsOctree::Node& node) {
+        SbBox3f box(node.box.MinX, node.box.MinY, node.box.MinZ,
+                    node.box.MaxX, node.box.MaxY, node.box.MaxZ);
+        if (!vv.intersect(box))
+            return -1.0f;
+        // the world size of the full screen height at the node
+        float scale = vv.getWorldToScreenScale(box.getCenter(), 1.0f);
+        if (scale <= 0.0f)
+            return std::numeric_limits<float>::max();
+        return node.spacing / scale * height;
+    }, that->lodError, that->lodBudget);
+
+    // the scene graph must not be changed while it is traversed
+    if (!nodes.empty() && nodes != that->lodNodes) {
+        that->pendingNodes.swap(nodes);
+        if (!that->lodSensor->isScheduled())
+            that->lodSensor->schedule();
+    }
+}
+
+void ViewProviderScattered::lodSensorCallback(void * ud, SoSensor *)
+{
+    ViewProviderScattered* that = static_cast<ViewProviderScattered*>(ud);
+    if (that->octree && !that->pendingNodes.empty() && that->pendingNodes != that->lodNodes) {
+        that->setLevelOfDetail(that->pendingNodes);
+        // pick the colors, intensities or normals of the displayed points
+        that->setActiveMode();
+    }
+}
+
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer &Viewer)
 {
     // create the polygon from the picked points
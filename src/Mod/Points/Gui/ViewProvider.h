@@ -28,6 +28,7 @@
 #include <Gui/ViewProviderPythonFeature.h>
 #include <Gui/ViewProviderBuilder.h>
 #include <Inventor/SbVec2f.h>
+#include <memory>
 
 
 class SoSwitch;
@@ -37,6 +38,10 @@ class SoLocateHighlight;
 class SoCoordinate3;
 class SoNormal;
 class SoEventCallback;
+class SoCallback;
+class SoAction;
+class SoSensor;
+class SoOneShotSensor;
 
 namespace App {
     class PropertyColorList;
@@ -50,6 +55,7 @@ namespace Points {
     class PropertyGreyValueList;
     class PropertyNormalList;
     class PointKernel;
+    class PointsOctree;
     class Feature;
 }
 
@@ -107,6 +113,8 @@ protected:
     SoMaterial          * pcColorMat;
     SoNormal            * pcPointsNormal;
     SoDrawStyle         * pcPointStyle;
+    /// Indices of the displayed points if only a level of detail is shown, otherwise empty
+    std::vector<uint32_t> lodIndices;
 
 private:
     static App::PropertyFloatConstraint::Constraints floatRange;
@@ -135,9 +143,30 @@ public:
 
 protected:
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer &Viewer);
+    /// Shows the points of the given octree nodes
+    void setLevelOfDetail(const std::vector<std::size_t>& nodes);
+
+private:
+    static void lodCallback(void * ud, SoAction * action);
+    static void lodSensorCallback(void * ud, SoSensor * sensor);
 
 protected:
     SoPointSet          * pcPoints;
+
+private:
+    /** @name Level of detail
+     * Large clouds are shown by the representatives of the octree nodes that are
+     * selected by their screen-space error for the current view.
+     */
+    //@{
+    SoCallback          * pcLodCallback;
+    SoOneShotSensor     * lodSensor;
+    std::shared_ptr<const Points::PointsOctree> octree;
+    std::vector<std::size_t> lodNodes;
+    std::vector<std::size_t> pendingNodes;
+    float lodError;
+    std::size_t lodBudget;
+    //@}
 };
 
 /**
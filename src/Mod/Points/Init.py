@@ -28,5 +28,7 @@
 
 
 # Append the open handler
-FreeCAD.addImportType("Point formats (*.asc *.pcd *.ply)","Points")
+FreeCAD.addImportType("Point formats (*.asc *.xyz *.pcd *.ply)","Points")
 FreeCAD.addExportType("Point formats (*.asc *.pcd *.ply)","Points")
+
+FreeCAD.__unit_test__ += [ "PointsTestsApp" ]
@@ -465,7 +465,7 @@ void ImageTriangulation::perform()
     const MeshCore::MeshFacetArray& face = kernel.GetFacets();
     MeshCore::MeshAlgorithm meshAlg(kernel);
     meshAlg.SetPointFlag(MeshCore::MeshPoint::INVALID);
-    std::vector<unsigned long> validPoints;
+    std::vector<MeshCore::PointIndex> validPoints;
     validPoints.reserve(face.size()*3);
     for (MeshCore::MeshFacetArray::_TConstIterator it = face.begin(); it != face.end(); ++it) {
         validPoints.push_back(it->_aulPoints[0]);
@@ -480,7 +480,7 @@ void ImageTriangulation::perform()
 
     unsigned long countInvalid = meshAlg.CountPointFlag(MeshCore::MeshPoint::INVALID);
     if (countInvalid > 0) {
-        std::vector<unsigned long> invalidPoints;
+        std::vector<MeshCore::PointIndex> invalidPoints;
         invalidPoints.reserve(countInvalid);
         meshAlg.GetPointsFlag(invalidPoints, MeshCore::MeshPoint::INVALID);
 
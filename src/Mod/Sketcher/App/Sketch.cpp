@@ -76,7 +76,7 @@ Sketch::Sketch()
   , RecalculateInitialSolutionWhileMovingPoint(false)
   , resolveAfterGeometryUpdated(false)
   , GCSsys(), ConstraintsCounter(0)
-  , isInitMove(false), isFine(true), moveStep(0)
+  , isInitMove(false), isFine(true), moveGeoId(Constraint::GeoUndef), movePos(none), moveStep(0)
   , defaultSolver(GCS::DogLeg)
   , defaultSolverRedundant(GCS::DogLeg)
   , debugMode(GCS::Minimal)
@@ -3705,6 +3705,9 @@ int Sketch::initMove(int geoId, PointPos pos, bool fine)
         return -1;
     }
 
+    moveGeoId = geoId;
+    movePos = pos;
+
     if (Geoms[geoId].type == Point) {
         if (pos == start) {
             GCS::Point &point = Points[Geoms[geoId].startPointId];
@@ -3977,6 +3980,15 @@ void Sketch::resetInitMove()
     isInitMove = false;
 }
 
+void Sketch::resetSolverCache()
+{
+    isInitMove = false;
+    clearTemporaryConstraints();
+    // temporary constraints do not affect the diagnosis, so this only stores the current
+    // parameters as reference and partitions the system again
+    GCSsys.initSolution(defaultSolverRedundant);
+}
+
 int Sketch::movePoint(int geoId, PointPos pos, Base::Vector3d toPoint, bool relative)
 {
     geoId = checkGeoId(geoId);
@@ -3985,7 +3997,8 @@ int Sketch::movePoint(int geoId, PointPos pos, Base::Vector3d toPoint, bool rela
     if (hasConflicts())
         return -1;
 
-    if (!isInitMove) {
+    // a drag may be kept over several calls, as long as it moves the same element
+    if (!isInitMove || geoId != moveGeoId || pos != movePos) {
         initMove(geoId, pos);
         initToPoint = toPoint;
         moveStep = 0;
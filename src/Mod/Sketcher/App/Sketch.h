@@ -130,6 +130,12 @@ public:
      */
     void resetInitMove();
 
+    /** Re-arms the solver on the current state of the sketch, reusing the parameters,
+      * constraints and diagnosis of the last setUpSketch. This is only valid as long as
+      * neither the geometry nor the constraints changed since then.
+      */
+    void resetSolverCache();
+
     /** move this point (or curve) to a new location and solve.
       * This will introduce some additional weak constraints expressing
       * a condition for satisfying the new point location!
@@ -459,6 +465,8 @@ protected:
 
     bool isInitMove;
     bool isFine;
+    int moveGeoId;                      // geometry and point of the current drag (see initMove)
+    PointPos movePos;
     Base::Vector3d initToPoint;
     double moveStep;
 
@@ -477,6 +485,7 @@ public:
     inline void setQRAlgorithm(GCS::QRAlgorithm alg){GCSsys.qrAlgorithm=alg;}
     inline GCS::QRAlgorithm getQRAlgorithm(){return GCSsys.qrAlgorithm;}
     inline void setQRPivotThreshold(double val){GCSsys.qrpivotThreshold=val;}
+    inline void setSparseSolverThreshold(int val){GCSsys.sparseSolverThreshold=val;}
     inline void setLM_eps(double val){GCSsys.LM_eps=val;}
     inline void setLM_eps1(double val){GCSsys.LM_eps1=val;}
     inline void setLM_tau(double val){GCSsys.LM_tau=val;}
@@ -139,7 +139,10 @@ SketchObject::SketchObject()
     lastSolverStatus=0;
     lastSolveTime=0;
 
-    solverNeedsUpdate=false;
+    solverNeedsUpdate=true;
+    solverSessionUpdate=false;
+    moveSessionKept=false;
+    solverMovedTemporarily=false;
 
     noRecomputes=false;
 
@@ -189,6 +192,7 @@ App::DocumentObjectExecReturn *SketchObject::execute(void)
     // setup and diagnose the sketch
     try {
         rebuildExternalGeometry();
+        Base::StateLocker lock(solverSessionUpdate, true); // only refreshes the geometry types known by the constraints
         Constraints.acceptGeometry(getCompleteGeometry());
     }
     catch (const Base::Exception& e) {
@@ -260,6 +264,7 @@ int SketchObject::solve(bool updateGeoAfterSolving/*=true*/)
 
     // Reset the initial movement in case of a dragging operation was ongoing on the solver.
     solvedSketch.resetInitMove();
+    moveSessionKept = false;
 
     // if updateGeoAfterSolving=false, the solver information is updated, but the Sketch is nothing
     // updated. It is useful to avoid triggering an OnChange when the goeometry did not change but
@@ -269,19 +274,28 @@ int SketchObject::solve(bool updateGeoAfterSolving/*=true*/)
     // therefore we update our sketch solver geometry with the SketchObject one.
     //
     // set up a sketch (including dofs counting and diagnosing of conflicts)
-    lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(), Constraints.getValues(),
-                                  getExternalGeometryCount());
+    //
+    // If neither geometry nor constraints changed since the last set up (e.g. a solve after dragging),
+    // the solver system and its diagnosis are still valid, so they are reused.
+    if (solverNeedsUpdate || solverMovedTemporarily) {
+        lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(), Constraints.getValues(),
+                                      getExternalGeometryCount());
 
-    FullyConstrained.setValue(lastDoF == 0);
-    // At this point we have the solver information about conflicting/redundant/over-constrained, but the sketch is NOT solved.
-    // Some examples:
-    // Redundant: a vertical line, a horizontal line and an angle constraint of 90 degrees between the two lines
-    // Conflicting: a 80 degrees angle between a vertical line and another line, then adding a horizontal constraint to that other line
-    // OverConstrained: a conflicting constraint when all other DoF are already constraint (it has more constrains than parameters and the extra constraints are not redundant)
+        FullyConstrained.setValue(lastDoF == 0);
+        // At this point we have the solver information about conflicting/redundant/over-constrained, but the sketch is NOT solved.
+        // Some examples:
+        // Redundant: a vertical line, a horizontal line and an angle constraint of 90 degrees between the two lines
+        // Conflicting: a 80 degrees angle between a vertical line and another line, then adding a horizontal constraint to that other line
+        // OverConstrained: a conflicting constraint when all other DoF are already constraint (it has more constrains than parameters and the extra constraints are not redundant)
 
-    solverNeedsUpdate=false;
+        solverNeedsUpdate=false;
+        solverMovedTemporarily=false;
 
-    retrieveSolverDiagnostics();
+        retrieveSolverDiagnostics();
+    }
+    else {
+        solvedSketch.resetSolverCache();
+    }
 
     lastSolveTime=0.0;
 
@@ -326,10 +340,17 @@ int SketchObject::solve(bool updateGeoAfterSolving/*=true*/)
     if (err == 0 && updateGeoAfterSolving) {
         // set the newly solved geometry
         std::vector<Part::Geometry *> geomlist = solvedSketch.extractGeometry();
-        Geometry.setValues(geomlist);
+        {
+            Base::StateLocker lock(solverSessionUpdate, true);
+            Geometry.setValues(geomlist);
+        }
         for (std::vector<Part::Geometry *>::iterator it = geomlist.begin(); it != geomlist.end(); ++it)
             if (*it) delete *it;
     }
+    else if (err == 0) {
+        // the solver moved away from the geometry of the sketch, so the next solve must start over from the latter
+        solverNeedsUpdate=true;
+    }
     else if(err <0) {
         // if solver failed, invalid constraints were likely added before solving
         // (see solve in addConstraint), so solver information is definitely invalid.
@@ -661,6 +682,10 @@ int SketchObject::setUpSketch()
     lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(), Constraints.getValues(),
                                        getExternalGeometryCount());
 
+    solverNeedsUpdate=false;
+    moveSessionKept=false;
+    solverMovedTemporarily=false;
+
     retrieveSolverDiagnostics();
 
     if(lastHasRedundancies || lastDoF < 0 || lastHasConflict || lastHasMalformedConstraints || lastHasPartialRedundancies)
@@ -689,6 +714,8 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
         retrieveSolverDiagnostics();
 
         solverNeedsUpdate=false;
+        moveSessionKept=false;
+        solverMovedTemporarily=false;
     }
 
     if (lastDoF < 0) // over-constrained sketch
@@ -696,6 +723,10 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
     if (lastHasConflict) // conflicting constraints
         return -1;
 
+    // a relative move refers to the current position, not to the reference of a drag kept from a previous call
+    if (relative && moveSessionKept)
+        solvedSketch.resetInitMove();
+
     // move the point and solve
     lastSolverStatus = solvedSketch.movePoint(GeoId, PosId, toPoint, relative);
 
@@ -704,14 +735,26 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
 
     if (lastSolverStatus == 0) {
         std::vector<Part::Geometry *> geomlist = solvedSketch.extractGeometry();
-        Geometry.setValues(geomlist);
+        {
+            Base::StateLocker lock(solverSessionUpdate, true);
+            Geometry.setValues(geomlist);
+        }
+        solverMovedTemporarily=false;
         //Constraints.acceptGeometry(getCompleteGeometry());
         for (std::vector<Part::Geometry *>::iterator it=geomlist.begin(); it != geomlist.end(); ++it) {
             if (*it) delete *it;
         }
     }
+    else {
+        // the solver may have been left at the reference of the drag
+        solverNeedsUpdate=true;
+    }
 
-    solvedSketch.resetInitMove(); // reset solver point moving mechanism
+    // Absolute moves keep the drag of the solver, so that successive moves of the same element
+    // (e.g. scripted drags) do not set up the temporary constraints and subsystems again.
+    moveSessionKept = (lastSolverStatus == 0 && !relative);
+    if (!moveSessionKept)
+        solvedSketch.resetInitMove(); // reset solver point moving mechanism
 
     return lastSolverStatus;
 }
@@ -6569,6 +6612,10 @@ void SketchObject::rebuildExternalGeometry(void)
         }
     }
 
+    // the linked geometry may have moved, the axes of the sketch cannot
+    if (!Objects.empty())
+        solverNeedsUpdate = true;
+
     rebuildVertexIndex();
 }
 
@@ -7223,6 +7270,9 @@ void SketchObject::onChanged(const App::Property* prop)
 
     if (prop == &Geometry || prop == &Constraints) {
 
+        if (!solverSessionUpdate)
+            solverNeedsUpdate = true;
+
         auto doc = getDocument();
 
         if(doc && doc->isPerformingTransaction()) { // undo/redo
@@ -7272,6 +7322,8 @@ void SketchObject::onChanged(const App::Property* prop)
         }
     }
     else if (prop == &ExternalGeometry) {
+        solverNeedsUpdate = true;
+
         // make sure not to change anything while restoring this object
         if (!isRestoring()) {
             // external geometry was cleared
@@ -427,6 +427,8 @@ public: /* Solver exposed interface */
     /// enables/disables solver initial solution recalculation when moving point mode (useful for dragging)
     inline void setRecalculateInitialSolutionWhileMovingPoint(bool recalculateInitialSolutionWhileMovingPoint)
         {solvedSketch.setRecalculateInitialSolutionWhileMovingPoint(recalculateInitialSolutionWhileMovingPoint);}
+    /// forces the next solve to set up and diagnose the solver system from scratch (e.g. after changing solver settings)
+    inline void invalidateSolverSession(void) {solverNeedsUpdate=true;}
     /// Forwards a request for a temporary initMove to the solver using the current sketch state as a reference (enables dragging)
     inline int initTemporaryMove(int geoId, PointPos pos, bool fine=true);
     /** Forwards a request for point or curve temporary movement to the solver using the current state as a reference (enables dragging).
@@ -617,9 +619,22 @@ private:
 
     /** this internal flag indicate that an operation modifying the geometry, but not the DoF of the sketch took place (e.g. toggle construction),
         so if next action is a movement of a point (movePoint), the geometry must be updated first.
+
+        While it is false, solvedSketch holds the geometry and constraints of the sketch, and solve() and movePoint() reuse
+        its solver system and diagnosis instead of setting up the sketch again. Any change of Geometry, Constraints or
+        external geometry not originating from the solver sets it (see onChanged).
     */
     bool solverNeedsUpdate;
 
+    /// set while Geometry or Constraints are updated with information the solver already has (e.g. its own solution)
+    bool solverSessionUpdate;
+
+    /// indicates that the drag of the solver was kept by movePoint() for a subsequent call
+    bool moveSessionKept;
+
+    /// indicates that the solver holds a temporary move not (yet) accepted into Geometry (see moveTemporaryPoint)
+    bool solverMovedTemporarily;
+
     int lastDoF;
     bool lastHasConflict;
     bool lastHasRedundancies;
@@ -668,11 +683,15 @@ inline int SketchObject::initTemporaryMove(int geoId, PointPos pos, bool fine/*=
     if(solverNeedsUpdate)
         solve();
 
+    moveSessionKept = false;
+
     return solvedSketch.initMove(geoId,pos,fine);
 }
 
 inline int SketchObject::moveTemporaryPoint(int geoId, PointPos pos, Base::Vector3d toPoint, bool relative/*=false*/)
 {
+    solverMovedTemporarily = true;
+
     return solvedSketch.movePoint(geoId, pos, toPoint, relative);
 }
 
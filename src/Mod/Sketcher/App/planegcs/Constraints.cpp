@@ -21,6 +21,7 @@
  ***************************************************************************/
 
 #include <cmath>
+#include <cassert>
 #include "Constraints.h"
 #include <algorithm>
 
@@ -2125,5 +2126,248 @@ double ConstraintEqualLineLength::grad(double *param)
     return deriv*scale;
 }
 
+// ConstraintBatch
+void ConstraintBatch::clear()
+{
+    constrs.clear();
+    tags.clear();
+    scales.clear();
+    slots.assign(nparams, VEC_pD());
+}
+
+void ConstraintBatch::add(Constraint *constr, int tag)
+{
+    assert(constr->getTypeId() == getTypeId() && int(constr->pvec.size()) == nparams);
+    constrs.push_back(constr);
+    tags.push_back(tag);
+    scales.push_back(constr->scale);
+    for (int slot=0; slot < nparams; slot++)
+        slots[slot].push_back(constr->pvec[slot]);
+    onAdd(constr);
+}
+
+// The kernels below repeat the formulas of error() and grad() of the respective
+// constraints, each slot of the gradient being the derivative with respect to
+// the corresponding parameter of pvec.
+
+// Equal
+class ConstraintBatchEqual : public ConstraintBatch
+{
+    VEC_D ratios;
+public:
+    ConstraintBatchEqual() : ConstraintBatch(2) {}
+    virtual ConstraintType getTypeId() { return Equal; }
+    virtual void onAdd(Constraint *constr) {
+        ratios.resize(size());
+        ratios.back() = static_cast<ConstraintEqual *>(constr)->getRatio();
+    }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *p1 = &slots[0][0], * const *p2 = &slots[1][0];
+        for (int i=0; i < n; i++)
+            err[tags[i]] = scales[i] * (*p1[i] - ratios[i] * *p2[i]);
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        for (int i=0; i < n; i++) {
+            grad[i] = scales[i];
+            grad[n+i] = -scales[i];
+        }
+    }
+};
+
+// Difference
+class ConstraintBatchDifference : public ConstraintBatch
+{
+public:
+    ConstraintBatchDifference() : ConstraintBatch(3) {}
+    virtual ConstraintType getTypeId() { return Difference; }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *p1 = &slots[0][0], * const *p2 = &slots[1][0], * const *d = &slots[2][0];
+        for (int i=0; i < n; i++)
+            err[tags[i]] = scales[i] * (*p2[i] - *p1[i] - *d[i]);
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        for (int i=0; i < n; i++) {
+            grad[i] = -scales[i];
+            grad[n+i] = scales[i];
+            grad[2*n+i] = -scales[i];
+        }
+    }
+};
+
+// P2PDistance
+class ConstraintBatchP2PDistance : public ConstraintBatch
+{
+public:
+    ConstraintBatchP2PDistance() : ConstraintBatch(5) {}
+    virtual ConstraintType getTypeId() { return P2PDistance; }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *p1x = &slots[0][0], * const *p1y = &slots[1][0], * const *p2x = &slots[2][0], * const *p2y = &slots[3][0];
+        double * const *dist = &slots[4][0];
+        for (int i=0; i < n; i++) {
+            double dx = *p1x[i] - *p2x[i];
+            double dy = *p1y[i] - *p2y[i];
+            err[tags[i]] = scales[i] * (sqrt(dx*dx + dy*dy) - *dist[i]);
+        }
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        double * const *p1x = &slots[0][0], * const *p1y = &slots[1][0], * const *p2x = &slots[2][0], * const *p2y = &slots[3][0];
+        for (int i=0; i < n; i++) {
+            double dx = *p1x[i] - *p2x[i];
+            double dy = *p1y[i] - *p2y[i];
+            double d = sqrt(dx*dx + dy*dy);
+            grad[i] = scales[i] * (dx/d);
+            grad[n+i] = scales[i] * (dy/d);
+            grad[2*n+i] = scales[i] * (-dx/d);
+            grad[3*n+i] = scales[i] * (-dy/d);
+            grad[4*n+i] = -scales[i];
+        }
+    }
+};
+
+// PointOnLine
+class ConstraintBatchPointOnLine : public ConstraintBatch
+{
+public:
+    ConstraintBatchPointOnLine() : ConstraintBatch(6) {}
+    virtual ConstraintType getTypeId() { return PointOnLine; }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *p0x = &slots[0][0], * const *p0y = &slots[1][0], * const *p1x = &slots[2][0];
+        double * const *p1y = &slots[3][0], * const *p2x = &slots[4][0], * const *p2y = &slots[5][0];
+        for (int i=0; i < n; i++) {
+            double x0=*p0x[i], x1=*p1x[i], x2=*p2x[i];
+            double y0=*p0y[i], y1=*p1y[i], y2=*p2y[i];
+            double dx = x2-x1;
+            double dy = y2-y1;
+            double d = sqrt(dx*dx+dy*dy);
+            double area = -x0*dy+y0*dx+x1*y2-x2*y1;
+            err[tags[i]] = scales[i] * area/d;
+        }
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        double * const *p0x = &slots[0][0], * const *p0y = &slots[1][0], * const *p1x = &slots[2][0];
+        double * const *p1y = &slots[3][0], * const *p2x = &slots[4][0], * const *p2y = &slots[5][0];
+        for (int i=0; i < n; i++) {
+            double x0=*p0x[i], x1=*p1x[i], x2=*p2x[i];
+            double y0=*p0y[i], y1=*p1y[i], y2=*p2y[i];
+            double dx = x2-x1;
+            double dy = y2-y1;
+            double d2 = dx*dx+dy*dy;
+            double d = sqrt(d2);
+            double area = -x0*dy+y0*dx+x1*y2-x2*y1;
+            grad[i] = scales[i] * ((y1-y2) / d);
+            grad[n+i] = scales[i] * ((x2-x1) / d);
+            grad[2*n+i] = scales[i] * (((y2-y0)*d + (dx/d)*area) / d2);
+            grad[3*n+i] = scales[i] * (((x0-x2)*d + (dy/d)*area) / d2);
+            grad[4*n+i] = scales[i] * (((y0-y1)*d - (dx/d)*area) / d2);
+            grad[5*n+i] = scales[i] * (((x1-x0)*d - (dy/d)*area) / d2);
+        }
+    }
+};
+
+// Parallel
+class ConstraintBatchParallel : public ConstraintBatch
+{
+public:
+    ConstraintBatchParallel() : ConstraintBatch(8) {}
+    virtual ConstraintType getTypeId() { return Parallel; }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *l1p1x = &slots[0][0], * const *l1p1y = &slots[1][0], * const *l1p2x = &slots[2][0], * const *l1p2y = &slots[3][0];
+        double * const *l2p1x = &slots[4][0], * const *l2p1y = &slots[5][0], * const *l2p2x = &slots[6][0], * const *l2p2y = &slots[7][0];
+        for (int i=0; i < n; i++) {
+            double dx1 = (*l1p1x[i] - *l1p2x[i]);
+            double dy1 = (*l1p1y[i] - *l1p2y[i]);
+            double dx2 = (*l2p1x[i] - *l2p2x[i]);
+            double dy2 = (*l2p1y[i] - *l2p2y[i]);
+            err[tags[i]] = scales[i] * (dx1*dy2 - dy1*dx2);
+        }
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        double * const *l1p1x = &slots[0][0], * const *l1p1y = &slots[1][0], * const *l1p2x = &slots[2][0], * const *l1p2y = &slots[3][0];
+        double * const *l2p1x = &slots[4][0], * const *l2p1y = &slots[5][0], * const *l2p2x = &slots[6][0], * const *l2p2y = &slots[7][0];
+        for (int i=0; i < n; i++) {
+            double dx1 = (*l1p1x[i] - *l1p2x[i]);
+            double dy1 = (*l1p1y[i] - *l1p2y[i]);
+            double dx2 = (*l2p1x[i] - *l2p2x[i]);
+            double dy2 = (*l2p1y[i] - *l2p2y[i]);
+            grad[i] = scales[i] * dy2;
+            grad[n+i] = scales[i] * -dx2;
+            grad[2*n+i] = scales[i] * -dy2;
+            grad[3*n+i] = scales[i] * dx2;
+            grad[4*n+i] = scales[i] * -dy1;
+            grad[5*n+i] = scales[i] * dx1;
+            grad[6*n+i] = scales[i] * dy1;
+            grad[7*n+i] = scales[i] * -dx1;
+        }
+    }
+};
+
+// Perpendicular
+class ConstraintBatchPerpendicular : public ConstraintBatch
+{
+public:
+    ConstraintBatchPerpendicular() : ConstraintBatch(8) {}
+    virtual ConstraintType getTypeId() { return Perpendicular; }
+    virtual void errors(double *err) {
+        int n = size();
+        double * const *l1p1x = &slots[0][0], * const *l1p1y = &slots[1][0], * const *l1p2x = &slots[2][0], * const *l1p2y = &slots[3][0];
+        double * const *l2p1x = &slots[4][0], * const *l2p1y = &slots[5][0], * const *l2p2x = &slots[6][0], * const *l2p2y = &slots[7][0];
+        for (int i=0; i < n; i++) {
+            double dx1 = (*l1p1x[i] - *l1p2x[i]);
+            double dy1 = (*l1p1y[i] - *l1p2y[i]);
+            double dx2 = (*l2p1x[i] - *l2p2x[i]);
+            double dy2 = (*l2p1y[i] - *l2p2y[i]);
+            err[tags[i]] = scales[i] * (dx1*dx2 + dy1*dy2);
+        }
+    }
+    virtual void grads(double *grad) {
+        int n = size();
+        double * const *l1p1x = &slots[0][0], * const *l1p1y = &slots[1][0], * const *l1p2x = &slots[2][0], * const *l1p2y = &slots[3][0];
+        double * const *l2p1x = &slots[4][0], * const *l2p1y = &slots[5][0], * const *l2p2x = &slots[6][0], * const *l2p2y = &slots[7][0];
+        for (int i=0; i < n; i++) {
+            double dx1 = (*l1p1x[i] - *l1p2x[i]);
+            double dy1 = (*l1p1y[i] - *l1p2y[i]);
+            double dx2 = (*l2p1x[i] - *l2p2x[i]);
+            double dy2 = (*l2p1y[i] - *l2p2y[i]);
+            grad[i] = scales[i] * dx2;
+            grad[n+i] = scales[i] * dy2;
+            grad[2*n+i] = scales[i] * -dx2;
+            grad[3*n+i] = scales[i] * -dy2;
+            grad[4*n+i] = scales[i] * dx1;
+            grad[5*n+i] = scales[i] * dy1;
+            grad[6*n+i] = scales[i] * -dx1;
+            grad[7*n+i] = scales[i] * -dy1;
+        }
+    }
+};
+
+ConstraintBatch *ConstraintBatch::create(ConstraintType type)
+{
+    switch (type) {
+    case Equal:
+        return new ConstraintBatchEqual();
+    case Difference:
+        return new ConstraintBatchDifference();
+    case P2PDistance:
+        return new ConstraintBatchP2PDistance();
+    case PointOnLine:
+        return new ConstraintBatchPointOnLine();
+    case Parallel:
+        return new ConstraintBatchParallel();
+    case Perpendicular:
+        return new ConstraintBatchPerpendicular();
+    default:
+        return 0;
+    }
+}
 
 } //namespace GCS
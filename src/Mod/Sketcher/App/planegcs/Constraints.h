@@ -92,8 +92,11 @@ namespace GCS
         HyperbolaNegativeMinorY = 17
     };
 
+    class ConstraintBatch;
+
     class Constraint
     {
+        friend class ConstraintBatch;
     _PROTECTED_UNLESS_EXTRACT_MODE_:
         VEC_pD origpvec; // is used only as a reference for redirecting and reverting pvec
         VEC_pD pvec;
@@ -119,7 +122,7 @@ namespace GCS
         virtual void rescale(double coef=1.);
         virtual double error();
         virtual double grad(double *);
-        // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+        // vectorized versions of error and grad, see ConstraintBatch
         virtual double maxStep(MAP_pD_D &dir, double lim=1.);
         // Finds first occurrence of param in pvec. This is useful to test if a constraint depends
         // on the parameter (it may not actually depend on it, e.g. angle-via-point doesn't depend
@@ -137,6 +140,7 @@ namespace GCS
         inline double* param2() { return pvec[1]; }
     public:
         ConstraintEqual(double *p1, double *p2, double p1p2ratio=1.0);
+        inline double getRatio() { return ratio; }
         virtual ConstraintType getTypeId();
         virtual void rescale(double coef=1.);
         virtual double error();
@@ -632,6 +636,56 @@ namespace GCS
         virtual double grad(double *);
     };
 
+    ///////////////////////////////////////
+    // Constraint batches
+    ///////////////////////////////////////
+
+    // Evaluates many constraints of the same type at once. The parameters of the
+    // constraints are kept in structure-of-arrays form, so that errors and gradients
+    // are computed in plain loops over the batch instead of one virtual call per
+    // constraint (and parameter).
+    //
+    // A batch takes the parameter pointers and the scale of its constraints at the time
+    // they are added, it has to be filled again after redirecting or rescaling them.
+    class ConstraintBatch
+    {
+    public:
+        virtual ~ConstraintBatch(){}
+
+        // Returns a new batch for constraints of the given type or NULL if the type
+        // has no batched implementation. The caller takes ownership.
+        static ConstraintBatch *create(ConstraintType type);
+
+        virtual ConstraintType getTypeId() = 0;
+
+        void clear();
+        // appends a constraint of the type of the batch, tag is returned by getTag()
+        void add(Constraint *constr, int tag=0);
+
+        inline int size() const { return static_cast<int>(constrs.size()); }
+        inline int paramCount() const { return nparams; }
+        inline Constraint *getConstraint(int i) const { return constrs[i]; }
+        inline int getTag(int i) const { return tags[i]; }
+        // the parameter the derivative grad[slot*size()+i] refers to
+        inline double *getParam(int slot, int i) const { return slots[slot][i]; }
+
+        // err[getTag(i)] is set to the error of the i-th constraint
+        virtual void errors(double *err) = 0;
+        // grad[slot*size()+i] is the derivative of the error of the i-th constraint with respect
+        // to its parameter in the given slot (parameters used by several slots get a contribution
+        // from each of them)
+        virtual void grads(double *grad) = 0;
+
+    protected:
+        ConstraintBatch(int nparams_) : nparams(nparams_), slots(nparams_) {}
+        virtual void onAdd(Constraint * /*constr*/) {}
+
+        int nparams;
+        std::vector<Constraint *> constrs;
+        std::vector<int> tags;
+        VEC_D scales;
+        std::vector<VEC_pD> slots; // slots[k][i] is the k-th parameter of the i-th constraint
+    };
 
 } //namespace GCS
 
@@ -460,6 +460,7 @@ System::System()
   , qrAlgorithm(EigenSparseQR)
   , dogLegGaussStep(FullPivLU)
   , qrpivotThreshold(1E-13)
+  , sparseSolverThreshold(100)
   , debugMode(Minimal)
   , LM_eps(1E-10)
   , LM_eps1(1E-80)
@@ -1730,12 +1731,108 @@ int System::solve_BFGS(SubSystem *subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+bool System::useSparseSolver(SubSystem *subsys) const
+{
+    // dense matrices are faster for small subsystems
+    return sparseSolverThreshold > 0 && subsys->pSize() >= sparseSolverThreshold;
+}
+
+namespace {
+
+// Linear algebra of the LM and DogLeg solvers, specialized for the dense and
+// the sparse jacobi matrix
+template <typename MatrixType>
+struct SolverAlgebra;
+
+template <>
+struct SolverAlgebra<Eigen::MatrixXd>
+{
+    // solve the augmented normal equations A*h=g
+    void solveNormal(const Eigen::MatrixXd &A, const Eigen::VectorXd &g, Eigen::VectorXd &h)
+    {
+        h = A.fullPivLu().solve(g);
+    }
+
+    // get the gauss-newton step
+    void gaussNewton(const Eigen::MatrixXd &Jx, const Eigen::VectorXd &fx,
+                     DogLegGaussStep dogLegGaussStep, Eigen::VectorXd &h_gn)
+    {
+        // http://forum.freecadweb.org/viewtopic.php?f=10&t=12769&start=50#p106220
+        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+        switch (dogLegGaussStep){
+            case FullPivLU:
+                h_gn = Jx.fullPivLu().solve(-fx);
+                break;
+            case LeastNormFullPivLU:
+                h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).fullPivLu().solve(-fx);
+                break;
+            case LeastNormLdlt:
+                h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).ldlt().solve(-fx);
+                break;
+        }
+    }
+};
+
+template <>
+struct SolverAlgebra<Eigen::SparseMatrix<double> >
+{
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double> > ldlt;
+    int patternSize = -1;
+
+    bool factorize(const Eigen::SparseMatrix<double> &A)
+    {
+        // the structure of the matrix does not change between iterations
+        if (int(A.nonZeros()) != patternSize) {
+            ldlt.analyzePattern(A);
+            patternSize = int(A.nonZeros());
+        }
+        ldlt.factorize(A);
+        return ldlt.info() == Eigen::Success;
+    }
+
+    void solveNormal(const Eigen::SparseMatrix<double> &A, const Eigen::VectorXd &g, Eigen::VectorXd &h)
+    {
+        // A is positive definite once augmented, the dense LU is only a safety net
+        if (factorize(A)) {
+            h = ldlt.solve(g);
+            if (h.allFinite())
+                return;
+        }
+        SolverAlgebra<Eigen::MatrixXd>().solveNormal(Eigen::MatrixXd(A), g, h);
+    }
+
+    void gaussNewton(const Eigen::SparseMatrix<double> &Jx, const Eigen::VectorXd &fx,
+                     DogLegGaussStep dogLegGaussStep, Eigen::VectorXd &h_gn)
+    {
+        // least norm step, as LeastNormLdlt, because J*J^T stays sparse. Rank
+        // deficient systems (redundant or conflicting constraints) fall back to
+        // the dense step of the selected type.
+        Eigen::SparseMatrix<double> JJt = Jx*Jx.transpose();
+        if (factorize(JJt)) {
+            h_gn = Jx.transpose()*ldlt.solve(-fx);
+            if (h_gn.allFinite() && (Jx*h_gn + fx).norm() <= 1e-6*fx.norm())
+                return;
+        }
+        SolverAlgebra<Eigen::MatrixXd>().gaussNewton(Eigen::MatrixXd(Jx), fx, dogLegGaussStep, h_gn);
+    }
+};
+
+} // namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+    if (useSparseSolver(subsys))
+        return solve_LM_impl<Eigen::SparseMatrix<double> >(subsys, isRedundantsolving);
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template <typename MatrixType>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
+{
     int xsize = subsys->pSize();
     int csize = subsys->cSize();
 
@@ -1743,9 +1840,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         return Success;
 
     Eigen::VectorXd e(csize), e_new(csize); // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);        // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    MatrixType J(csize, xsize);             // Jacobi of the subsystem
+    MatrixType A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
+    SolverAlgebra<MatrixType> algebra;
 
     subsys->redirectParams();
 
@@ -1817,10 +1915,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         while (k < 50) {
             // augment normal equations A = A+uI
             for (int i=0; i < xsize; ++i)
-                A(i,i) += mu;
+                A.coeffRef(i,i) += mu;
 
             //solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            algebra.solveNormal(A, g, h);
             double rel_error = (A*h - g).norm() / g.norm();
 
             // check if solving works
@@ -1869,7 +1967,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
             mu*=nu;
             nu*=2.0;
             for (int i=0; i < xsize; ++i) // restore diagonal J^T J entries
-                A(i,i) = diag_A(i);
+                A.coeffRef(i,i) = diag_A(i);
 
             k++;
         }
@@ -1906,6 +2004,14 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+    if (useSparseSolver(subsys))
+        return solve_DL_impl<Eigen::SparseMatrix<double> >(subsys, isRedundantsolving);
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template <typename MatrixType>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
+{
     double tolg=(isRedundantsolving?DL_tolgRedundant:DL_tolg);
     double tolx=(isRedundantsolving?DL_tolxRedundant:DL_tolx);
     double tolf=(isRedundantsolving?DL_tolfRedundant:DL_tolf);
@@ -1929,6 +2035,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                 << ", dogLegGaussStep: " << (dogLegGaussStep==FullPivLU?"FullPivLU":(dogLegGaussStep==LeastNormFullPivLU?"LeastNormFullPivLU":"LeastNormLdlt"))
                 << ", xsize: "          << xsize
                 << ", csize: "          << csize
+                << ", sparse: "         << (useSparseSolver(subsys)?"true":"false")
                 << ", maxIter: "        << maxIterNumber  << "\n";
 
         const std::string tmp = stream.str();
@@ -1937,8 +2044,9 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    MatrixType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
+    SolverAlgebra<MatrixType> algebra;
 
     subsys->redirectParams();
 
@@ -1979,19 +2087,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             h_sd  = alpha*g;
 
             // get the gauss-newton step
-            // http://forum.freecadweb.org/viewtopic.php?f=10&t=12769&start=50#p106220
-            // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-            switch (dogLegGaussStep){
-                case FullPivLU:
-                    h_gn = Jx.fullPivLu().solve(-fx);
-                    break;
-                case LeastNormFullPivLU:
-                    h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).fullPivLu().solve(-fx);
-                    break;
-                case LeastNormLdlt:
-                    h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).ldlt().solve(-fx);
-                    break;
-            }
+            algebra.gaussNewton(Jx, fx, dogLegGaussStep, h_gn);
 
             double rel_error = (Jx*h_gn + fx).norm() / fx.norm();
             if (rel_error > 1e15)
@@ -3827,10 +3923,11 @@ void System::makeReducedJacobian(Eigen::MatrixXd &J,
                                  std::map< int , int> &tagmultiplicity)
 {
     // construct specific parameter list for diagonose ignoring driven constraint parameters
+    SET_pD pdrivenset(pdrivenlist.begin(), pdrivenlist.end());
+    MAP_pD_I pdiagnoseindex;
     for (int j=0; j < int(plist.size()); j++) {
-        auto result1 = std::find(std::begin(pdrivenlist), std::end(pdrivenlist), plist[j]);
-
-        if (result1 == std::end(pdrivenlist)) {
+        if (pdrivenset.find(plist[j]) == pdrivenset.end()) {
+            pdiagnoseindex[plist[j]] = int(pdiagnoselist.size());
             pdiagnoselist.push_back(plist[j]);
         }
     }
@@ -3845,8 +3942,12 @@ void System::makeReducedJacobian(Eigen::MatrixXd &J,
         ++allcount;
         if ((*constr)->getTag() >= 0 && (*constr)->isDriving()) {
             jacobianconstraintcount++;
-            for (int j=0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount-1,j) = (*constr)->grad(pdiagnoselist[j]);
+            // the gradient is zero for all parameters the constraint does not depend on
+            VEC_pD &cparams = c2p[*constr];
+            for (VEC_pD::const_iterator param=cparams.begin(); param != cparams.end(); ++param) {
+                MAP_pD_I::const_iterator j = pdiagnoseindex.find(*param);
+                if (j != pdiagnoseindex.end())
+                    J(jacobianconstraintcount-1,j->second) = (*constr)->grad(*param);
             }
 
             // parallel processing: create tag multiplicity map
@@ -137,6 +137,13 @@ namespace GCS
         int solve_LM(SubSystem *subsys, bool isRedundantsolving=false);
         int solve_DL(SubSystem *subsys, bool isRedundantsolving=false);
 
+        // MatrixType is the type of the jacobi matrix, Eigen::MatrixXd or Eigen::SparseMatrix<double>
+        template <typename MatrixType>
+        int solve_LM_impl(SubSystem *subsys, bool isRedundantsolving);
+        template <typename MatrixType>
+        int solve_DL_impl(SubSystem *subsys, bool isRedundantsolving);
+        bool useSparseSolver(SubSystem *subsys) const;
+
         void makeReducedJacobian(Eigen::MatrixXd &J, std::map<int,int> &jacobianconstraintmap, GCS::VEC_pD &pdiagnoselist, std::map< int , int> &tagmultiplicity);
 
         void makeDenseQRDecomposition(  const Eigen::MatrixXd &J,
@@ -204,6 +211,7 @@ namespace GCS
         QRAlgorithm qrAlgorithm;
         DogLegGaussStep dogLegGaussStep;
         double qrpivotThreshold;
+        int sparseSolverThreshold; // number of parameters from which LM and DogLeg use a sparse jacobi, 0 to disable
         DebugMode debugMode;
         double LM_eps;
         double LM_eps1;
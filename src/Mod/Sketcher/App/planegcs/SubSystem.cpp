@@ -20,6 +20,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include "SubSystem.h"
@@ -44,6 +45,7 @@ SubSystem::SubSystem(std::vector<Constraint *> &clist_, VEC_pD &params,
 
 SubSystem::~SubSystem()
 {
+    clearBatches();
 }
 
 void SubSystem::initialize(VEC_pD &params, MAP_pD_pD &reductionmap)
@@ -126,6 +128,88 @@ void SubSystem::initialize(VEC_pD &params, MAP_pD_pD &reductionmap)
         }
 //        (*constr)->redirectParams(pmap); // redirect parameters to pvec
     }
+
+    // every constraint only depends on a few parameters, keep the structure
+    // of the jacobi matrix for the sparse solvers
+    std::vector<Eigen::Triplet<double> > entries;
+    for (int i=0; i < csize; i++) {
+        const VEC_pD &constr_params = c2p[clist[i]];
+        for (VEC_pD::const_iterator p=constr_params.begin();
+             p != constr_params.end(); ++p)
+            entries.push_back(Eigen::Triplet<double>(i, int(*p - &pvals[0]), 0.));
+    }
+    jacobiPattern.resize(csize, psize);
+    jacobiPattern.setFromTriplets(entries.begin(), entries.end());
+    jacobiPattern.makeCompressed();
+
+    residual.resize(csize);
+    initBatches(false);
+}
+
+void SubSystem::initBatches(bool batched)
+{
+    clearBatches();
+
+    // group the constraints by type, those without batched implementation are
+    // evaluated one by one (as all of them unless batched)
+    std::map<ConstraintType, ConstraintBatch *> typebatches;
+    for (int i=0; i < csize; i++) {
+        ConstraintType type = batched ? clist[i]->getTypeId() : None;
+        std::map<ConstraintType, ConstraintBatch *>::iterator it = typebatches.find(type);
+        if (it == typebatches.end()) {
+            it = typebatches.insert(std::make_pair(type, ConstraintBatch::create(type))).first;
+            if (it->second)
+                batches.push_back(it->second);
+        }
+        if (it->second)
+            it->second->add(clist[i], i);
+        else
+            unbatched.push_back(i);
+    }
+
+    // locate the jacobi entries of every constraint
+    std::vector<std::vector<JacobiEntry> > rowentries(csize);
+    for (int j=0; j < psize; j++) {
+        int nonzero = jacobiPattern.outerIndexPtr()[j];
+        for (Eigen::SparseMatrix<double>::InnerIterator it(jacobiPattern, j); it; ++it, ++nonzero) {
+            JacobiEntry entry = {int(it.row()), j, nonzero, &pvals[j]};
+            rowentries[it.row()].push_back(entry);
+        }
+    }
+
+    batchEntries.resize(batches.size());
+    for (std::size_t b=0; b < batches.size(); b++) {
+        ConstraintBatch *batch = batches[b];
+        int n = batch->size();
+        JacobiEntry none = {-1, -1, -1, 0};
+        batchEntries[b].assign(batch->paramCount()*n, none);
+        for (int slot=0; slot < batch->paramCount(); slot++) {
+            for (int i=0; i < n; i++) {
+                double *param = batch->getParam(slot, i);
+                const std::vector<JacobiEntry> &row = rowentries[batch->getTag(i)];
+                for (std::vector<JacobiEntry>::const_iterator entry=row.begin(); entry != row.end(); ++entry) {
+                    if (entry->param == param) {
+                        batchEntries[b][slot*n+i] = *entry;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    unbatchedEntries.clear();
+    for (std::vector<int>::const_iterator i=unbatched.begin(); i != unbatched.end(); ++i)
+        unbatchedEntries.insert(unbatchedEntries.end(), rowentries[*i].begin(), rowentries[*i].end());
+}
+
+void SubSystem::clearBatches()
+{
+    for (std::vector<ConstraintBatch *>::iterator batch=batches.begin(); batch != batches.end(); ++batch)
+        delete *batch;
+    batches.clear();
+    batchEntries.clear();
+    unbatched.clear();
+    unbatchedEntries.clear();
 }
 
 void SubSystem::redirectParams()
@@ -141,6 +225,9 @@ void SubSystem::redirectParams()
         (*constr)->revertParams();  // this line will normally not be necessary
         (*constr)->redirectParams(pmap);
     }
+
+    // the batches refer to the redirected parameters
+    initBatches(true);
 }
 
 void SubSystem::revertParams()
@@ -148,6 +235,8 @@ void SubSystem::revertParams()
     for (std::vector<Constraint *>::iterator constr=clist.begin();
          constr != clist.end(); ++constr)
         (*constr)->revertParams();
+
+    initBatches(false);
 }
 
 void SubSystem::getParamMap(MAP_pD_pD &pmapOut)
@@ -207,13 +296,8 @@ void SubSystem::getConstraintList(std::vector<Constraint *> &clist_)
 
 double SubSystem::error()
 {
-    double err = 0.;
-    for (std::vector<Constraint *>::const_iterator constr=clist.begin();
-         constr != clist.end(); ++constr) {
-        double tmp = (*constr)->error();
-        err += tmp*tmp;
-    }
-    err *= 0.5;
+    double err;
+    calcResidual(residual, err);
     return err;
 }
 
@@ -221,24 +305,19 @@ void SubSystem::calcResidual(Eigen::VectorXd &r)
 {
     assert(r.size() == csize);
 
-    int i=0;
-    for (std::vector<Constraint *>::const_iterator constr=clist.begin();
-         constr != clist.end(); ++constr, i++) {
-        r[i] = (*constr)->error();
-    }
+    for (std::vector<ConstraintBatch *>::const_iterator batch=batches.begin(); batch != batches.end(); ++batch)
+        (*batch)->errors(r.data());
+    for (std::vector<int>::const_iterator i=unbatched.begin(); i != unbatched.end(); ++i)
+        r[*i] = clist[*i]->error();
 }
 
 void SubSystem::calcResidual(Eigen::VectorXd &r, double &err)
 {
-    assert(r.size() == csize);
+    calcResidual(r);
 
-    int i=0;
     err = 0.;
-    for (std::vector<Constraint *>::const_iterator constr=clist.begin();
-         constr != clist.end(); ++constr, i++) {
-        r[i] = (*constr)->error();
+    for (int i=0; i < csize; i++)
         err += r[i]*r[i];
-    }
     err *= 0.5;
 }
 
@@ -272,7 +351,45 @@ void SubSystem::calcJacobi(VEC_pD &params, Eigen::MatrixXd &jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd &jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // only the entries of the adjacency lists are evaluated
+    jacobi.setZero(csize, psize);
+
+    for (std::size_t b=0; b < batches.size(); b++) {
+        batchValues.resize(batchEntries[b].size());
+        batches[b]->grads(&batchValues[0]);
+        for (std::size_t k=0; k < batchValues.size(); k++) {
+            const JacobiEntry &entry = batchEntries[b][k];
+            if (entry.row >= 0)
+                jacobi(entry.row, entry.col) += batchValues[k];
+        }
+    }
+    for (std::vector<JacobiEntry>::const_iterator entry=unbatchedEntries.begin();
+         entry != unbatchedEntries.end(); ++entry)
+        jacobi(entry->row, entry->col) = clist[entry->row]->grad(entry->param);
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double> &jacobi)
+{
+    // only the entries of the adjacency lists are evaluated
+    if (jacobi.rows() != csize || jacobi.cols() != psize ||
+        jacobi.nonZeros() != jacobiPattern.nonZeros() || !jacobi.isCompressed())
+        jacobi = jacobiPattern;
+
+    double *values = jacobi.valuePtr();
+    std::fill(values, values + jacobi.nonZeros(), 0.);
+
+    for (std::size_t b=0; b < batches.size(); b++) {
+        batchValues.resize(batchEntries[b].size());
+        batches[b]->grads(&batchValues[0]);
+        for (std::size_t k=0; k < batchValues.size(); k++) {
+            const JacobiEntry &entry = batchEntries[b][k];
+            if (entry.row >= 0)
+                values[entry.nonzero] += batchValues[k];
+        }
+    }
+    for (std::vector<JacobiEntry>::const_iterator entry=unbatchedEntries.begin();
+         entry != unbatchedEntries.end(); ++entry)
+        values[entry->nonzero] = clist[entry->row]->grad(entry->param);
 }
 
 void SubSystem::calcGrad(VEC_pD &params, Eigen::VectorXd &grad)
@@ -295,7 +412,12 @@ void SubSystem::calcGrad(VEC_pD &params, Eigen::VectorXd &grad)
 
 void SubSystem::calcGrad(Eigen::VectorXd &grad)
 {
-    calcGrad(plist, grad);
+    assert(grad.size() == psize);
+
+    // the gradient of the error is the residual multiplied by the jacobi matrix
+    calcResidual(residual);
+    calcJacobi(jacobiBuffer);
+    grad = jacobiBuffer.transpose() * residual;
 }
 
 double SubSystem::maxStep(VEC_pD &params, Eigen::VectorXd &xdir)
@@ -27,6 +27,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 #include "Constraints.h"
 
 namespace GCS
@@ -43,7 +44,24 @@ namespace GCS
 //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
         std::map<Constraint *,VEC_pD > c2p; // constraint to parameter adjacency list
         std::map<double *,std::vector<Constraint *> > p2c; // parameter to constraint adjacency list
+        Eigen::SparseMatrix<double> jacobiPattern; // non zero structure of the jacobi matrix, from c2p
+
+        // batched evaluation of the constraints (see ConstraintBatch), only while they are redirected to pvals
+        struct JacobiEntry {
+            int row, col, nonzero; // position in the jacobi matrix and index among the values of jacobiPattern
+            double *param;
+        };
+        std::vector<ConstraintBatch *> batches;     // tags of the batched constraints are their rows
+        std::vector<std::vector<JacobiEntry> > batchEntries; // per batch, one entry per gradient slot (row -1 if not a parameter of the subsystem)
+        std::vector<int> unbatched;                 // rows of the constraints evaluated one by one
+        std::vector<JacobiEntry> unbatchedEntries;  // their non zero jacobi entries
+        VEC_D batchValues;                          // output buffer of the batches
+        Eigen::VectorXd residual;                   // buffers for error() and calcGrad()
+        Eigen::SparseMatrix<double> jacobiBuffer;
+
         void initialize(VEC_pD &params, MAP_pD_pD &reductionmap); // called by the constructors
+        void initBatches(bool batched);
+        void clearBatches();
     public:
         SubSystem(std::vector<Constraint *> &clist_, VEC_pD &params);
         SubSystem(std::vector<Constraint *> &clist_, VEC_pD &params,
@@ -71,6 +89,7 @@ namespace GCS
         void calcResidual(Eigen::VectorXd &r, double &err);
         void calcJacobi(VEC_pD &params, Eigen::MatrixXd &jacobi);
         void calcJacobi(Eigen::MatrixXd &jacobi);
+        void calcJacobi(Eigen::SparseMatrix<double> &jacobi);
         void calcGrad(VEC_pD &params, Eigen::VectorXd &grad);
         void calcGrad(Eigen::VectorXd &grad);
 
@@ -53,6 +53,7 @@
 #define DEFAULT_RSOLVER 2           // DL=2, LM=1, BFGS=0
 #define DEFAULT_QRSOLVER 1          // DENSE=0, SPARSEQR=1
 #define QR_PIVOT_THRESHOLD 1E-13    // under this value a Jacobian value is regarded as zero
+#define SPARSE_SOLVER_THRESHOLD 100 // number of parameters from which LM and DL use a sparse Jacobian, 0=never
 #define DEFAULT_SOLVER_DEBUG 1      // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
 #define DEFAULT_DOGLEG_GAUSS_STEP 0   // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
@@ -79,6 +80,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch *sketc
     ui->lineEditConvergence->onRestore();
     ui->comboBoxQRMethod->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
+    ui->spinBoxSparseSolverThreshold->onRestore();
     ui->comboBoxRedundantDefaultSolver->onRestore();
     ui->spinBoxRedundantSolverMaxIterations->onRestore();
     ui->checkBoxRedundantSketchSizeMultiplier->onRestore();
@@ -475,6 +477,12 @@ void TaskSketcherSolverAdvanced::on_comboBoxQRMethod_currentIndexChanged(int ind
     ui->comboBoxQRMethod->onSave();
 }
 
+void TaskSketcherSolverAdvanced::on_spinBoxSparseSolverThreshold_valueChanged(int i)
+{
+    ui->spinBoxSparseSolverThreshold->onSave();
+    const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setSparseSolverThreshold(i);
+}
+
 void TaskSketcherSolverAdvanced::on_comboBoxRedundantDefaultSolver_currentIndexChanged(int index)
 {
     ui->comboBoxRedundantDefaultSolver->onSave();
@@ -509,6 +517,8 @@ void TaskSketcherSolverAdvanced::on_comboBoxDebugMode_currentIndexChanged(int in
 void TaskSketcherSolverAdvanced::on_pushButtonSolve_clicked(bool checked/* = false*/)
 {
     Q_UNUSED(checked);
+    // solver settings may have changed, so set up and diagnose the sketch again
+    sketchView->getSketchObject()->invalidateSolverSession();
     sketchView->getSketchObject()->solve();
 }
 
@@ -542,6 +552,7 @@ void TaskSketcherSolverAdvanced::on_pushButtonDefaults_clicked(bool checked/* =
     hGrp->SetASCII("RedundantConvergence",QString::number(CONVERGENCE).toUtf8());
     hGrp->SetInt("QRMethod",DEFAULT_QRSOLVER);
     hGrp->SetASCII("QRPivotThreshold",QString::number(QR_PIVOT_THRESHOLD).toUtf8());
+    hGrp->SetInt("SparseSolverThreshold",SPARSE_SOLVER_THRESHOLD);
     hGrp->SetInt("DebugMode",DEFAULT_SOLVER_DEBUG);
 
     ui->comboBoxDefaultSolver->onRestore();
@@ -551,6 +562,7 @@ void TaskSketcherSolverAdvanced::on_pushButtonDefaults_clicked(bool checked/* =
     ui->lineEditConvergence->onRestore();
     ui->comboBoxQRMethod->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
+    ui->spinBoxSparseSolverThreshold->onRestore();
     ui->comboBoxRedundantDefaultSolver->onRestore();
     ui->spinBoxRedundantSolverMaxIterations->onRestore();
     ui->checkBoxRedundantSketchSizeMultiplier->onRestore();
@@ -568,6 +580,7 @@ void TaskSketcherSolverAdvanced::updateSketchObject(void)
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).defaultSolverRedundant=(GCS::Algorithm) ui->comboBoxRedundantDefaultSolver->currentIndex();
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setQRAlgorithm((GCS::QRAlgorithm) ui->comboBoxQRMethod->currentIndex());
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setQRPivotThreshold(ui->lineEditQRPivotThreshold->text().toDouble());
+    const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setSparseSolverThreshold(ui->spinBoxSparseSolverThreshold->value());
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setConvergenceRedundant(ui->lineEditRedundantConvergence->text().toDouble());
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setConvergence(ui->lineEditConvergence->text().toDouble());
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setSketchSizeMultiplier(ui->checkBoxSketchSizeMultiplier->isChecked());
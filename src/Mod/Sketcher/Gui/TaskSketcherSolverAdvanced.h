@@ -53,6 +53,7 @@ private Q_SLOTS:
     void on_lineEditConvergence_editingFinished();
     void on_comboBoxQRMethod_currentIndexChanged(int index);
     void on_lineEditQRPivotThreshold_editingFinished();
+    void on_spinBoxSparseSolverThreshold_valueChanged(int i);
     void on_comboBoxRedundantDefaultSolver_currentIndexChanged(int index);
     void on_lineEditRedundantConvergence_editingFinished();
     void on_spinBoxRedundantSolverMaxIterations_valueChanged(int i);
@@ -0,0 +1,99 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Times the solver on sketches made of a single planegcs constraint type.
+
+    from SketcherTests import BatchBenchmark
+    BatchBenchmark.run()
+
+Each sketch holds pairs of lines tied by one sketcher constraint that maps to
+one of the constraint types the sub systems evaluate in batches: Horizontal
+(Equal), DistanceX (Difference), Distance of a line (P2PDistance),
+PointOnObject on a line (PointOnLine), Parallel and Perpendicular. The time
+is spent almost entirely in the residual and jacobian evaluation, so running
+it on builds with and without the batches compares the two.
+"""
+
+import time
+import FreeCAD, Part, Sketcher
+
+App = FreeCAD
+
+def horizontal(a, b):
+    return [Sketcher.Constraint('Horizontal', a), Sketcher.Constraint('Horizontal', b)]
+
+def distanceX(a, b):
+    return [Sketcher.Constraint('DistanceX', a, 1, a, 2, 6.0),
+            Sketcher.Constraint('DistanceX', b, 1, b, 2, 6.0)]
+
+def distance(a, b):
+    return [Sketcher.Constraint('Distance', a, 6.0), Sketcher.Constraint('Distance', b, 6.0)]
+
+def pointOnLine(a, b):
+    return [Sketcher.Constraint('PointOnObject', b, 1, a),
+            Sketcher.Constraint('PointOnObject', a, 2, b)]
+
+def parallel(a, b):
+    return [Sketcher.Constraint('Parallel', a, b)]
+
+def perpendicular(a, b):
+    return [Sketcher.Constraint('Perpendicular', a, b)]
+
+Types = [("Equal", horizontal), ("Difference", distanceX), ("P2PDistance", distance),
+         ("PointOnLine", pointOnLine), ("Parallel", parallel), ("Perpendicular", perpendicular)]
+
+def makeSketch(make, pairs):
+    """Return a Sketcher.Sketch of pairs of skewed lines constrained by make
+    and the number of its constraints"""
+    sketch = Sketcher.Sketch()
+    geos = []
+    cstrs = []
+    for i in range(pairs):
+        x = 20.0 * i
+        d = 0.1 * (i % 5 + 1)
+        geos.append(Part.LineSegment(App.Vector(x, 0), App.Vector(x + 5, d)))
+        geos.append(Part.LineSegment(App.Vector(x + 5 + d, -1), App.Vector(x + 7, 4)))
+        cstrs += make(2 * i, 2 * i + 1)
+    sketch.addGeometry(geos)
+    sketch.addConstraint(cstrs)
+    return sketch, len(cstrs)
+
+def timeType(make, pairs, repeat):
+    """Return the number of constraints and the best time of solving a fresh
+    sketch of pairs line pairs"""
+    best = None
+    for _ in range(repeat):
+        sketch, count = makeSketch(make, pairs)
+        start = time.time()
+        res = sketch.solve()
+        elapsed = time.time() - start
+        if res != 0:
+            App.Console.PrintWarning("Sketch of %d constraints not solved (%d)\n" % (count, res))
+        best = elapsed if best is None else min(best, elapsed)
+    return count, best
+
+def run(pairs=1000, repeat=3):
+    """Print the best solver time out of repeat runs for each constraint type"""
+    App.Console.PrintMessage("%14s %12s %10s %16s\n" % ("type", "constraints", "solve [s]", "per constraint [us]"))
+    for name, make in Types:
+        count, best = timeType(make, pairs, repeat)
+        App.Console.PrintMessage("%14s %12d %10.4f %16.2f\n" % (name, count, best, 1e6 * best / count))
@@ -0,0 +1,98 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Solves rows of constrained rectangles to time the sketch solver.
+
+    from SketcherTests import SolverBenchmark
+    SolverBenchmark.run()
+
+Every rectangle has 12 constraints. Two times are printed for each row
+length: solving the sketch object, which sets up and diagnoses the system
+first, and solving the same system again without the diagnosis.
+"""
+
+import time
+import FreeCAD, Part, Sketcher
+
+App = FreeCAD
+
+def addRectangles(sketch, count, width=10.0, height=5.0, gap=10.0):
+    """Add count rectangles in a row, slightly off their constrained position,
+    to a Sketcher.SketchObject or a Sketcher.Sketch"""
+    geos = []
+    cstrs = []
+    for r in range(count):
+        x = r * (width + gap)
+        # move the corners a bit, so that the solver has something to do
+        d = 0.1 * (r % 3)
+        corners = [App.Vector(x, 0), App.Vector(x + width + d, 0),
+                   App.Vector(x + width, height - d), App.Vector(x - d, height)]
+        i = len(geos)
+        for k in range(4):
+            geos.append(Part.LineSegment(corners[k], corners[(k + 1) % 4]))
+        for k in range(4):
+            cstrs.append(Sketcher.Constraint('Coincident', i + k, 2, i + (k + 1) % 4, 1))
+        cstrs.append(Sketcher.Constraint('Horizontal', i))
+        cstrs.append(Sketcher.Constraint('Horizontal', i + 2))
+        cstrs.append(Sketcher.Constraint('Vertical', i + 1))
+        cstrs.append(Sketcher.Constraint('Vertical', i + 3))
+        cstrs.append(Sketcher.Constraint('DistanceX', i, 1, i, 2, width))
+        cstrs.append(Sketcher.Constraint('DistanceY', i + 1, 1, i + 1, 2, height))
+        if r == 0:
+            cstrs.append(Sketcher.Constraint('DistanceX', i, 1, x))
+            cstrs.append(Sketcher.Constraint('DistanceY', i, 1, 0.0))
+        else:
+            cstrs.append(Sketcher.Constraint('DistanceX', i - 3, 1, i, 1, gap))
+            cstrs.append(Sketcher.Constraint('DistanceY', i - 4, 1, i, 1, 0.0))
+    sketch.addGeometry(geos)
+    sketch.addConstraint(cstrs)
+    return len(cstrs)
+
+def timeSketch(constraints):
+    """Return the number of constraints, the time of solving the sketch object
+    including the diagnosis, and of solving the same system only."""
+    doc = App.newDocument("SolverBenchmark")
+    try:
+        sketch = doc.addObject('Sketcher::SketchObject', 'Sketch')
+        count = addRectangles(sketch, max(1, constraints // 12))
+
+        start = time.time()
+        res = sketch.solve()
+        full = time.time() - start
+        if res != 0:
+            App.Console.PrintWarning("Sketch of %d constraints not solved (%d)\n" % (count, res))
+
+        solver = Sketcher.Sketch()
+        addRectangles(solver, max(1, constraints // 12))
+        start = time.time()
+        solver.solve()
+        solve = time.time() - start
+        return count, full, solve
+    finally:
+        App.closeDocument(doc.Name)
+
+def run(sizes=(100, 300, 1000, 3000, 10000)):
+    """Print the solver times for sketches with about the given numbers of constraints"""
+    App.Console.PrintMessage("%12s %18s %14s\n" % ("constraints", "diagnose+solve [s]", "solve [s]"))
+    for size in sizes:
+        count, full, solve = timeSketch(size)
+        App.Console.PrintMessage("%12d %18.3f %14.3f\n" % (count, full, solve))
@@ -140,6 +140,36 @@ class TestSketcherSolver(unittest.TestCase):
         self.Box.addConstraint(Sketcher.Constraint('DistanceY',1,2,-50.0))
         self.Doc.recompute()
 
+    def testRepeatedMovePoint(self):
+        # successive moves of the same point keep the solver session between calls
+        self.Box = self.Doc.addObject('Sketcher::SketchObject','SketchBox')
+        self.Box.addGeometry(Part.LineSegment(App.Vector(0,10,0),App.Vector(10,10,0)))
+        self.Box.addGeometry(Part.LineSegment(App.Vector(10,10,0),App.Vector(10,0,0)))
+        self.Box.addGeometry(Part.LineSegment(App.Vector(10,0,0),App.Vector(0,0,0)))
+        self.Box.addGeometry(Part.LineSegment(App.Vector(0,0,0),App.Vector(0,10,0)))
+        for i in range(4):
+            self.Box.addConstraint(Sketcher.Constraint('Coincident',i,2,(i+1)%4,1))
+        self.Box.addConstraint(Sketcher.Constraint('Horizontal',0))
+        self.Box.addConstraint(Sketcher.Constraint('Horizontal',2))
+        self.Box.addConstraint(Sketcher.Constraint('Vertical',1))
+        self.Box.addConstraint(Sketcher.Constraint('Vertical',3))
+        self.Box.addConstraint(Sketcher.Constraint('Coincident',2,2,-1,1))
+        self.Doc.recompute()
+        for x in range(11, 21):
+            self.Box.movePoint(0,2,App.Vector(x,x/2.0,0))
+        self.assertAlmostEqual(self.Box.getPoint(1,1).x, 20.0, 6)
+        self.assertAlmostEqual(self.Box.getPoint(1,1).y, 10.0, 6)
+        # a relative move starts from the current position
+        self.Box.movePoint(0,2,App.Vector(1,1,0),1)
+        self.assertAlmostEqual(self.Box.getPoint(0,2).x, 21.0, 6)
+        self.assertAlmostEqual(self.Box.getPoint(0,2).y, 11.0, 6)
+        # a topology change after moving is picked up by the solver
+        self.Box.addConstraint(Sketcher.Constraint('Distance',0,15.0))
+        self.assertEqual(self.Box.solve(), 0)
+        self.Doc.recompute()
+        self.assertAlmostEqual(self.Box.getPoint(0,2).x, 15.0, 6)
+        self.assertAlmostEqual(self.Box.getPoint(1,2).x, 15.0, 6)
+
     def testSlotCase(self):
         self.Slot = self.Doc.addObject('Sketcher::SketchObject','SketchSlot')
         CreateSlotPlateSet(self.Slot)
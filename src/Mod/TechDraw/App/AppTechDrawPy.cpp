@@ -70,6 +70,7 @@
 #include "DrawPagePy.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "EdgeWalker.h"
 #include "DrawUtil.h"
 #include "DrawProjGroup.h"
@@ -133,6 +134,12 @@ public:
         add_varargs_method("makeGeomHatch",&Module::makeGeomHatch,
             "makeGeomHatch(face, [patScale], [patName], [patFile]) -- draw a geom hatch on a given face, using optionally the given scale (default 1) and a given pattern name (ex. Diamond) and .pat file (the default pattern name and/or .pat files set in preferences are used if none are given). Returns a Part compound shape."
         );
+        add_varargs_method("getHLRCacheKeys",&Module::getHLRCacheKeys,
+            "getHLRCacheKeys() -- returns the keys of the cached HLR results, the most recently used first."
+        );
+        add_varargs_method("clearHLRCache",&Module::clearHLRCache,
+            "clearHLRCache() -- removes all cached HLR results."
+        );
         initialize("This is a module for making drawings"); // register with Python
     }
     virtual ~Module() {}
@@ -984,6 +991,29 @@ private:
         return Py::None();
     }
 
+    Py::Object getHLRCacheKeys(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+
+        Py::List result;
+        for (auto& key: HLRCache::instance().keys()) {
+            result.append(Py::String(key));
+        }
+        return result;
+    }
+
+    Py::Object clearHLRCache(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+
+        HLRCache::instance().clear();
+        return Py::None();
+    }
+
 
  };
 
@@ -31,9 +31,17 @@
 #include <cmath>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <Base/Exception.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 #include <Base/UnitsApi.h>
 
@@ -348,13 +356,28 @@ void DrawPage::updateAllViews()
     std::vector<App::DocumentObject*> featViews = getAllViews();
     std::vector<App::DocumentObject*>::iterator it = featViews.begin();
     //first, make sure all the Parts have been executed so GeometryObjects exist
-    for(; it != featViews.end(); ++it) {
-        TechDraw::DrawViewPart *part = dynamic_cast<TechDraw::DrawViewPart *>(*it);
-        TechDraw::DrawViewCollection *collect = dynamic_cast<TechDraw::DrawViewCollection*>(*it);
-        if (part != nullptr) {
-            part->recomputeFeature();
-        } else if (collect != nullptr) {
-            collect->recomputeFeature();
+    if (Preferences::parallelHLR() && Base::parallelThreadCount() > 1) {
+        //collections first, they may change the scale of their items
+        std::vector<TechDraw::DrawViewPart*> parts;
+        for(; it != featViews.end(); ++it) {
+            TechDraw::DrawViewPart *part = dynamic_cast<TechDraw::DrawViewPart *>(*it);
+            TechDraw::DrawViewCollection *collect = dynamic_cast<TechDraw::DrawViewCollection*>(*it);
+            if (part != nullptr) {
+                parts.push_back(part);
+            } else if (collect != nullptr) {
+                collect->recomputeFeature();
+            }
+        }
+        recomputeConcurrently(parts);
+    } else {
+        for(; it != featViews.end(); ++it) {
+            TechDraw::DrawViewPart *part = dynamic_cast<TechDraw::DrawViewPart *>(*it);
+            TechDraw::DrawViewCollection *collect = dynamic_cast<TechDraw::DrawViewCollection*>(*it);
+            if (part != nullptr) {
+                part->recomputeFeature();
+            } else if (collect != nullptr) {
+                collect->recomputeFeature();
+            }
         }
     }
     //second, make sure all the Dimensions have been executed so Measurements have References
@@ -383,6 +406,79 @@ void DrawPage::updateAllViews()
 
 }
 
+//! recompute the parts with the hidden line removal running on worker threads. each part
+//! is recomputed on this thread as soon as its projection is finished. parts which
+//! can't be projected in advance (sections, details) are recomputed afterwards.
+void DrawPage::recomputeConcurrently(const std::vector<DrawViewPart*>& parts)
+{
+    std::vector<DrawViewPart*> prepared;
+    std::vector<DrawViewPart*> others;
+    for (auto& part: parts) {
+        if (part->prepareProjection()) {
+            prepared.push_back(part);
+        } else {
+            others.push_back(part);
+        }
+    }
+
+    std::atomic<std::size_t> next(0);
+    std::mutex mutex;
+    std::condition_variable finishedChanged;
+    std::deque<std::size_t> finished;
+    auto work = [&]() {
+        for (std::size_t i = next++; i < prepared.size(); i = next++) {
+            prepared[i]->runProjection();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.push_back(i);
+            }
+            finishedChanged.notify_one();
+        }
+    };
+
+    std::size_t threads = std::min(prepared.size(),
+                                   static_cast<std::size_t>(Base::parallelThreadCount()));
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threads; i++) {
+        workers.emplace_back(work);
+    }
+
+    std::exception_ptr error;
+    for (std::size_t done = 0; done < prepared.size(); done++) {
+        std::size_t i;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finishedChanged.wait(lock, [&finished]() { return !finished.empty(); });
+            i = finished.front();
+            finished.pop_front();
+        }
+        prepared[i]->reportProjection();
+        if (error) {
+            continue;
+        }
+        try {
+            prepared[i]->recomputeFeature();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        prepared[i]->clearProjection();
+    }
+    for (auto& worker: workers) {
+        worker.join();
+    }
+    if (error) {
+        for (auto& part: prepared) {
+            part->clearProjection();
+        }
+        std::rethrow_exception(error);
+    }
+
+    for (auto& part: others) {
+        part->recomputeFeature();
+    }
+}
+
 std::vector<App::DocumentObject*> DrawPage::getAllViews(void) 
 {
     auto views = Views.getValues();   //list of docObjects
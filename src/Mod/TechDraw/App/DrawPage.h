@@ -119,6 +119,8 @@ private:
     bool nowUnsetting;
     static App::PropertyFloatConstraint::Constraints scaleRange;
 
+    void recomputeConcurrently(const std::vector<DrawViewPart*>& parts);
+
 };
 
 typedef App::FeaturePythonT<DrawPage> DrawPagePython;
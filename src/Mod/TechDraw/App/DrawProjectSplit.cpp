@@ -65,6 +65,7 @@
 #include <limits>
 #include <algorithm>
 #include <cmath>
+#include <unordered_map>
 #include <GeomLib_Tool.hxx>
 
 #include <App/Application.h>
@@ -88,6 +89,48 @@
 using namespace TechDraw;
 using namespace std;
 
+namespace {
+//bounding box of an edge, including the gap
+struct edgeBox {
+    int i;
+    double xMin, yMin, zMin;
+    double xMax, yMax, zMax;
+};
+
+//end vertex of an edge
+struct edgeEnd {
+    int i;
+    TopoDS_Vertex v;
+    gp_Pnt pnt;
+};
+
+//cell of a hash grid
+struct cellKey {
+    long long x, y, z;
+    bool operator==(const cellKey& other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+struct cellHash {
+    std::size_t operator()(const cellKey& key) const {
+        std::size_t seed = std::hash<long long>()(key.x);
+        seed ^= std::hash<long long>()(key.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        seed ^= std::hash<long long>()(key.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+cellKey cellOf(const Base::Vector3d& v, double cellSize)
+{
+    cellKey key;
+    key.x = static_cast<long long>(std::floor(v.x / cellSize));
+    key.y = static_cast<long long>(std::floor(v.y / cellSize));
+    key.z = static_cast<long long>(std::floor(v.z / cellSize));
+    return key;
+}
+}
+
 
 //===========================================================================
 // DrawProjectSplit
@@ -138,6 +181,7 @@ TechDraw::GeometryObject* DrawProjectSplit::buildGeometryObject(TopoDS_Shape sha
         geometryObject->projectShape(shape,
             viewAxis);
     }
+    TechDraw::GeometryObject::printMessages(geometryObject->takeMessages());
         
     geometryObject->extractGeometry(TechDraw::ecHARD,                   //always show the hard&outline visible lines
                                     true);
@@ -170,63 +214,7 @@ std::vector<TopoDS_Edge> DrawProjectSplit::getEdges(TechDraw::GeometryObject* ge
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = origEdges.begin();
-    int iOuter = 0;
-    for (; itOuter != origEdges.end(); ++itOuter, iOuter++) {
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::Add(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            Base::Console().Message("DPS::Extract Faces - outer Bnd_Box is void\n");
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            Base::Console().Message("DPS::extractFaces - outerEdge: %d is ZeroEdge\n",iOuter);   //this is not finding ZeroEdges
-            continue;  //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = faceEdges.begin();
-        for (; itInner != faceEdges.end(); ++itInner,iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;  //skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::Add(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                Base::Console().Log("INFO - DPS::Extract Faces - inner Bnd_Box is void\n");
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {      //bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (isOnEdge((*itInner),v1,param,false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(),pnt1.Y(),pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (isOnEdge((*itInner),v2,param,false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(),pnt2.Y(),pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        } //inner loop
-    }   //outer loop
+    std::vector<splitPoint> splits = findSplitPoints(faceEdges);
 
     std::vector<splitPoint> sorted = sortSplits(splits,true);
     auto last = std::unique(sorted.begin(), sorted.end(), DrawProjectSplit::splitEqual);  //duplicates to back
@@ -241,24 +229,103 @@ std::vector<TopoDS_Edge> DrawProjectSplit::getEdges(TechDraw::GeometryObject* ge
 }
 
 
+//! find the vertices of edges which touch another edge between its ends.
+//! the bounding boxes of the edges are computed once. the boxes and the vertices are swept
+//! along x, so a vertex is only checked against the edges whose box contains it.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<splitPoint> splits;
+    std::vector<edgeBox> boxes;
+    std::vector<edgeEnd> ends;
+    boxes.reserve(edges.size());
+    ends.reserve(2 * edges.size());
+
+    int iEdge = 0;
+    for (auto& e: edges) {
+        Bnd_Box sBox;
+        BRepBndLib::Add(e, sBox);
+        sBox.SetGap(0.1);
+        if (sBox.IsVoid()) {
+            Base::Console().Log("INFO - DPS::findSplitPoints - Bnd_Box is void for edge: %d\n", iEdge);
+        } else if (DrawUtil::isZeroEdge(e)) {
+            Base::Console().Log("DPS::findSplitPoints - edge: %d is ZeroEdge\n", iEdge);  //shouldn't happen ;)
+        } else {
+            edgeBox box;
+            box.i = iEdge;
+            sBox.Get(box.xMin, box.yMin, box.zMin, box.xMax, box.yMax, box.zMax);
+            boxes.push_back(box);
+
+            edgeEnd end;
+            end.i = iEdge;
+            end.v = TopExp::FirstVertex(e);
+            end.pnt = BRep_Tool::Pnt(end.v);
+            ends.push_back(end);
+            end.v = TopExp::LastVertex(e);
+            end.pnt = BRep_Tool::Pnt(end.v);
+            ends.push_back(end);
+        }
+        iEdge++;
+    }
+
+    std::sort(boxes.begin(), boxes.end(),
+              [](const edgeBox& b1, const edgeBox& b2) { return b1.xMin < b2.xMin; });
+    std::sort(ends.begin(), ends.end(),
+              [](const edgeEnd& e1, const edgeEnd& e2) { return e1.pnt.X() < e2.pnt.X(); });
+
+    std::vector<const edgeBox*> active;                     //boxes spanning the current x
+    std::size_t nextBox = 0;
+    for (auto& end: ends) {
+        double x = end.pnt.X();
+        for (; nextBox < boxes.size() && boxes[nextBox].xMin <= x; nextBox++) {
+            active.push_back(&boxes[nextBox]);
+        }
+        //boxes ending before this vertex can't contain any of the following vertices
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [x](const edgeBox* b) { return b->xMax < x; }),
+                     active.end());
+
+        for (auto box: active) {
+            if (box->i == end.i) {
+                continue;
+            }
+            if (end.pnt.Y() < box->yMin || end.pnt.Y() > box->yMax ||
+                end.pnt.Z() < box->zMin || end.pnt.Z() > box->zMax) {
+                continue;
+            }
+            double param = -1;
+            if (isOnEdge(edges[box->i], end.v, param, false, false)) {
+                splitPoint s;
+                s.i = box->i;
+                s.v = Base::Vector3d(end.pnt.X(), end.pnt.Y(), end.pnt.Z());
+                s.param = param;
+                splits.push_back(s);
+            }
+        }
+    }
+    return splits;
+}
+
 //this routine is the big time consumer.  gets called many times (and is slow?))
 //note param gets modified here
-bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds)
+//checkBox = false if the caller already knows that v is inside the bounding box of e
+bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds, bool checkBox)
 {
     bool result = false;
     bool outOfBox = false;
     param = -2;
 
     //eliminate obvious cases
-    Bnd_Box sBox;
-    BRepBndLib::Add(e, sBox);
-    sBox.SetGap(0.1);
-    if (sBox.IsVoid()) {
-        Base::Console().Message("DPS::isOnEdge - Bnd_Box is void\n");
-    } else {
-        gp_Pnt pt = BRep_Tool::Pnt(v);
-        if (sBox.IsOut(pt)) {
-            outOfBox = true;
+    if (checkBox) {
+        Bnd_Box sBox;
+        BRepBndLib::Add(e, sBox);
+        sBox.SetGap(0.1);
+        if (sBox.IsVoid()) {
+            Base::Console().Message("DPS::isOnEdge - Bnd_Box is void\n");
+        } else {
+            gp_Pnt pt = BRep_Tool::Pnt(v);
+            if (sBox.IsOut(pt)) {
+                outOfBox = true;
+            }
         }
     }
     if (!outOfBox) {
@@ -441,16 +508,33 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeDuplicateEdges(std::vector<Topo
         idx++;
     }
 
-    std::vector<edgeSortItem> sorted = sortEdges(temp,true);
-    auto last = std::unique(sorted.begin(), sorted.end(), edgeSortItem::edgeEqual);  //duplicates to back
-    sorted.erase(last, sorted.end());                         //remove dupls
-
-    //TODO: "sorted" turns to garbage if pagescale set to "0.1"!!!!???? ***
-    for (auto e: sorted) {
-        if (e.idx < inEdges.size()) {
-            result.push_back(inEdges.at(e.idx));                  //<<< ***here
-        } else {
-            Base::Console().Message("ERROR - DPS::removeDuplicateEdges - access: %d inEdges: %d\n",e.idx,inEdges.size());
+    //the kept edges are hashed by their start point. a duplicate starts within
+    //Precision::Confusion(), so only the neighbouring cells have to be searched.
+    double cellSize = Precision::Confusion();
+    std::unordered_map<cellKey, std::vector<unsigned int>, cellHash> cells;
+    cells.reserve(temp.size());
+    for (auto& item: temp) {
+        cellKey key = cellOf(item.start, cellSize);
+        bool duplicate = false;
+        for (long long dx = -1; dx <= 1 && !duplicate; dx++) {
+            for (long long dy = -1; dy <= 1 && !duplicate; dy++) {
+                for (long long dz = -1; dz <= 1 && !duplicate; dz++) {
+                    auto it = cells.find(cellKey{key.x + dx, key.y + dy, key.z + dz});
+                    if (it == cells.end()) {
+                        continue;
+                    }
+                    for (auto kept: it->second) {
+                        if (edgeSortItem::edgeEqual(temp[kept], item)) {
+                            duplicate = true;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        if (!duplicate) {
+            cells[key].push_back(item.idx);
+            result.push_back(inEdges.at(item.idx));
         }
     }
     return result;
@@ -64,6 +64,8 @@ public:
 
     virtual short mustExecute() const override;
     virtual App::DocumentObjectExecReturn *execute(void) override;
+    //the detail is cut and projected by execute()
+    virtual bool canProjectConcurrently(void) const override { return false; }
     virtual void onChanged(const App::Property* prop) override;
     virtual const char* getViewProviderName(void) const override {
         return "TechDrawGui::ViewProviderViewPart";
@@ -65,6 +65,8 @@ public:
     //@{
     /// recalculate the Feature
     virtual App::DocumentObjectExecReturn *execute(void) override;
+    //the fused sources are projected by execute()
+    virtual bool canProjectConcurrently(void) const override { return false; }
     virtual void onChanged(const App::Property* prop) override;
     //@}
 
@@ -57,6 +57,7 @@
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
 #include <HLRBRep_ShapeBounds.hxx>
+#include <Precision.hxx>
 #include <ShapeExtend_WireData.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <ShapeFix_Wire.hxx>
@@ -78,6 +79,7 @@
 #include <limits>
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 
 #include <App/Application.h>
 #include <App/Document.h>
@@ -108,6 +110,7 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "LineGroup.h"
 #include "ShapeExtractor.h"
 
@@ -116,6 +119,21 @@
 using namespace TechDraw;
 using namespace std;
 
+//! the input and the result of a projection made by runProjection()
+struct DrawViewPart::Projection
+{
+    std::unique_ptr<GeometryObject> go;
+    TopoDS_Shape centeredShape;
+    TopoDS_Shape shape;                  //centered, scaled and rotated
+    gp_Ax2 viewAxis;
+    Base::Vector3d centroid;
+    double scale;
+    double rotation;
+    bool done;
+    bool failed;
+    std::vector<GeometryObject::Message> messages;      //printed by reportProjection()
+};
+
 
 //===========================================================================
 // DrawViewPart
@@ -169,6 +187,14 @@ DrawViewPart::DrawViewPart(void) :
     ADD_PROPERTY_TYPE(IsoHidden ,(prefIsoHid()),sgroup,App::Prop_None,"Show Hidden Iso u,v lines");
     ADD_PROPERTY_TYPE(IsoCount ,(prefIsoCount()),sgroup,App::Prop_None,"Number of iso parameters lines");
 
+    //HLR result saved with the document, see Preferences::saveHLRCache
+    ADD_PROPERTY_TYPE(HLRCacheKey ,(""),sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden | App::Prop_NoRecompute),
+                      "Key of the saved HLR result");
+    ADD_PROPERTY_TYPE(HLRCacheResult ,(TopoDS_Shape()),sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden | App::Prop_NoRecompute),
+                      "Saved HLR result");
+
     geometryObject = nullptr;
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
@@ -342,6 +368,13 @@ void DrawViewPart::onChanged(const App::Property* prop)
         Direction.setValue(Base::Vector3d(0.0, -1.0, 0.0));
     }
 
+    //a saved HLR result is made available to all views
+    if (prop == &HLRCacheResult) {
+        if (!HLRCacheKey.isEmpty() && !HLRCacheResult.getValue().IsNull()) {
+            HLRCache::instance().insert(HLRCacheKey.getStrValue(), HLRCacheResult.getValue());
+        }
+    }
+
     DrawView::onChanged(prop);
 
 //TODO: when scale changes, any Dimensions for this View sb recalculated.  DVD should pick this up subject to topological naming issues.
@@ -420,6 +453,18 @@ GeometryObject* DrawViewPart::makeGeometryForShape(TopoDS_Shape shape)
                             inputCenter.Y(),
                             inputCenter.Z());
 
+    //the projection may already have been made on a worker thread
+    if (isProjectionValid(viewAxis, centroid)) {
+        m_saveCentroid = centroid;
+        m_saveShape = m_projection->centeredShape;
+        GeometryObject* go = m_projection->go.release();
+        clearProjection();
+        extractGeometry(go);
+        storeHLRResult(go);
+        return go;
+    }
+    clearProjection();
+
     //center shape on origin
     TopoDS_Shape centeredShape = TechDraw::moveShape(shape,
                                                      centroid * -1.0);
@@ -434,19 +479,83 @@ GeometryObject* DrawViewPart::makeGeometryForShape(TopoDS_Shape shape)
                                             Rotation.getValue());  //conventional rotation
      }
 //    BRepTools::Write(scaledShape, "DVPScaled.brep");            //debug
-    GeometryObject* go =  buildGeometryObject(scaledShape,viewAxis);
-    return go;
+    GeometryObject* go = newGeometryObject();
+    setHLRSource(go, centroid);
+    return buildGeometryObject(go, scaledShape, viewAxis);
 }
 
 //note: slightly different than routine with same name in DrawProjectSplit
 TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape, gp_Ax2 viewAxis)
+{
+    return buildGeometryObject(newGeometryObject(), shape, viewAxis);
+}
+
+//! project the shape with a set up GeometryObject and extract the geometry of the view
+TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TechDraw::GeometryObject* go,
+                                                            const TopoDS_Shape& shape,
+                                                            const gp_Ax2& viewAxis)
+{
+    projectGeometry(go, shape, viewAxis);
+    GeometryObject::printMessages(go->takeMessages());
+    extractGeometry(go);
+    storeHLRResult(go);
+    return go;
+}
+
+//! key the HLR result on the sources of the view and on how they are centered, scaled and
+//! rotated. the hashes of the sources are kept by the HLRCache, the projected copy is new.
+void DrawViewPart::setHLRSource(TechDraw::GeometryObject* go, const Base::Vector3d& centroid) const
+{
+    std::vector<TopoDS_Shape> sources;
+    for (auto& obj: getAllSources()) {
+        TopoDS_Shape shape = Part::Feature::getShape(obj);
+        if (shape.IsNull()) {
+            return;             //hash the projected shape instead
+        }
+        sources.push_back(shape);
+    }
+    std::stringstream transform;
+    transform << std::setprecision(12);
+    transform << "C" << centroid.x << " " << centroid.y << " " << centroid.z;
+    transform << " S" << getScale() << " R" << Rotation.getValue();
+    go->setHLRSource(sources, transform.str());
+}
+
+//! keep the HLR result in the document, so it isn't projected again on opening
+void DrawViewPart::storeHLRResult(TechDraw::GeometryObject* go)
+{
+    if (!Preferences::saveHLRCache()) {
+        if (!HLRCacheKey.isEmpty()) {
+            HLRCacheKey.setValue("");
+            HLRCacheResult.setValue(TopoDS_Shape());
+        }
+        return;
+    }
+
+    std::string key = go->getHLRKey();
+    if (key.empty() || key == HLRCacheKey.getStrValue()) {
+        return;
+    }
+    HLRCacheKey.setValue(key);
+    HLRCacheResult.setValue(go->getHLRResult());
+}
+
+//! a GeometryObject set up with the HLR parameters of this view
+TechDraw::GeometryObject* DrawViewPart::newGeometryObject(void)
 {
     TechDraw::GeometryObject* go = new TechDraw::GeometryObject(getNameInDocument(), this);
     go->setIsoCount(IsoCount.getValue());
     go->isPerspective(Perspective.getValue());
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
+    go->partitionSolids(Preferences::partitionPolygonHLR());
+    HLRCache::instance().setMaxSize(std::max(0, Preferences::hlrCacheSize()));
+    return go;
+}
 
+//! run the hidden line removal. this doesn't use the view, so it may run on any thread.
+void DrawViewPart::projectGeometry(TechDraw::GeometryObject* go, const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
     if (go->usePolygonHLR()){
         go->projectShapeWithPolygonAlgo(shape,
             viewAxis);
@@ -455,7 +564,11 @@ TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape,
         go->projectShape(shape,
             viewAxis);
     }
+}
 
+//! make the edges and vertices of the view from the projected shape
+void DrawViewPart::extractGeometry(TechDraw::GeometryObject* go)
+{
     go->extractGeometry(TechDraw::ecHARD,                   //always show the hard&outline visible lines
                         true);
     go->extractGeometry(TechDraw::ecOUTLINE,
@@ -496,7 +609,119 @@ TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape,
         Base::Console().Log("DVP::buildGO - NO extracted edges!\n");
     }
     bbox = go->calcBoundingBox();
-    return go;
+}
+
+bool DrawViewPart::canProjectConcurrently(void) const
+{
+    return true;
+}
+
+//! collect the input of the projection for runProjection(). returns false if there
+//! is nothing to project.
+bool DrawViewPart::prepareProjection(void)
+{
+    clearProjection();
+    if (!keepUpdated() || !canProjectConcurrently()) {
+        return false;
+    }
+    if (getAllSources().empty()) {
+        return false;
+    }
+    TopoDS_Shape shape = getSourceShape();
+    if (shape.IsNull()) {
+        return false;
+    }
+
+    std::unique_ptr<Projection> projection(new Projection);
+    projection->viewAxis = getProjectionCS(Base::Vector3d(0.0,0.0,0.0));
+    gp_Pnt inputCenter = TechDraw::findCentroid(shape,
+                                                projection->viewAxis);
+    projection->centroid = Base::Vector3d(inputCenter.X(),
+                                          inputCenter.Y(),
+                                          inputCenter.Z());
+    projection->centeredShape = TechDraw::moveShape(shape,
+                                                    projection->centroid * -1.0);
+    projection->scale = getScale();
+    projection->rotation = Rotation.getValue();
+    projection->shape = TechDraw::scaleShape(projection->centeredShape,
+                                             projection->scale);
+    if (!DrawUtil::fpCompare(projection->rotation,0.0)) {
+        projection->shape = TechDraw::rotateShape(projection->shape,
+                                                  projection->viewAxis,
+                                                  projection->rotation);
+    }
+    projection->go.reset(newGeometryObject());
+    setHLRSource(projection->go.get(), projection->centroid);
+    //the mesh is stored in the source shape, which may be shared by other views
+    if (projection->go->usePolygonHLR() && !projection->go->isPerspective()) {
+        projection->go->meshForPolygonAlgo(projection->shape);
+    }
+    projection->done = false;
+    projection->failed = false;
+    m_projection = std::move(projection);
+    return true;
+}
+
+//! run the projection set up by prepareProjection(). this only uses the prepared input,
+//! so it may run on a worker thread.
+void DrawViewPart::runProjection(void)
+{
+    if (!m_projection || m_projection->done) {
+        return;
+    }
+    GeometryObject* go = m_projection->go.get();
+    //the views are already projected in parallel
+    go->projectSerially(true);
+    try {
+        projectGeometry(go, m_projection->shape, m_projection->viewAxis);
+        m_projection->messages = go->takeMessages();
+    }
+    catch (...) {
+        m_projection->messages = go->takeMessages();
+        m_projection->failed = true;
+        m_projection->go.reset();          //execute will try again
+    }
+    m_projection->done = true;
+}
+
+//! print the console output of runProjection(). call this on the main thread.
+void DrawViewPart::reportProjection(void)
+{
+    if (!m_projection || !m_projection->done) {
+        return;
+    }
+    GeometryObject::printMessages(m_projection->messages);
+    m_projection->messages.clear();
+    if (m_projection->failed) {
+        Base::Console().Log("DVP - %s - concurrent projection failed, projecting again\n",
+                            getNameInDocument());
+        m_projection->failed = false;
+    }
+}
+
+void DrawViewPart::clearProjection(void)
+{
+    m_projection.reset();
+}
+
+//! true if the result of runProjection() was made with the current input
+bool DrawViewPart::isProjectionValid(const gp_Ax2& viewAxis, const Base::Vector3d& centroid)
+{
+    if (!m_projection || !m_projection->done || !m_projection->go) {
+        return false;
+    }
+    const Projection& p = *m_projection;
+    GeometryObject* go = p.go.get();
+    return p.viewAxis.Location().IsEqual(viewAxis.Location(), Precision::Confusion()) &&
+           p.viewAxis.Direction().IsEqual(viewAxis.Direction(), Precision::Angular()) &&
+           p.viewAxis.XDirection().IsEqual(viewAxis.XDirection(), Precision::Angular()) &&
+           p.centroid.IsEqual(centroid, Precision::Confusion()) &&
+           DrawUtil::fpCompare(p.scale, getScale()) &&
+           DrawUtil::fpCompare(p.rotation, Rotation.getValue()) &&
+           go->getIsoCount() == IsoCount.getValue() &&
+           go->isPerspective() == Perspective.getValue() &&
+           DrawUtil::fpCompare(go->getFocus(), Focus.getValue()) &&
+           go->usePolygonHLR() == CoarseView.getValue();
 }
 
 //! make faces from the existing edge geometry
@@ -526,63 +751,7 @@ void DrawViewPart::extractFaces()
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {    //*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::Add(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            Base::Console().Log("DVP::Extract Faces - outer Bnd_Box is void for %s\n",getNameInDocument());
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            Base::Console().Log("DVP::extractFaces - outerEdge: %d is ZeroEdge\n",iOuter);   //this is not finding ZeroEdges
-            continue;  //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();   //***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner,iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;  //skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::Add(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                Base::Console().Log("INFO - DVP::Extract Faces - inner Bnd_Box is void for %s\n",getNameInDocument());
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {      //bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner),v1,param,false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(),pnt1.Y(),pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner),v2,param,false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(),pnt2.Y(),pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        } //inner loop
-    }   //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits,true);
     auto last = std::unique(sorted.begin(), sorted.end(), DrawProjectSplit::splitEqual);  //duplicates to back
@@ -25,6 +25,8 @@
 #ifndef _DrawViewPart_h_
 #define _DrawViewPart_h_
 
+#include <memory>
+
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
@@ -37,6 +39,8 @@
 
 #include <Base/BoundBox.h>
 
+#include <Mod/Part/App/PropertyTopoShape.h>
+
 #include "PropertyGeomFormatList.h"
 #include "PropertyCenterLineList.h"
 #include "PropertyCosmeticEdgeList.h"
@@ -112,6 +116,9 @@ public:
     App::PropertyBool   IsoHidden;
     App::PropertyInteger  IsoCount;
 
+    App::PropertyString      HLRCacheKey;
+    Part::PropertyPartShape  HLRCacheResult;
+
     virtual short mustExecute() const override;
     virtual void onDocumentRestored() override;
     virtual App::DocumentObjectExecReturn *execute(void) override;
@@ -205,6 +212,20 @@ public:
 
     std::vector<App::DocumentObject*> getAllSources(void) const;
 
+    /** @name Concurrent projection
+     * DrawPage::updateAllViews() runs the hidden line removal of its views on worker
+     * threads. prepareProjection() collects the input on the main thread, runProjection()
+     * may run on any thread and the next execute() uses its result if the input is unchanged.
+     * runProjection() doesn't print, reportProjection() prints its output on the main thread.
+     */
+    //@{
+    virtual bool canProjectConcurrently(void) const;
+    bool prepareProjection(void);
+    void runProjection(void);
+    void reportProjection(void);
+    void clearProjection(void);
+    //@}
+
 
 protected:
     bool checkXDirection(void) const;
@@ -217,6 +238,13 @@ protected:
 
     virtual TechDraw::GeometryObject*  buildGeometryObject(TopoDS_Shape shape, gp_Ax2 viewAxis); //const??
     virtual TechDraw::GeometryObject*  makeGeometryForShape(TopoDS_Shape shape);   //const??
+    TechDraw::GeometryObject* newGeometryObject(void);
+    TechDraw::GeometryObject* buildGeometryObject(TechDraw::GeometryObject* go, const TopoDS_Shape& shape,
+                                                  const gp_Ax2& viewAxis);
+    void setHLRSource(TechDraw::GeometryObject* go, const Base::Vector3d& centroid) const;
+    void extractGeometry(TechDraw::GeometryObject* go);
+    static void projectGeometry(TechDraw::GeometryObject* go, const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
+    void storeHLRResult(TechDraw::GeometryObject* go);
     void partExec(TopoDS_Shape shape);
     virtual void addShapes2d(void);
 
@@ -247,6 +275,10 @@ protected:
 private:
     bool nowUnsetting;
 
+    struct Projection;
+    std::unique_ptr<Projection> m_projection;
+    bool isProjectionValid(const gp_Ax2& viewAxis, const Base::Vector3d& centroid);
+
 };
 
 typedef App::FeaturePythonT<DrawViewPart> DrawViewPartPython;
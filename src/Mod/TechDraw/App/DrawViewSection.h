@@ -84,6 +84,8 @@ public:
     bool isReallyInBox (const gp_Pnt p, const Bnd_Box& bb) const;
 
     virtual App::DocumentObjectExecReturn *execute(void) override;
+    //the section is cut and projected by execute()
+    virtual bool canProjectConcurrently(void) const override { return false; }
     virtual void onChanged(const App::Property* prop) override;
     virtual const char* getViewProviderName(void) const override {
         return "TechDrawGui::ViewProviderViewSection";
@@ -63,21 +63,26 @@
 #include <TopoDS_Face.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS_Iterator.hxx>
 
 #endif  // #ifndef _PreComp_
 
 #include <algorithm>
 #include <chrono>
+#include <cstdarg>
+#include <cstdio>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Tools.h>
 
 #include <Mod/Part/App/PartFeature.h>
 
 #include "DrawUtil.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "DrawViewPart.h"
 #include "DrawViewDetail.h"
 
@@ -89,13 +94,180 @@ struct EdgePoints {
     TopoDS_Edge edge;
 };
 
+namespace {
+//edges found by the polygon algo, not yet inverted
+struct PolygonEdges {
+    TopoDS_Shape visHard;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidOutline;
+    std::vector<GeometryObject::Message> errors;
+    bool failed = false;
+};
+
+std::string formatMessage(const char* format, va_list args)
+{
+    va_list copy;
+    va_copy(copy, args);
+    int size = std::vsnprintf(nullptr, 0, format, copy);
+    va_end(copy);
+    if (size < 0) {
+        return std::string();
+    }
+    std::vector<char> buffer(static_cast<std::size_t>(size) + 1);
+    std::vsnprintf(buffer.data(), buffer.size(), format, args);
+    return std::string(buffer.data(), static_cast<std::size_t>(size));
+}
+
+void addError(PolygonEdges& result, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    result.errors.push_back({true, formatMessage(format, args)});
+    va_end(args);
+    result.failed = true;
+}
+
+//the solids of a shape, and a compound of the faces outside of any solid
+std::vector<TopoDS_Shape> partitionBySolid(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Shape> parts;
+    TopExp_Explorer solids(shape, TopAbs_SOLID);
+    for (; solids.More(); solids.Next()) {
+        parts.push_back(solids.Current());
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound rest;
+    builder.MakeCompound(rest);
+    bool haveRest = false;
+    TopExp_Explorer faces(shape, TopAbs_FACE, TopAbs_SOLID);
+    for (; faces.More(); faces.Next()) {
+        builder.Add(rest, faces.Current());
+        haveRest = true;
+    }
+    if (haveRest) {
+        parts.push_back(rest);
+    }
+    return parts;
+}
+
+//project a meshed shape. this doesn't modify the shape, so it may run on any thread.
+PolygonEdges projectWithPolygonAlgo(const TopoDS_Shape& shape, const gp_Ax2& viewAxis,
+                                    bool isPersp, double focus, const std::string& parentName)
+{
+    PolygonEdges result;
+    Handle(HLRBRep_PolyAlgo) brep_hlrPoly = NULL;
+
+    try {
+        brep_hlrPoly = new HLRBRep_PolyAlgo();
+        brep_hlrPoly->Load(shape);
+
+        if (isPersp) {
+            double fLength = std::max(Precision::Confusion(), focus);
+            HLRAlgo_Projector projector(viewAxis, fLength);
+            brep_hlrPoly->Projector(projector);
+        }
+        else { // non perspective
+            HLRAlgo_Projector projector(viewAxis);
+            brep_hlrPoly->Projector(projector);
+        }
+        brep_hlrPoly->Update();
+    }
+    catch (const Standard_Failure& e) {
+        addError(result, "GO::projectShapeWithPolygonAlgo - OCC error - %s - while projecting shape for %s\n",
+                 e.GetMessageString(), parentName.c_str());
+    }
+    catch (...) {
+        addError(result, "GO::projectShapeWithPolygonAlgo - unknown error while projecting shape for %s\n",
+                 parentName.c_str());
+    }
+
+    try {
+        HLRBRep_PolyHLRToShape polyhlrToShape;
+        polyhlrToShape.Update(brep_hlrPoly);
+
+        result.visHard    = polyhlrToShape.VCompound();
+        BRepLib::BuildCurves3d(result.visHard);
+        result.visSmooth  = polyhlrToShape.Rg1LineVCompound();
+        BRepLib::BuildCurves3d(result.visSmooth);
+        result.visSeam    = polyhlrToShape.RgNLineVCompound();
+        BRepLib::BuildCurves3d(result.visSeam);
+        result.visOutline = polyhlrToShape.OutLineVCompound();
+        BRepLib::BuildCurves3d(result.visOutline);
+
+        result.hidHard    = polyhlrToShape.HCompound();
+        BRepLib::BuildCurves3d(result.hidHard);
+        result.hidSmooth  = polyhlrToShape.Rg1LineHCompound();
+        BRepLib::BuildCurves3d(result.hidSmooth);
+        result.hidSeam    = polyhlrToShape.RgNLineHCompound();
+        BRepLib::BuildCurves3d(result.hidSeam);
+        result.hidOutline = polyhlrToShape.OutLineHCompound();
+        BRepLib::BuildCurves3d(result.hidOutline);
+    }
+    catch (const Standard_Failure& e) {
+        addError(result, "GO::projectShapeWithPolygonAlgo - OCC error - %s - while extracting edges for %s\n",
+                 e.GetMessageString(), parentName.c_str());
+    }
+    catch (...) {
+        addError(result, "GO::projectShapeWithPolygonAlgo - - error occurred while extracting edges for %s\n",
+                 parentName.c_str());
+    }
+    return result;
+}
+
+//merge the edges of the parts of a shape into one compound per category
+TopoDS_Shape mergeCompounds(const std::vector<PolygonEdges>& parts, TopoDS_Shape PolygonEdges::*category)
+{
+    if (parts.size() == 1) {
+        return parts.front().*category;
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (auto& part: parts) {
+        const TopoDS_Shape& edges = part.*category;
+        if (!edges.IsNull()) {
+            builder.Add(result, edges);
+        }
+    }
+    return result;
+}
+
+PolygonEdges mergePolygonEdges(const std::vector<PolygonEdges>& parts)
+{
+    PolygonEdges result;
+    result.visHard    = mergeCompounds(parts, &PolygonEdges::visHard);
+    result.visSmooth  = mergeCompounds(parts, &PolygonEdges::visSmooth);
+    result.visSeam    = mergeCompounds(parts, &PolygonEdges::visSeam);
+    result.visOutline = mergeCompounds(parts, &PolygonEdges::visOutline);
+    result.hidHard    = mergeCompounds(parts, &PolygonEdges::hidHard);
+    result.hidSmooth  = mergeCompounds(parts, &PolygonEdges::hidSmooth);
+    result.hidSeam    = mergeCompounds(parts, &PolygonEdges::hidSeam);
+    result.hidOutline = mergeCompounds(parts, &PolygonEdges::hidOutline);
+    for (auto& part: parts) {
+        result.failed = result.failed || part.failed;
+        result.errors.insert(result.errors.end(), part.errors.begin(), part.errors.end());
+    }
+    return result;
+}
+}
+
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj) :
     m_parentName(parent),
     m_parent(parentObj),
     m_isoCount(0),
     m_isPersp(false),
     m_focus(100.0),
-    m_usePolygonHLR(false)
+    m_usePolygonHLR(false),
+    m_partitionSolids(false),
+    m_isMeshed(false),
+    m_projectSerially(false)
 
 {
 }
@@ -148,6 +320,25 @@ const std::vector<BaseGeom *> GeometryObject::getVisibleFaceEdges(const bool smo
 
 
 
+void GeometryObject::addMessage(bool isError, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    m_messages.push_back({isError, formatMessage(format, args)});
+    va_end(args);
+}
+
+void GeometryObject::printMessages(const std::vector<Message>& messages)
+{
+    for (auto& message: messages) {
+        if (message.isError) {
+            Base::Console().Error("%s", message.text.c_str());
+        } else {
+            Base::Console().Log("%s", message.text.c_str());
+        }
+    }
+}
+
 void GeometryObject::clear()
 {
     for(std::vector<BaseGeom *>::iterator it = edgeGeom.begin(); it != edgeGeom.end(); ++it) {
@@ -179,8 +370,14 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
     clear();
 //    DrawUtil::dumpCS("GO::projectShape - VA in", viewAxis);    //debug
 
+    m_hlrKey = HLRCache::makeKey(makeShapeKey(input), viewAxis, m_isPersp, m_focus, false, m_isoCount, false);
+    if (findHLRResult()) {
+        return;
+    }
+
     auto start = chrono::high_resolution_clock::now();
 
+    bool failed = false;
     Handle(HLRBRep_Algo) brep_hlr = NULL;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -198,18 +395,20 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
 
     }
     catch (const Standard_Failure& e) {
-        Base::Console().Error("GO::projectShape - OCC error - %s - while projecting shape\n",
-                              e.GetMessageString());
+        addMessage(true, "GO::projectShape - OCC error - %s - while projecting shape\n",
+                   e.GetMessageString());
+        failed = true;
         }
     catch (...) {
-        Base::Console().Error("GeometryObject::projectShape - unknown error occurred while projecting shape\n");
+        addMessage(true, "GeometryObject::projectShape - unknown error occurred while projecting shape\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShape - unknown error occurred while projecting shape");
     }
 
     auto end   = chrono::high_resolution_clock::now();
     auto diff  = end - start;
     double diffOut = chrono::duration <double, milli> (diff).count();
-    Base::Console().Log("TIMING - %s GO spent: %.3f millisecs in HLRBRep_Algo & co\n",m_parentName.c_str(),diffOut);
+    addMessage(false, "TIMING - %s GO spent: %.3f millisecs in HLRBRep_Algo & co\n",m_parentName.c_str(),diffOut);
 
     start = chrono::high_resolution_clock::now();
 
@@ -260,17 +459,81 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
 
     }
     catch (const Standard_Failure& e) {
-        Base::Console().Error("GO::projectShape - OCC error - %s - while extracting edges\n",
-                              e.GetMessageString());
+        addMessage(true, "GO::projectShape - OCC error - %s - while extracting edges\n",
+                   e.GetMessageString());
+        failed = true;
     }
     catch (...) {
-        Base::Console().Error("GO::projectShape - unknown error while extracting edges\n");
+        addMessage(true, "GO::projectShape - unknown error while extracting edges\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShape - error occurred while extracting edges");
     }
     end   = chrono::high_resolution_clock::now();
     diff  = end - start;
     diffOut = chrono::duration <double, milli> (diff).count();
-    Base::Console().Log("TIMING - %s GO spent: %.3f millisecs in hlrToShape and BuildCurves\n",m_parentName.c_str(),diffOut);
+    addMessage(false, "TIMING - %s GO spent: %.3f millisecs in hlrToShape and BuildCurves\n",m_parentName.c_str(),diffOut);
+
+    if (!failed) {
+        HLRCache::instance().insert(m_hlrKey, getHLRResult());
+    }
+}
+
+//! the part of the HLRCache key for the projected shape
+std::string GeometryObject::makeShapeKey(const TopoDS_Shape& input) const
+{
+    if (m_hlrSources.empty()) {
+        return HLRCache::makeShapeKey(input);
+    }
+    return HLRCache::instance().makeSourceKey(m_hlrSources) + " " + m_hlrTransform;
+}
+
+//! use the result of an earlier projection with the same key
+bool GeometryObject::findHLRResult(void)
+{
+    TopoDS_Shape cached;
+    if (!HLRCache::instance().find(m_hlrKey, cached) ||
+        !setHLRResult(cached)) {
+        return false;
+    }
+    addMessage(false, "LOG - %s GO found HLR result in cache\n", m_parentName.c_str());
+    return true;
+}
+
+TopoDS_Shape GeometryObject::getHLRResult(void) const
+{
+    const TopoDS_Shape* shapes[] = { &visHard, &visOutline, &visSmooth, &visSeam, &visIso,
+                                     &hidHard, &hidOutline, &hidSmooth, &hidSeam, &hidIso };
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (auto shape: shapes) {
+        if (shape->IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(result, empty);
+        } else {
+            builder.Add(result, *shape);
+        }
+    }
+    return result;
+}
+
+//! unpack a compound made by getHLRResult
+bool GeometryObject::setHLRResult(const TopoDS_Shape& result)
+{
+    TopoDS_Shape* shapes[] = { &visHard, &visOutline, &visSmooth, &visSeam, &visIso,
+                               &hidHard, &hidOutline, &hidSmooth, &hidSeam, &hidIso };
+    std::vector<TopoDS_Shape> parts;
+    for (TopoDS_Iterator it(result); it.More(); it.Next()) {
+        parts.push_back(it.Value());
+    }
+    if (parts.size() != sizeof(shapes) / sizeof(shapes[0])) {
+        return false;
+    }
+    for (std::size_t i = 0; i < parts.size(); i++) {
+        *shapes[i] = parts[i];
+    }
+    return true;
 }
 
 //mirror a shape thru XZ plane for Qt's inverted Y coordinate
@@ -293,12 +556,30 @@ TopoDS_Shape GeometryObject::invertGeometry(const TopoDS_Shape s)
     return result;
 }
 
+//!mesh a shape for the polygon algo
+void GeometryObject::meshForPolygonAlgo(const TopoDS_Shape& input)
+{
+    try {
+        BRepMesh_IncrementalMesh(input, 0.10, false, 0.5, true); //Poly Algo requires a mesh!
+        m_isMeshed = true;
+    }
+    catch (const Standard_Failure& e) {
+        addMessage(true, "GO::meshForPolygonAlgo - OCC error - %s - while meshing shape\n",
+                   e.GetMessageString());
+    }
+}
+
 //!set up a hidden line remover and project a shape with it
 void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
                                                  const gp_Ax2 &viewAxis)
 {
     // Clear previous Geometry
     clear();
+
+    m_hlrKey = HLRCache::makeKey(makeShapeKey(input), viewAxis, m_isPersp, m_focus, true, 0, m_partitionSolids);
+    if (findHLRResult()) {
+        return;
+    }
     
     //work around for Mantis issue #3332
     //if 3332 gets fixed in OCC, this will produce shifted views and will need
@@ -316,91 +597,53 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
 
     auto start = chrono::high_resolution_clock::now();
 
-    Handle(HLRBRep_PolyAlgo) brep_hlrPoly = NULL;
-
-    try {
-        TopExp_Explorer faces(inCopy, TopAbs_FACE);
-        for (int i = 1; faces.More(); faces.Next(), i++) {
-            const TopoDS_Face& f = TopoDS::Face(faces.Current());
-            if (!f.IsNull()) {
-                BRepMesh_IncrementalMesh(f, 0.10); //Poly Algo requires a mesh!
-            }
-        }
-        brep_hlrPoly = new HLRBRep_PolyAlgo();
-        brep_hlrPoly->Load(inCopy);
-
-        if (m_isPersp) {
-            double fLength = std::max(Precision::Confusion(), m_focus);
-            HLRAlgo_Projector projector(viewAxis, fLength);
-            brep_hlrPoly->Projector(projector);
-        }
-        else { // non perspective
-            HLRAlgo_Projector projector(viewAxis);
-            brep_hlrPoly->Projector(projector);
-        }
-        brep_hlrPoly->Update();
+    //the copy for a perspective view has no mesh yet
+    if (m_isPersp || !m_isMeshed) {
+        meshForPolygonAlgo(inCopy);
     }
-    catch (const Standard_Failure& e) {
-        Base::Console().Error("GO::projectShapeWithPolygonAlgo - OCC error - %s - while projecting shape\n",
-                              e.GetMessageString());
+
+    std::vector<TopoDS_Shape> parts;
+    if (m_partitionSolids) {
+        parts = partitionBySolid(inCopy);
     }
-    catch (...) {
-        Base::Console().Error("GO::projectShapeWithPolygonAlgo - unknown error while projecting shape\n");
-//        throw Base::RuntimeError("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while projecting shape");
-//        Standard_Failure::Raise("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while projecting shape");
+    if (parts.size() < 2) {
+        parts.clear();
+        parts.push_back(inCopy);
     }
 
-    try {
-        HLRBRep_PolyHLRToShape polyhlrToShape;
-        polyhlrToShape.Update(brep_hlrPoly);
-
-        visHard    = polyhlrToShape.VCompound();
-        BRepLib::BuildCurves3d(visHard);
-        visHard = invertGeometry(visHard);
-//        BRepTools::Write(visHard, "GOvisHardi.brep");            //debug
-
-        visSmooth  = polyhlrToShape.Rg1LineVCompound();
-        BRepLib::BuildCurves3d(visSmooth);
-        visSmooth = invertGeometry(visSmooth);
-
-        visSeam    = polyhlrToShape.RgNLineVCompound();
-        BRepLib::BuildCurves3d(visSeam);
-        visSeam = invertGeometry(visSeam);
-
-        visOutline    = polyhlrToShape.OutLineVCompound();
-        BRepLib::BuildCurves3d(visOutline);
-        visOutline = invertGeometry(visOutline);
-
-        hidHard    = polyhlrToShape.HCompound();
-        BRepLib::BuildCurves3d(hidHard);
-        hidHard = invertGeometry(hidHard);
-//        BRepTools::Write(hidHard, "GOhidHardi.brep");            //debug
-
-        hidSmooth  = polyhlrToShape.Rg1LineHCompound();
-        BRepLib::BuildCurves3d(hidSmooth);
-        hidSmooth = invertGeometry(hidSmooth);
-
-        hidSeam    = polyhlrToShape.RgNLineHCompound();
-        BRepLib::BuildCurves3d(hidSeam);
-        hidSeam = invertGeometry(hidSeam);
-
-        hidOutline = polyhlrToShape.OutLineHCompound();
-        BRepLib::BuildCurves3d(hidOutline);
-        hidOutline = invertGeometry(hidOutline);
-    }
-    catch (const Standard_Failure& e) {
-        Base::Console().Error("GO::projectShapeWithPolygonAlgo - OCC error - %s - while extracting edges\n",
-                              e.GetMessageString());
+    std::vector<PolygonEdges> results(parts.size());
+    auto project = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            results[i] = projectWithPolygonAlgo(parts[i], viewAxis, m_isPersp, m_focus, m_parentName);
+        }
+    };
+    if (m_projectSerially) {
+        project(0, parts.size());
+    } else {
+        Base::parallel_for(parts.size(), std::size_t(1), project);
     }
-    catch (...) {
-        Base::Console().Error("GO::projectShapeWithPolygonAlgo - - error occurred while extracting edges\n");
-//        throw Base::RuntimeError("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while extracting edges");
-//        Standard_Failure::Raise("GeometryObject::projectShapeWithPolygonAlgo - error occurred while extracting edges");
+
+    PolygonEdges merged = mergePolygonEdges(results);
+    m_messages.insert(m_messages.end(), merged.errors.begin(), merged.errors.end());
+    visHard = invertGeometry(merged.visHard);
+    visSmooth = invertGeometry(merged.visSmooth);
+    visSeam = invertGeometry(merged.visSeam);
+    visOutline = invertGeometry(merged.visOutline);
+    hidHard = invertGeometry(merged.hidHard);
+    hidSmooth = invertGeometry(merged.hidSmooth);
+    hidSeam = invertGeometry(merged.hidSeam);
+    hidOutline = invertGeometry(merged.hidOutline);
+    visIso = TopoDS_Shape();
+    hidIso = TopoDS_Shape();
+    if (!merged.failed) {
+        HLRCache::instance().insert(m_hlrKey, getHLRResult());
     }
+
     auto end = chrono::high_resolution_clock::now();
     auto diff = end - start;
     double diffOut = chrono::duration <double, milli>(diff).count();
-    Base::Console().Log("TIMING - %s GO spent: %.3f millisecs in HLRBRep_PolyAlgo & co\n", m_parentName.c_str(), diffOut);
+    addMessage(false, "TIMING - %s GO spent: %.3f millisecs in HLRBRep_PolyAlgo & co (%d parts)\n",
+               m_parentName.c_str(), diffOut, static_cast<int>(parts.size()));
 }
 
 TopoDS_Shape GeometryObject::projectFace(const TopoDS_Shape &face,
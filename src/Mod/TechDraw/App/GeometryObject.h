@@ -114,8 +114,30 @@ public:
 
     void projectShape(const TopoDS_Shape &input,
                       const gp_Ax2 &viewAxis);
+    //! the key of the last projection in the HLRCache
+    std::string getHLRKey(void) const { return m_hlrKey; }
+    //! key the HLRCache on the shapes the projected shape is made from and on a description
+    //! of how it is made from them. this is cheaper than hashing the projected shape.
+    void setHLRSource(const std::vector<TopoDS_Shape>& sources, const std::string& transform)
+        { m_hlrSources = sources; m_hlrTransform = transform; }
+    //! the edge compounds of the last projection packed into one compound
+    TopoDS_Shape getHLRResult(void) const;
     void projectShapeWithPolygonAlgo(const TopoDS_Shape &input,
                                      const gp_Ax2 &viewAxis);
+    //! mesh the shape for projectShapeWithPolygonAlgo. the mesh is stored in the shape, so
+    //! this must not run concurrently for shapes sharing faces.
+    void meshForPolygonAlgo(const TopoDS_Shape &input);
+
+    //! console output of the projection. projections may run on worker threads, so
+    //! they collect their output to be printed on the main thread by printMessages.
+    struct Message {
+        bool isError;
+        std::string text;
+    };
+    std::vector<Message> takeMessages(void) { std::vector<Message> result; result.swap(m_messages); return result; }
+    static void printMessages(const std::vector<Message>& messages);
+    //! don't use more threads for the projection, e.g. when running on a worker thread
+    void projectSerially(bool b) { m_projectSerially = b; }
     TopoDS_Shape projectFace(const TopoDS_Shape &face,
                              const gp_Ax2 &CS);
 
@@ -123,11 +145,15 @@ public:
     void addFaceGeom(Face * f);
     void clearFaceGeom();
     void setIsoCount(int i) { m_isoCount = i; }
+    int getIsoCount(void) const { return m_isoCount; }
     void setParentName(std::string n);                          //for debug messages
     void isPerspective(bool b) { m_isPersp = b; }
     bool isPerspective(void) { return m_isPersp; }
     void usePolygonHLR(bool b) { m_usePolygonHLR = b; }
     bool usePolygonHLR(void) const { return m_usePolygonHLR; }
+    //! project the solids separately with the polygon algo. solids don't hide each other then.
+    void partitionSolids(bool b) { m_partitionSolids = b; }
+    bool partitionSolids(void) const { return m_partitionSolids; }
     void setFocus(double f) { m_focus = f; }
     double getFocus(void) { return m_focus; }
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -182,6 +208,10 @@ protected:
     TopoDS_Shape hidIso;
 
     void addGeomFromCompound(TopoDS_Shape edgeCompound, edgeClass category, bool visible);
+    bool setHLRResult(const TopoDS_Shape& result);
+    bool findHLRResult(void);
+    std::string makeShapeKey(const TopoDS_Shape& input) const;
+    void addMessage(bool isError, const char* format, ...);
     TechDraw::DrawViewDetail* isParentDetail(void);
 
     //similar function in Geometry?
@@ -204,6 +234,13 @@ protected:
     bool m_isPersp;
     double m_focus;
     bool m_usePolygonHLR;
+    bool m_partitionSolids;
+    bool m_isMeshed;
+    bool m_projectSerially;
+    std::string m_hlrKey;
+    std::vector<TopoDS_Shape> m_hlrSources;
+    std::string m_hlrTransform;
+    std::vector<Message> m_messages;
 };
 
 } //namespace TechDraw
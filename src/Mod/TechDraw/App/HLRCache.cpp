@@ -0,0 +1,262 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepTools.hxx>
+#include <gp_Ax2.hxx>
+#include <Standard_Version.hxx>
+#endif
+
+#if OCC_VERSION_HEX >= 0x070600
+#include <TopTools_FormatVersion.hxx>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+
+#include <App/Application.h>
+
+#include "Preferences.h"
+#include "HLRCache.h"
+
+using namespace TechDraw;
+
+namespace {
+//computes the FNV-1a hash of the bytes written to it
+class HashBuffer : public std::streambuf
+{
+public:
+    HashBuffer() : hash(14695981039346656037ULL) {}
+    uint64_t getHash() const { return hash; }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            add(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        for (std::streamsize i = 0; i < n; i++) {
+            add(s[i]);
+        }
+        return n;
+    }
+
+private:
+    void add(char c)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    uint64_t hash;
+};
+
+//number of kept source hashes
+const std::size_t maxSourceHashes = 64;
+
+uint64_t hashShape(const TopoDS_Shape& shape)
+{
+    HashBuffer buffer;
+    std::ostream out(&buffer);
+    //leave out the mesh, the polygon algo adds it to the shape
+#if OCC_VERSION_HEX >= 0x070600
+    BRepTools::Write(shape, out, Standard_False, Standard_False, TopTools_FormatVersion_CURRENT);
+#else
+    BRepBuilderAPI_Copy copy(shape);
+    BRepTools::Write(copy.Shape(), out);
+#endif
+    return buffer.getHash();
+}
+
+std::string toHex(uint64_t hash)
+{
+    std::stringstream builder;
+    builder << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return builder.str();
+}
+}
+
+HLRCache& HLRCache::instance()
+{
+    static HLRCache cache;
+    return cache;
+}
+
+HLRCache::HLRCache() :
+    maxSize(static_cast<std::size_t>(std::max(0, Preferences::hlrCacheSize())))
+{
+    //don't keep the results and the source shapes of closed documents
+    App::GetApplication().signalDeleteDocument.connect([this](const App::Document&) {
+        clear();
+    });
+}
+
+std::string HLRCache::makeShapeKey(const TopoDS_Shape& shape)
+{
+    return toHex(hashShape(shape));
+}
+
+std::string HLRCache::makeSourceKey(const std::vector<TopoDS_Shape>& sources)
+{
+    //FNV-1a of the source hashes
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto& source: sources) {
+        uint64_t sourceHash = source.IsNull() ? 0 : hashSource(source);
+        for (int i = 0; i < 8; i++) {
+            hash ^= (sourceHash >> (8 * i)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return "S" + toHex(hash);
+}
+
+uint64_t HLRCache::hashSource(const TopoDS_Shape& shape)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = sourceHashes.begin(); it != sourceHashes.end(); ++it) {
+            if (it->first.IsEqual(shape)) {
+                sourceHashes.splice(sourceHashes.begin(), sourceHashes, it);
+                return it->second;
+            }
+        }
+    }
+
+    //hash without holding the lock, another thread may hash the same shape meanwhile
+    uint64_t hash = hashShape(shape);
+    std::lock_guard<std::mutex> lock(mutex);
+    sourceHashes.emplace_front(shape, hash);
+    if (sourceHashes.size() > maxSourceHashes) {
+        sourceHashes.pop_back();
+    }
+    return hash;
+}
+
+std::string HLRCache::makeKey(const std::string& shapeKey, const gp_Ax2& viewAxis,
+                              bool perspective, double focus, bool polygonHLR,
+                              int isoCount, bool partitionSolids)
+{
+    std::stringstream builder;
+    builder << shapeKey;
+    builder << std::setprecision(12);
+    const gp_Pnt& loc = viewAxis.Location();
+    const gp_Dir& dir = viewAxis.Direction();
+    const gp_Dir& xDir = viewAxis.XDirection();
+    builder << " " << loc.X() << " " << loc.Y() << " " << loc.Z();
+    builder << " " << dir.X() << " " << dir.Y() << " " << dir.Z();
+    builder << " " << xDir.X() << " " << xDir.Y() << " " << xDir.Z();
+    if (perspective) {
+        builder << " P" << focus;
+    }
+    if (polygonHLR) {
+        builder << (partitionSolids ? " PS" : " PA");
+    }
+    else {
+        builder << " E" << isoCount;
+    }
+    return builder.str();
+}
+
+bool HLRCache::find(const std::string& key, TopoDS_Shape& result)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    result = it->second->second;
+    return true;
+}
+
+void HLRCache::insert(const std::string& key, const TopoDS_Shape& result)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (maxSize == 0) {
+        return;
+    }
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->second = result;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    entries.emplace_front(key, result);
+    index[key] = entries.begin();
+    shrink();
+}
+
+void HLRCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+    sourceHashes.clear();
+}
+
+void HLRCache::setMaxSize(std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxSize = size;
+    shrink();
+}
+
+std::size_t HLRCache::getMaxSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxSize;
+}
+
+std::size_t HLRCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::vector<std::string> HLRCache::keys() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> result;
+    for (auto& entry: entries) {
+        result.push_back(entry.first);
+    }
+    return result;
+}
+
+void HLRCache::shrink()
+{
+    while (entries.size() > maxSize) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
@@ -0,0 +1,101 @@
+/***************************************************************************
+ *   Copyright (c) 2021 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef _TechDraw_HLRCache_h_
+#define _TechDraw_HLRCache_h_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+class gp_Ax2;
+
+namespace TechDraw
+{
+
+/**
+ * The HLRCache keeps the edge compounds found by the hidden line removal, so a view
+ * doesn't project its shape again when only e.g. its label changes, or when another
+ * view shows the same shape in the same direction.
+ *
+ * A result is stored as a compound of the visible and hidden edge compounds, see
+ * GeometryObject::getHLRResult(). Its key is made from a hash of the content of the
+ * projected shape and the projection parameters. The cache holds a limited number of
+ * results and drops the least recently used one when it is full.
+ *
+ * Hashing the content of a shape means writing it as BRep text. A part view projects
+ * a transformed copy of its sources, so instead it uses a key made from the hashes of
+ * the sources and the transformation. These hashes are kept as long as the source
+ * shapes are used, so the sources aren't written again for every projection.
+ * The cache is cleared when a document is closed.
+ */
+class TechDrawExport HLRCache
+{
+public:
+    static HLRCache& instance();
+
+    /// Returns a key for the content of \a shape
+    static std::string makeShapeKey(const TopoDS_Shape& shape);
+    /// Returns a key for the content of \a sources, using the kept hashes of known shapes
+    std::string makeSourceKey(const std::vector<TopoDS_Shape>& sources);
+    /// Returns the key of the projection of the shape with \a shapeKey with the given parameters
+    static std::string makeKey(const std::string& shapeKey, const gp_Ax2& viewAxis,
+                               bool perspective, double focus, bool polygonHLR,
+                               int isoCount, bool partitionSolids);
+
+    /// Returns true and sets \a result if there is a result for \a key
+    bool find(const std::string& key, TopoDS_Shape& result);
+    void insert(const std::string& key, const TopoDS_Shape& result);
+    void clear();
+
+    /// Sets the number of results to keep, 0 disables the cache
+    void setMaxSize(std::size_t);
+    std::size_t getMaxSize() const;
+    std::size_t size() const;
+    /// Returns the keys of the results, the most recently used first
+    std::vector<std::string> keys() const;
+
+private:
+    HLRCache();
+    void shrink();
+    uint64_t hashSource(const TopoDS_Shape& shape);
+
+private:
+    typedef std::list<std::pair<std::string, TopoDS_Shape> > EntryList;
+
+    mutable std::mutex mutex;
+    EntryList entries;                  //most recently used first
+    std::unordered_map<std::string, EntryList::iterator> index;
+    std::size_t maxSize;
+    //the hashes of the last used source shapes, holding the shapes keeps their TShapes unique
+    std::list<std::pair<TopoDS_Shape, uint64_t> > sourceHashes;
+};
+
+} //namespace TechDraw
+
+#endif // _TechDraw_HLRCache_h_
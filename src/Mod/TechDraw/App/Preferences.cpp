@@ -148,6 +148,46 @@ bool Preferences::keepPagesUpToDate()
     return autoUpdate;
 }
 
+//run the hidden line removal of the views of a page on worker threads
+bool Preferences::parallelHLR()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    bool result = hGrp->GetBool("ParallelHLR", true);
+    return result;
+}
+
+//project the solids of a coarse view separately. solids don't hide each other then.
+bool Preferences::partitionPolygonHLR()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    bool result = hGrp->GetBool("PartitionPolygonHLR", false);
+    return result;
+}
+
+//number of HLR results kept in memory, 0 disables the cache
+int Preferences::hlrCacheSize()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    int result = hGrp->GetInt("HLRCacheSize", 64);
+    return result;
+}
+
+//store the HLR result of a view in the document, so it isn't projected again on opening
+bool Preferences::saveHLRCache()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    bool result = hGrp->GetBool("SaveHLRCache", false);
+    return result;
+}
+
 bool Preferences::useGlobalDecimals()
 {
     bool result = false;
@@ -57,6 +57,10 @@ static double      vertexScale();
 
 static bool        useGlobalDecimals();
 static bool        keepPagesUpToDate();
+static bool        parallelHLR();
+static bool        partitionPolygonHLR();
+static int         hlrCacheSize();
+static bool        saveHLRCache();
 
 static int         projectionAngle();
 static int         lineGroup();
@@ -0,0 +1,90 @@
+#***************************************************************************
+#*   Copyright (c) 2021 FreeCAD Developers                                 *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#***************************************************************************
+
+"""Times the face detection steps of TechDraw on sheet metal like shapes.
+
+    import TechDrawBenchmark
+    TechDrawBenchmark.run()
+
+Perforated plates, bent brackets with slots and assemblies of both are
+passed in the usual view directions to TechDraw.findShapeOutline. It
+projects the shape, splits the edges at the vertices of other edges, removes
+duplicate edges and walks the edge graph, as a DrawViewPart does to find
+its faces.
+"""
+
+import time
+import FreeCAD, Part, TechDraw
+
+App = FreeCAD
+
+def makePlate(holes=10):
+    """Return a plate with a grid of holes x holes holes."""
+    plate = Part.makeBox(5.0 * holes, 5.0 * holes, 1)
+    cylinders = []
+    for i in range(holes):
+        for j in range(holes):
+            cylinders.append(Part.makeCylinder(1, 3, App.Vector(2.5 + 5 * i, 2.5 + 5 * j, -1)))
+    return plate.cut(Part.makeCompound(cylinders))
+
+def makeBracket(slots=10):
+    """Return an L shaped bracket with a row of slots in both flanges."""
+    length = 6.0 * slots
+    bracket = Part.makeBox(length, 20, 1).fuse(Part.makeBox(length, 1, 20))
+    tools = []
+    for i in range(slots):
+        x = 3 + 6 * i
+        tools.append(Part.makeBox(2, 8, 3, App.Vector(x - 1, 6, -1)))
+        tools.append(Part.makeBox(2, 3, 8, App.Vector(x - 1, -1, 6)))
+    return bracket.cut(Part.makeCompound(tools)).removeSplitter()
+
+def makeAssembly(count=4, holes=10):
+    """Return a compound of plates and brackets in a row."""
+    parts = []
+    for n in range(count):
+        plate = makePlate(holes)
+        plate.translate(App.Vector(0, 0, 30 * n))
+        bracket = makeBracket(holes)
+        bracket.translate(App.Vector(0, 5.0 * holes, 30 * n))
+        parts.extend([plate, bracket])
+    return Part.makeCompound(parts)
+
+def makeCorpus(size=10):
+    """Return a list of (name, shape) of sample shapes"""
+    return [("Plate", makePlate(size)),
+            ("Bracket", makeBracket(size)),
+            ("Assembly", makeAssembly(4, size))]
+
+def run(size=10):
+    """Print the time to find the outline of the sample shapes in the front,
+    top, right and isometric direction"""
+    directions = [("Front", App.Vector(0, -1, 0)),
+                  ("Top", App.Vector(0, 0, 1)),
+                  ("Right", App.Vector(1, 0, 0)),
+                  ("Iso", App.Vector(1, -1, 1))]
+    App.Console.PrintMessage("%10s %8s %8s %10s\n" % ("shape", "edges", "view", "time [s]"))
+    for name, shape in makeCorpus(size):
+        for view, direction in directions:
+            start = time.time()
+            TechDraw.findShapeOutline(shape, 1.0, direction)
+            elapsed = time.time() - start
+            App.Console.PrintMessage("%10s %8d %8s %10.3f\n" % (name, len(shape.Edges), view, elapsed))
@@ -23,6 +23,7 @@
 import FreeCAD, os, sys, unittest, Part
 import Measure
 import TechDraw
+import tempfile
 import time
 App = FreeCAD
 
@@ -95,3 +96,80 @@ class TechDrawTestCases(unittest.TestCase):
             print("TD DrawViewBalloon test passed")
         else:
             print("TD DrawViewBalloon test failed")
+
+
+class TechDrawHLRCacheTestCases(unittest.TestCase):
+    def setUp(self):
+        self.hGrp = App.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        self.cacheSize = self.hGrp.GetInt("HLRCacheSize", 64)
+        self.saveCache = self.hGrp.GetBool("SaveHLRCache", False)
+        # the views store their key in the hidden property HLRCacheKey
+        self.hGrp.SetBool("SaveHLRCache", True)
+        self.doc = App.newDocument("TDHLRCache")
+        self.box = self.doc.addObject("Part::Box", "Box")
+        self.page = self.doc.addObject("TechDraw::DrawPage", "Page")
+        template = self.doc.addObject("TechDraw::DrawSVGTemplate", "Template")
+        template.Template = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                         "TDTest", "TestTemplate.svg")
+        self.page.Template = template
+        TechDraw.clearHLRCache()
+
+    def tearDown(self):
+        App.closeDocument(self.doc.Name)
+        self.hGrp.SetInt("HLRCacheSize", self.cacheSize)
+        self.hGrp.SetBool("SaveHLRCache", self.saveCache)
+
+    def addView(self, name, direction):
+        view = self.doc.addObject("TechDraw::DrawViewPart", name)
+        self.page.addView(view)
+        view.Source = [self.box]
+        view.Direction = direction
+        self.doc.recompute()
+        self.assertTrue(view.HLRCacheKey)
+        return view
+
+    def testLeastRecentlyUsed(self):
+        self.hGrp.SetInt("HLRCacheSize", 2)
+        top = self.addView("Top", App.Vector(0, 0, 1))
+        front = self.addView("Front", App.Vector(0, -1, 0))
+        right = self.addView("Right", App.Vector(1, 0, 0))
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [right.HLRCacheKey, front.HLRCacheKey])
+
+        # projecting again uses the cached result and makes it the most recently used
+        front.touch()
+        self.doc.recompute()
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [front.HLRCacheKey, right.HLRCacheKey])
+
+        # the least recently used result is dropped
+        top.touch()
+        self.doc.recompute()
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [top.HLRCacheKey, front.HLRCacheKey])
+
+        # a changed source gets a new key
+        key = top.HLRCacheKey
+        self.box.Length = 20
+        self.doc.recompute()
+        self.assertNotEqual(top.HLRCacheKey, key)
+
+    def testRestoreFromDocument(self):
+        view = self.addView("View", App.Vector(0, 0, 1))
+        key = view.HLRCacheKey
+        edges = len(view.getVisibleEdges())
+        self.assertFalse(view.HLRCacheResult.isNull())
+
+        fileName = os.path.join(tempfile.gettempdir(), "TDHLRCache.FCStd")
+        self.doc.saveAs(fileName)
+        App.closeDocument(self.doc.Name)
+        # closing a document clears the cache
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [])
+
+        self.doc = App.openDocument(fileName)
+        os.remove(fileName)
+        view = self.doc.getObject("View")
+        # the saved result is put back into the cache and used by the next projection
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [key])
+        view.touch()
+        self.doc.recompute()
+        self.assertEqual(view.HLRCacheKey, key)
+        self.assertEqual(len(view.getVisibleEdges()), edges)
+        self.assertEqual(TechDraw.getHLRCacheKeys(), [key])
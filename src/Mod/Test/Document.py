@@ -21,7 +21,7 @@
 #*                                                                         *
 #***************************************************************************/
 
-import FreeCAD, os, unittest, tempfile
+import FreeCAD, os, unittest, tempfile, zipfile
 import math
 
 #---------------------------------------------------------------------------
@@ -606,6 +606,44 @@ class DocumentRecomputeCases(unittest.TestCase):
     self.Doc.removeObject(L7.Name)
     self.Doc.removeObject(L8.Name)
 
+  def testConcurrentRecompute(self):
+    param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Document")
+    concurrent = param.GetBool("ConcurrentRecompute", False)
+    param.SetBool("ConcurrentRecompute", True)
+    try:
+      # two independent chains and a common root
+      #       L1
+      #      /  \
+      #    L2    L3
+      #     |     |
+      #    L4    L5
+      L1 = self.Doc.addObject("App::FeatureTest","Label_1")
+      L2 = self.Doc.addObject("App::FeatureTest","Label_2")
+      L3 = self.Doc.addObject("App::FeatureTest","Label_3")
+      L4 = self.Doc.addObject("App::FeatureTest","Label_4")
+      L5 = self.Doc.addObject("App::FeatureTest","Label_5")
+      L1.LinkList = [L2,L3]
+      L2.Link = L4
+      L3.Link = L5
+
+      self.assertEqual(self.Doc.recompute(), 5)
+      self.assertEqual((1, 1, 1, 1, 1), (L1.ExecCount,L2.ExecCount,L3.ExecCount,L4.ExecCount,L5.ExecCount))
+      L4.enforceRecompute()
+      self.assertEqual(self.Doc.recompute(), 3)
+      self.assertEqual((2, 2, 1, 2, 1), (L1.ExecCount,L2.ExecCount,L3.ExecCount,L4.ExecCount,L5.ExecCount))
+
+      # a failing object must prevent the recompute of its dependents only
+      L5.ExceptionType = 1
+      L5.enforceRecompute()
+      L4.enforceRecompute()
+      self.Doc.recompute()
+      self.assertEqual((2, 3, 1, 3, 1), (L1.ExecCount,L2.ExecCount,L3.ExecCount,L4.ExecCount,L5.ExecCount))
+      L5.ExceptionType = 0
+      self.Doc.recompute()
+      self.assertEqual((3, 3, 2, 3, 2), (L1.ExecCount,L2.ExecCount,L3.ExecCount,L4.ExecCount,L5.ExecCount))
+    finally:
+      param.SetBool("ConcurrentRecompute", concurrent)
+
   def tearDown(self):
     #closing doc
     FreeCAD.closeDocument("RecomputeTests")
@@ -1310,6 +1348,35 @@ class DocumentFileIncludeCases(unittest.TestCase):
     self.failUnless(os.path.exists(L5.File))
     FreeCAD.closeDocument("Doc2")
 
+  def testStoredAndDeflatedFiles(self):
+    # the files are compressed in memory and written to the archive as raw entries
+    contents = {"Image.png" : os.urandom(50000),
+                "Random.bin" : os.urandom(50000),
+                "Text.txt" : b"test No3\n" * 5000}
+    for i, name in enumerate(sorted(contents)):
+      obj = self.Doc.addObject("App::DocumentObjectFileIncluded","FileObject%d" % i)
+      with open(self.Doc.getTempFileName("test"),"wb") as file:
+        file.write(contents[name])
+      obj.File = (file.name,name)
+
+    FileName = tempfile.gettempdir() + os.sep + "FileIncludeTests.FCStd"
+    self.Doc.saveAs(FileName)
+    with zipfile.ZipFile(FileName) as archive:
+      self.failUnless(archive.testzip() is None)
+      # compressed formats and data that doesn't get smaller are stored
+      self.failUnless(archive.getinfo("Image.png").compress_type == zipfile.ZIP_STORED)
+      self.failUnless(archive.getinfo("Random.bin").compress_type == zipfile.ZIP_STORED)
+      self.failUnless(archive.getinfo("Text.txt").compress_type == zipfile.ZIP_DEFLATED)
+      for name, data in contents.items():
+        self.failUnless(archive.read(name) == data)
+
+    FreeCAD.closeDocument("FileIncludeTests")
+    self.Doc = FreeCAD.open(FileName)
+    for i, name in enumerate(sorted(contents)):
+      with open(self.Doc.getObject("FileObject%d" % i).File,"rb") as file:
+        self.failUnless(file.read() == contents[name])
+    os.remove(FileName)
+
 
   def tearDown(self):
     #closing doc
@@ -1406,6 +1473,61 @@ class DocumentExpressionCases(unittest.TestCase):
     # must not raise a topological error
     self.assertEqual(self.Doc.recompute(), 2)
 
+  def testNumericExpression(self):
+    # numeric expressions are evaluated without Python, check that the result
+    # is the same as evaluated by Python
+    name = self.Obj1.Name
+    self.Obj1.Integer = 7
+    self.Obj1.Float = 2.5
+    self.Obj1.Distance = 3
+    self.Obj2.setExpression('Integer', u'%s.Integer * 2 + 1' % name)
+    self.Obj2.setExpression('Float', u'%s.Integer > 5 ? %s.Integer / 2 : -%s.Float' % (name, name, name))
+    self.Obj2.setExpression('Distance', u'%s.Distance * 2 + 1 mm' % name)
+    self.Obj2.setExpression('Angle', u'atan2(%s.Float, %s.Float) + 2^3 * 1 deg' % (name, name))
+    self.Doc.recompute()
+    self.assertEqual(self.Obj2.Integer, 15)
+    self.assertAlmostEqual(self.Obj2.Float, 3.5)
+    self.assertAlmostEqual(self.Obj2.Distance.Value, 7.0)
+    self.assertAlmostEqual(self.Obj2.Angle.Value, 53.0)
+
+    self.Obj1.Integer = 3
+    self.Doc.recompute()
+    self.assertEqual(self.Obj2.Integer, 7)
+    self.assertAlmostEqual(self.Obj2.Float, -2.5)
+
+    # comparisons give booleans, also when bound to a number
+    self.Obj2.setExpression('Bool', u'%s.Integer < 5' % name)
+    self.Obj2.setExpression('ConstraintInt', u'%s.Integer < 5' % name)
+    self.Doc.recompute()
+    self.assertIs(self.Obj2.Bool, True)
+    self.assertEqual(self.Obj2.ConstraintInt, 1)
+    self.Obj1.Integer = 5
+    self.Doc.recompute()
+    self.assertIs(self.Obj2.Bool, False)
+    self.assertEqual(self.Obj2.ConstraintInt, 0)
+    self.Obj2.setExpression('Bool', None)
+    self.Obj2.setExpression('ConstraintInt', None)
+
+    # a reference by label must follow the relabeled object
+    self.Obj1.Label = 'Source'
+    self.Obj2.setExpression('Float', u'<<Source>>.Float * 2')
+    self.Doc.recompute()
+    self.assertAlmostEqual(self.Obj2.Float, 5.0)
+    self.Obj1.Label = 'Target'
+    self.Obj1.Float = 4
+    self.Doc.recompute()
+    self.assertAlmostEqual(self.Obj2.Float, 8.0)
+
+    # a unit mismatch is an error as in Python, the property keeps its value
+    for expr in (u'%s.Distance + 1', u'%s.Distance - %s.Angle', u'%s.Distance < 1 deg'):
+      self.Obj2.Distance = 2
+      self.Obj2.setExpression('Distance', expr.replace('%s', name))
+      self.Doc.recompute()
+      self.assertIn('Invalid', self.Obj2.State)
+      self.assertAlmostEqual(self.Obj2.Distance.Value, 2.0)
+      self.Obj2.setExpression('Distance', None)
+      self.Doc.recompute()
+
   def tearDown(self):
     #closing doc
     FreeCAD.closeDocument(self.Doc.Name)
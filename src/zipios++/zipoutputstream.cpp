@@ -55,6 +55,10 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
   putNextEntry( ZipCDirEntry(entryName));
 }
 
+void ZipOutputStream::putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) {
+  ozf->putRawEntry( entry, data, size ) ;
+}
+
 
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
@@ -54,6 +54,10 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Writes an entry whose data is already compressed, see
+      ZipOutputStreambuf::putRawEntry(). */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
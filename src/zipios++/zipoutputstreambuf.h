@@ -49,6 +49,14 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry whose data is already compressed with the method of
+      the entry. The method, the crc, the size and the compressed size of the
+      entry must be set, the compressed size must match \a size.
+      @param entry the entry to write.
+      @param data the raw data of the entry as it is written to the archive.
+      @param size the number of bytes of data. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 